@@ -2,6 +2,7 @@
 #define _PAL_CUSTOM_H_
 
 #include "cy_gpio.h"
+#include "pal_i2c.h"
 #include "usb_i2c.h"
 #include "../app_version.h"
 
@@ -16,4 +17,139 @@ typedef struct cy_stc_gpio_ctx cy_stc_gpio_ctx_t;
 /* Address of slave Optiga Trust M device */
 #define OPTIGA_FX_ADDR              0x30
 
+/*
+ * Number of Optiga Trust M devices on SCB0. Only 1 is supported: the OPTIGA host library defines the
+ * IFX I2C context of instance 0 only, bound to optiga_pal_i2c_context_0, and the PAL serves every chip
+ * through one bus client and one transfer in flight. The PAL tables are indexed by chip so that more
+ * can be added once the library binds further contexts, the application itself serves chip 0 only.
+ */
+#ifndef OPTIGA_NUM_CHIPS
+#define OPTIGA_NUM_CHIPS            (1u)
+#endif
+#if (OPTIGA_NUM_CHIPS != 1)
+#error "OPTIGA_NUM_CHIPS must be 1, the OPTIGA host library binds optiga_pal_i2c_context_0 only"
+#endif
+
+/* PAL contexts of every chip, indexed by chip. */
+extern pal_i2c_t * const optiga_pal_i2c_contexts[OPTIGA_NUM_CHIPS];
+
+/* Events pal_os_event_create() can hand out at the same time, two per chip: the one of the OPTIGA stack
+ * driving it and the one timing the long retry backoffs of its PAL I2C. */
+#ifndef PAL_OS_EVENT_POOL_SIZE
+#define PAL_OS_EVENT_POOL_SIZE      (2u * OPTIGA_NUM_CHIPS)
+#endif
+
+/* Delays up to this many microseconds are spun by the pal_os_event dispatcher instead of re-arming a timer. */
+#ifndef PAL_OS_EVENT_SPIN_US
+#define PAL_OS_EVENT_SPIN_US        (50u)
+#endif
+
+/*
+ * pal_os_event delays shorter than an RTOS tick are timed by a TCPWM counter when PAL_OS_EVENT_HW_TIMER_EN
+ * is set. The counter is clocked at 1 MHz through the given 16 bit divider (divider 3 is taken by SCB0).
+ */
+#ifndef PAL_OS_EVENT_HW_TIMER_EN
+#define PAL_OS_EVENT_HW_TIMER_EN    (0u)
+#endif
+#if PAL_OS_EVENT_HW_TIMER_EN
+#ifndef PAL_OS_EVENT_TCPWM_BASE
+#define PAL_OS_EVENT_TCPWM_BASE     TCPWM0
+#endif
+#ifndef PAL_OS_EVENT_TCPWM_CNT
+#define PAL_OS_EVENT_TCPWM_CNT      (0u)
+#endif
+#ifndef PAL_OS_EVENT_TCPWM_DIV
+#define PAL_OS_EVENT_TCPWM_DIV      (4u)
+#endif
+#ifndef PAL_OS_EVENT_TCPWM_IRQ
+#define PAL_OS_EVENT_TCPWM_IRQ      (tcpwm_0_interrupts_0_IRQn + PAL_OS_EVENT_TCPWM_CNT)
+#endif
+/* Hands the expiry to the RTOS, so it must not be more urgent than configMAX_SYSCALL_INTERRUPT_PRIORITY. */
+#ifndef PAL_OS_EVENT_TCPWM_INTR_PRIORITY
+#define PAL_OS_EVENT_TCPWM_INTR_PRIORITY (3u)
+#endif
+#endif /* PAL_OS_EVENT_HW_TIMER_EN */
+
+/*
+ * With PAL_OS_EVENT_TASK_EN the OPTIGA stack runs in its own service task, woken by direct task
+ * notifications, instead of in the RTOS timer task shared with the USB timers.
+ */
+#ifndef PAL_OS_EVENT_TASK_EN
+#define PAL_OS_EVENT_TASK_EN        (0u)
+#endif
+#ifndef PAL_OS_EVENT_TASK_PRIORITY
+#define PAL_OS_EVENT_TASK_PRIORITY  (configMAX_PRIORITIES - 2)
+#endif
+#ifndef PAL_OS_EVENT_TASK_STACK
+#define PAL_OS_EVENT_TASK_STACK     (1024u)
+#endif
+/* Transfer completions which may wait for the service task at the same time. */
+#ifndef PAL_OS_EVENT_PEND_DEPTH
+#define PAL_OS_EVENT_PEND_DEPTH     (4u)
+#endif
+
+/* Run function in the task context of the OPTIGA stack, from an interrupt. Returns pdFAIL when it cannot be queued. */
+BaseType_t pal_os_event_pend_function_call_from_isr(PendedFunction_t function, void * p_arg, uint32_t arg,
+                                                    BaseType_t * p_higher_priority_task_woken);
+
+/* I2C bitrate in KHz achieved by the last pal_i2c_set_bitrate() or bitrate fall back. */
+uint16_t pal_i2c_get_bitrate(void);
+
+/* Transfer direction a retry policy applies to. */
+typedef enum pal_i2c_retry_dir
+{
+    PAL_I2C_RETRY_WRITE = 0,
+    PAL_I2C_RETRY_READ,
+    PAL_I2C_RETRY_DIR_COUNT
+} pal_i2c_retry_dir_t;
+
+/* How a failed I2C transfer is retried. Nothing is delayed once a transfer succeeds. */
+typedef struct pal_i2c_retry_policy
+{
+    uint8_t  max_attempts;                      /* Attempts including the first one, at least 1. */
+    uint16_t initial_backoff_us;                /* Wait after the first failure, doubled after each further one. */
+    uint16_t max_backoff_us;                    /* Upper bound of the doubled wait. */
+    uint16_t jitter_us;                         /* Random 0..jitter_us added to every wait. */
+    uint16_t yield_threshold_us;                /* Waits at least this long are timed by pal_os_event instead of spun. */
+} pal_i2c_retry_policy_t;
+
+/* Counters of one retry policy, for tuning under load. */
+typedef struct pal_i2c_retry_stats
+{
+    uint32_t transfers;                         /* Transfers requested by the IFX I2C layer. */
+    uint32_t retries;                           /* Additional attempts made. */
+    uint32_t failures;                          /* Transfers which failed after the last attempt. */
+    uint32_t spin_waits;                        /* Backoffs spent in Cy_SysLib_DelayUs. */
+    uint32_t yield_waits;                       /* Backoffs handed to pal_os_event, leaving the task free. */
+    uint32_t backoff_us;                        /* Total time spent backing off. */
+} pal_i2c_retry_stats_t;
+
+void pal_i2c_set_retry_policy(pal_i2c_retry_dir_t dir, const pal_i2c_retry_policy_t * p_policy);
+void pal_i2c_get_retry_stats(pal_i2c_retry_dir_t dir, pal_i2c_retry_stats_t * p_stats);
+void pal_i2c_clear_retry_stats(void);
+
+/* Write p_wr_data then read length bytes into p_data in one transaction, the read started with a
+ * repeated START. Completion is reported once, for the read, like pal_i2c_read(). */
+pal_status_t pal_i2c_write_read(const pal_i2c_t * p_i2c_context, uint8_t * p_wr_data, uint16_t wr_length,
+                                uint8_t * p_data, uint16_t length);
+
+/* Counters of the combined write/read transactions, cleared by pal_i2c_clear_retry_stats(). */
+typedef struct pal_i2c_combined_stats
+{
+    uint32_t transfers;                         /* Combined transactions started. */
+    uint32_t failures;                          /* Combined transactions which failed after the last attempt. */
+    uint32_t deferred_writes;                   /* Register address writes held back for the next read. */
+} pal_i2c_combined_stats_t;
+
+void pal_i2c_get_combined_stats(pal_i2c_combined_stats_t * p_stats);
+
+#if I2C_INTR_MODE_EN
+/* End of transfer hooks implemented in pal_i2c.c, called from the SCB0 event callback (ISR context). */
+void i2c_master_end_of_transmit_callback(void);
+void i2c_master_end_of_receive_callback(void);
+void i2c_master_error_detected_callback(void);
+void i2c_master_nack_received_callback(void);
+void i2c_master_arbitration_lost_callback(void);
+#endif /* I2C_INTR_MODE_EN */
+
 #endif /* _PAL_CUSTOM_H_ */
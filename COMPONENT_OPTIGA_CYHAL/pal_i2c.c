@@ -42,38 +42,457 @@
 #include "cy_debug.h"
 #include "pal_custom.h"
 #include "pal_os_timer.h"
+#include "pal_os_event.h"
+#include "task.h"
+#include "i2c_bus_mgr.h"
 
 
+// Highest bitrate in KHz the IFX I2C layer may request, normally set from the Makefile
+#ifndef PAL_I2C_MASTER_MAX_BITRATE
 #define PAL_I2C_MASTER_MAX_BITRATE  (400U)
+#endif
 
-static volatile uint32_t g_entry_count = 0;
+// Consecutive bus faults after which the bitrate falls back to the next lower I2C mode
+#ifndef PAL_I2C_BITRATE_FALLBACK_FAULTS
+#define PAL_I2C_BITRATE_FALLBACK_FAULTS  (3U)
+#endif
+
+// Longest time in ms a transfer waits for another SCB0 client before reporting the bus busy. The
+// transfer is queued by priority and started once granted, without blocking the calling task.
+#ifndef PAL_I2C_BUS_WAIT_MS
+#define PAL_I2C_BUS_WAIT_MS  (50U)
+#endif
+
+static cy_stc_i2c_bus_client_t g_pal_i2c_bus_client;
 static pal_i2c_t * gp_pal_i2c_current_ctx;
 
+// Bitrate in KHz currently used on the bus and the ceiling left after fall backs
+static uint16_t g_pal_i2c_bitrate = (uint16_t)(I2C_DATARATE / 1000U);
+static uint16_t g_pal_i2c_bitrate_limit = PAL_I2C_MASTER_MAX_BITRATE;
+static volatile uint8_t g_pal_i2c_fault_count = 0;
+
+// Default retry policy, applied to both directions unless changed with pal_i2c_set_retry_policy()
+#ifndef PAL_I2C_RETRY_MAX_ATTEMPTS
+#define PAL_I2C_RETRY_MAX_ATTEMPTS          (3U)
+#endif
+#ifndef PAL_I2C_RETRY_INITIAL_BACKOFF_US
+#define PAL_I2C_RETRY_INITIAL_BACKOFF_US    (100U)
+#endif
+#ifndef PAL_I2C_RETRY_MAX_BACKOFF_US
+#define PAL_I2C_RETRY_MAX_BACKOFF_US        (4000U)
+#endif
+#ifndef PAL_I2C_RETRY_JITTER_US
+#define PAL_I2C_RETRY_JITTER_US             (50U)
+#endif
+#ifndef PAL_I2C_RETRY_YIELD_THRESHOLD_US
+#define PAL_I2C_RETRY_YIELD_THRESHOLD_US    (1000U)
+#endif
+
+typedef struct pal_i2c_retry
+{
+    pal_i2c_retry_policy_t policy;
+    pal_i2c_retry_stats_t stats;
+} pal_i2c_retry_t;
+
+static pal_i2c_retry_t g_pal_i2c_retry[PAL_I2C_RETRY_DIR_COUNT] =
+{
+    [PAL_I2C_RETRY_WRITE] = { .policy = { PAL_I2C_RETRY_MAX_ATTEMPTS, PAL_I2C_RETRY_INITIAL_BACKOFF_US,
+                                          PAL_I2C_RETRY_MAX_BACKOFF_US, PAL_I2C_RETRY_JITTER_US,
+                                          PAL_I2C_RETRY_YIELD_THRESHOLD_US } },
+    [PAL_I2C_RETRY_READ]  = { .policy = { PAL_I2C_RETRY_MAX_ATTEMPTS, PAL_I2C_RETRY_INITIAL_BACKOFF_US,
+                                          PAL_I2C_RETRY_MAX_BACKOFF_US, PAL_I2C_RETRY_JITTER_US,
+                                          PAL_I2C_RETRY_YIELD_THRESHOLD_US } },
+};
+
+static uint32_t g_pal_i2c_jitter_seed = 0;
+
+// Runs the attempt following a backoff of yield_threshold_us or more, and starts a transfer queued for
+// SCB0 once granted. NULL when none could be created, waits for the bus then block the calling task.
+static pal_os_event_t * gp_pal_i2c_retry_event = NULL;
+
+// Joins the register address write of the IFX I2C layer with the following read of the same chip
+// into one transaction with a repeated START, normally set from the Makefile
+#ifndef PAL_I2C_COMBINED_READ_EN
+#define PAL_I2C_COMBINED_READ_EN  (0U)
+#endif
+
+static pal_i2c_combined_stats_t g_pal_i2c_combined_stats;
+
+#if PAL_I2C_COMBINED_READ_EN
+// Register address written by the IFX I2C layer but not yet sent, one per chip
+typedef struct pal_i2c_reg_select
+{
+    bool pending;
+    uint8_t reg;
+} pal_i2c_reg_select_t;
+
+static pal_i2c_reg_select_t g_pal_i2c_reg_select[OPTIGA_NUM_CHIPS];
+
+// Entry sent with the read in progress, dropped once that read succeeds
+static pal_i2c_reg_select_t * gp_pal_i2c_reg_select_active;
+#endif /* PAL_I2C_COMBINED_READ_EN */
+
+// Transfer in flight, kept so that a failed attempt can be made again after a backoff
+static struct
+{
+    pal_i2c_retry_dir_t dir;
+    uint8_t slave_address;
+    uint8_t * p_data;
+    uint16_t length;
+    uint8_t * p_wr_data;
+    uint16_t wr_length;
+    uint8_t attempt;
+} g_pal_i2c_xfer;
+
+// Transfer queued for SCB0 by pal_i2c_start() while another client owns it
+static struct
+{
+    bool queued;
+    volatile bool granted;
+    const pal_i2c_t * p_i2c_context;
+    pal_i2c_retry_dir_t dir;
+    uint8_t * p_wr_data;
+    uint16_t wr_length;
+    uint8_t * p_data;
+    uint16_t length;
+} g_pal_i2c_bus_wait;
+
+static void pal_i2c_retry_event_callback(void * p_ctx);
+static void pal_i2c_bus_wait_event_callback(void * p_ctx);
+
 static pal_status_t pal_i2c_acquire(const void * p_i2c_context)
 {
-    // To avoid compiler errors/warnings. This context might be used by a target 
-    // system to implement a proper mutex handling
     (void)p_i2c_context;
-    
-    if (0 == g_entry_count)
+
+    // SCB0 is shared through the bus manager, OPTIGA frames are served ahead of bulk clients
+    if (CY_I2C_BUS_SUCCESS == Cy_USB_I2CBusAcquire(&g_pal_i2c_bus_client, pdMS_TO_TICKS(PAL_I2C_BUS_WAIT_MS)))
     {
-        g_entry_count++;
-        if (1 == g_entry_count)
-        {
-            return PAL_STATUS_SUCCESS;
-        }
+        return PAL_STATUS_SUCCESS;
     }
     return PAL_STATUS_FAILURE;
 }
 
 static void pal_i2c_release(const void * p_i2c_context)
 {
-    // To avoid compiler errors/warnings. This context might be used by a target 
-    // system to implement a proper mutex handling
     (void)p_i2c_context;
-    
-    g_entry_count = 0;
+
+    Cy_USB_I2CBusRelease(&g_pal_i2c_bus_client);
+}
+
+// A data NACK, arbitration loss or bus error counts as a bus fault. An address NACK is only the
+// OPTIGA being busy, which the IFX I2C layer polls for, so it neither counts nor clears the count.
+static void pal_i2c_track_bus_fault(bool fault)
+{
+    if (!fault)
+    {
+        g_pal_i2c_fault_count = 0;
+    }
+    else if (g_pal_i2c_fault_count < UINT8_MAX)
+    {
+        g_pal_i2c_fault_count++;
+    }
+}
+
+static uint16_t pal_i2c_apply_bitrate(uint16_t bitrate)
+{
+    uint32_t achieved;
+
+    // Step down through Fast-mode Plus, Fast-mode and Standard-mode until the SCB clock allows it
+    for (;;)
+    {
+        achieved = Cy_USB_I2CSetDataRate(SCB0, (uint32_t)bitrate * 1000U);
+        if (0U != achieved)
+        {
+            g_pal_i2c_bitrate = (uint16_t)(achieved / 1000U);
+            DBG_APP_INFO("PAL I2C bitrate %d KHz requested, %d Hz achieved\r\n", bitrate, achieved);
+            return g_pal_i2c_bitrate;
+        }
+
+        // A busy SCB is not a reason to step down
+        if ((bitrate <= 100U) || (CY_SCB_I2C_IDLE != I2C_context.state))
+        {
+            return 0;
+        }
+        bitrate = (bitrate > 400U) ? 400U : 100U;
+    }
+}
+
+// Must be called with the bus acquired and no transfer in progress
+static void pal_i2c_check_fallback(void)
+{
+    uint16_t fallback;
+
+    if (g_pal_i2c_fault_count < PAL_I2C_BITRATE_FALLBACK_FAULTS)
+    {
+        return;
+    }
+    g_pal_i2c_fault_count = 0;
+
+    fallback = (g_pal_i2c_bitrate > 400U) ? 400U : 100U;
+    if (fallback >= g_pal_i2c_bitrate)
+    {
+        // Already at Standard-mode, nothing left to fall back to
+        return;
+    }
+
+    g_pal_i2c_bitrate_limit = fallback;
+    DBG_APP_ERR("PAL I2C: %d bus faults at %d KHz, falling back\r\n", PAL_I2C_BITRATE_FALLBACK_FAULTS,
+                g_pal_i2c_bitrate);
+    (void)pal_i2c_apply_bitrate(fallback);
+}
+
+uint16_t pal_i2c_get_bitrate(void)
+{
+    return g_pal_i2c_bitrate;
+}
+
+void pal_i2c_set_retry_policy(pal_i2c_retry_dir_t dir, const pal_i2c_retry_policy_t * p_policy)
+{
+    if ((dir < PAL_I2C_RETRY_DIR_COUNT) && (NULL != p_policy))
+    {
+        g_pal_i2c_retry[dir].policy = *p_policy;
+        if (0U == g_pal_i2c_retry[dir].policy.max_attempts)
+        {
+            g_pal_i2c_retry[dir].policy.max_attempts = 1U;
+        }
+    }
+}
+
+void pal_i2c_get_retry_stats(pal_i2c_retry_dir_t dir, pal_i2c_retry_stats_t * p_stats)
+{
+    if ((dir < PAL_I2C_RETRY_DIR_COUNT) && (NULL != p_stats))
+    {
+        *p_stats = g_pal_i2c_retry[dir].stats;
+    }
+}
+
+void pal_i2c_clear_retry_stats(void)
+{
+    memset((void *)&g_pal_i2c_retry[PAL_I2C_RETRY_WRITE].stats, 0, sizeof(pal_i2c_retry_stats_t));
+    memset((void *)&g_pal_i2c_retry[PAL_I2C_RETRY_READ].stats, 0, sizeof(pal_i2c_retry_stats_t));
+    memset((void *)&g_pal_i2c_combined_stats, 0, sizeof(g_pal_i2c_combined_stats));
+}
+
+void pal_i2c_get_combined_stats(pal_i2c_combined_stats_t * p_stats)
+{
+    if (NULL != p_stats)
+    {
+        *p_stats = g_pal_i2c_combined_stats;
+    }
+}
+
+#if PAL_I2C_COMBINED_READ_EN
+static pal_i2c_reg_select_t * pal_i2c_get_reg_select(const pal_i2c_t * p_i2c_context)
+{
+    uint8_t index;
+
+    for (index = 0; index < OPTIGA_NUM_CHIPS; index++)
+    {
+        if (optiga_pal_i2c_contexts[index] == p_i2c_context)
+        {
+            return &g_pal_i2c_reg_select[index];
+        }
+    }
+    return NULL;
+}
+#endif /* PAL_I2C_COMBINED_READ_EN */
+
+// Called once the read which carried a deferred register address has ended
+static void pal_i2c_reg_select_done(bool success)
+{
+#if PAL_I2C_COMBINED_READ_EN
+    // On failure the address is kept, so that the retried read selects the register again
+    if ((success) && (NULL != gp_pal_i2c_reg_select_active))
+    {
+        gp_pal_i2c_reg_select_active->pending = false;
+    }
+    gp_pal_i2c_reg_select_active = NULL;
+#else
+    (void)success;
+#endif /* PAL_I2C_COMBINED_READ_EN */
+}
+
+// Wait before the next attempt. The delay doubles with every failed attempt up to max_backoff_us,
+// plus a random jitter so that retries of several masters do not stay aligned. Long waits are handed
+// to pal_os_event, which calls pal_i2c_retry_event_callback() once they have elapsed, and true is
+// returned. The caller usually is the RTOS timer task, which must never block. Short waits are spun
+// since a tick would be far longer than asked for.
+static bool pal_i2c_backoff(pal_i2c_retry_t * p_retry, uint8_t failed_attempts)
+{
+    const pal_i2c_retry_policy_t * p_policy = &p_retry->policy;
+    uint32_t delay_us = p_policy->initial_backoff_us;
+    uint8_t shift;
+
+    for (shift = 1; (shift < failed_attempts) && (delay_us < p_policy->max_backoff_us); shift++)
+    {
+        delay_us <<= 1;
+    }
+    if (delay_us > p_policy->max_backoff_us)
+    {
+        delay_us = p_policy->max_backoff_us;
+    }
+
+    if (0U != p_policy->jitter_us)
+    {
+        if (0U == g_pal_i2c_jitter_seed)
+        {
+            g_pal_i2c_jitter_seed = (uint32_t)xTaskGetTickCount() | 1U;
+        }
+        // xorshift32
+        g_pal_i2c_jitter_seed ^= g_pal_i2c_jitter_seed << 13;
+        g_pal_i2c_jitter_seed ^= g_pal_i2c_jitter_seed >> 17;
+        g_pal_i2c_jitter_seed ^= g_pal_i2c_jitter_seed << 5;
+        delay_us += g_pal_i2c_jitter_seed % ((uint32_t)p_policy->jitter_us + 1U);
+    }
+
+    p_retry->stats.backoff_us += delay_us;
+
+    if ((delay_us >= p_policy->yield_threshold_us) && (NULL != gp_pal_i2c_retry_event) &&
+        (taskSCHEDULER_RUNNING == xTaskGetSchedulerState()))
+    {
+        // The bus stays acquired until the transfer has ended
+        p_retry->stats.yield_waits++;
+        pal_os_event_register_callback_oneshot(gp_pal_i2c_retry_event, pal_i2c_retry_event_callback, NULL, delay_us);
+        return true;
+    }
+
+    p_retry->stats.spin_waits++;
+    Cy_SysLib_DelayUs((uint16_t)((delay_us > UINT16_MAX) ? UINT16_MAX : delay_us));
+    return false;
+}
+
+#if I2C_INTR_MODE_EN
+static cy_en_scb_i2c_status_t pal_i2c_start_transfer(void)
+{
+    const cy_stc_i2c_transport_t * p_transport = Cy_USB_I2CGetTransport();
+
+    if (0U != g_pal_i2c_xfer.wr_length)
+    {
+        return p_transport->writeReadAsync(SCB0, g_pal_i2c_xfer.slave_address, g_pal_i2c_xfer.p_wr_data,
+                                           g_pal_i2c_xfer.wr_length, g_pal_i2c_xfer.p_data, g_pal_i2c_xfer.length);
+    }
+    if (PAL_I2C_RETRY_READ == g_pal_i2c_xfer.dir)
+    {
+        return p_transport->readAsync(SCB0, g_pal_i2c_xfer.slave_address, g_pal_i2c_xfer.p_data, g_pal_i2c_xfer.length, true);
+    }
+    return p_transport->writeAsync(SCB0, g_pal_i2c_xfer.slave_address, g_pal_i2c_xfer.p_data, g_pal_i2c_xfer.length, true);
+}
+
+// Start a new transfer, further attempts are made from pal_i2c_deferred_upper_layer_callback().
+// A read with wr_length bytes to write first is done as one transaction joined by a repeated START.
+static cy_en_scb_i2c_status_t pal_i2c_transfer(pal_i2c_retry_dir_t dir, uint8_t slave_address,
+                                               uint8_t * p_data, uint16_t length,
+                                               uint8_t * p_wr_data, uint16_t wr_length)
+{
+    cy_en_scb_i2c_status_t i2c_status;
+
+    g_pal_i2c_xfer.dir = dir;
+    g_pal_i2c_xfer.slave_address = slave_address;
+    g_pal_i2c_xfer.p_data = p_data;
+    g_pal_i2c_xfer.length = length;
+    g_pal_i2c_xfer.p_wr_data = p_wr_data;
+    g_pal_i2c_xfer.wr_length = wr_length;
+    g_pal_i2c_xfer.attempt = 1U;
+    g_pal_i2c_retry[dir].stats.transfers++;
+
+    i2c_status = pal_i2c_start_transfer();
+    if (CY_SCB_I2C_SUCCESS != i2c_status)
+    {
+        g_pal_i2c_retry[dir].stats.failures++;
+    }
+    return i2c_status;
+}
+
+// Returns true when another attempt of the failed transfer has been started or scheduled
+static bool pal_i2c_retry_transfer(void)
+{
+    pal_i2c_retry_t * p_retry = &g_pal_i2c_retry[g_pal_i2c_xfer.dir];
+
+    while (g_pal_i2c_xfer.attempt < p_retry->policy.max_attempts)
+    {
+        p_retry->stats.retries++;
+        if (pal_i2c_backoff(p_retry, g_pal_i2c_xfer.attempt))
+        {
+            return true;
+        }
+        g_pal_i2c_xfer.attempt++;
+
+        if (CY_SCB_I2C_SUCCESS == pal_i2c_start_transfer())
+        {
+            return true;
+        }
+    }
+
+    p_retry->stats.failures++;
+    return false;
+}
+#else
+// Blocking attempts of the transfer in flight, retried on failure as configured by the policy of the
+// direction. Returns false when the next attempt waits for a long backoff, its outcome is then
+// reported from pal_i2c_retry_event_callback().
+static bool pal_i2c_run_attempts(cy_en_scb_i2c_status_t * p_i2c_status)
+{
+    pal_i2c_retry_t * p_retry = &g_pal_i2c_retry[g_pal_i2c_xfer.dir];
+    const cy_stc_i2c_transport_t * p_transport = Cy_USB_I2CGetTransport();
+    cy_en_scb_i2c_status_t i2c_status;
+
+    for (;;)
+    {
+        if (0U != g_pal_i2c_xfer.wr_length)
+        {
+            i2c_status = p_transport->writeRead(SCB0, g_pal_i2c_xfer.slave_address, g_pal_i2c_xfer.p_wr_data,
+                                                g_pal_i2c_xfer.wr_length, g_pal_i2c_xfer.p_data, g_pal_i2c_xfer.length);
+        }
+        else
+        {
+            i2c_status = (PAL_I2C_RETRY_READ == g_pal_i2c_xfer.dir)
+                ? p_transport->read(SCB0, g_pal_i2c_xfer.slave_address, g_pal_i2c_xfer.p_data, g_pal_i2c_xfer.length, true)
+                : p_transport->write(SCB0, g_pal_i2c_xfer.slave_address, g_pal_i2c_xfer.p_data, g_pal_i2c_xfer.length, true);
+        }
+        g_pal_i2c_xfer.attempt++;
+
+        if (CY_SCB_I2C_MASTER_MANUAL_ADDR_NAK != i2c_status)
+        {
+            pal_i2c_track_bus_fault(CY_SCB_I2C_SUCCESS != i2c_status);
+        }
+
+        if ((CY_SCB_I2C_SUCCESS == i2c_status) || (g_pal_i2c_xfer.attempt >= p_retry->policy.max_attempts))
+        {
+            break;
+        }
+
+        p_retry->stats.retries++;
+        if (pal_i2c_backoff(p_retry, g_pal_i2c_xfer.attempt))
+        {
+            return false;
+        }
+    }
+
+    if (CY_SCB_I2C_SUCCESS != i2c_status)
+    {
+        p_retry->stats.failures++;
+    }
+    *p_i2c_status = i2c_status;
+    return true;
+}
+
+// Blocking transfer. A read with wr_length bytes to write first is done as one transaction joined by a
+// repeated START. Returns false when it goes on after a backoff, see pal_i2c_run_attempts().
+static bool pal_i2c_transfer(pal_i2c_retry_dir_t dir, uint8_t slave_address, uint8_t * p_data, uint16_t length,
+                             uint8_t * p_wr_data, uint16_t wr_length, cy_en_scb_i2c_status_t * p_i2c_status)
+{
+    g_pal_i2c_xfer.dir = dir;
+    g_pal_i2c_xfer.slave_address = slave_address;
+    g_pal_i2c_xfer.p_data = p_data;
+    g_pal_i2c_xfer.length = length;
+    g_pal_i2c_xfer.p_wr_data = p_wr_data;
+    g_pal_i2c_xfer.wr_length = wr_length;
+    g_pal_i2c_xfer.attempt = 0U;
+    g_pal_i2c_retry[dir].stats.transfers++;
+
+    return pal_i2c_run_attempts(p_i2c_status);
 }
+#endif /* I2C_INTR_MODE_EN */
 
 void invoke_upper_layer_callback (const pal_i2c_t * p_pal_i2c_ctx, optiga_lib_status_t event)
 {
@@ -81,31 +500,117 @@ void invoke_upper_layer_callback (const pal_i2c_t * p_pal_i2c_ctx, optiga_lib_st
 
     upper_layer_handler = (upper_layer_callback_t)p_pal_i2c_ctx->upper_layer_event_handler;
 
-    upper_layer_handler(p_pal_i2c_ctx->p_upper_layer_ctx, event);
+    pal_i2c_check_fallback();
 
-    //Release I2C Bus
+    //Release I2C Bus first, the upper layer may start the next transfer from within the handler
     pal_i2c_release(p_pal_i2c_ctx->p_upper_layer_ctx);
+
+    upper_layer_handler(p_pal_i2c_ctx->p_upper_layer_ctx, event);
+}
+
+// End of the transfer in flight, after its last attempt
+static void pal_i2c_transfer_done(optiga_lib_status_t event)
+{
+    if (0U != g_pal_i2c_xfer.wr_length)
+    {
+        if (PAL_I2C_EVENT_SUCCESS != event)
+        {
+            g_pal_i2c_combined_stats.failures++;
+        }
+        pal_i2c_reg_select_done(PAL_I2C_EVENT_SUCCESS == event);
+    }
+
+    invoke_upper_layer_callback(gp_pal_i2c_current_ctx, event);
+}
+
+/**
+* Runs in the task which drives the rest of the IFX I2C stack through pal_os_event, the timer
+* service task or the OPTIGA service task, once a backoff handed over by pal_i2c_backoff() has elapsed.
+*/
+static void pal_i2c_retry_event_callback(void * p_ctx)
+{
+#if I2C_INTR_MODE_EN
+    (void)p_ctx;
+
+    g_pal_i2c_xfer.attempt++;
+    if ((CY_SCB_I2C_SUCCESS == pal_i2c_start_transfer()) || (pal_i2c_retry_transfer()))
+    {
+        return;
+    }
+    pal_i2c_transfer_done(PAL_I2C_EVENT_ERROR);
+#else
+    cy_en_scb_i2c_status_t i2c_status;
+
+    (void)p_ctx;
+
+    if (pal_i2c_run_attempts(&i2c_status))
+    {
+        pal_i2c_transfer_done((CY_SCB_I2C_SUCCESS == i2c_status) ? PAL_I2C_EVENT_SUCCESS : PAL_I2C_EVENT_ERROR);
+    }
+#endif /* I2C_INTR_MODE_EN */
+}
+
+#if I2C_INTR_MODE_EN
+/**
+* Runs in the task which drives the rest of the IFX I2C stack through pal_os_event, the timer
+* service task or the OPTIGA service task.
+*/
+static void pal_i2c_deferred_upper_layer_callback(void * p_pal_i2c_ctx, uint32_t event)
+{
+    (void)p_pal_i2c_ctx;
+
+    if ((PAL_I2C_EVENT_ERROR == (optiga_lib_status_t)event) && (pal_i2c_retry_transfer()))
+    {
+        // The bus stays acquired, completion of the new attempt is reported the same way
+        return;
+    }
+
+    pal_i2c_transfer_done((optiga_lib_status_t)event);
+}
+#endif /* I2C_INTR_MODE_EN */
+
+static void pal_i2c_signal_transfer_done(optiga_lib_status_t event)
+{
+#if I2C_INTR_MODE_EN
+    // Called from the SCB0 interrupt. The upper layer is not interrupt safe, so hand over to task context.
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    BaseType_t pend_status;
+
+    pend_status = pal_os_event_pend_function_call_from_isr(pal_i2c_deferred_upper_layer_callback,
+                                                           (void *)gp_pal_i2c_current_ctx,
+                                                           (uint32_t)event,
+                                                           &higher_priority_task_woken);
+    configASSERT(pdPASS == pend_status);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+#else
+    invoke_upper_layer_callback(gp_pal_i2c_current_ctx, event);
+#endif /* I2C_INTR_MODE_EN */
 }
 
 // The next 5 functions are required only in case you have interrupt based i2c implementation
 void i2c_master_end_of_transmit_callback(void)
 {
-    invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_SUCCESS);
+    pal_i2c_track_bus_fault(false);
+    pal_i2c_signal_transfer_done(PAL_I2C_EVENT_SUCCESS);
 }
 
 void i2c_master_end_of_receive_callback(void)
 {
-    invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_SUCCESS);
+    pal_i2c_track_bus_fault(false);
+    pal_i2c_signal_transfer_done(PAL_I2C_EVENT_SUCCESS);
 }
 
 void i2c_master_error_detected_callback(void)
 {
-    invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_ERROR);
+    pal_i2c_track_bus_fault(true);
+    pal_i2c_signal_transfer_done(PAL_I2C_EVENT_ERROR);
 }
 
+// Address NACKs only, both transfer modes report a data NACK through i2c_master_error_detected_callback()
 void i2c_master_nack_received_callback(void)
 {
-    i2c_master_error_detected_callback();
+    // The OPTIGA being busy is no bus fault, see pal_i2c_track_bus_fault()
+    pal_i2c_signal_transfer_done(PAL_I2C_EVENT_ERROR);
 }
 
 void i2c_master_arbitration_lost_callback(void)
@@ -115,8 +620,35 @@ void i2c_master_arbitration_lost_callback(void)
 
 pal_status_t pal_i2c_init(const pal_i2c_t * p_i2c_context)
 {
-    (void)p_i2c_context;
+    Cy_USB_I2CBusClientInit(&g_pal_i2c_bus_client, "OPTIGA", I2C_BUS_PRIO_OPTIGA);
+
+    if (NULL == gp_pal_i2c_retry_event)
+    {
+        gp_pal_i2c_retry_event = pal_os_event_create(NULL, NULL);
+        if (NULL == gp_pal_i2c_retry_event)
+        {
+#if I2C_INTR_MODE_EN && PAL_OS_EVENT_TASK_EN
+            // Without the service task the completions pended from the SCB0 interrupt would be lost
+            DBG_APP_ERR("PAL I2C: no OPTIGA service task, transfers cannot complete\r\n");
+            return PAL_STATUS_FAILURE;
+#else
+            DBG_APP_ERR("PAL I2C: no retry event, backoffs are spun\r\n");
+#endif /* I2C_INTR_MODE_EN && PAL_OS_EVENT_TASK_EN */
+        }
+    }
+
+    // SCB0 is re-initialised, which must not happen under a transfer of another client
+    if (PAL_STATUS_SUCCESS != pal_i2c_acquire(p_i2c_context))
+    {
+        return PAL_STATUS_FAILURE;
+    }
     Cy_USB_I2CInit();
+
+    // Init brings SCB0 back to I2C_DATARATE, the fall back ceiling is kept
+    g_pal_i2c_bitrate = (uint16_t)(I2C_DATARATE / 1000U);
+    g_pal_i2c_fault_count = 0;
+
+    pal_i2c_release(p_i2c_context);
     return PAL_STATUS_SUCCESS;
 }
 
@@ -128,109 +660,234 @@ pal_status_t pal_i2c_deinit(const pal_i2c_t * p_i2c_context)
     return PAL_STATUS_SUCCESS;
 }
 
-pal_status_t pal_i2c_write(const pal_i2c_t * p_i2c_context, uint8_t * p_data, uint16_t length) {
+// Start the transfer with SCB0 acquired. A read with wr_length bytes to write first is done as one
+// transaction joined by a repeated START. The bus is released and the upper layer informed once it ends.
+static pal_status_t pal_i2c_run_transfer(const pal_i2c_t * p_i2c_context, pal_i2c_retry_dir_t dir,
+                                         uint8_t * p_wr_data, uint16_t wr_length, uint8_t * p_data, uint16_t length)
+{
     pal_status_t status = PAL_STATUS_FAILURE;
-    
-    //Acquire the I2C bus before read/write
-    if (PAL_STATUS_SUCCESS == pal_i2c_acquire(p_i2c_context)) {
-
-        cy_en_scb_i2c_status_t i2c_status;
-        for(int i=0; i<3; i++){ /* Attempt 3 times. */
-            i2c_status = cyi2c_master_write(SCB0, OPTIGA_FX_ADDR, p_data, length, true);
-            Cy_SysLib_DelayUs(100);
-            if(!i2c_status) break;  /* stop attempts once succeeded */
-        }
-
-        if(i2c_status) {
-            //If I2C Master fails to invoke the write operation, invoke upper layer event handler with error.
-            ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))
-                                                       (p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_ERROR);
-            
-            //Release I2C Bus
-            pal_i2c_release((void * )p_i2c_context);
-        }
-        else {
-            pal_i2c_release((void * )p_i2c_context);
-            
-            /**
-            * Infineon I2C Protocol is a polling based protocol, if foo_i2c_write will fail it will be reported to the 
-            * upper layers by calling 
-            * (p_i2c_context->upper_layer_event_handler))(p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_ERROR);
-            * If the function foo_i2c_write() will succedd then two options are possible
-            * 1. if foo_i2c_write() is interrupt based, then you need to configure interrupts in the function 
-            *    pal_i2c_init() so that on a succesfull transmit interrupt the callback i2c_master_end_of_transmit_callback(),
-            *    in case of successfull receive i2c_master_end_of_receive_callback() callback 
-            *    in case of not acknowedged, arbitration lost, generic error i2c_master_nack_received_callback() or
-            *    i2c_master_arbitration_lost_callback()
-            * 2. If foo_i2c_write() is a blocking function which will return either ok or failure after transmitting data
-            *    you can handle this case directly here and call 
-            *    invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_SUCCESS);
-            *    
-            */
 
-            ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))(p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_SUCCESS);
+    if (0U != wr_length)
+    {
+        g_pal_i2c_combined_stats.transfers++;
+    }
 
-            status = PAL_STATUS_SUCCESS;
+#if I2C_INTR_MODE_EN
+    gp_pal_i2c_current_ctx = (pal_i2c_t *)p_i2c_context;
+
+    if (CY_SCB_I2C_SUCCESS != pal_i2c_transfer(dir, p_i2c_context->slave_address, p_data, length, p_wr_data, wr_length))
+    {
+        if (0U != wr_length)
+        {
+            g_pal_i2c_combined_stats.failures++;
+            pal_i2c_reg_select_done(false);
         }
+
+        //If I2C Master fails to invoke the operation, invoke upper layer event handler with error.
+        pal_i2c_release((void * )p_i2c_context);
+        ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))
+                                                   (p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_ERROR);
+    }
+    else
+    {
+        // The bus is released and the upper layer informed by i2c_master_end_of_transmit_callback()
+        // or i2c_master_end_of_receive_callback()
+        status = PAL_STATUS_SUCCESS;
+    }
+#else
+    cy_en_scb_i2c_status_t i2c_status;
+    gp_pal_i2c_current_ctx = (pal_i2c_t *)p_i2c_context;
+
+    if (!pal_i2c_transfer(dir, p_i2c_context->slave_address, p_data, length, p_wr_data, wr_length, &i2c_status))
+    {
+        // Retried after a backoff, the bus is released and the upper layer informed by pal_i2c_transfer_done()
+        status = PAL_STATUS_SUCCESS;
+    }
+    else if(i2c_status) {
+        //If I2C Master fails to invoke the operation, release the bus and invoke upper layer event handler with error.
+        pal_i2c_transfer_done(PAL_I2C_EVENT_ERROR);
     }
     else {
-        status = PAL_STATUS_I2C_BUSY;
-        ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))
-                                                        (p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_BUSY);
+        /**
+        * Infineon I2C Protocol is a polling based protocol, if foo_i2c_write will fail it will be reported to the 
+        * upper layers by calling 
+        * (p_i2c_context->upper_layer_event_handler))(p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_ERROR);
+        * If the function foo_i2c_write() will succedd then two options are possible
+        * 1. if foo_i2c_write() is interrupt based, then you need to configure interrupts in the function 
+        *    pal_i2c_init() so that on a succesfull transmit interrupt the callback i2c_master_end_of_transmit_callback(),
+        *    in case of successfull receive i2c_master_end_of_receive_callback() callback 
+        *    in case of not acknowedged, arbitration lost, generic error i2c_master_nack_received_callback() or
+        *    i2c_master_arbitration_lost_callback()
+        * 2. If foo_i2c_write() is a blocking function which will return either ok or failure after transmitting data
+        *    you can handle this case directly here and call 
+        *    invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_SUCCESS);
+        *    
+        */
+        pal_i2c_transfer_done(PAL_I2C_EVENT_SUCCESS);
+
+        status = PAL_STATUS_SUCCESS;
     }
+#endif /* I2C_INTR_MODE_EN */
+
     return status;
 }
 
-pal_status_t pal_i2c_read(const pal_i2c_t * p_i2c_context, uint8_t * p_data, uint16_t length)
+// Called by the client releasing SCB0 to the queued transfer, in its task
+static void pal_i2c_bus_granted(void * p_arg)
 {
-    pal_status_t status = PAL_STATUS_FAILURE;
-    // Acquire the I2C bus before read/write
-    
-    if (PAL_STATUS_SUCCESS == pal_i2c_acquire(p_i2c_context))
+    (void)p_arg;
+
+    // Replaces the bus wait timeout, the transfer is started in the task driving the IFX I2C layer
+    g_pal_i2c_bus_wait.granted = true;
+    pal_os_event_register_callback_oneshot(gp_pal_i2c_retry_event, pal_i2c_bus_wait_event_callback, NULL, 0U);
+}
+
+/**
+* Runs in the task which drives the rest of the IFX I2C stack through pal_os_event, once a transfer queued
+* for SCB0 has been granted the bus or has waited PAL_I2C_BUS_WAIT_MS for it.
+*/
+static void pal_i2c_bus_wait_event_callback(void * p_ctx)
+{
+    const pal_i2c_t * p_i2c_context = g_pal_i2c_bus_wait.p_i2c_context;
+
+    (void)p_ctx;
+
+    if (!g_pal_i2c_bus_wait.queued)
     {
-        
-        cy_en_scb_i2c_status_t i2c_status;
-        i2c_status = cyi2c_master_read(SCB0, OPTIGA_FX_ADDR, p_data, length, true);
-
-        //Invoke the low level i2c master driver API to read from the bus
-        if(i2c_status) {
-            //If I2C Master fails to invoke the read operation, invoke upper layer event handler with error.
-            ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))
-                                                       (p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_ERROR);
-
-            //Release I2C Bus
-            
-            pal_i2c_release((void * )p_i2c_context);
-        }
-        else {
-            
-            /**
-            * Similar to the foo_i2c_write() case you can directly call 
-            * invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_SUCCESS);
-            * if you have blocking (non-interrupt) i2c calls
-            */
-            ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))(p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_SUCCESS);
+        return;
+    }
+    g_pal_i2c_bus_wait.queued = false;
 
-            status = PAL_STATUS_SUCCESS;
+    if (Cy_USB_I2CBusCancel(&g_pal_i2c_bus_client))
+    {
+        ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))
+                                                    (p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_BUSY);
+        return;
+    }
+
+    (void)pal_i2c_run_transfer(p_i2c_context, g_pal_i2c_bus_wait.dir, g_pal_i2c_bus_wait.p_wr_data,
+                               g_pal_i2c_bus_wait.wr_length, g_pal_i2c_bus_wait.p_data, g_pal_i2c_bus_wait.length);
+}
+
+// Acquire SCB0 and start the transfer. While another client owns the bus, the transfer is queued by
+// priority and started from pal_i2c_bus_wait_event_callback() once granted, so that the IFX I2C layer
+// running in the RTOS timer task neither blocks nor sees PAL_I2C_EVENT_BUSY for a short wait.
+static pal_status_t pal_i2c_start(const pal_i2c_t * p_i2c_context, pal_i2c_retry_dir_t dir,
+                                  uint8_t * p_wr_data, uint16_t wr_length, uint8_t * p_data, uint16_t length)
+{
+    cy_en_i2c_bus_status_t bus_status;
+
+    if (NULL != gp_pal_i2c_retry_event)
+    {
+        g_pal_i2c_bus_wait.p_i2c_context = p_i2c_context;
+        g_pal_i2c_bus_wait.dir = dir;
+        g_pal_i2c_bus_wait.p_wr_data = p_wr_data;
+        g_pal_i2c_bus_wait.wr_length = wr_length;
+        g_pal_i2c_bus_wait.p_data = p_data;
+        g_pal_i2c_bus_wait.length = length;
+        g_pal_i2c_bus_wait.granted = false;
+        g_pal_i2c_bus_wait.queued = true;
+
+        bus_status = Cy_USB_I2CBusRequest(&g_pal_i2c_bus_client, pal_i2c_bus_granted, NULL);
+        if (CY_I2C_BUS_PENDING == bus_status)
+        {
+            pal_os_event_register_callback_oneshot(gp_pal_i2c_retry_event, pal_i2c_bus_wait_event_callback, NULL,
+                                                   PAL_I2C_BUS_WAIT_MS * 1000U);
+            // A grant made by a higher priority task before the timeout was armed is not lost
+            if (g_pal_i2c_bus_wait.granted)
+            {
+                pal_os_event_register_callback_oneshot(gp_pal_i2c_retry_event, pal_i2c_bus_wait_event_callback,
+                                                       NULL, 0U);
+            }
+            return PAL_STATUS_SUCCESS;
         }
+        g_pal_i2c_bus_wait.queued = false;
     }
     else
     {
-        status = PAL_STATUS_I2C_BUSY;
-        ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))
-                                                        (p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_BUSY);
+        bus_status = Cy_USB_I2CBusAcquire(&g_pal_i2c_bus_client, pdMS_TO_TICKS(PAL_I2C_BUS_WAIT_MS));
     }
 
-    pal_i2c_release((void * )p_i2c_context);
-    return status;
+    if (CY_I2C_BUS_SUCCESS == bus_status)
+    {
+        return pal_i2c_run_transfer(p_i2c_context, dir, p_wr_data, wr_length, p_data, length);
+    }
+
+    ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))
+                                                (p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_BUSY);
+    return PAL_STATUS_I2C_BUSY;
+}
+
+pal_status_t pal_i2c_write(const pal_i2c_t * p_i2c_context, uint8_t * p_data, uint16_t length) {
+#if PAL_I2C_COMBINED_READ_EN
+    pal_i2c_reg_select_t * p_reg_select = pal_i2c_get_reg_select(p_i2c_context);
+
+    if (NULL != p_reg_select) {
+        // Any other write selects a register of its own
+        p_reg_select->pending = false;
+
+        if (1U == length) {
+            // A lone register address is always followed by a read of that register, send both together
+            p_reg_select->reg = p_data[0];
+            p_reg_select->pending = true;
+            g_pal_i2c_combined_stats.deferred_writes++;
+            ((upper_layer_callback_t)(p_i2c_context->upper_layer_event_handler))(p_i2c_context->p_upper_layer_ctx , PAL_I2C_EVENT_SUCCESS);
+            return PAL_STATUS_SUCCESS;
+        }
+    }
+#endif /* PAL_I2C_COMBINED_READ_EN */
+
+    return pal_i2c_start(p_i2c_context, PAL_I2C_RETRY_WRITE, NULL, 0U, p_data, length);
+}
+
+pal_status_t pal_i2c_read(const pal_i2c_t * p_i2c_context, uint8_t * p_data, uint16_t length)
+{
+#if PAL_I2C_COMBINED_READ_EN
+    pal_i2c_reg_select_t * p_reg_select = pal_i2c_get_reg_select(p_i2c_context);
+
+    if ((NULL != p_reg_select) && (p_reg_select->pending))
+    {
+        gp_pal_i2c_reg_select_active = p_reg_select;
+        return pal_i2c_start(p_i2c_context, PAL_I2C_RETRY_READ, &p_reg_select->reg, 1U, p_data, length);
+    }
+#endif /* PAL_I2C_COMBINED_READ_EN */
+
+    return pal_i2c_start(p_i2c_context, PAL_I2C_RETRY_READ, NULL, 0U, p_data, length);
+}
+
+pal_status_t pal_i2c_write_read(const pal_i2c_t * p_i2c_context, uint8_t * p_wr_data, uint16_t wr_length,
+                                uint8_t * p_data, uint16_t length)
+{
+#if PAL_I2C_COMBINED_READ_EN
+    gp_pal_i2c_reg_select_active = NULL;
+#endif /* PAL_I2C_COMBINED_READ_EN */
+
+    return pal_i2c_start(p_i2c_context, PAL_I2C_RETRY_READ, p_wr_data, wr_length, p_data, length);
 }
 
 pal_status_t pal_i2c_set_bitrate(const pal_i2c_t * p_i2c_context, uint16_t bitrate)
 {
-    /* NOTE: The baud rate for the SCB which is used for I2C is already set. User will not have to re-specify it. */
-    pal_status_t return_status;
+    pal_status_t return_status = PAL_STATUS_FAILURE;
+
+    // Never go above the build time maximum, nor above the rate the bus has fallen back to
+    if (bitrate > g_pal_i2c_bitrate_limit)
+    {
+        bitrate = g_pal_i2c_bitrate_limit;
+    }
 
-    return_status = PAL_STATUS_SUCCESS;
+    if (PAL_STATUS_SUCCESS == pal_i2c_acquire(p_i2c_context))
+    {
+        // SCB0 is re-clocked, the achieved rate is available from pal_i2c_get_bitrate()
+        if (0U != pal_i2c_apply_bitrate(bitrate))
+        {
+            return_status = PAL_STATUS_SUCCESS;
+        }
+        pal_i2c_release(p_i2c_context);
+    }
+    else
+    {
+        return_status = PAL_STATUS_I2C_BUSY;
+    }
 
     return return_status;
 }
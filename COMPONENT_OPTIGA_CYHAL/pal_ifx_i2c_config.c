@@ -63,6 +63,14 @@ pal_i2c_t optiga_pal_i2c_context_0 =
     OPTIGA_FX_ADDR,
 };
 
+/**
+ * \brief PAL I2C configurations indexed by chip, see OPTIGA_NUM_CHIPS.
+ */
+pal_i2c_t * const optiga_pal_i2c_contexts[OPTIGA_NUM_CHIPS] =
+{
+    &optiga_pal_i2c_context_0,
+};
+
 /**
 * \brief PAL vdd pin configuration for OPTIGA. 
  */
@@ -37,21 +37,373 @@
 
 /* Includes */
 #include "pal_os_event.h"
+#include "pal_os_timer.h"
+#include "pal_custom.h"
 
 /* RTOS includes */
 #include "FreeRTOS.h"
 #include "queue.h"
+#include "task.h"
 #include "timers.h"
 
 /* Includes for logging */
 #include "optiga_app.h"
 
-/* Global timer variables */
-TimerHandle_t fx_optiga_timer;
-volatile bool timer_created = false;
+/* Events handed out by pal_os_event_create(), one per OPTIGA instance in use. Each one is scheduled
+ * independently, with its own callback, context and due time. */
+typedef struct
+{
+    pal_os_event_t event;
+    bool in_use;
+    bool pending;
+    uint32_t due_us;
+} pal_os_event_entry_t;
 
-/* Global event instance */
-pal_os_event_t pal_os_event_0 = {0};
+static pal_os_event_entry_t pal_os_event_pool[PAL_OS_EVENT_POOL_SIZE];
+
+#if !PAL_OS_EVENT_TASK_EN
+/* RTOS timer serving the delays of a tick or more, re-armed for the earliest pending event. */
+static TimerHandle_t pal_os_event_timer = NULL;
+
+/* Set while due callbacks are run, the scheduler is re-armed once they are all done. */
+static bool pal_os_event_dispatching = false;
+#endif /* !PAL_OS_EVENT_TASK_EN */
+
+#define PAL_OS_EVENT_TICK_US        (1000000U / configTICK_RATE_HZ)
+
+static void pal_os_event_arm(void);
+
+/* Pool entry of an event, NULL when the event does not come from pal_os_event_create(). */
+static pal_os_event_entry_t * pal_os_event_get_entry(pal_os_event_t * p_pal_os_event) {
+    for (uint8_t i = 0; i < PAL_OS_EVENT_POOL_SIZE; i++) {
+        if ((&pal_os_event_pool[i].event == p_pal_os_event) && (pal_os_event_pool[i].in_use)) {
+            return &pal_os_event_pool[i];
+        }
+    }
+    return NULL;
+}
+
+/* Run the callbacks which are due, in task context. Delays shorter than PAL_OS_EVENT_SPIN_US are waited out here.
+ * Returns the microseconds left until the next pending event, INT32_MAX when there is none. */
+static int32_t pal_os_event_run_due(void) {
+    pal_os_event_entry_t * p_due;
+    register_callback callback;
+    void * callback_ctx;
+    int32_t wait_us;
+    uint32_t now_us;
+
+    for (;;) {
+        p_due = NULL;
+        wait_us = INT32_MAX;
+        callback = NULL;
+        callback_ctx = NULL;
+        now_us = pal_os_timer_get_time_in_microseconds();
+
+        taskENTER_CRITICAL();
+        for (uint8_t i = 0; i < PAL_OS_EVENT_POOL_SIZE; i++) {
+            if ((pal_os_event_pool[i].in_use) && (pal_os_event_pool[i].pending) &&
+                ((int32_t)(pal_os_event_pool[i].due_us - now_us) < wait_us)) {
+                p_due = &pal_os_event_pool[i];
+                wait_us = (int32_t)(p_due->due_us - now_us);
+            }
+        }
+        if ((NULL != p_due) && (wait_us <= 0)) {
+            p_due->pending = false;
+            callback = p_due->event.callback_registered;
+            callback_ctx = p_due->event.callback_ctx;
+        }
+        taskEXIT_CRITICAL();
+
+        if ((NULL == p_due) || (wait_us > (int32_t)PAL_OS_EVENT_SPIN_US)) {
+            return wait_us;
+        }
+        if (wait_us > 0) {
+            Cy_SysLib_DelayUs((uint16_t)wait_us);
+            continue;
+        }
+
+        if (NULL != callback) {
+            callback(callback_ctx);
+        }
+    }
+}
+
+#if PAL_OS_EVENT_TASK_EN
+/* Service task running the OPTIGA stack, woken by direct notifications. */
+static TaskHandle_t pal_os_event_task_handle = NULL;
+
+/* Functions handed over from interrupts, run by the service task in order. */
+typedef struct
+{
+    PendedFunction_t function;
+    void * p_arg;
+    uint32_t arg;
+} pal_os_event_pended_t;
+
+static pal_os_event_pended_t pal_os_event_pended[PAL_OS_EVENT_PEND_DEPTH];
+static volatile uint8_t pal_os_event_pended_head = 0;
+static volatile uint8_t pal_os_event_pended_tail = 0;
+#endif /* PAL_OS_EVENT_TASK_EN */
+
+#if PAL_OS_EVENT_HW_TIMER_EN
+static bool pal_os_event_hw_timer_ready = false;
+
+#if !PAL_OS_EVENT_TASK_EN
+static void pal_os_event_dispatch_pended(void * p_arg, uint32_t arg);
+#endif /* !PAL_OS_EVENT_TASK_EN */
+
+/* Compare timer interrupt: the callbacks run in task context like the other ones. */
+static void pal_os_event_hw_timer_isr(void) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    uint32_t intr_status = Cy_TCPWM_GetInterruptStatusMasked(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT);
+
+    Cy_TCPWM_ClearInterrupt(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT, intr_status);
+
+#if PAL_OS_EVENT_TASK_EN
+    vTaskNotifyGiveFromISR(pal_os_event_task_handle, &higher_priority_task_woken);
+#else
+    if (pdPASS != xTimerPendFunctionCallFromISR(pal_os_event_dispatch_pended, NULL, 0, &higher_priority_task_woken)) {
+        /* Timer queue full, the RTOS timer picks the event up one tick later. */
+        (void)xTimerChangePeriodFromISR(pal_os_event_timer, 1, &higher_priority_task_woken);
+    }
+#endif /* PAL_OS_EVENT_TASK_EN */
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+/* One-shot counter clocked at 1 MHz, so that its period is the delay in microseconds. */
+static void pal_os_event_hw_timer_init(void) {
+    cy_stc_tcpwm_counter_config_t counter_config;
+    cy_stc_sysint_t intr_config;
+
+    memset((void *)&counter_config, 0, sizeof(counter_config));
+    counter_config.period           = PAL_OS_EVENT_TICK_US;
+    counter_config.clockPrescaler   = CY_TCPWM_COUNTER_PRESCALER_DIVBY_1;
+    counter_config.runMode          = CY_TCPWM_COUNTER_ONESHOT;
+    counter_config.countDirection   = CY_TCPWM_COUNTER_COUNT_UP;
+    counter_config.compareOrCapture = CY_TCPWM_COUNTER_MODE_COMPARE;
+    counter_config.interruptSources = CY_TCPWM_INT_ON_TC;
+    counter_config.countInputMode   = CY_TCPWM_INPUT_LEVEL;
+    counter_config.countInput       = CY_TCPWM_INPUT_1;
+
+    Cy_SysClk_PeriphDisableDivider(CY_SYSCLK_DIV_16_BIT, PAL_OS_EVENT_TCPWM_DIV);
+    Cy_SysClk_PeriphSetDivider(CY_SYSCLK_DIV_16_BIT, PAL_OS_EVENT_TCPWM_DIV,
+                               (Cy_SysClk_ClkPeriGetFrequency() / 1000000U) - 1U);
+    Cy_SysClk_PeriphEnableDivider(CY_SYSCLK_DIV_16_BIT, PAL_OS_EVENT_TCPWM_DIV);
+    Cy_SysClk_PeriphAssignDivider((en_clk_dst_t)(PCLK_TCPWM0_CLOCKS0 + PAL_OS_EVENT_TCPWM_CNT),
+                                  CY_SYSCLK_DIV_16_BIT, PAL_OS_EVENT_TCPWM_DIV);
+
+    if (CY_TCPWM_SUCCESS != Cy_TCPWM_Counter_Init(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT, &counter_config)) {
+        OPTIGA_LOG_ERROR("Event compare timer init failed, using the RTOS tick only");
+        return;
+    }
+    Cy_TCPWM_Counter_Enable(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT);
+    Cy_TCPWM_SetInterruptMask(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT, CY_TCPWM_INT_ON_TC);
+
+#if (!CY_CPU_CORTEX_M4)
+    intr_config.intrSrc = NvicMux4_IRQn;
+    intr_config.cm0pSrc = PAL_OS_EVENT_TCPWM_IRQ;
+#else
+    intr_config.intrSrc = (IRQn_Type)PAL_OS_EVENT_TCPWM_IRQ;
+#endif /* (!CY_CPU_CORTEX_M4) */
+    intr_config.intrPriority = PAL_OS_EVENT_TCPWM_INTR_PRIORITY;
+    Cy_SysInt_Init(&intr_config, pal_os_event_hw_timer_isr);
+    NVIC_EnableIRQ(intr_config.intrSrc);
+
+    pal_os_event_hw_timer_ready = true;
+}
+
+/* Returns true when the compare timer now times the delay. */
+static bool pal_os_event_hw_timer_start(int32_t wait_us) {
+    if (!pal_os_event_hw_timer_ready) {
+        pal_os_event_hw_timer_init();
+    }
+    if ((!pal_os_event_hw_timer_ready) || (wait_us >= (int32_t)PAL_OS_EVENT_TICK_US)) {
+        return false;
+    }
+
+    Cy_TCPWM_TriggerStopOrKill_Single(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT);
+    Cy_TCPWM_Counter_SetCounter(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT, 0);
+    Cy_TCPWM_Counter_SetPeriod(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT, (uint32_t)((wait_us < 1) ? 1 : wait_us));
+    Cy_TCPWM_TriggerStart_Single(PAL_OS_EVENT_TCPWM_BASE, PAL_OS_EVENT_TCPWM_CNT);
+    return true;
+}
+#endif /* PAL_OS_EVENT_HW_TIMER_EN */
+
+#if PAL_OS_EVENT_TASK_EN
+/* Ticks to block for until the next event, starting the compare timer for delays below a tick. */
+static TickType_t pal_os_event_task_wait(int32_t wait_us) {
+    if (INT32_MAX == wait_us) {
+        return portMAX_DELAY;
+    }
+#if PAL_OS_EVENT_HW_TIMER_EN
+    if (pal_os_event_hw_timer_start(wait_us)) {
+        return portMAX_DELAY;
+    }
+#endif /* PAL_OS_EVENT_HW_TIMER_EN */
+    if (wait_us < 1) {
+        wait_us = 1;
+    }
+    return (TickType_t)(((uint32_t)wait_us + PAL_OS_EVENT_TICK_US - 1U) / PAL_OS_EVENT_TICK_US);
+}
+
+static void pal_os_event_task(void * p_arg) {
+    pal_os_event_pended_t pended;
+    int32_t wait_us;
+
+    (void)p_arg;
+
+    for (;;) {
+        /* Transfer completions first, their callbacks usually schedule the next protocol step. */
+        while (pal_os_event_pended_tail != pal_os_event_pended_head) {
+            pended = pal_os_event_pended[pal_os_event_pended_tail];
+            pal_os_event_pended_tail = (uint8_t)((pal_os_event_pended_tail + 1U) % PAL_OS_EVENT_PEND_DEPTH);
+            pended.function(pended.p_arg, pended.arg);
+        }
+
+        wait_us = pal_os_event_run_due();
+
+        /* A notification given since the events were looked at ends the wait at once. */
+        (void)ulTaskNotifyTake(pdTRUE, pal_os_event_task_wait(wait_us));
+    }
+}
+
+/* Create the service task along with the first event, so that completions pended from an ISR
+   before any event was scheduled find it running. */
+static bool pal_os_event_task_create(void) {
+    if (NULL == pal_os_event_task_handle) {
+        vTaskSuspendAll();
+        if (NULL == pal_os_event_task_handle) {
+            if (pdPASS != xTaskCreate(pal_os_event_task, "fx_optiga_evt", PAL_OS_EVENT_TASK_STACK, NULL,
+                                      PAL_OS_EVENT_TASK_PRIORITY, &pal_os_event_task_handle)) {
+                pal_os_event_task_handle = NULL;
+            }
+        }
+        (void)xTaskResumeAll();
+
+        if (NULL == pal_os_event_task_handle) {
+            OPTIGA_LOG_ERROR("Event Create Failed, service task not created");
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Wake the service task to re-evaluate the pending events. */
+static void pal_os_event_arm(void) {
+    if (NULL == pal_os_event_task_handle) {
+        OPTIGA_LOG_ERROR("Event Register Failed, service task not created");
+        return;
+    }
+
+    /* The service task looks at the events again before it blocks. */
+    if (xTaskGetCurrentTaskHandle() != pal_os_event_task_handle) {
+        (void)xTaskNotifyGive(pal_os_event_task_handle);
+    }
+}
+
+BaseType_t pal_os_event_pend_function_call_from_isr(PendedFunction_t function, void * p_arg, uint32_t arg,
+                                                    BaseType_t * p_higher_priority_task_woken) {
+    UBaseType_t int_state;
+    uint8_t next;
+
+    if (NULL == pal_os_event_task_handle) {
+        return pdFAIL;
+    }
+
+    int_state = taskENTER_CRITICAL_FROM_ISR();
+    next = (uint8_t)((pal_os_event_pended_head + 1U) % PAL_OS_EVENT_PEND_DEPTH);
+    if (next == pal_os_event_pended_tail) {
+        taskEXIT_CRITICAL_FROM_ISR(int_state);
+        return pdFAIL;
+    }
+    pal_os_event_pended[pal_os_event_pended_head].function = function;
+    pal_os_event_pended[pal_os_event_pended_head].p_arg = p_arg;
+    pal_os_event_pended[pal_os_event_pended_head].arg = arg;
+    pal_os_event_pended_head = next;
+    taskEXIT_CRITICAL_FROM_ISR(int_state);
+
+    vTaskNotifyGiveFromISR(pal_os_event_task_handle, p_higher_priority_task_woken);
+    return pdPASS;
+}
+#else
+static void pal_os_event_dispatch(void) {
+    pal_os_event_dispatching = true;
+    (void)pal_os_event_run_due();
+    pal_os_event_dispatching = false;
+    pal_os_event_arm();
+}
+
+void Cy_PAL_CbkWrapper(TimerHandle_t xTimer){
+    (void)xTimer;
+
+    pal_os_event_dispatch();
+}
+
+#if PAL_OS_EVENT_HW_TIMER_EN
+static void pal_os_event_dispatch_pended(void * p_arg, uint32_t arg) {
+    (void)p_arg;
+    (void)arg;
+
+    pal_os_event_dispatch();
+}
+#endif /* PAL_OS_EVENT_HW_TIMER_EN */
+
+/* Arm the RTOS timer, or the compare timer below one tick, for the earliest pending event. */
+static void pal_os_event_arm(void) {
+    int32_t wait_us = INT32_MAX;
+    bool pending = false;
+    uint32_t now_us;
+    TickType_t ticks;
+
+    if (pal_os_event_dispatching) {
+        return;
+    }
+
+    now_us = pal_os_timer_get_time_in_microseconds();
+    taskENTER_CRITICAL();
+    for (uint8_t i = 0; i < PAL_OS_EVENT_POOL_SIZE; i++) {
+        if ((pal_os_event_pool[i].in_use) && (pal_os_event_pool[i].pending) &&
+            ((int32_t)(pal_os_event_pool[i].due_us - now_us) < wait_us)) {
+            wait_us = (int32_t)(pal_os_event_pool[i].due_us - now_us);
+            pending = true;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (!pending) {
+        return;
+    }
+    if (wait_us < 1) {
+        wait_us = 1;
+    }
+
+#if PAL_OS_EVENT_HW_TIMER_EN
+    if (pal_os_event_hw_timer_start(wait_us)) {
+        return;
+    }
+#endif /* PAL_OS_EVENT_HW_TIMER_EN */
+
+    /* A tick may already be partly elapsed. An early expiry finds nothing due and re-arms for the rest. */
+    ticks = (TickType_t)(((uint32_t)wait_us + PAL_OS_EVENT_TICK_US - 1U) / PAL_OS_EVENT_TICK_US);
+    if (NULL == pal_os_event_timer) {
+        /** \note A wrapper `Cy_PAL_CbkWrapper` is used because xTimerCreate expects a cbk function with an xTimerHandle_t param. */
+        pal_os_event_timer = xTimerCreate("fx_optiga_timer", ticks, pdFALSE, NULL, Cy_PAL_CbkWrapper);
+        if (NULL == pal_os_event_timer) {
+            OPTIGA_LOG_ERROR("Event Register Failed, timer not created");
+            return;
+        }
+    }
+    /* Also starts the timer, restarting it from now when it was already running. */
+    if (pdPASS != xTimerChangePeriod(pal_os_event_timer, ticks, 0)) {
+        OPTIGA_LOG_ERROR("Event Register Failed, timer queue full");
+    }
+}
+
+BaseType_t pal_os_event_pend_function_call_from_isr(PendedFunction_t function, void * p_arg, uint32_t arg,
+                                                    BaseType_t * p_higher_priority_task_woken) {
+    return xTimerPendFunctionCallFromISR(function, p_arg, arg, p_higher_priority_task_woken);
+}
+#endif /* PAL_OS_EVENT_TASK_EN */
 
 void pal_os_event_start(pal_os_event_t * p_pal_os_event, register_callback callback, void * callback_args) {
     if (0 == p_pal_os_event->is_event_triggered) {
@@ -65,24 +417,50 @@ void pal_os_event_stop(pal_os_event_t * p_pal_os_event) {
 }
 
 pal_os_event_t * pal_os_event_create(register_callback callback, void * callback_args) {
+    pal_os_event_entry_t * p_entry = NULL;
+
+    taskENTER_CRITICAL();
+    for (uint8_t i = 0; i < PAL_OS_EVENT_POOL_SIZE; i++) {
+        if (!pal_os_event_pool[i].in_use) {
+            p_entry = &pal_os_event_pool[i];
+            memset((void *)p_entry, 0, sizeof(pal_os_event_entry_t));
+            p_entry->in_use = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL == p_entry) {
+        /* PAL_OS_EVENT_POOL_SIZE is too small for the instances created */
+        OPTIGA_LOG_ERROR("Event Create Failed, all %d events in use", PAL_OS_EVENT_POOL_SIZE);
+        configASSERT(NULL != p_entry);
+        return NULL;
+    }
+
+#if PAL_OS_EVENT_TASK_EN
+    if (!pal_os_event_task_create()) {
+        taskENTER_CRITICAL();
+        p_entry->in_use = false;
+        taskEXIT_CRITICAL();
+        return NULL;
+    }
+#endif /* PAL_OS_EVENT_TASK_EN */
+
     if (( NULL != callback )&&( NULL != callback_args ))
     {
-        pal_os_event_start(&pal_os_event_0, callback, callback_args);
+        pal_os_event_start(&p_entry->event, callback, callback_args);
     }
-    return (&pal_os_event_0);
-}
-
-void Cy_PAL_CbkWrapper(TimerHandle_t xTimer){
-    pal_os_event_trigger_registered_callback();
+    return (&p_entry->event);
 }
 
+/* Kept for ports driving the stack from their own timer, it serves the first event of the pool. */
 void pal_os_event_trigger_registered_callback(void) {
 
     register_callback callback;
 
-    if (pal_os_event_0.callback_registered) {
-        callback = pal_os_event_0.callback_registered;
-        callback((void * )pal_os_event_0.callback_ctx);
+    if ((pal_os_event_pool[0].in_use) && (pal_os_event_pool[0].event.callback_registered)) {
+        callback = pal_os_event_pool[0].event.callback_registered;
+        callback((void * )pal_os_event_pool[0].event.callback_ctx);
     }
 
 }
@@ -91,32 +469,36 @@ void pal_os_event_register_callback_oneshot(pal_os_event_t * p_pal_os_event,
                                              register_callback callback,
                                              void * callback_args,
                                              uint32_t time_us) {
+    pal_os_event_entry_t * p_entry = pal_os_event_get_entry(p_pal_os_event);
+
+    if (NULL == p_entry) {
+        OPTIGA_LOG_ERROR("Event Register Failed, event not created");
+        return;
+    }
+
+    /* Every call is scheduled with its own delay, replacing the one still pending for this event. */
+    taskENTER_CRITICAL();
     p_pal_os_event->callback_registered = callback;
     p_pal_os_event->callback_ctx = callback_args;
+    p_entry->due_us = pal_os_timer_get_time_in_microseconds() + time_us;
+    p_entry->pending = true;
+    taskEXIT_CRITICAL();
 
-    if(!timer_created){
-        uint32_t time_ms = time_us<1000?1:(uint32_t)(time_us/1000);
-        /** \note A wrapper `Cy_PAL_CbkWrapper` is used because xTimerCreate expects a cbk function with an xTimerHandle_t param. */
-        fx_optiga_timer = xTimerCreate("fx_optiga_timer_n", time_ms, pdFALSE, p_pal_os_event, Cy_PAL_CbkWrapper);
-        timer_created = true;
-    }
-    xTimerStart(fx_optiga_timer, 0);
+    pal_os_event_arm();
 }
 
 void pal_os_event_destroy(pal_os_event_t * pal_os_event) {
-    (void)pal_os_event;
+    pal_os_event_entry_t * p_entry = pal_os_event_get_entry(pal_os_event);
 
-    uint32_t timerStopStatus = pdPASS;
-    uint32_t timerDeleteStatus = pdPASS;
-
-    timerStopStatus = xTimerStop(fx_optiga_timer, 0);
-    timerDeleteStatus = xTimerDelete(fx_optiga_timer, 0);
-
-    if(timerStopStatus==pdPASS && timerDeleteStatus==pdPASS){
-        timer_created = false;
-    } else {
-        OPTIGA_LOG_ERROR("Event Destroy Failed. Status - [xTimerStop: 0x%x, xTimerDelete: 0x%x]", timerStopStatus, timerDeleteStatus);
+    if (NULL == p_entry) {
+        return;
     }
+
+    /* Back to the pool. The shared timers keep running for the other events, a stale expiry finds nothing due. */
+    taskENTER_CRITICAL();
+    p_entry->pending = false;
+    p_entry->in_use = false;
+    taskEXIT_CRITICAL();
 }
 
 /**
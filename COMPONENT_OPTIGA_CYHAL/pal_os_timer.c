@@ -34,18 +34,57 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "cy_syslib.h"
+#include "cy_pdl.h"
 
-static volatile uint32_t g_tick_count = 0;
+/// @cond hidden
 
-/// @cond hidden 
+#if (__CORTEX_M >= 3)
+// The DWT cycle counter wraps every few tens of seconds. It is extended to 64 bits on every read,
+// the RTOS tick count elapsed since the previous read telling how many times it wrapped meanwhile.
+static uint64_t g_timer_cycles = 0;
+static uint32_t g_timer_last_cyccnt = 0;
+static TickType_t g_timer_last_tick = 0;
+static bool g_timer_started = false;
 
-/**
-* ISR handler for counting 1 milliseconds ticks
-*/
-void delay_timer_isr(void)
+static uint64_t pal_os_timer_get_cycles(void)
 {
-    g_tick_count += 1u;
+    uint32_t int_state;
+    uint32_t cyccnt;
+    uint32_t delta;
+    uint64_t expected;
+    TickType_t tick;
+
+    int_state = Cy_SysLib_EnterCriticalSection();
+
+    if (!g_timer_started)
+    {
+        // Left running if already enabled, other users of the counter only take differences
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        g_timer_last_cyccnt = DWT->CYCCNT;
+        g_timer_last_tick = xTaskGetTickCountFromISR();
+        g_timer_started = true;
+    }
+
+    cyccnt = DWT->CYCCNT;
+    tick = xTaskGetTickCountFromISR();
+    delta = cyccnt - g_timer_last_cyccnt;
+
+    // Add the whole wraps the tick count says were missed, rounding to the nearest one
+    expected = (uint64_t)(TickType_t)(tick - g_timer_last_tick) * (SystemCoreClock / configTICK_RATE_HZ);
+    if (expected > delta)
+    {
+        g_timer_cycles += ((expected - delta + 0x80000000ULL) >> 32) << 32;
+    }
+    g_timer_cycles += delta;
+    g_timer_last_cyccnt = cyccnt;
+    g_timer_last_tick = tick;
+
+    Cy_SysLib_ExitCriticalSection(int_state);
+
+    return g_timer_cycles;
 }
+#endif /* (__CORTEX_M >= 3) */
 
 /// @endcond
 
@@ -60,10 +99,36 @@ uint32_t pal_os_timer_get_time_in_milliseconds(void)
     return (uint32_t)xTaskGetTickCount();
 }
 
+/**
+* Get the current time in microseconds, from a free running hardware counter<br>
+*
+*
+* \retval  uint32_t time in microseconds, wrapping at 32 bits
+*/
 uint32_t pal_os_timer_get_time_in_microseconds(void)
 {
-    uint32_t time_in_ms = pal_os_timer_get_time_in_milliseconds();
-    return (time_in_ms*1000);
+#if (__CORTEX_M >= 3)
+    return (uint32_t)(pal_os_timer_get_cycles() / (SystemCoreClock / 1000000U));
+#else
+    // No cycle counter on CM0+: the RTOS tick count extends the SysTick down counter
+    uint32_t int_state;
+    uint32_t ticks;
+    uint32_t value;
+    uint32_t reload = Cy_SysTick_GetReload() + 1U;
+
+    int_state = Cy_SysLib_EnterCriticalSection();
+    ticks = (uint32_t)xTaskGetTickCountFromISR();
+    value = Cy_SysTick_GetValue();
+
+    // A reload not yet counted by the pending tick interrupt
+    if ((0U != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) && (value > (reload / 2U)))
+    {
+        ticks++;
+    }
+    Cy_SysLib_ExitCriticalSection(int_state);
+
+    return (ticks * (1000000U / configTICK_RATE_HZ)) + (((reload - 1U - value) * (1000000U / configTICK_RATE_HZ)) / reload);
+#endif /* (__CORTEX_M >= 3) */
 }
 
 /**
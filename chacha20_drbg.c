@@ -0,0 +1,184 @@
+/***************************************************************************//**
+* \file chacha20_drbg.c
+*
+* \version 1.0
+*
+* \details  This file provides the ChaCha20 block function of RFC 8439 and the
+*           random bit generator built on it.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include <string.h>
+#include "chacha20_drbg.h"
+
+#define DRBG_BLOCK_LENGTH           (64u)
+
+/* Second nonce word of generate and seed blocks, keeps the two streams apart */
+#define DRBG_NONCE_GENERATE         (0x47425244U)   /* "DRBG" */
+#define DRBG_NONCE_SEED             (0x44454553U)   /* "SEED" */
+
+#define DRBG_ROTL(v, c)             (((v) << (c)) | ((v) >> (32u - (c))))
+
+#define DRBG_QUARTER_ROUND(a, b, c, d) \
+    do { \
+        (a) += (b); (d) ^= (a); (d) = DRBG_ROTL((d), 16u); \
+        (c) += (d); (b) ^= (c); (b) = DRBG_ROTL((b), 12u); \
+        (a) += (b); (d) ^= (a); (d) = DRBG_ROTL((d), 8u); \
+        (c) += (d); (b) ^= (c); (b) = DRBG_ROTL((b), 7u); \
+    } while (0)
+
+/**
+ * \name Cy_Drbg_ChaChaBlock
+ * \brief One 64 byte ChaCha20 block, RFC 8439 section 2.3
+ * \param key 8 words
+ * \param counter
+ * \param nonce 3 words
+ * \param out 64 bytes, little endian words
+ * \retval None
+ */
+static void Cy_Drbg_ChaChaBlock(const uint32_t *key, uint32_t counter, const uint32_t *nonce, uint8_t *out)
+{
+    uint32_t state[16];
+    uint32_t x[16];
+    uint8_t i;
+
+    state[0] = 0x61707865U;
+    state[1] = 0x3320646EU;
+    state[2] = 0x79622D32U;
+    state[3] = 0x6B206574U;
+    memcpy(&state[4], key, 8u * sizeof(uint32_t));
+    state[12] = counter;
+    memcpy(&state[13], nonce, 3u * sizeof(uint32_t));
+    memcpy(x, state, sizeof(x));
+
+    for (i = 0; i < 10u; i++) {
+        DRBG_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        DRBG_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        DRBG_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        DRBG_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        DRBG_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        DRBG_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        DRBG_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        DRBG_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < 16u; i++) {
+        uint32_t v = x[i] + state[i];
+
+        out[4u * i] = (uint8_t)v;
+        out[(4u * i) + 1u] = (uint8_t)(v >> 8);
+        out[(4u * i) + 2u] = (uint8_t)(v >> 16);
+        out[(4u * i) + 3u] = (uint8_t)(v >> 24);
+    }
+    memset(x, 0, sizeof(x));
+    memset(state, 0, sizeof(state));
+}
+
+/**
+ * \name Cy_Drbg_Rekey
+ * \brief Replace the key with the first 32 bytes of a block
+ * \param p_drbg
+ * \param block
+ * \retval None
+ */
+static void Cy_Drbg_Rekey(cy_stc_drbg_t *p_drbg, const uint8_t *block)
+{
+    uint8_t i;
+
+    for (i = 0; i < 8u; i++) {
+        p_drbg->key[i] = (uint32_t)block[4u * i] | ((uint32_t)block[(4u * i) + 1u] << 8) |
+                         ((uint32_t)block[(4u * i) + 2u] << 16) | ((uint32_t)block[(4u * i) + 3u] << 24);
+    }
+}
+
+void Cy_Drbg_Seed(cy_stc_drbg_t *p_drbg, const uint8_t *seed, uint16_t seed_length)
+{
+    const uint32_t nonce[3] = { 0, DRBG_NONCE_SEED, 0 };
+    uint8_t block[DRBG_BLOCK_LENGTH];
+    uint16_t offset = 0;
+    uint8_t i;
+
+    /* XOR each 32 byte piece into the key, then run the key through a block */
+    do {
+        for (i = 0; (i < DRBG_SEED_LENGTH) && ((offset + i) < seed_length); i++) {
+            p_drbg->key[i / 4u] ^= (uint32_t)seed[offset + i] << (8u * (i % 4u));
+        }
+        Cy_Drbg_ChaChaBlock(p_drbg->key, offset, nonce, block);
+        Cy_Drbg_Rekey(p_drbg, block);
+        offset = (uint16_t)(offset + DRBG_SEED_LENGTH);
+    } while (offset < seed_length);
+
+    memset(block, 0, sizeof(block));
+    memset(p_drbg->buffer, 0, sizeof(p_drbg->buffer));
+    p_drbg->available = 0;
+    p_drbg->seeded = true;
+}
+
+/**
+ * \name Cy_Drbg_Refill
+ * \brief Fill the buffer with keystream, take its first 32 bytes as the next key and wipe them
+ * \param p_drbg
+ * \retval None
+ */
+static void Cy_Drbg_Refill(cy_stc_drbg_t *p_drbg)
+{
+    const uint32_t nonce[3] = { p_drbg->refills++, DRBG_NONCE_GENERATE, 0 };
+    uint32_t counter;
+
+    for (counter = 0; counter < (DRBG_BUFFER_LENGTH / DRBG_BLOCK_LENGTH); counter++) {
+        Cy_Drbg_ChaChaBlock(p_drbg->key, counter, nonce, &p_drbg->buffer[counter * DRBG_BLOCK_LENGTH]);
+    }
+    Cy_Drbg_Rekey(p_drbg, p_drbg->buffer);
+    memset(p_drbg->buffer, 0, DRBG_SEED_LENGTH);
+    p_drbg->available = (uint16_t)(DRBG_BUFFER_LENGTH - DRBG_SEED_LENGTH);
+}
+
+bool Cy_Drbg_Generate(cy_stc_drbg_t *p_drbg, uint8_t *out, uint32_t out_length)
+{
+    uint8_t *src;
+    uint16_t n;
+
+    if (!p_drbg->seeded) {
+        return false;
+    }
+
+    while (out_length > 0u) {
+        if (0u == p_drbg->available) {
+            Cy_Drbg_Refill(p_drbg);
+        }
+        n = (out_length > p_drbg->available) ? p_drbg->available : (uint16_t)out_length;
+        src = &p_drbg->buffer[DRBG_BUFFER_LENGTH - p_drbg->available];
+        memcpy(out, src, n);
+        memset(src, 0, n);
+        p_drbg->available = (uint16_t)(p_drbg->available - n);
+        out += n;
+        out_length -= n;
+    }
+    return true;
+}
@@ -0,0 +1,82 @@
+/***************************************************************************//**
+* \file chacha20_drbg.h
+*
+* \version 1.0
+*
+* \details  Deterministic random bit generator built on the ChaCha20 block function,
+*           with fast key erasure: each refill of the output buffer replaces the key
+*           and served bytes are wiped, so earlier output cannot be recomputed from
+*           the state.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _CHACHA20_DRBG_H_
+#define _CHACHA20_DRBG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Seed material mixed in by one round of Cy_Drbg_Seed, longer seeds take several rounds */
+#define DRBG_SEED_LENGTH                            (32u)
+
+/* Keystream generated per refill, a multiple of the 64 byte block. The first 32 bytes become the next key. */
+#ifndef DRBG_BUFFER_LENGTH
+#define DRBG_BUFFER_LENGTH                          (256u)
+#endif
+
+typedef struct
+{
+    uint32_t key[8];
+    uint32_t refills;                               /* Nonce of the next refill */
+    uint16_t available;                             /* Unserved bytes at the end of buffer */
+    bool seeded;
+    uint8_t buffer[DRBG_BUFFER_LENGTH];
+} cy_stc_drbg_t;
+
+/**
+ * \name Cy_Drbg_Seed
+ * \brief Mix seed material into the key and drop the buffered output. Used for the first seed and for
+ *        every reseed.
+ * \param p_drbg
+ * \param seed
+ * \param seed_length
+ * \retval None
+ */
+void Cy_Drbg_Seed(cy_stc_drbg_t *p_drbg, const uint8_t *seed, uint16_t seed_length);
+
+/**
+ * \name Cy_Drbg_Generate
+ * \brief Produce random bytes, from the buffer while it lasts. The generator must have been seeded.
+ * \param p_drbg
+ * \param out
+ * \param out_length
+ * \retval false if the generator was never seeded, out is then untouched
+ */
+bool Cy_Drbg_Generate(cy_stc_drbg_t *p_drbg, uint8_t *out, uint32_t out_length);
+
+#endif /* _CHACHA20_DRBG_H_ */
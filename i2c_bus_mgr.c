@@ -0,0 +1,324 @@
+/***************************************************************************//**
+* \file i2c_bus_mgr.c
+* \version 1.0
+*
+* \details Serialises the clients of the SCB0 I2C master. The bus is handed
+*          over on release to the waiting client with the highest priority,
+*          the oldest request first among equal priorities.
+*
+*******************************************************************************
+* \copyright
+* (c) (2021-2026), Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/* Includes */
+#include "cy_pdl.h"
+#include "cy_debug.h"
+#include "i2c_bus_mgr.h"
+#include "pal_os_timer.h"
+
+/* Current owner of the bus, NULL when free. */
+static cy_stc_i2c_bus_client_t *pI2CBusOwner = NULL;
+
+/* Registered clients. */
+static cy_stc_i2c_bus_client_t *pI2CBusClients = NULL;
+
+/**
+ * \name Cy_USB_I2CBusGrant
+ * \brief Make pClient the owner and update its counters. Called inside a critical section.
+ * \param pClient
+ * \retval None
+ */
+static void Cy_USB_I2CBusGrant(cy_stc_i2c_bus_client_t *pClient)
+{
+    uint32_t waitUs = pal_os_timer_get_time_in_microseconds() - pClient->requestUs;
+
+    pI2CBusOwner = pClient;
+    pClient->waiting = false;
+    pClient->nestCount = 0;
+    pClient->grantCount++;
+    pClient->totalWaitUs += waitUs;
+    if (waitUs > pClient->maxWaitUs)
+    {
+        pClient->maxWaitUs = waitUs;
+    }
+}
+
+void Cy_USB_I2CBusClientInit(cy_stc_i2c_bus_client_t *pClient, const char *name, uint8_t priority)
+{
+    cy_stc_i2c_bus_client_t *pIter;
+
+    if (pClient == NULL)
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    pClient->name = name;
+    pClient->priority = priority;
+
+    for (pIter = pI2CBusClients; pIter != NULL; pIter = pIter->pNext)
+    {
+        if (pIter == pClient)
+        {
+            break;
+        }
+    }
+
+    if (pIter == NULL)
+    {
+        pClient->waiting = false;
+        pClient->pNext = pI2CBusClients;
+        pI2CBusClients = pClient;
+    }
+    taskEXIT_CRITICAL();
+
+    if (pClient->grantSem == NULL)
+    {
+        pClient->grantSem = xSemaphoreCreateBinary();
+        if (pClient->grantSem == NULL)
+        {
+            DBG_APP_ERR("I2C bus client %s: semaphore create failed\r\n", name);
+        }
+    }
+}
+
+cy_en_i2c_bus_status_t Cy_USB_I2CBusAcquire(cy_stc_i2c_bus_client_t *pClient, TickType_t timeout)
+{
+    cy_en_i2c_bus_status_t status;
+
+    if (pClient == NULL)
+    {
+        return CY_I2C_BUS_BAD_PARAM;
+    }
+
+    /* Blocking the timer task would stall every software timer, including the OPTIGA events. */
+    if (xTaskGetCurrentTaskHandle() == xTimerGetTimerDaemonTaskHandle())
+    {
+        timeout = 0;
+    }
+
+    taskENTER_CRITICAL();
+    if (pI2CBusOwner == pClient)
+    {
+        if (pClient->nestCount < UINT8_MAX)
+        {
+            pClient->nestCount++;
+            status = CY_I2C_BUS_SUCCESS;
+        }
+        else
+        {
+            status = CY_I2C_BUS_BAD_PARAM;
+        }
+        taskEXIT_CRITICAL();
+        return status;
+    }
+
+    pClient->requestUs = pal_os_timer_get_time_in_microseconds();
+
+    if (pI2CBusOwner == NULL)
+    {
+        Cy_USB_I2CBusGrant(pClient);
+        taskEXIT_CRITICAL();
+        return CY_I2C_BUS_SUCCESS;
+    }
+
+    if ((timeout == 0) || (pClient->grantSem == NULL))
+    {
+        pClient->timeoutCount++;
+        taskEXIT_CRITICAL();
+        return CY_I2C_BUS_TIMEOUT;
+    }
+
+    /* Queue behind the owner, the releasing task gives the semaphore once the bus is ours. */
+    pClient->grantCb = NULL;
+    pClient->waiting = true;
+    pClient->contendedCount++;
+    taskEXIT_CRITICAL();
+
+    if (pdTRUE == xSemaphoreTake(pClient->grantSem, timeout))
+    {
+        return CY_I2C_BUS_SUCCESS;
+    }
+
+    taskENTER_CRITICAL();
+    if (pI2CBusOwner == pClient)
+    {
+        /* Granted just as the wait timed out, drop the give so the next wait does not see it. */
+        (void)xSemaphoreTake(pClient->grantSem, 0);
+        status = CY_I2C_BUS_SUCCESS;
+    }
+    else
+    {
+        pClient->waiting = false;
+        pClient->timeoutCount++;
+        status = CY_I2C_BUS_TIMEOUT;
+    }
+    taskEXIT_CRITICAL();
+
+    return status;
+}
+
+cy_en_i2c_bus_status_t Cy_USB_I2CBusRequest(cy_stc_i2c_bus_client_t *pClient, cy_cb_i2c_bus_grant_t grantCb,
+                                            void *pArg)
+{
+    cy_en_i2c_bus_status_t status;
+
+    if ((pClient == NULL) || (grantCb == NULL))
+    {
+        return CY_I2C_BUS_BAD_PARAM;
+    }
+
+    taskENTER_CRITICAL();
+    if (pI2CBusOwner == pClient)
+    {
+        if (pClient->nestCount < UINT8_MAX)
+        {
+            pClient->nestCount++;
+            status = CY_I2C_BUS_SUCCESS;
+        }
+        else
+        {
+            status = CY_I2C_BUS_BAD_PARAM;
+        }
+    }
+    else if (pClient->waiting)
+    {
+        /* One request per client at a time. */
+        status = CY_I2C_BUS_BAD_PARAM;
+    }
+    else
+    {
+        pClient->requestUs = pal_os_timer_get_time_in_microseconds();
+        if (pI2CBusOwner == NULL)
+        {
+            Cy_USB_I2CBusGrant(pClient);
+            status = CY_I2C_BUS_SUCCESS;
+        }
+        else
+        {
+            /* Served by priority along with the blocked acquirers, see Cy_USB_I2CBusRelease. */
+            pClient->grantCb = grantCb;
+            pClient->pGrantArg = pArg;
+            pClient->waiting = true;
+            pClient->contendedCount++;
+            status = CY_I2C_BUS_PENDING;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return status;
+}
+
+bool Cy_USB_I2CBusCancel(cy_stc_i2c_bus_client_t *pClient)
+{
+    bool cancelled = false;
+
+    if (pClient == NULL)
+    {
+        return false;
+    }
+
+    taskENTER_CRITICAL();
+    if (pI2CBusOwner != pClient)
+    {
+        if (pClient->waiting)
+        {
+            pClient->waiting = false;
+            pClient->timeoutCount++;
+        }
+        cancelled = true;
+    }
+    taskEXIT_CRITICAL();
+
+    return cancelled;
+}
+
+void Cy_USB_I2CBusRelease(cy_stc_i2c_bus_client_t *pClient)
+{
+    cy_stc_i2c_bus_client_t *pIter;
+    cy_stc_i2c_bus_client_t *pNext = NULL;
+    cy_cb_i2c_bus_grant_t grantCb = NULL;
+    void *pGrantArg = NULL;
+
+    taskENTER_CRITICAL();
+    if (pI2CBusOwner != pClient)
+    {
+        taskEXIT_CRITICAL();
+        return;
+    }
+
+    if (pClient->nestCount != 0)
+    {
+        pClient->nestCount--;
+        taskEXIT_CRITICAL();
+        return;
+    }
+
+    for (pIter = pI2CBusClients; pIter != NULL; pIter = pIter->pNext)
+    {
+        if (!pIter->waiting)
+        {
+            continue;
+        }
+
+        if ((pNext == NULL) || (pIter->priority > pNext->priority) ||
+            ((pIter->priority == pNext->priority) &&
+             ((int32_t)(pIter->requestUs - pNext->requestUs) < 0)))
+        {
+            pNext = pIter;
+        }
+    }
+
+    if (pNext != NULL)
+    {
+        Cy_USB_I2CBusGrant(pNext);
+        grantCb = pNext->grantCb;
+        pGrantArg = pNext->pGrantArg;
+        pNext->grantCb = NULL;
+        if (grantCb == NULL)
+        {
+            (void)xSemaphoreGive(pNext->grantSem);
+        }
+    }
+    else
+    {
+        pI2CBusOwner = NULL;
+    }
+    taskEXIT_CRITICAL();
+
+    /* Outside the critical section, the callback usually schedules an event of its client. */
+    if (grantCb != NULL)
+    {
+        grantCb(pGrantArg);
+    }
+}
+
+void Cy_USB_I2CBusPrintStats(void)
+{
+    cy_stc_i2c_bus_client_t *pIter;
+
+    for (pIter = pI2CBusClients; pIter != NULL; pIter = pIter->pNext)
+    {
+        DBG_APP_INFO("I2C bus %s: grants %d contended %d timeouts %d wait total %dus max %dus\r\n",
+                     (pIter->name != NULL) ? pIter->name : "?", pIter->grantCount, pIter->contendedCount,
+                     pIter->timeoutCount, pIter->totalWaitUs, pIter->maxWaitUs);
+    }
+}
+
+/* End of File */
@@ -0,0 +1,131 @@
+/***************************************************************************//**
+* \file i2c_bus_mgr.h
+* \version 1.0
+*
+* \brief Defines the SCB0 I2C bus manager shared by all I2C clients
+*
+*******************************************************************************
+* \copyright
+* (c) (2021-2026), Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef _CY_I2C_BUS_MGR_H_
+#define _CY_I2C_BUS_MGR_H_
+
+#include "cy_pdl.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "semphr.h"
+
+/* Client priorities, a waiting client with a higher value is granted the bus first. */
+#define I2C_BUS_PRIO_BULK              (1u)         /* Register traffic, e.g. the FPGA at FPGASLAVE_ADDR. */
+#define I2C_BUS_PRIO_OPTIGA            (4u)         /* OPTIGA Trust M frames, latency critical. */
+
+typedef enum
+{
+    CY_I2C_BUS_SUCCESS = 0,
+    CY_I2C_BUS_TIMEOUT,                             /* The bus was not granted within the timeout. */
+    CY_I2C_BUS_PENDING,                             /* Queued, the grant callback runs once the bus is granted. */
+    CY_I2C_BUS_BAD_PARAM
+} cy_en_i2c_bus_status_t;
+
+/* Called by the releasing task once a queued request got the bus. Must not block or touch SCB0. */
+typedef void (*cy_cb_i2c_bus_grant_t)(void *pArg);
+
+/* A user of SCB0. Only one task at a time may acquire the bus through a given client. */
+typedef struct cy_stc_i2c_bus_client_
+{
+    const char *name;
+    uint8_t priority;
+    bool waiting;                                   /* Blocked in Cy_USB_I2CBusAcquire or queued by Cy_USB_I2CBusRequest. */
+    uint8_t nestCount;                              /* Acquires made while already owning the bus. */
+    SemaphoreHandle_t grantSem;                     /* Given by the releasing client on hand over. */
+    cy_cb_i2c_bus_grant_t grantCb;                  /* Called instead on hand over to a queued request. */
+    void *pGrantArg;
+    uint32_t requestUs;                             /* pal_os_timer time of the pending acquire. */
+    uint32_t grantCount;                            /* Number of times the bus was granted. */
+    uint32_t contendedCount;                        /* Grants which had to wait for another client. */
+    uint32_t timeoutCount;
+    uint32_t totalWaitUs;                           /* Microseconds, I2C frames are far shorter than a tick. */
+    uint32_t maxWaitUs;
+    struct cy_stc_i2c_bus_client_ *pNext;
+} cy_stc_i2c_bus_client_t;
+
+/**
+ * \name Cy_USB_I2CBusClientInit
+ * \brief Register a client of the SCB0 bus. Registering the same client again only updates its priority.
+ * \param pClient
+ * \param name
+ * \param priority I2C_BUS_PRIO_xxx
+ * \retval None
+ */
+void Cy_USB_I2CBusClientInit(cy_stc_i2c_bus_client_t *pClient, const char *name, uint8_t priority);
+
+/**
+ * \name Cy_USB_I2CBusAcquire
+ * \brief Acquire the SCB0 bus, waiting behind the current owner if needed. Task context only.
+ *        The owner may acquire again, each acquire is then undone by one Cy_USB_I2CBusRelease.
+ *        The RTOS timer task must never block, a timeout given from it is taken as 0. It queues
+ *        with Cy_USB_I2CBusRequest instead.
+ * \param pClient
+ * \param timeout Ticks to wait, 0 to only try
+ * \retval status
+ */
+cy_en_i2c_bus_status_t Cy_USB_I2CBusAcquire(cy_stc_i2c_bus_client_t *pClient, TickType_t timeout);
+
+/**
+ * \name Cy_USB_I2CBusRequest
+ * \brief Acquire the SCB0 bus without blocking. When it is owned by another client, the request is
+ *        queued like a blocked Cy_USB_I2CBusAcquire and grantCb is called by the releasing task once
+ *        the bus is handed over. For callers which must not block, e.g. the RTOS timer task.
+ * \param pClient
+ * \param grantCb Called on a later grant only, not when CY_I2C_BUS_SUCCESS is returned
+ * \param pArg Passed to grantCb
+ * \retval CY_I2C_BUS_SUCCESS when acquired at once, CY_I2C_BUS_PENDING when queued
+ */
+cy_en_i2c_bus_status_t Cy_USB_I2CBusRequest(cy_stc_i2c_bus_client_t *pClient, cy_cb_i2c_bus_grant_t grantCb,
+                                            void *pArg);
+
+/**
+ * \name Cy_USB_I2CBusCancel
+ * \brief Withdraw a request queued by Cy_USB_I2CBusRequest, e.g. once it waited too long
+ * \param pClient
+ * \retval true when withdrawn, false when the bus has been granted meanwhile and is now owned
+ */
+bool Cy_USB_I2CBusCancel(cy_stc_i2c_bus_client_t *pClient);
+
+/**
+ * \name Cy_USB_I2CBusRelease
+ * \brief Release the SCB0 bus and hand it to the most urgent waiting client, once every nested
+ *        acquire has been released. Task context only.
+ * \param pClient
+ * \retval None
+ */
+void Cy_USB_I2CBusRelease(cy_stc_i2c_bus_client_t *pClient);
+
+/**
+ * \name Cy_USB_I2CBusPrintStats
+ * \brief Print the grant and wait time counters of every registered client, wait times in microseconds
+ * \retval None
+ */
+void Cy_USB_I2CBusPrintStats(void);
+
+#endif /* _CY_I2C_BUS_MGR_H_ */
+
+/* End of File */
@@ -0,0 +1,358 @@
+/***************************************************************************//**
+* \file i2c_trace.c
+* \version 1.0
+*
+* \details Records the START, repeated START, data and STOP phases of the SCB0
+*          I2C transfers with a CPU cycle timestamp, and decodes them into
+*          OPTIGA register accesses and IFX I2C frames on dump.
+*
+*******************************************************************************
+* \copyright
+* (c) (2021-2026), Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/* Includes */
+#include "cy_pdl.h"
+#include "cy_debug.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "i2c_trace.h"
+
+#if I2C_TRACE_EN
+
+/* OPTIGA Trust M registers */
+#define OPTIGA_REG_DATA                (0x80u)
+#define OPTIGA_REG_DATA_REG_LEN        (0x81u)
+#define OPTIGA_REG_I2C_STATE           (0x82u)
+#define OPTIGA_REG_MAX_SCL_FREQU       (0x84u)
+#define OPTIGA_REG_SOFT_RESET          (0x88u)
+#define OPTIGA_REG_I2C_MODE            (0x89u)
+
+/* IFX I2C frame control byte */
+#define IFX_FCTR_CONTROL_FRAME_Msk     (0x80u)
+#define IFX_FCTR_SEQCTR_Pos            (5u)
+#define IFX_FCTR_FRNR_Pos              (2u)
+
+static cy_stc_i2c_trace_entry_t i2cTraceBuf[I2C_TRACE_DEPTH];
+static uint32_t i2cTraceCount = 0;                  /* Entries recorded since the last dump. */
+static volatile bool i2cTracePaused = false;
+static volatile bool i2cTraceDumpRequested = false;
+
+/**
+ * \name Cy_USB_I2CTraceTimestamp
+ * \brief Current time in CPU cycles
+ * \retval Cycle count, wrapping at 32 bits
+ */
+static uint32_t Cy_USB_I2CTraceTimestamp(void)
+{
+#if (__CORTEX_M >= 3)
+    return DWT->CYCCNT;
+#else
+    /* No cycle counter on CM0+: rebuild one from the RTOS tick and the SysTick down counter. */
+    uint32_t ticks;
+    uint32_t value;
+    uint32_t reload = Cy_SysTick_GetReload() + 1UL;
+
+    do
+    {
+        ticks = (uint32_t)xTaskGetTickCountFromISR();
+        value = Cy_SysTick_GetValue();
+    } while (ticks != (uint32_t)xTaskGetTickCountFromISR());
+
+    return ((ticks * reload) + (reload - 1UL - value));
+#endif /* (__CORTEX_M >= 3) */
+}
+
+/**
+ * \name Cy_USB_I2CTraceCyclesToUs
+ * \brief Convert a cycle count to microseconds
+ * \param cycles
+ * \retval Microseconds
+ */
+static uint32_t Cy_USB_I2CTraceCyclesToUs(uint32_t cycles)
+{
+    uint32_t cyclesPerUs = SystemCoreClock / 1000000UL;
+
+    return (cyclesPerUs != 0UL) ? (cycles / cyclesPerUs) : cycles;
+}
+
+void Cy_USB_I2CTraceInit(void)
+{
+#if (__CORTEX_M >= 3)
+    /* The counter is shared with the PAL timer, leave it running from where it is. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* (__CORTEX_M >= 3) */
+
+    i2cTraceCount = 0;
+    i2cTracePaused = false;
+}
+
+void Cy_USB_I2CTraceAdd(uint8_t event, uint16_t dev_addr, bool read, uint16_t length, uint32_t status,
+                        const uint8_t *pData)
+{
+    cy_stc_i2c_trace_entry_t *pEntry;
+    uint32_t intState;
+    uint32_t idx;
+
+    intState = Cy_SysLib_EnterCriticalSection();
+    if (i2cTracePaused)
+    {
+        Cy_SysLib_ExitCriticalSection(intState);
+        return;
+    }
+
+    pEntry = &i2cTraceBuf[i2cTraceCount % I2C_TRACE_DEPTH];
+    i2cTraceCount++;
+
+    pEntry->timestamp = Cy_USB_I2CTraceTimestamp();
+    pEntry->status    = status;
+    pEntry->length    = length;
+    pEntry->event     = event;
+    pEntry->address   = (uint8_t)((dev_addr << 1) | ((read) ? 1U : 0U));
+    for (idx = 0; idx < I2C_TRACE_DATA_BYTES; idx++)
+    {
+        pEntry->data[idx] = ((pData != NULL) && (idx < length)) ? pData[idx] : 0U;
+    }
+    Cy_SysLib_ExitCriticalSection(intState);
+}
+
+/**
+ * \name Cy_USB_I2CTraceRegName
+ * \brief Name of an OPTIGA register
+ * \param reg
+ * \retval Name, NULL if not known
+ */
+static const char *Cy_USB_I2CTraceRegName(uint8_t reg)
+{
+    switch (reg)
+    {
+        case OPTIGA_REG_DATA:           return "DATA";
+        case OPTIGA_REG_DATA_REG_LEN:   return "DATA_REG_LEN";
+        case OPTIGA_REG_I2C_STATE:      return "I2C_STATE";
+        case OPTIGA_REG_MAX_SCL_FREQU:  return "MAX_SCL_FREQU";
+        case OPTIGA_REG_SOFT_RESET:     return "SOFT_RESET";
+        case OPTIGA_REG_I2C_MODE:       return "I2C_MODE";
+        default:                        return NULL;
+    }
+}
+
+/**
+ * \name Cy_USB_I2CTracePrintFrame
+ * \brief Print the IFX I2C frame header found at the start of a DATA register access
+ * \param pFrame Frame control byte followed by the 16-bit frame length
+ * \param length Bytes available at pFrame
+ * \retval None
+ */
+static void Cy_USB_I2CTracePrintFrame(const uint8_t *pFrame, uint32_t length)
+{
+    uint8_t fctr;
+
+    if (length < 3U)
+    {
+        return;
+    }
+
+    fctr = pFrame[0];
+    if ((fctr & IFX_FCTR_CONTROL_FRAME_Msk) != 0U)
+    {
+        DBG_APP_INFO("        control frame seqctr %d ack %d\r\n",
+                     (fctr >> IFX_FCTR_SEQCTR_Pos) & 0x3U, fctr & 0x3U);
+    }
+    else
+    {
+        DBG_APP_INFO("        data frame frnr %d ack %d payload %d\r\n", (fctr >> IFX_FCTR_FRNR_Pos) & 0x3U,
+                     fctr & 0x3U, ((uint32_t)pFrame[1] << 8) | pFrame[2]);
+    }
+}
+
+void Cy_USB_I2CTraceDump(void)
+{
+    const cy_stc_i2c_trace_entry_t *pEntry;
+    uint32_t intState;
+    uint32_t count;
+    uint32_t first;
+    uint32_t idx;
+    uint32_t frameStart = 0;
+    uint32_t lastStop = 0;
+    bool haveStop = false;
+    bool inFrame = false;
+    bool frameRead = false;
+    uint16_t frameLen = 0;
+    uint32_t frameStatus = 0;
+    uint8_t frameData[I2C_TRACE_DATA_BYTES] = {0};
+    uint8_t frameAddr = 0;
+    uint8_t curReg = 0;
+    uint32_t guard = 0;
+    uint32_t busTime;
+    uint32_t frames = 0;
+    uint32_t pollFrames = 0;
+    uint32_t totalBus = 0;
+    uint32_t totalGuard = 0;
+    uint32_t totalPoll = 0;
+    bool frameRestart = false;
+    bool lastRegSelect = false;
+    uint32_t regSelectStart = 0;
+    uint32_t splitReads = 0;
+    uint32_t splitTime = 0;
+    uint32_t combinedReads = 0;
+    uint32_t combinedTime = 0;
+    const char *pRegName;
+
+    /* Stop recording and take the entry count together, so that no transfer interrupt adds an entry
+     * between the two. A dump already running in another task keeps the trace. */
+    intState = Cy_SysLib_EnterCriticalSection();
+    if (i2cTracePaused)
+    {
+        Cy_SysLib_ExitCriticalSection(intState);
+        return;
+    }
+    i2cTracePaused = true;
+    count = i2cTraceCount;
+    Cy_SysLib_ExitCriticalSection(intState);
+
+    first = (count > I2C_TRACE_DEPTH) ? (count - I2C_TRACE_DEPTH) : 0UL;
+    DBG_APP_INFO("I2C trace: %d events, %d lost\r\n", count - first, first);
+
+    for (idx = first; idx < count; idx++)
+    {
+        pEntry = &i2cTraceBuf[idx % I2C_TRACE_DEPTH];
+
+        switch (pEntry->event)
+        {
+            case I2C_TRACE_EVT_START:
+            case I2C_TRACE_EVT_RESTART:
+                if (!inFrame)
+                {
+                    frameStart = pEntry->timestamp;
+                    guard = (haveStop) ? (pEntry->timestamp - lastStop) : 0UL;
+                    inFrame = true;
+                    frameRestart = false;
+                }
+                else
+                {
+                    frameRestart = true;
+                }
+                frameAddr = pEntry->address;
+                frameRead = ((pEntry->address & 0x01U) != 0U);
+                break;
+
+            case I2C_TRACE_EVT_DATA:
+                frameLen = pEntry->length;
+                frameStatus = pEntry->status;
+                memcpy(frameData, pEntry->data, sizeof(frameData));
+
+                /* A write of the register address selects the register for the next read, which
+                 * follows either after a STOP or with a ReSTART in the same frame. */
+                if ((!frameRead) && (frameLen != 0U))
+                {
+                    curReg = frameData[0];
+                }
+                break;
+
+            case I2C_TRACE_EVT_STOP:
+                if (!inFrame)
+                {
+                    break;
+                }
+                busTime = pEntry->timestamp - frameStart;
+                inFrame = false;
+                haveStop = true;
+                lastStop = pEntry->timestamp;
+                frames++;
+                totalBus += busTime;
+                totalGuard += guard;
+
+                /* Register read latency: from the START of the address write to the STOP of the
+                 * read, whether split in two frames or combined with a ReSTART. */
+                if ((frameRead) && (frameStatus == 0UL) && (frameRestart))
+                {
+                    combinedReads++;
+                    combinedTime += busTime;
+                }
+                else if ((frameRead) && (frameStatus == 0UL) && (lastRegSelect))
+                {
+                    splitReads++;
+                    splitTime += pEntry->timestamp - regSelectStart;
+                }
+                lastRegSelect = ((!frameRead) && (frameLen == 1U) && (frameStatus == 0UL));
+                regSelectStart = frameStart;
+
+                pRegName = Cy_USB_I2CTraceRegName(curReg);
+                DBG_APP_INFO("#%d %s 0x%x %s len %d st 0x%x bus %dus guard %dus\r\n", frames,
+                             (frameRestart) ? "WR+RD" : ((frameRead) ? "RD" : "WR"), frameAddr >> 1, (pRegName != NULL) ? pRegName : "?",
+                             frameLen, frameStatus, Cy_USB_I2CTraceCyclesToUs(busTime),
+                             Cy_USB_I2CTraceCyclesToUs(guard));
+
+                /* I2C_STATE reads and NACKed attempts are the OPTIGA being polled until it is ready. */
+                if ((curReg == OPTIGA_REG_I2C_STATE) || (frameStatus != 0UL))
+                {
+                    pollFrames++;
+                    totalPoll += busTime + guard;
+                }
+                else if ((curReg == OPTIGA_REG_DATA) && (frameStatus == 0UL))
+                {
+                    if (frameRead)
+                    {
+                        Cy_USB_I2CTracePrintFrame(frameData, frameLen);
+                    }
+                    else if (frameLen > 1U)
+                    {
+                        Cy_USB_I2CTracePrintFrame(&frameData[1], frameLen - 1U);
+                    }
+                }
+#if USBFS_LOGS_ENABLE
+                vTaskDelay(10);
+#endif /* USBFS_LOGS_ENABLE */
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    DBG_APP_INFO("I2C trace: %d frames, bus %dus, guard %dus, polling %d frames %dus\r\n", frames,
+                 Cy_USB_I2CTraceCyclesToUs(totalBus), Cy_USB_I2CTraceCyclesToUs(totalGuard), pollFrames,
+                 Cy_USB_I2CTraceCyclesToUs(totalPoll));
+    DBG_APP_INFO("I2C trace: register reads split %d avg %dus, combined %d avg %dus\r\n", splitReads,
+                 (splitReads != 0UL) ? Cy_USB_I2CTraceCyclesToUs(splitTime / splitReads) : 0UL, combinedReads,
+                 (combinedReads != 0UL) ? Cy_USB_I2CTraceCyclesToUs(combinedTime / combinedReads) : 0UL);
+
+    intState = Cy_SysLib_EnterCriticalSection();
+    i2cTraceCount = 0;
+    i2cTracePaused = false;
+    Cy_SysLib_ExitCriticalSection(intState);
+}
+
+void Cy_USB_I2CTraceRequestDump(void)
+{
+    i2cTraceDumpRequested = true;
+}
+
+void Cy_USB_I2CTraceService(void)
+{
+    if (i2cTraceDumpRequested)
+    {
+        i2cTraceDumpRequested = false;
+        Cy_USB_I2CTraceDump();
+    }
+}
+
+#endif /* I2C_TRACE_EN */
+
+/* End of File */
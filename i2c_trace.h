@@ -0,0 +1,109 @@
+/***************************************************************************//**
+* \file i2c_trace.h
+* \version 1.0
+*
+* \brief Defines the SCB0 I2C transaction trace buffer
+*
+*******************************************************************************
+* \copyright
+* (c) (2021-2026), Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef _CY_I2C_TRACE_H_
+#define _CY_I2C_TRACE_H_
+
+#include "cy_pdl.h"
+
+/* Number of entries kept, the oldest ones are overwritten. */
+#ifndef I2C_TRACE_DEPTH
+#define I2C_TRACE_DEPTH                (128u)
+#endif
+
+/* Leading bytes of every data phase kept in the trace. */
+#define I2C_TRACE_DATA_BYTES           (4u)
+
+/* Trace events */
+#define I2C_TRACE_EVT_START            (1u)         /* START and address sent. */
+#define I2C_TRACE_EVT_RESTART          (2u)         /* Repeated START and address sent. */
+#define I2C_TRACE_EVT_DATA             (3u)         /* Data phase ended, with byte count and status. */
+#define I2C_TRACE_EVT_STOP             (4u)         /* STOP sent, the bus is free. */
+
+typedef struct
+{
+    uint32_t timestamp;                             /* CPU cycles. */
+    uint32_t status;                                /* Driver status of the data phase, 0 on success. */
+    uint16_t length;                                /* Bytes moved in the data phase. */
+    uint8_t event;                                  /* I2C_TRACE_EVT_xxx */
+    uint8_t address;                                /* Address byte on the wire, bit 0 set for a read. */
+    uint8_t data[I2C_TRACE_DATA_BYTES];
+} cy_stc_i2c_trace_entry_t;
+
+#if I2C_TRACE_EN
+/**
+ * \name Cy_USB_I2CTraceInit
+ * \brief Start the cycle counter used for the timestamps and empty the trace
+ * \retval None
+ */
+void Cy_USB_I2CTraceInit(void);
+
+/**
+ * \name Cy_USB_I2CTraceAdd
+ * \brief Record one trace event. Callable from task and interrupt context.
+ * \param event I2C_TRACE_EVT_xxx
+ * \param dev_addr 7-bit address
+ * \param read
+ * \param length
+ * \param status
+ * \param pData Data of the phase, may be NULL
+ * \retval None
+ */
+void Cy_USB_I2CTraceAdd(uint8_t event, uint16_t dev_addr, bool read, uint16_t length, uint32_t status,
+                        const uint8_t *pData);
+
+/**
+ * \name Cy_USB_I2CTraceDump
+ * \brief Print the trace as decoded I2C frames with bus, guard and polling time, then empty it
+ * \retval None
+ */
+void Cy_USB_I2CTraceDump(void);
+
+/**
+ * \name Cy_USB_I2CTraceRequestDump
+ * \brief Ask for a dump of the trace by the log task, for a vendor request or a button. Callable from
+ * task and interrupt context.
+ * \retval None
+ */
+void Cy_USB_I2CTraceRequestDump(void);
+
+/**
+ * \name Cy_USB_I2CTraceService
+ * \brief Dump the trace if Cy_USB_I2CTraceRequestDump was called since the last call, from the log task
+ * \retval None
+ */
+void Cy_USB_I2CTraceService(void);
+
+#define I2C_TRACE_ADD(event, dev_addr, read, length, status, pData) \
+    Cy_USB_I2CTraceAdd((event), (dev_addr), (read), (length), (uint32_t)(status), (pData))
+#else
+#define I2C_TRACE_ADD(event, dev_addr, read, length, status, pData) \
+    do { (void)(dev_addr); (void)(length); (void)(status); (void)(pData); } while (0)
+#endif /* I2C_TRACE_EN */
+
+#endif /* _CY_I2C_TRACE_H_ */
+
+/* End of File */
@@ -35,6 +35,12 @@
 
 /* Optiga related includes */
 #include "optiga_app.h"
+#include "optiga_service.h"
+#include "optiga_keypool.h"
+#include "optiga_entropy.h"
+#include "optiga_hash.h"
+#include "optiga_hbhash.h"
+#include "i2c_trace.h"
 #include <stdint.h>
 
 #if DEBUG_INFRA_EN
@@ -92,6 +98,11 @@ void PrintTaskHandler(void *pTaskParam)
         /* Print any pending logs to the output console. */
         Cy_Debug_PrintLog();
 
+#if I2C_TRACE_EN
+        /* Dump the I2C trace when asked for through Cy_USB_I2CTraceRequestDump. */
+        Cy_USB_I2CTraceService();
+#endif /* I2C_TRACE_EN */
+
         /* Put the thread to sleep for 5 ms */
         vTaskDelay(pdMS_TO_TICKS(5));
     }
@@ -179,9 +190,44 @@ void OptigaApplication(void * nothing){
 #if USBFS_LOGS_ENABLE
     vTaskDelay(1000);
 #endif
+#if I2C_TRACE_EN
+    Cy_USB_I2CTraceInit();
+#endif /* I2C_TRACE_EN */
     Cy_Optiga_Init();
+#if OPTIGA_KEYPOOL_EN
+    /* Fills the free key slots whenever the application leaves the chips idle. */
+    (void)Cy_Optiga_KeyPoolInit();
+#endif /* OPTIGA_KEYPOOL_EN */
+#if OPTIGA_ENTROPY_EN
+    /* Keeps TRNG bytes in RAM for nonces and challenges. */
+    (void)Cy_Optiga_EntropyInit();
+#endif /* OPTIGA_ENTROPY_EN */
     Cy_Optiga_Main();
+#if OPTIGA_HASH_BENCH_EN
+    Cy_Optiga_HashBench();
+#endif /* OPTIGA_HASH_BENCH_EN */
+#if OPTIGA_HBHASH_EN
+    /* Streams an image through HBDMA buffers and the in place hash stage. */
+    Cy_Optiga_HbHashDemo();
+#endif /* OPTIGA_HBHASH_EN */
+#if OPTIGA_SVC_EN
+    /* The chips stay open for the requests queued by the other tasks. */
+    if (Cy_Optiga_SvcInit()) {
+        Cy_Optiga_SvcDemo();
+#if I2C_TRACE_EN
+        Cy_USB_I2CTraceDump();
+#endif /* I2C_TRACE_EN */
+        vTaskDelete(NULL);
+    }
+#endif /* OPTIGA_SVC_EN */
+#if OPTIGA_KEYPOOL_EN || OPTIGA_ENTROPY_EN
+    /* The chips stay open for the key pool and entropy pool refills. */
+    vTaskDelete(NULL);
+#endif /* OPTIGA_KEYPOOL_EN || OPTIGA_ENTROPY_EN */
     Cy_Optiga_Deinit();
+#if I2C_TRACE_EN
+    Cy_USB_I2CTraceDump();
+#endif /* I2C_TRACE_EN */
 
     while(true);
 }
@@ -217,6 +263,8 @@ int main (void)
 
     /* Initialize appCtxt */
     memset((uint8_t *)&appCtxt, 0, sizeof(appCtxt));
+    appCtxt.pCpuDw0Base = DW0;
+    appCtxt.pCpuDw1Base = DW1;
 
     /* Initialize the PDL and register ISR for USB block. */
     Logging_Init();
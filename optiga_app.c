@@ -36,64 +36,260 @@
 
 /* Includes */
 #include "optiga_app.h"
+#include "optiga_keypool.h"
+#include "optiga_entropy.h"
+#include "optiga_hash.h"
+#include "p256_verify.h"
+#include "i2c_bus_mgr.h"
 #include "cy_debug.h"
 #include "pal_os_memory.h"
 #include "pal_os_timer.h"
+#include "semphr.h"
+#include <string.h>
 
-/* This variable is updated based on asynchronous Optiga operations */
-static volatile optiga_lib_status_t optiga_lib_status;
+/**
+ * \name Cy_Optiga_OpInit
+ * \brief Prepare an operation context before passing it to optiga_util_create/optiga_crypt_create
+ * \param p_op
+ * \retval None
+ */
+void Cy_Optiga_OpInit(cy_stc_optiga_op_t *p_op)
+{
+    p_op->status = OPTIGA_LIB_SUCCESS;
+    p_op->startUs = 0;
+    p_op->durationUs = 0;
+    p_op->abandoned = false;
+    p_op->done = xSemaphoreCreateBinaryStatic(&p_op->doneBuffer);
+}
 
 /**
- * \name optiga_lib_callback
- * \brief Callback when optiga_lib_xxxx operation is completed asynchronously
- * \param context
+ * \name Cy_Optiga_OpCallback
+ * \brief Callback of util and crypt instances created with a cy_stc_optiga_op_t as context
+ * \param context The cy_stc_optiga_op_t of the instance
  * \param return_status
  * \retval None
  */
-// lint --e{818} suppress "argument "context" is not used in the sample provided"
-static void optiga_lib_callback(void *context, optiga_lib_status_t return_status) {
-    optiga_lib_status = return_status;
-    if (NULL != context) {
-        // callback to upper layer here
+void Cy_Optiga_OpCallback(void *context, optiga_lib_status_t return_status)
+{
+    cy_stc_optiga_op_t *p_op = (cy_stc_optiga_op_t *)context;
+
+    taskENTER_CRITICAL();
+    if (p_op->abandoned) {
+        /* Its waiter gave up, the status may already belong to the next operation. */
+        p_op->abandoned = false;
+        taskEXIT_CRITICAL();
+        return;
     }
+    p_op->durationUs = pal_os_timer_get_time_in_microseconds() - p_op->startUs;
+    p_op->status = return_status;
+    taskEXIT_CRITICAL();
+    (void)xSemaphoreGive(p_op->done);
 }
 
 /**
- * \name optiga_crypt_callback
- * \brief Callback when optiga_crypt_xxxx operation is completed asynchronously
- * \param context
- * \param return_status
+ * \name Cy_Optiga_OpStart
+ * \brief Mark an operation as running, call right before starting it on the instance
+ * \param p_op
  * \retval None
  */
-//lint --e{818} suppress "argument "context" is not used in the sample provided"
-static void optiga_crypt_callback(void * context, optiga_lib_status_t return_status)
+void Cy_Optiga_OpStart(cy_stc_optiga_op_t *p_op)
 {
-    optiga_lib_status = return_status;
-    if (NULL != context)
-    {
-        // callback to upper layer here
+    p_op->status = OPTIGA_LIB_BUSY;
+    p_op->startUs = pal_os_timer_get_time_in_microseconds();
+}
+
+/**
+ * \name Cy_Optiga_OpWait
+ * \brief Block until an asynchronous operation completes, leaving the CPU to other tasks meanwhile
+ * \param p_op
+ * \param return_status Status returned when starting the operation
+ * \param timeout_ms
+ * \retval Final status of the operation, OPTIGA_APP_ERR_TIMEOUT if it did not complete in time
+ */
+optiga_lib_status_t Cy_Optiga_OpWait(cy_stc_optiga_op_t *p_op, optiga_lib_status_t return_status, uint32_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+    TickType_t elapsed;
+
+    if (OPTIGA_LIB_SUCCESS != return_status) {
+        /* The library refuses an instance whose last operation has not called back yet. */
+        if (p_op->abandoned) {
+            OPTIGA_LOG_ERROR("Operation refused, the previous one timed out and is still running");
+            return_status = OPTIGA_APP_ERR_OP_PENDING;
+        }
+        p_op->status = return_status;
+        return return_status;
     }
+
+    /* A give left over from an operation which completed right at its timeout only costs one more round. */
+    while (OPTIGA_LIB_BUSY == p_op->status) {
+        elapsed = xTaskGetTickCount() - start;
+        if ((elapsed >= timeout) || (pdTRUE != xSemaphoreTake(p_op->done, timeout - elapsed))) {
+            taskENTER_CRITICAL();
+            if (OPTIGA_LIB_BUSY == p_op->status) {
+                p_op->abandoned = true;
+                p_op->status = OPTIGA_APP_ERR_TIMEOUT;
+            }
+            taskEXIT_CRITICAL();
+            if (OPTIGA_APP_ERR_TIMEOUT == p_op->status) {
+                OPTIGA_LOG_ERROR("Operation not completed within %dms", timeout_ms);
+                return OPTIGA_APP_ERR_TIMEOUT;
+            }
+        }
+    }
+    return p_op->status;
 }
 
 /**
- * \name optiga_util_callback
- * \brief Callback when optiga_util_xxxx operation is completed asynchronously
- * \param context
- * \param return_status
+ * \name Cy_Optiga_OpPending
+ * \brief Check whether an operation context is still in use, running or waiting for a late callback
+ * \param p_op
+ * \retval true while the context must not be reused
+ */
+bool Cy_Optiga_OpPending(const cy_stc_optiga_op_t *p_op)
+{
+    return (OPTIGA_LIB_BUSY == p_op->status) || (p_op->abandoned);
+}
+
+/* Util and crypt instance pairs of chip 0, created once by Cy_Optiga_Init and lent out by Cy_Optiga_InstAcquire */
+static cy_stc_optiga_inst_t optiga_inst_pool[OPTIGA_APP_INST_POOL_SIZE];
+
+/* Shadow copies of object metadata as last read from chip 0, refilled round robin */
+static struct
+{
+    uint16_t oid;
+    uint16_t length;
+    bool valid;
+    uint8_t data[OPTIGA_APP_METADATA_MAX_LENGTH];
+} optiga_metadata_cache[OPTIGA_APP_METADATA_CACHE_SIZE];
+static uint8_t optiga_metadata_next = 0;
+/* Bumped by every invalidate, a chip read which spans one does not refill its shadow */
+static uint32_t optiga_metadata_epoch = 0;
+static cy_stc_optiga_metadata_stats_t optiga_metadata_stats;
+
+/* Public keys decoded for MCU verifies with the encoding they came from, refilled round robin */
+static cy_stc_p256_key_t optiga_verify_keys[OPTIGA_APP_VERIFY_KEY_CACHE];
+static struct
+{
+    uint16_t length;
+    bool valid;
+    uint8_t encoding[P256_PUBKEY_BITSTRING_LENGTH];
+} optiga_verify_key_src[OPTIGA_APP_VERIFY_KEY_CACHE];
+static uint8_t optiga_verify_key_next = 0;
+static SemaphoreHandle_t optiga_verify_lock = NULL;
+static StaticSemaphore_t optiga_verify_lock_buffer;
+
+/**
+ * \name Cy_Optiga_InstPoolDestroy
+ * \brief Destroy the instances of the pool
  * \retval None
  */
-//lint --e{818} suppress "argument "context" is not used in the sample provided"
-static void optiga_util_callback(void * context, optiga_lib_status_t return_status)
+static void Cy_Optiga_InstPoolDestroy(void)
 {
-    optiga_lib_status = return_status;
-    if (NULL != context)
-    {
-        // callback to upper layer here
+    uint8_t i;
+
+    for (i = 0; i < OPTIGA_APP_INST_POOL_SIZE; i++) {
+        if (NULL != optiga_inst_pool[i].crypt) {
+            (void)optiga_crypt_destroy(optiga_inst_pool[i].crypt);
+            optiga_inst_pool[i].crypt = NULL;
+        }
+        if (NULL != optiga_inst_pool[i].util) {
+            (void)optiga_util_destroy(optiga_inst_pool[i].util);
+            optiga_inst_pool[i].util = NULL;
+        }
+        optiga_inst_pool[i].in_use = false;
+    }
+}
+
+/**
+ * \name Cy_Optiga_InstPoolCreate
+ * \brief Create the instances of the pool, the only library allocations of the application
+ * \retval true if every pair of the pool was created
+ */
+static bool Cy_Optiga_InstPoolCreate(void)
+{
+    cy_stc_optiga_inst_t *p_inst;
+    uint8_t i;
+
+    for (i = 0; i < OPTIGA_APP_INST_POOL_SIZE; i++) {
+        p_inst = &optiga_inst_pool[i];
+        if (NULL != p_inst->util) {
+            continue;
+        }
+        /* arg1 OPTIGA_INSTANCE_ID_0 replaced with direct value 0 */
+        Cy_Optiga_OpInit(&p_inst->op);
+        p_inst->util = optiga_util_create(0, Cy_Optiga_OpCallback, &p_inst->op);
+        p_inst->crypt = optiga_crypt_create(0, Cy_Optiga_OpCallback, &p_inst->op);
+        if ((NULL == p_inst->util) || (NULL == p_inst->crypt)) {
+            Cy_Optiga_InstPoolDestroy();
+            return false;
+        }
+        p_inst->in_use = false;
+    }
+    return true;
+}
+
+/**
+ * \name Cy_Optiga_InstAcquire
+ * \brief Borrow a util and crypt instance pair of chip 0
+ * \retval The pair, NULL if all pairs are in use
+ */
+cy_stc_optiga_inst_t *Cy_Optiga_InstAcquire(void)
+{
+    cy_stc_optiga_inst_t *p_inst = NULL;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_APP_INST_POOL_SIZE; i++) {
+        /* A pair whose last operation timed out comes back once the library called it back. */
+        if ((NULL != optiga_inst_pool[i].util) && (!optiga_inst_pool[i].in_use) &&
+            (!optiga_inst_pool[i].op.abandoned)) {
+            optiga_inst_pool[i].in_use = true;
+            p_inst = &optiga_inst_pool[i];
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL == p_inst) {
+        OPTIGA_LOG_ERROR("Instance pool exhausted, %d pairs", OPTIGA_APP_INST_POOL_SIZE);
     }
+    return p_inst;
 }
 
-/* Used to manage application on the Optiga */
-optiga_util_t * me_util_instance = NULL;
+/**
+ * \name Cy_Optiga_InstRelease
+ * \brief Return a pair taken with Cy_Optiga_InstAcquire once its last operation completed
+ * \param p_inst
+ * \retval None
+ */
+void Cy_Optiga_InstRelease(cy_stc_optiga_inst_t *p_inst)
+{
+    if (NULL != p_inst) {
+        taskENTER_CRITICAL();
+        p_inst->in_use = false;
+        taskEXIT_CRITICAL();
+    }
+}
+
+/**
+ * \name Cy_Optiga_InstPoolIdle
+ * \brief Check that no instance pair is lent out or waiting for a late callback
+ * \retval true if background work would not delay any caller
+ */
+bool Cy_Optiga_InstPoolIdle(void)
+{
+    bool idle = true;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_APP_INST_POOL_SIZE; i++) {
+        idle = idle && (!optiga_inst_pool[i].in_use) && (!optiga_inst_pool[i].op.abandoned);
+    }
+    taskEXIT_CRITICAL();
+    return idle;
+}
 
 /**
  * \name Cy_Optiga_Init
@@ -102,28 +298,32 @@ optiga_util_t * me_util_instance = NULL;
  */
 void Cy_Optiga_Init(void) {
     optiga_lib_status_t return_status = !OPTIGA_LIB_SUCCESS;
+    cy_stc_optiga_inst_t *p_inst = NULL;
     pal_init();
+    /* The chip may have been replaced or written by someone else since the last session. */
+    Cy_Optiga_MetadataInvalidate(0xFFFF);
     do {
-        if (NULL == me_util_instance) {
-            /* Create an instance of optiga_util to open the application on OPTIGA. */
-            /* arg1 OPTIGA_INSTANCE_ID_0 replaced with direct value 0 */
-            me_util_instance = optiga_util_create(0, optiga_lib_callback, NULL);
-            if (NULL == me_util_instance) {
-                OPTIGA_LOG_ERROR("Util Instance Could NOT be Created!\r\n");
-                break;
-            }
+        /* Create the instances once, every later user borrows them from the pool. */
+        if (!Cy_Optiga_InstPoolCreate()) {
+            OPTIGA_LOG_ERROR("Instance Pool Could NOT be Created!\r\n");
+            break;
         }
-        
+        p_inst = Cy_Optiga_InstAcquire();
+        if (NULL == p_inst) {
+            break;
+        }
+
         /**
          * Open the application on OPTIGA which is a precondition to perform any other operations
          * using optiga_util_open_application
          */
-         optiga_lib_status = OPTIGA_LIB_BUSY;
-        return_status = optiga_util_open_application(me_util_instance, 0);
-        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+        Cy_Optiga_OpStart(&p_inst->op);
+        return_status = optiga_util_open_application(p_inst->util, 0);
+        WAIT_AND_CHECK_STATUS(return_status, p_inst->op);
         OPTIGA_LOG_MESSAGE("Util Application Opened");
 
     }while(FALSE);
+    Cy_Optiga_InstRelease(p_inst);
      OPTIGA_LOG_STATUS(__FUNCTION__, return_status);
 }
 
@@ -134,25 +334,486 @@ void Cy_Optiga_Init(void) {
  */
 void Cy_Optiga_Deinit(void) {
     optiga_lib_status_t return_status = !OPTIGA_LIB_SUCCESS;
+    cy_stc_optiga_inst_t *p_inst = NULL;
+
     do {
+        p_inst = Cy_Optiga_InstAcquire();
+        if (NULL == p_inst) {
+            break;
+        }
+
         /**
          * Close the application on OPTIGA after all the operations are executed
          * using optiga_util_close_application
          */
-        optiga_lib_status = OPTIGA_LIB_BUSY;
-        return_status = optiga_util_close_application(me_util_instance, 0);
-
-        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+        Cy_Optiga_OpStart(&p_inst->op);
+        return_status = optiga_util_close_application(p_inst->util, 0);
 
-        /* destroy util and crypt instances */
-        // lint --e{534} suppress "Error handling is not required so return value is not checked"
-        optiga_util_destroy(me_util_instance);
-        me_util_instance = NULL;
+        WAIT_AND_CHECK_STATUS(return_status, p_inst->op);
     } while (FALSE);
+    Cy_Optiga_InstRelease(p_inst);
+
+    /* destroy util and crypt instances */
+    Cy_Optiga_InstPoolDestroy();
     pal_deinit();
     OPTIGA_LOG_STATUS(__FUNCTION__, return_status);
 }
 
+/**
+ * \name Cy_Optiga_Sign
+ * \brief ECDSA sign a digest with a key of the chip, on an instance pair borrowed from the pool
+ * \param key_id
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length In: size of signature, out: length of the DER encoded signature
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_Sign(optiga_key_id_t key_id, const uint8_t *digest, uint8_t digest_length,
+                                   uint8_t *signature, uint16_t *signature_length)
+{
+    optiga_lib_status_t return_status;
+    cy_stc_optiga_inst_t *p_inst = Cy_Optiga_InstAcquire();
+
+    if (NULL == p_inst) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+
+    Cy_Optiga_OpStart(&p_inst->op);
+    return_status = optiga_crypt_ecdsa_sign(p_inst->crypt, digest, digest_length, key_id, signature,
+                                            signature_length);
+    return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    Cy_Optiga_InstRelease(p_inst);
+
+    return return_status;
+}
+
+/**
+ * \name Cy_Optiga_Verify
+ * \brief ECDSA verify a signature with a host provided public key on the chip
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param public_key
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_Verify(const uint8_t *digest, uint8_t digest_length, const uint8_t *signature,
+                                     uint16_t signature_length, const public_key_from_host_t *public_key)
+{
+    optiga_lib_status_t return_status;
+    cy_stc_optiga_inst_t *p_inst = Cy_Optiga_InstAcquire();
+
+    if (NULL == p_inst) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+
+    Cy_Optiga_OpStart(&p_inst->op);
+    return_status = optiga_crypt_ecdsa_verify(p_inst->crypt, digest, digest_length, signature, signature_length,
+                                              OPTIGA_CRYPT_HOST_DATA, public_key);
+    return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    Cy_Optiga_InstRelease(p_inst);
+
+    return return_status;
+}
+
+/**
+ * \name Cy_Optiga_VerifyWith
+ * \brief ECDSA verify a signature with a host provided P-256 public key on the selected engine
+ * \param engine
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param public_key
+ * \retval Status of the operation, OPTIGA_APP_ERR_SIGNATURE for a signature rejected on the MCU
+ */
+optiga_lib_status_t Cy_Optiga_VerifyWith(cy_en_optiga_verify_engine_t engine, const uint8_t *digest,
+                                         uint8_t digest_length, const uint8_t *signature,
+                                         uint16_t signature_length, const public_key_from_host_t *public_key)
+{
+    cy_stc_optiga_verify_item_t item;
+
+    if (CY_OPTIGA_VERIFY_CHIP == engine) {
+        return Cy_Optiga_Verify(digest, digest_length, signature, signature_length, public_key);
+    }
+
+    /* A batch of one, which keeps the decoded key for the next verify */
+    item.digest = digest;
+    item.digestLength = digest_length;
+    item.signature = signature;
+    item.signatureLength = signature_length;
+    item.keyIndex = 0;
+    item.status = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    (void)Cy_Optiga_VerifyBatch(public_key, 1u, &item, 1u);
+    return item.status;
+}
+
+/**
+ * \name Cy_Optiga_VerifyKeyLookup
+ * \brief Find the decoded form of a public key, decoding it into a slot not used by the current call.
+ *        Called with optiga_verify_lock held.
+ * \param public_key
+ * \param busy Slots already holding keys of the current call, the chosen slot is added
+ * \retval Slot index, -1 if the key is not a valid P-256 public key
+ */
+static int8_t Cy_Optiga_VerifyKeyLookup(const public_key_from_host_t *public_key, bool *busy)
+{
+    uint8_t i;
+    uint8_t slot;
+
+    if ((NULL == public_key->public_key) || ((uint8_t)OPTIGA_ECC_CURVE_NIST_P_256 != public_key->key_type) ||
+        (public_key->length > P256_PUBKEY_BITSTRING_LENGTH)) {
+        return -1;
+    }
+    for (i = 0; i < OPTIGA_APP_VERIFY_KEY_CACHE; i++) {
+        if ((optiga_verify_key_src[i].valid) && (optiga_verify_key_src[i].length == public_key->length) &&
+            (0 == memcmp(optiga_verify_key_src[i].encoding, public_key->public_key, public_key->length))) {
+            busy[i] = true;
+            return (int8_t)i;
+        }
+    }
+
+    /* Not kept: take the next slot round robin, skipping the ones this call still needs */
+    do {
+        slot = optiga_verify_key_next;
+        optiga_verify_key_next = (uint8_t)((optiga_verify_key_next + 1u) % OPTIGA_APP_VERIFY_KEY_CACHE);
+    } while (busy[slot]);
+
+    optiga_verify_key_src[slot].valid = false;
+    if (CY_P256_SUCCESS != Cy_P256_KeyInit(&optiga_verify_keys[slot], public_key->public_key, public_key->length)) {
+        return -1;
+    }
+    memcpy(optiga_verify_key_src[slot].encoding, public_key->public_key, public_key->length);
+    optiga_verify_key_src[slot].length = public_key->length;
+    optiga_verify_key_src[slot].valid = true;
+    busy[slot] = true;
+    return (int8_t)slot;
+}
+
+/**
+ * \name Cy_Optiga_VerifyBatch
+ * \brief ECDSA verify many signatures against a few P-256 public keys on the MCU. Decoded keys and
+ *        their precomputed tables are kept across calls, the items share the inversions of S.
+ * \param public_keys
+ * \param num_keys At most OPTIGA_APP_VERIFY_KEY_CACHE
+ * \param items Each gets its own status
+ * \param num_items
+ * \retval OPTIGA_LIB_SUCCESS if every item verified, OPTIGA_APP_ERR_SIGNATURE if any did not,
+ *         OPTIGA_CRYPT_ERROR_INVALID_INPUT for a bad call
+ */
+optiga_lib_status_t Cy_Optiga_VerifyBatch(const public_key_from_host_t *public_keys, uint8_t num_keys,
+                                          cy_stc_optiga_verify_item_t *items, uint16_t num_items)
+{
+    cy_stc_p256_batch_item_t batch[P256_BATCH_CHUNK];
+    int8_t slots[OPTIGA_APP_VERIFY_KEY_CACHE];
+    bool busy[OPTIGA_APP_VERIFY_KEY_CACHE] = { false };
+    optiga_lib_status_t return_status = OPTIGA_LIB_SUCCESS;
+    uint16_t base, i;
+    uint8_t count;
+
+    if ((NULL == public_keys) || (NULL == items) || (0u == num_keys) || (num_keys > OPTIGA_APP_VERIFY_KEY_CACHE)) {
+        return OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    }
+
+    taskENTER_CRITICAL();
+    if (NULL == optiga_verify_lock) {
+        optiga_verify_lock = xSemaphoreCreateMutexStatic(&optiga_verify_lock_buffer);
+    }
+    taskEXIT_CRITICAL();
+    (void)xSemaphoreTake(optiga_verify_lock, portMAX_DELAY);
+
+    for (i = 0; i < num_keys; i++) {
+        slots[i] = Cy_Optiga_VerifyKeyLookup(&public_keys[i], busy);
+    }
+
+    /* Items naming an undecodable key or one outside the call get a key index the batch rejects */
+    for (base = 0; base < num_items; base = (uint16_t)(base + count)) {
+        count = (uint8_t)((((uint32_t)num_items - base) > P256_BATCH_CHUNK) ? P256_BATCH_CHUNK : (uint32_t)(num_items - base));
+        for (i = 0; i < count; i++) {
+            const cy_stc_optiga_verify_item_t *p_item = &items[base + i];
+
+            batch[i].digest = p_item->digest;
+            batch[i].digestLength = p_item->digestLength;
+            batch[i].signature = p_item->signature;
+            batch[i].signatureLength = p_item->signatureLength;
+            batch[i].keyIndex = ((p_item->keyIndex < num_keys) && (slots[p_item->keyIndex] >= 0)) ?
+                                (uint8_t)slots[p_item->keyIndex] : (uint8_t)OPTIGA_APP_VERIFY_KEY_CACHE;
+        }
+        (void)Cy_P256_VerifyBatch(optiga_verify_keys, OPTIGA_APP_VERIFY_KEY_CACHE, batch, count);
+        for (i = 0; i < count; i++) {
+            optiga_lib_status_t status = OPTIGA_LIB_SUCCESS;
+
+            if (CY_P256_INVALID_SIGNATURE == batch[i].result) {
+                status = OPTIGA_APP_ERR_SIGNATURE;
+            } else if (CY_P256_SUCCESS != batch[i].result) {
+                status = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            }
+            items[base + i].status = status;
+            if (OPTIGA_LIB_SUCCESS != status) {
+                return_status = OPTIGA_APP_ERR_SIGNATURE;
+            }
+        }
+    }
+
+    (void)xSemaphoreGive(optiga_verify_lock);
+    return return_status;
+}
+
+/**
+ * \name Cy_Optiga_GetRandom
+ * \brief Read random bytes from the chip
+ * \param random_data
+ * \param random_data_length
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_GetRandom(uint8_t *random_data, uint16_t random_data_length)
+{
+    optiga_lib_status_t return_status;
+    cy_stc_optiga_inst_t *p_inst = Cy_Optiga_InstAcquire();
+
+    if (NULL == p_inst) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+
+    Cy_Optiga_OpStart(&p_inst->op);
+    return_status = optiga_crypt_random(p_inst->crypt, OPTIGA_RNG_TYPE_TRNG, random_data, random_data_length);
+    return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    Cy_Optiga_InstRelease(p_inst);
+
+    return return_status;
+}
+
+/**
+ * \name Cy_Optiga_Hash
+ * \brief SHA-256 hash a host buffer on the MCU, or on the chip when Cy_Optiga_HashSelect picks it
+ * \param data
+ * \param data_length
+ * \param digest 32 bytes
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_Hash(const uint8_t *data, uint32_t data_length, uint8_t *digest)
+{
+    optiga_lib_status_t return_status;
+    hash_data_from_host_t hash_data = {data, data_length};
+    cy_stc_sha256_t sha256;
+    cy_stc_optiga_inst_t *p_inst;
+
+    if (CY_OPTIGA_HASH_MCU == Cy_Optiga_HashSelect(CY_OPTIGA_HASH_SHA256, data_length, CY_OPTIGA_HASH_AUTO)) {
+        Cy_Sha256_Init(&sha256);
+        Cy_Sha256_Update(&sha256, data, data_length);
+        Cy_Sha256_Final(&sha256, digest);
+        return OPTIGA_LIB_SUCCESS;
+    }
+
+    p_inst = Cy_Optiga_InstAcquire();
+    if (NULL == p_inst) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+
+    Cy_Optiga_OpStart(&p_inst->op);
+    return_status = optiga_crypt_hash(p_inst->crypt, OPTIGA_HASH_TYPE_SHA_256, OPTIGA_CRYPT_HOST_DATA, &hash_data,
+                                      digest);
+    return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    Cy_Optiga_InstRelease(p_inst);
+
+    return return_status;
+}
+
+/**
+ * \name Cy_Optiga_MetadataFind
+ * \brief Find the shadow of an OID. Called inside a critical section.
+ * \param oid
+ * \retval Index of the valid entry, -1 if the OID has no shadow
+ */
+static int8_t Cy_Optiga_MetadataFind(uint16_t oid)
+{
+    uint8_t i;
+
+    for (i = 0; i < OPTIGA_APP_METADATA_CACHE_SIZE; i++) {
+        if ((optiga_metadata_cache[i].valid) && (optiga_metadata_cache[i].oid == oid)) {
+            return (int8_t)i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * \name Cy_Optiga_MetadataContains
+ * \brief Check that every tag of a metadata write is already present with the same value
+ * \param shadow Metadata read from the chip, 0x20 Len followed by tag/length/value entries
+ * \param shadow_length
+ * \param metadata Metadata to be written, same format
+ * \param metadata_length
+ * \retval true if writing metadata would not change the object
+ */
+static bool Cy_Optiga_MetadataContains(const uint8_t *shadow, uint16_t shadow_length,
+                                       const uint8_t *metadata, uint16_t metadata_length)
+{
+    uint16_t i;
+    uint16_t j;
+
+    if ((metadata_length < 2) || (shadow_length < 2) || (0x20 != metadata[0]) || (0x20 != shadow[0]) ||
+        ((uint16_t)(metadata[1] + 2) != metadata_length) || ((uint16_t)(shadow[1] + 2) > shadow_length)) {
+        return false;
+    }
+
+    for (i = 2; i < metadata_length; i += (uint16_t)(2 + metadata[i + 1])) {
+        if ((i + 2 > metadata_length) || (i + 2 + metadata[i + 1] > metadata_length)) {
+            return false;
+        }
+        for (j = 2; j + 2 <= shadow[1] + 2; j += (uint16_t)(2 + shadow[j + 1])) {
+            if (shadow[j] == metadata[i]) {
+                break;
+            }
+        }
+        if ((j + 2 > shadow[1] + 2) || (shadow[j + 1] != metadata[i + 1]) ||
+            (j + 2 + shadow[j + 1] > shadow[1] + 2) ||
+            (0 != memcmp(&shadow[j + 2], &metadata[i + 2], metadata[i + 1]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * \name Cy_Optiga_MetadataInvalidate
+ * \brief Drop the shadow of an OID, after a write which bypassed the metadata layer
+ * \param oid OID, 0xFFFF for all
+ * \retval None
+ */
+void Cy_Optiga_MetadataInvalidate(uint16_t oid)
+{
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_APP_METADATA_CACHE_SIZE; i++) {
+        if ((0xFFFF == oid) || (optiga_metadata_cache[i].oid == oid)) {
+            optiga_metadata_cache[i].valid = false;
+        }
+    }
+    optiga_metadata_epoch++;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * \name Cy_Optiga_MetadataRead
+ * \brief Read the metadata of an OID, from its shadow if it has one, else from the chip
+ * \param p_inst Instance pair used for a chip read
+ * \param oid
+ * \param buffer
+ * \param length In: size of buffer, out: length of the metadata
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_MetadataRead(cy_stc_optiga_inst_t *p_inst, uint16_t oid, uint8_t *buffer,
+                                           uint16_t *length)
+{
+    optiga_lib_status_t return_status;
+    uint8_t data[OPTIGA_APP_METADATA_MAX_LENGTH];
+    uint16_t data_length = sizeof(data);
+    uint32_t epoch;
+    int8_t idx;
+
+    return_status = OPTIGA_LIB_SUCCESS;
+    taskENTER_CRITICAL();
+    idx = Cy_Optiga_MetadataFind(oid);
+    if ((idx >= 0) && (optiga_metadata_cache[idx].length > *length)) {
+        return_status = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    } else if (idx >= 0) {
+        *length = optiga_metadata_cache[idx].length;
+        pal_os_memcpy(buffer, optiga_metadata_cache[idx].data, *length);
+        optiga_metadata_stats.hits++;
+    }
+    epoch = optiga_metadata_epoch;
+    taskEXIT_CRITICAL();
+    if (idx >= 0) {
+        return return_status;
+    }
+
+    Cy_Optiga_OpStart(&p_inst->op);
+    return_status = optiga_util_read_metadata(p_inst->util, oid, data, &data_length);
+    return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    if (OPTIGA_LIB_SUCCESS != return_status) {
+        return return_status;
+    }
+    if (data_length > *length) {
+        return OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    }
+    *length = data_length;
+    pal_os_memcpy(buffer, data, data_length);
+
+    /* A write which invalidated meanwhile may have landed on either side of this read. */
+    taskENTER_CRITICAL();
+    if (epoch == optiga_metadata_epoch) {
+        idx = Cy_Optiga_MetadataFind(oid);
+        if (idx < 0) {
+            idx = (int8_t)optiga_metadata_next;
+            optiga_metadata_next = (uint8_t)((optiga_metadata_next + 1) % OPTIGA_APP_METADATA_CACHE_SIZE);
+        }
+        optiga_metadata_cache[idx].oid = oid;
+        optiga_metadata_cache[idx].length = data_length;
+        pal_os_memcpy(optiga_metadata_cache[idx].data, data, data_length);
+        optiga_metadata_cache[idx].valid = true;
+    }
+    optiga_metadata_stats.reads++;
+    taskEXIT_CRITICAL();
+
+    return OPTIGA_LIB_SUCCESS;
+}
+
+/**
+ * \name Cy_Optiga_MetadataWrite
+ * \brief Write metadata of an OID unless its shadow already holds every tag with the same value
+ * \param p_inst Instance pair used for the chip accesses
+ * \param oid
+ * \param metadata 0x20 Len followed by tag/length/value entries
+ * \param metadata_length
+ * \retval Status of the operation, OPTIGA_LIB_SUCCESS when the write was skipped
+ */
+optiga_lib_status_t Cy_Optiga_MetadataWrite(cy_stc_optiga_inst_t *p_inst, uint16_t oid, const uint8_t *metadata,
+                                            uint8_t metadata_length)
+{
+    optiga_lib_status_t return_status;
+    uint8_t shadow[OPTIGA_APP_METADATA_MAX_LENGTH];
+    uint16_t shadow_length = sizeof(shadow);
+
+    /* A failed read only costs the skip, the write below decides. */
+    return_status = Cy_Optiga_MetadataRead(p_inst, oid, shadow, &shadow_length);
+    if ((OPTIGA_LIB_SUCCESS == return_status) &&
+        (Cy_Optiga_MetadataContains(shadow, shadow_length, metadata, metadata_length))) {
+        taskENTER_CRITICAL();
+        optiga_metadata_stats.skippedWrites++;
+        taskEXIT_CRITICAL();
+        OPTIGA_LOG_MESSAGE("Metadata of 0x%x unchanged, write skipped", oid);
+        return OPTIGA_LIB_SUCCESS;
+    }
+
+    /* Dropped on both sides, a read which ran while the write was queued may have refilled it. */
+    Cy_Optiga_MetadataInvalidate(oid);
+    Cy_Optiga_OpStart(&p_inst->op);
+    return_status = optiga_util_write_metadata(p_inst->util, oid, metadata, metadata_length);
+    return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    Cy_Optiga_MetadataInvalidate(oid);
+
+    taskENTER_CRITICAL();
+    optiga_metadata_stats.writes++;
+    taskEXIT_CRITICAL();
+    return return_status;
+}
+
+/**
+ * \name Cy_Optiga_MetadataGetStats
+ * \brief Copy the metadata layer counters
+ * \param p_stats
+ * \retval None
+ */
+void Cy_Optiga_MetadataGetStats(cy_stc_optiga_metadata_stats_t *p_stats)
+{
+    taskENTER_CRITICAL();
+    *p_stats = optiga_metadata_stats;
+    taskEXIT_CRITICAL();
+}
+
 /**
  * \name printHex
  * \brief Inserts leading zero to visually adjust padding in logs, and prints the hex number
@@ -240,16 +901,16 @@ void optiga_app_util_encode_ecc_public_key_in_bit_string_format(
 
 /**
  * \name optiga_app_performance_measurement
- * \brief Calculate time difference for performance measurements
+ * \brief Calculate time difference in microseconds for performance measurements
  * \param time_value
  * \param time_reset_flag
  * \retval None
  */
 void optiga_app_performance_measurement(uint32_t *time_value, uint8_t time_reset_flag) {
     if (TRUE == time_reset_flag) {
-        *time_value = pal_os_timer_get_time_in_milliseconds();
+        *time_value = pal_os_timer_get_time_in_microseconds();
     } else if (FALSE == time_reset_flag) {
-        *time_value = pal_os_timer_get_time_in_milliseconds() - *time_value;
+        *time_value = pal_os_timer_get_time_in_microseconds() - *time_value;
     }
 }
 
@@ -310,6 +971,30 @@ bool Cy_Optiga_HbDmaInit(void)
     return true;
 }
 
+/**
+ * \name Cy_Optiga_PrintPalStats
+ * \brief Log the I2C bitrate reached after any fall back, and the retry and combined write/read counters of the PAL
+ * \retval None
+ */
+static void Cy_Optiga_PrintPalStats(void)
+{
+    static const char * const dir_names[PAL_I2C_RETRY_DIR_COUNT] = { "Write", "Read" };
+    pal_i2c_retry_stats_t retry_stats;
+    pal_i2c_combined_stats_t combined_stats;
+    uint8_t dir;
+
+    OPTIGA_LOG_MESSAGE("PAL I2C Bitrate: %dKHz", pal_i2c_get_bitrate());
+    for (dir = 0; dir < (uint8_t)PAL_I2C_RETRY_DIR_COUNT; dir++) {
+        pal_i2c_get_retry_stats((pal_i2c_retry_dir_t)dir, &retry_stats);
+        OPTIGA_LOG_MESSAGE("PAL I2C %s: %d transfers, %d retries, %d failures, %d spun and %d yielded backoffs, %dus",
+                           dir_names[dir], retry_stats.transfers, retry_stats.retries, retry_stats.failures,
+                           retry_stats.spin_waits, retry_stats.yield_waits, retry_stats.backoff_us);
+    }
+    pal_i2c_get_combined_stats(&combined_stats);
+    OPTIGA_LOG_MESSAGE("PAL I2C Write/Read: %d transfers, %d failures, %d register writes deferred",
+                       combined_stats.transfers, combined_stats.failures, combined_stats.deferred_writes);
+}
+
 /**
  * \name Cy_Optiga_Main
  * \brief The main Optiga application logic
@@ -331,25 +1016,23 @@ void Cy_Optiga_Main(void){
     uint16_t public_key_length = sizeof(public_key);
     uint16_t optiga_oid;
 
+    cy_stc_optiga_inst_t * p_inst = NULL;
+    bool key_from_pool = false;
     optiga_crypt_t * crypt_me = NULL;
     optiga_util_t * util_me = NULL;
 
     do
     {
         /**
-         * 1. Create OPTIGA Crypt and Util Instances
+         * 1. Borrow OPTIGA Crypt and Util Instances from the pool
          */
-        crypt_me = optiga_crypt_create(0, optiga_crypt_callback, NULL);
-        if (NULL == crypt_me)
-        {
-            break;
-        }
-
-        util_me = optiga_util_create(0, optiga_util_callback, NULL);
-        if (NULL == util_me)
+        p_inst = Cy_Optiga_InstAcquire();
+        if (NULL == p_inst)
         {
             break;
         }
+        crypt_me = p_inst->crypt;
+        util_me = p_inst->util;
 
         /* Use a copy for printing, to preserve the const nature of digest */
         uint8_t digest_copy[sizeof(digest)];
@@ -359,14 +1042,16 @@ void Cy_Optiga_Main(void){
         /**
          * Write medata for key store OPTIGA_FREE_ECC_KEY_ID
          * This macro is set as part of the lib config header file, to 0xE0F2
+         * The write, and its NVM cycle, is skipped when the chip already holds this metadata.
          */
-        optiga_lib_status = OPTIGA_LIB_BUSY;
         optiga_oid = OPTIGA_FREE_ECC_KEY_ID;
-        return_status = optiga_util_write_metadata(util_me,
-                                                   optiga_oid,
-                                                   OPTIGA_FREE_ECC_KEY_ID_metadata,
-                                                   sizeof(OPTIGA_FREE_ECC_KEY_ID_metadata));
-        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+        return_status = Cy_Optiga_MetadataWrite(p_inst,
+                                                optiga_oid,
+                                                OPTIGA_FREE_ECC_KEY_ID_metadata,
+                                                sizeof(OPTIGA_FREE_ECC_KEY_ID_metadata));
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
         OPTIGA_LOG_MESSAGE("Metadata Write Complete, Key Store ID: 0x%x", optiga_oid);
 
         /**
@@ -376,29 +1061,46 @@ void Cy_Optiga_Main(void){
          *       - Store the Private key in OPTIGA Key store
          *       - Export Public Key
          */
-        optiga_lib_status = OPTIGA_LIB_BUSY;
-        optiga_key_id = OPTIGA_FREE_ECC_KEY_ID;
-        /* For session-based keys, use OPTIGA_KEY_ID_SESSION_BASED as key id as shown below. */
-        // optiga_key_id = OPTIGA_KEY_ID_SESSION_BASED;
-        return_status = optiga_crypt_ecc_generate_keypair(crypt_me,
-                                                          OPTIGA_ECC_CURVE_NIST_P_256,
-                                                          (uint8_t)OPTIGA_KEY_USAGE_SIGN,
-                                                          FALSE,
-                                                          &optiga_key_id,
-                                                          public_key,
-                                                          &public_key_length);
-        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
-        OPTIGA_LOG_MESSAGE("Keypair Generation Complete, Key Store ID: 0x%x", optiga_key_id);
+#if OPTIGA_KEYPOOL_EN
+        /* A key generated while the chip was idle takes the generation off this path. */
+        key_from_pool = (OPTIGA_LIB_SUCCESS == Cy_Optiga_KeyPoolTake(&optiga_key_id, public_key,
+                                                                     &public_key_length));
+        if (key_from_pool) {
+            OPTIGA_LOG_MESSAGE("Keypair Taken From Pool, Key Store ID: 0x%x", optiga_key_id);
+        }
+#endif /* OPTIGA_KEYPOOL_EN */
+        if (!key_from_pool) {
+            Cy_Optiga_OpStart(&p_inst->op);
+            optiga_key_id = OPTIGA_FREE_ECC_KEY_ID;
+            /* For session-based keys, use OPTIGA_KEY_ID_SESSION_BASED as key id as shown below. */
+            // optiga_key_id = OPTIGA_KEY_ID_SESSION_BASED;
+            return_status = optiga_crypt_ecc_generate_keypair(crypt_me,
+                                                              OPTIGA_ECC_CURVE_NIST_P_256,
+                                                              (uint8_t)OPTIGA_KEY_USAGE_SIGN,
+                                                              FALSE,
+                                                              &optiga_key_id,
+                                                              public_key,
+                                                              &public_key_length);
+            /* Key generation updates the algorithm and key usage tags of the key object. */
+            Cy_Optiga_MetadataInvalidate(optiga_key_id);
+            return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+            Cy_Optiga_MetadataInvalidate(optiga_key_id);
+            if (OPTIGA_LIB_SUCCESS != return_status) {
+                break;
+            }
+            OPTIGA_LOG_MESSAGE("Keypair Generation Complete, Key Store ID: 0x%x, %dus", optiga_key_id,
+                               p_inst->op.durationUs);
+        }
 
         return_status = OPTIGA_LIB_SUCCESS;
 
 
         /**
-         * 3. Sign the digest using Private key from Key Store ID E0F2
+         * 3. Sign the digest using Private key from Key Store ID E0F2, or the pooled key slot
          */
         uint8_t signature[80];
         uint16_t signature_length = sizeof(signature);
-        optiga_lib_status = OPTIGA_LIB_BUSY;
+        Cy_Optiga_OpStart(&p_inst->op);
         return_status = optiga_crypt_ecdsa_sign(
             crypt_me,
             digest,
@@ -407,8 +1109,8 @@ void Cy_Optiga_Main(void){
             signature,
             &signature_length
         );
-        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
-        OPTIGA_LOG_MESSAGE("Signing Complete, Key Store ID: 0x%x", optiga_key_id);
+        WAIT_AND_CHECK_STATUS(return_status, p_inst->op);
+        OPTIGA_LOG_MESSAGE("Signing Complete, Key Store ID: 0x%x, %dus", optiga_key_id, p_inst->op.durationUs);
 
         printArray16("Public Key (incl. header)", public_key, public_key_length, true);
         printArray16("Signature (in DER encoding format)", signature, signature_length, false);
@@ -439,7 +1141,7 @@ void Cy_Optiga_Main(void){
                                                      public_key_length,
                                                      (uint8_t)OPTIGA_ECC_CURVE_NIST_P_256
                                                     };
-        optiga_lib_status = OPTIGA_LIB_BUSY;
+        Cy_Optiga_OpStart(&p_inst->op);
         return_status = optiga_crypt_ecdsa_verify(
             crypt_me,
             digest,
@@ -449,8 +1151,39 @@ void Cy_Optiga_Main(void){
             OPTIGA_CRYPT_HOST_DATA,
             &public_key_details
         );
-        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
-        OPTIGA_LOG_MESSAGE("Sign Verification Complete");
+        WAIT_AND_CHECK_STATUS(return_status, p_inst->op);
+        OPTIGA_LOG_MESSAGE("Sign Verification Complete, %dus", p_inst->op.durationUs);
+#if OPTIGA_SW_VERIFY_EN
+        /* The same check in software on the CM4, which keeps the chip free for signing */
+        uint32_t sw_verify_start = pal_os_timer_get_time_in_microseconds();
+        return_status = Cy_Optiga_VerifyWith(CY_OPTIGA_VERIFY_MCU, digest, sizeof(digest), signature,
+                                             signature_length, &public_key_details);
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
+        OPTIGA_LOG_MESSAGE("MCU Sign Verification Complete, %dus",
+                           pal_os_timer_get_time_in_microseconds() - sw_verify_start);
+#endif /* OPTIGA_SW_VERIFY_EN */
+#if OPTIGA_ENTROPY_EN
+
+        /**
+         * 5. Read a session nonce from the RAM entropy pool and a challenge from the DRBG
+         */
+        uint8_t nonce[16];
+        uint32_t rng_start = pal_os_timer_get_time_in_microseconds();
+        return_status = Cy_Optiga_EntropyGet(nonce, sizeof(nonce));
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
+        OPTIGA_LOG_MESSAGE("Pool Random Read Complete, %dus, %d bytes left",
+                           pal_os_timer_get_time_in_microseconds() - rng_start, Cy_Optiga_EntropyLevel());
+        rng_start = pal_os_timer_get_time_in_microseconds();
+        return_status = Cy_Optiga_RandomGet(nonce, sizeof(nonce));
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
+        OPTIGA_LOG_MESSAGE("DRBG Random Read Complete, %dus", pal_os_timer_get_time_in_microseconds() - rng_start);
+#endif /* OPTIGA_ENTROPY_EN */
 #if USBFS_LOGS_ENABLE
     vTaskDelay(100);
 #endif
@@ -461,28 +1194,20 @@ void Cy_Optiga_Main(void){
     vTaskDelay(100);
 #endif
     OPTIGA_LOG_STATUS(__FUNCTION__, return_status);
+    /* How long the frames of the demo waited for SCB0 behind the other clients. */
+    Cy_USB_I2CBusPrintStats();
+    /* Bitrate and retries of the PAL, to tune the fall back and retry policies under load. */
+    Cy_Optiga_PrintPalStats();
 #if USBFS_LOGS_ENABLE
     vTaskDelay(100);
 #endif
-    if (crypt_me)
-    {
-        /* Destroy the instance after the completion of usecase if not required. */
-        return_status = optiga_crypt_destroy(crypt_me);
-        if(OPTIGA_LIB_SUCCESS != return_status)
-        {
-            //lint --e{774} suppress This is a generic macro
-            OPTIGA_LOG_STATUS(__FUNCTION__, return_status);
-        }
-    }
-    if (util_me)
-    {
-        /* Destroy the instance after the completion of usecase if not required. */
-        return_status = optiga_util_destroy(util_me);
-        if(OPTIGA_LIB_SUCCESS != return_status)
-        {
-            //lint --e{774} suppress This is a generic macro
-            OPTIGA_LOG_STATUS(__FUNCTION__, return_status);
-        }
+    /* Hand the instances back for the next user, they are destroyed by Cy_Optiga_Deinit. */
+    Cy_Optiga_InstRelease(p_inst);
+#if OPTIGA_KEYPOOL_EN
+    /* The demo key was used once, let the pool generate a fresh one into its slot. */
+    if (key_from_pool) {
+        Cy_Optiga_KeyPoolReturn(optiga_key_id);
     }
+#endif /* OPTIGA_KEYPOOL_EN */
 
 }
@@ -39,6 +39,7 @@
 
 /* FreeRTOS include */
 #include "FreeRTOS.h"
+#include "semphr.h"
 
 /* Library stack include */
 #include "cy_debug.h"
@@ -61,6 +62,57 @@
 #define VBUS_DETECT_GPIO_INTR                       (ioss_interrupts_gpio_dpslp_4_IRQn)
 #define VBUS_DETECT_STATE                           (0u)
 
+/*
+ * Util and crypt instance pairs of chip 0 created by Cy_Optiga_Init and lent out by Cy_Optiga_InstAcquire.
+ * Two library registrations per pair, all of them must fit in OPTIGA_CMD_MAX_REGISTRATIONS.
+ */
+#ifndef OPTIGA_APP_INST_POOL_SIZE
+#define OPTIGA_APP_INST_POOL_SIZE                   (3u)
+#endif
+
+/* Objects whose metadata is shadowed by Cy_Optiga_MetadataRead/Cy_Optiga_MetadataWrite */
+#ifndef OPTIGA_APP_METADATA_CACHE_SIZE
+#define OPTIGA_APP_METADATA_CACHE_SIZE              (4u)
+#endif
+#define OPTIGA_APP_METADATA_MAX_LENGTH              (64u)
+
+/* Public keys kept decoded for MCU verifies, about 1.1 KB each; also the most keys one batch can name */
+#ifndef OPTIGA_APP_VERIFY_KEY_CACHE
+#define OPTIGA_APP_VERIFY_KEY_CACHE                 (2u)
+#endif
+
+/* Longest wait for an asynchronous Optiga operation before giving up with OPTIGA_APP_ERR_TIMEOUT */
+#ifndef OPTIGA_APP_WAIT_TIMEOUT_MS
+#define OPTIGA_APP_WAIT_TIMEOUT_MS                  (5000u)
+#endif
+
+/* Status of an operation which did not complete within the wait timeout, outside the library codes */
+#define OPTIGA_APP_ERR_TIMEOUT                      (0x0F01)
+
+/* Status of a verify on the MCU whose signature does not match the digest and key */
+#define OPTIGA_APP_ERR_SIGNATURE                    (0x0F05)
+
+/* Status of an operation refused because its context still waits for the callback of one which timed out */
+#define OPTIGA_APP_ERR_OP_PENDING                   (0x0F06)
+
+/* Where Cy_Optiga_VerifyWith checks an ECDSA P-256 signature */
+typedef enum
+{
+    CY_OPTIGA_VERIFY_CHIP = 0,                      /* On the chip, as Cy_Optiga_Verify */
+    CY_OPTIGA_VERIFY_MCU                            /* In software on the CM4, leaving the chips to signing */
+} cy_en_optiga_verify_engine_t;
+
+/* One signature of a Cy_Optiga_VerifyBatch call */
+typedef struct
+{
+    const uint8_t *digest;
+    uint8_t digestLength;
+    const uint8_t *signature;
+    uint16_t signatureLength;
+    uint8_t keyIndex;                               /* Into the public keys of the call */
+    optiga_lib_status_t status;                     /* Set by the call, as Cy_Optiga_VerifyWith reports it */
+} cy_stc_optiga_verify_item_t;
+
 #define START_PERFORMANCE_MEASUREMENT(time_taken) \
     optiga_app_performance_measurement(&time_taken, START_TIMER)
 
@@ -77,15 +129,13 @@
     Cy_Debug_AddToLog(3, "[Optiga][ERROR]: "msg"%s", ##__VA_ARGS__, "\r\n"); \
 }
 
-#define WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status) \
+#define WAIT_AND_CHECK_STATUS(return_status, op) \
 { \
     if (OPTIGA_LIB_SUCCESS != return_status) { \
         break; \
     } \
-    while (OPTIGA_LIB_BUSY == optiga_lib_status) { \
-    } \
-    if (OPTIGA_LIB_SUCCESS != optiga_lib_status) { \
-        return_status = optiga_lib_status; \
+    return_status = Cy_Optiga_OpWait(&(op), return_status, OPTIGA_APP_WAIT_TIMEOUT_MS); \
+    if (OPTIGA_LIB_SUCCESS != return_status) { \
         break; \
     } \
 }
@@ -104,14 +154,43 @@
 #define OPTIGA_LOG_PERFORMANCE_VALUE(time_taken, return_value) \
 { \
     if (OPTIGA_LIB_SUCCESS == return_value) { \
-        Cy_Debug_AddToLog(3, "[Optiga]: Time Taken - %dms, Status - 0x%x\r\n", time_taken, return_value); \
+        Cy_Debug_AddToLog(3, "[Optiga]: Time Taken - %dus, Status - 0x%x\r\n", time_taken, return_value); \
     } \
     else \
     { \
-        Cy_Debug_AddToLog(3, "[Optiga][ERROR]: Time Taken - %dms, Status - 0x%x\r\n", time_taken, return_value); \
+        Cy_Debug_AddToLog(3, "[Optiga][ERROR]: Time Taken - %dus, Status - 0x%x\r\n", time_taken, return_value); \
     } \
 }
 
+/* Completion context of the operations of an instance, given as the context of optiga_util_create/optiga_crypt_create */
+typedef struct
+{
+    volatile optiga_lib_status_t status;            /* OPTIGA_LIB_BUSY while an operation runs */
+    SemaphoreHandle_t done;                         /* Given by Cy_Optiga_OpCallback */
+    StaticSemaphore_t doneBuffer;
+    uint32_t startUs;                               /* Set by Cy_Optiga_OpStart */
+    uint32_t durationUs;                            /* Start to callback of the last operation */
+    volatile bool abandoned;                        /* Timed out in Cy_Optiga_OpWait, its callback is still due */
+} cy_stc_optiga_op_t;
+
+/* Util and crypt instance pair of the pool, sharing one operation context */
+typedef struct
+{
+    optiga_util_t *util;
+    optiga_crypt_t *crypt;
+    cy_stc_optiga_op_t op;
+    bool in_use;
+} cy_stc_optiga_inst_t;
+
+/* Metadata layer counters */
+typedef struct
+{
+    uint32_t hits;                                  /* Reads served from a shadow */
+    uint32_t reads;                                 /* Reads from the chip */
+    uint32_t writes;                                /* Writes issued to the chip */
+    uint32_t skippedWrites;                         /* Writes the shadow showed to be no-ops */
+} cy_stc_optiga_metadata_stats_t;
+
 /* Functions Declarations */
 
 
@@ -129,6 +208,188 @@ void Cy_Optiga_Init(void);
  */
  void Cy_Optiga_Deinit(void);
 
+/**
+ * \name Cy_Optiga_OpInit
+ * \brief Prepare an operation context before passing it to optiga_util_create/optiga_crypt_create
+ * \param p_op
+ * \retval None
+ */
+void Cy_Optiga_OpInit(cy_stc_optiga_op_t *p_op);
+
+/**
+ * \name Cy_Optiga_OpCallback
+ * \brief Callback of util and crypt instances created with a cy_stc_optiga_op_t as context
+ * \param context The cy_stc_optiga_op_t of the instance
+ * \param return_status
+ * \retval None
+ */
+void Cy_Optiga_OpCallback(void *context, optiga_lib_status_t return_status);
+
+/**
+ * \name Cy_Optiga_OpStart
+ * \brief Mark an operation as running, call right before starting it on the instance
+ * \param p_op
+ * \retval None
+ */
+void Cy_Optiga_OpStart(cy_stc_optiga_op_t *p_op);
+
+/**
+ * \name Cy_Optiga_OpWait
+ * \brief Block until an asynchronous operation completes, leaving the CPU to other tasks meanwhile
+ * \param p_op
+ * \param return_status Status returned when starting the operation
+ * \param timeout_ms
+ * \retval Final status of the operation, OPTIGA_APP_ERR_TIMEOUT if it did not complete in time. The
+ *         operation then still runs: its callback is dropped, and the context stays pending until it came.
+ *         OPTIGA_APP_ERR_OP_PENDING if the operation could not start because of that.
+ */
+optiga_lib_status_t Cy_Optiga_OpWait(cy_stc_optiga_op_t *p_op, optiga_lib_status_t return_status,
+                                     uint32_t timeout_ms);
+
+/**
+ * \name Cy_Optiga_OpPending
+ * \brief Check whether an operation context is still in use, running or waiting for a late callback
+ * \param p_op
+ * \retval true while the context must not be reused
+ */
+bool Cy_Optiga_OpPending(const cy_stc_optiga_op_t *p_op);
+
+/**
+ * \name Cy_Optiga_InstAcquire
+ * \brief Borrow a util and crypt instance pair of chip 0
+ * \retval The pair, NULL if all pairs are in use
+ */
+cy_stc_optiga_inst_t *Cy_Optiga_InstAcquire(void);
+
+/**
+ * \name Cy_Optiga_InstRelease
+ * \brief Return a pair taken with Cy_Optiga_InstAcquire once its last operation completed
+ * \param p_inst
+ * \retval None
+ */
+void Cy_Optiga_InstRelease(cy_stc_optiga_inst_t *p_inst);
+
+/**
+ * \name Cy_Optiga_InstPoolIdle
+ * \brief Check that no instance pair is lent out or waiting for a late callback
+ * \retval true if background work would not delay any caller
+ */
+bool Cy_Optiga_InstPoolIdle(void);
+
+/**
+ * \name Cy_Optiga_Sign
+ * \brief ECDSA sign a digest with a key of the chip, on an instance pair borrowed from the pool
+ * \param key_id
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length In: size of signature, out: length of the DER encoded signature
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_Sign(optiga_key_id_t key_id, const uint8_t *digest, uint8_t digest_length,
+                                   uint8_t *signature, uint16_t *signature_length);
+
+/**
+ * \name Cy_Optiga_Verify
+ * \brief ECDSA verify a signature with a host provided public key on the chip
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param public_key
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_Verify(const uint8_t *digest, uint8_t digest_length, const uint8_t *signature,
+                                     uint16_t signature_length, const public_key_from_host_t *public_key);
+
+/**
+ * \name Cy_Optiga_VerifyWith
+ * \brief ECDSA verify a signature with a host provided P-256 public key on the selected engine
+ * \param engine
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param public_key
+ * \retval Status of the operation, OPTIGA_APP_ERR_SIGNATURE for a signature rejected on the MCU
+ */
+optiga_lib_status_t Cy_Optiga_VerifyWith(cy_en_optiga_verify_engine_t engine, const uint8_t *digest,
+                                         uint8_t digest_length, const uint8_t *signature,
+                                         uint16_t signature_length, const public_key_from_host_t *public_key);
+
+/**
+ * \name Cy_Optiga_VerifyBatch
+ * \brief ECDSA verify many signatures against a few P-256 public keys on the MCU. Decoded keys and
+ *        their precomputed tables are kept across calls, the items share the inversions of S.
+ * \param public_keys
+ * \param num_keys At most OPTIGA_APP_VERIFY_KEY_CACHE
+ * \param items Each gets its own status
+ * \param num_items
+ * \retval OPTIGA_LIB_SUCCESS if every item verified, OPTIGA_APP_ERR_SIGNATURE if any did not,
+ *         OPTIGA_CRYPT_ERROR_INVALID_INPUT for a bad call
+ */
+optiga_lib_status_t Cy_Optiga_VerifyBatch(const public_key_from_host_t *public_keys, uint8_t num_keys,
+                                          cy_stc_optiga_verify_item_t *items, uint16_t num_items);
+
+/**
+ * \name Cy_Optiga_GetRandom
+ * \brief Read random bytes from the chip
+ * \param random_data
+ * \param random_data_length
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_GetRandom(uint8_t *random_data, uint16_t random_data_length);
+
+/**
+ * \name Cy_Optiga_Hash
+ * \brief SHA-256 hash a host buffer on the MCU, or on the chip when Cy_Optiga_HashSelect picks it
+ * \param data
+ * \param data_length
+ * \param digest 32 bytes
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_Hash(const uint8_t *data, uint32_t data_length, uint8_t *digest);
+
+/**
+ * \name Cy_Optiga_MetadataInvalidate
+ * \brief Drop the shadow of an OID, after a write which bypassed the metadata layer
+ * \param oid OID, 0xFFFF for all
+ * \retval None
+ */
+void Cy_Optiga_MetadataInvalidate(uint16_t oid);
+
+/**
+ * \name Cy_Optiga_MetadataRead
+ * \brief Read the metadata of an OID, from its shadow if it has one, else from the chip
+ * \param p_inst Instance pair used for a chip read
+ * \param oid
+ * \param buffer
+ * \param length In: size of buffer, out: length of the metadata
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_MetadataRead(cy_stc_optiga_inst_t *p_inst, uint16_t oid, uint8_t *buffer,
+                                           uint16_t *length);
+
+/**
+ * \name Cy_Optiga_MetadataWrite
+ * \brief Write metadata of an OID unless its shadow already holds every tag with the same value
+ * \param p_inst Instance pair used for the chip accesses
+ * \param oid
+ * \param metadata 0x20 Len followed by tag/length/value entries
+ * \param metadata_length
+ * \retval Status of the operation, OPTIGA_LIB_SUCCESS when the write was skipped
+ */
+optiga_lib_status_t Cy_Optiga_MetadataWrite(cy_stc_optiga_inst_t *p_inst, uint16_t oid, const uint8_t *metadata,
+                                            uint8_t metadata_length);
+
+/**
+ * \name Cy_Optiga_MetadataGetStats
+ * \brief Copy the metadata layer counters
+ * \param p_stats
+ * \retval None
+ */
+void Cy_Optiga_MetadataGetStats(cy_stc_optiga_metadata_stats_t *p_stats);
+
 /**
  * \name printHex
  * \brief Inserts leading zero to visually adjust padding in logs, and prints the hex number
@@ -162,7 +423,7 @@ void optiga_app_util_encode_ecc_public_key_in_bit_string_format(const uint8_t *q
 
 /**
  * \name optiga_app_performance_measurement
- * \brief Calculate time difference for performance measurements
+ * \brief Calculate time difference in microseconds for performance measurements
  * \param time_value
  * \param time_reset_flag
  * \retval None
@@ -0,0 +1,264 @@
+/***************************************************************************//**
+* \file optiga_entropy.c
+*
+* \version 1.0
+*
+* \details  This file provides the background refill of the TRNG pool, serves
+*           random bytes from it and runs the DRBG seeded from it.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include "optiga_entropy.h"
+#include "task.h"
+#include <string.h>
+
+#if (OPTIGA_ENTROPY_HIGH_WATERMARK > OPTIGA_ENTROPY_POOL_SIZE) || \
+    (OPTIGA_ENTROPY_LOW_WATERMARK > OPTIGA_ENTROPY_HIGH_WATERMARK)
+#error "OPTIGA_ENTROPY_LOW_WATERMARK <= OPTIGA_ENTROPY_HIGH_WATERMARK <= OPTIGA_ENTROPY_POOL_SIZE required"
+#endif
+
+/* TRNG bytes, consumed from the top and wiped when handed out */
+static uint8_t optiga_entropy_pool[OPTIGA_ENTROPY_POOL_SIZE];
+static uint16_t optiga_entropy_level = 0;
+
+static cy_stc_optiga_entropy_stats_t optiga_entropy_stats = { .minLevel = OPTIGA_ENTROPY_POOL_SIZE };
+
+static TaskHandle_t optiga_entropy_task = NULL;
+
+/* DRBG state, used under optiga_drbg_lock */
+static cy_stc_drbg_t optiga_drbg;
+static uint32_t optiga_drbg_since_seed = 0;
+static SemaphoreHandle_t optiga_drbg_lock = NULL;
+static StaticSemaphore_t optiga_drbg_lock_buffer;
+
+/**
+ * \name Cy_Optiga_EntropyPush
+ * \brief Add bytes read from the chip to the pool, as far as they fit
+ * \param data
+ * \param length
+ * \retval None
+ */
+static void Cy_Optiga_EntropyPush(const uint8_t *data, uint16_t length)
+{
+    taskENTER_CRITICAL();
+    if (length > (OPTIGA_ENTROPY_POOL_SIZE - optiga_entropy_level)) {
+        length = (uint16_t)(OPTIGA_ENTROPY_POOL_SIZE - optiga_entropy_level);
+    }
+    memcpy(&optiga_entropy_pool[optiga_entropy_level], data, length);
+    optiga_entropy_level = (uint16_t)(optiga_entropy_level + length);
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * \name Cy_Optiga_EntropyTake
+ * \brief Move bytes out of the pool and wake the refill
+ * \param data
+ * \param length
+ * \param all_or_nothing Take nothing unless the pool holds length bytes
+ * \retval Bytes taken
+ */
+static uint16_t Cy_Optiga_EntropyTake(uint8_t *data, uint16_t length, bool all_or_nothing)
+{
+    uint16_t n;
+
+    taskENTER_CRITICAL();
+    n = (length > optiga_entropy_level) ? optiga_entropy_level : length;
+    if ((all_or_nothing) && (n < length)) {
+        n = 0;
+    }
+    optiga_entropy_level = (uint16_t)(optiga_entropy_level - n);
+    memcpy(data, &optiga_entropy_pool[optiga_entropy_level], n);
+    memset(&optiga_entropy_pool[optiga_entropy_level], 0, n);
+    optiga_entropy_stats.poolBytes += n;
+    if (optiga_entropy_level < optiga_entropy_stats.minLevel) {
+        optiga_entropy_stats.minLevel = optiga_entropy_level;
+    }
+    taskEXIT_CRITICAL();
+
+    if ((n > 0u) && (NULL != optiga_entropy_task)) {
+        (void)xTaskNotifyGive(optiga_entropy_task);
+    }
+    return n;
+}
+
+/**
+ * \name Cy_Optiga_EntropyTask
+ * \brief Top the pool up to the high watermark while the chip is idle, and without waiting for an idle
+ *        chip below the low watermark
+ * \param nothing
+ * \retval None
+ */
+static void Cy_Optiga_EntropyTask(void *nothing)
+{
+    uint8_t chunk[OPTIGA_ENTROPY_CHUNK];
+    optiga_lib_status_t return_status;
+    uint16_t level;
+    uint16_t room;
+
+    (void)nothing;
+    for (;;) {
+        level = Cy_Optiga_EntropyLevel();
+        room = (level < OPTIGA_ENTROPY_HIGH_WATERMARK) ? (uint16_t)(OPTIGA_ENTROPY_HIGH_WATERMARK - level) : 0u;
+        if (room < OPTIGA_ENTROPY_MIN_READ) {
+            /* Full, sleep until a consumer takes from the pool. */
+            (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        if ((level >= OPTIGA_ENTROPY_LOW_WATERMARK) && (!Cy_Optiga_InstPoolIdle())) {
+            (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(OPTIGA_ENTROPY_RETRY_MS));
+            continue;
+        }
+
+        if (room > OPTIGA_ENTROPY_CHUNK) {
+            room = OPTIGA_ENTROPY_CHUNK;
+        }
+        return_status = Cy_Optiga_GetRandom(chunk, room);
+        if (OPTIGA_LIB_SUCCESS == return_status) {
+            Cy_Optiga_EntropyPush(chunk, room);
+            memset(chunk, 0, sizeof(chunk));
+            taskENTER_CRITICAL();
+            optiga_entropy_stats.refills++;
+            taskEXIT_CRITICAL();
+        } else {
+            taskENTER_CRITICAL();
+            optiga_entropy_stats.failures++;
+            taskEXIT_CRITICAL();
+            OPTIGA_LOG_STATUS("Entropy pool refill", return_status);
+            vTaskDelay(pdMS_TO_TICKS(OPTIGA_ENTROPY_RETRY_MS));
+        }
+    }
+}
+
+bool Cy_Optiga_EntropyInit(void)
+{
+    if (NULL == optiga_drbg_lock) {
+        optiga_drbg_lock = xSemaphoreCreateMutexStatic(&optiga_drbg_lock_buffer);
+    }
+    if (NULL == optiga_entropy_task) {
+        if (pdPASS != xTaskCreate(Cy_Optiga_EntropyTask, "fx_optiga_rng", OPTIGA_ENTROPY_TASK_STACK, NULL,
+                                  OPTIGA_ENTROPY_TASK_PRIORITY, &optiga_entropy_task)) {
+            OPTIGA_LOG_ERROR("Entropy Pool Task Could NOT be Created!");
+            optiga_entropy_task = NULL;
+        }
+    }
+    return (NULL != optiga_entropy_task);
+}
+
+optiga_lib_status_t Cy_Optiga_EntropyGet(uint8_t *random_data, uint16_t random_data_length)
+{
+    optiga_lib_status_t return_status = OPTIGA_LIB_SUCCESS;
+    uint8_t chunk[OPTIGA_ENTROPY_CHUNK];
+    uint16_t n;
+
+    n = Cy_Optiga_EntropyTake(random_data, random_data_length, false);
+    random_data += n;
+    random_data_length = (uint16_t)(random_data_length - n);
+
+    /* The pool ran dry: read the rest directly, at least the chip minimum, and keep any excess */
+    while ((random_data_length > 0u) && (OPTIGA_LIB_SUCCESS == return_status)) {
+        uint16_t read = (random_data_length > OPTIGA_ENTROPY_CHUNK) ? OPTIGA_ENTROPY_CHUNK : random_data_length;
+
+        n = read;
+        if (read < OPTIGA_ENTROPY_MIN_READ) {
+            read = OPTIGA_ENTROPY_MIN_READ;
+        }
+        return_status = Cy_Optiga_GetRandom(chunk, read);
+        if (OPTIGA_LIB_SUCCESS == return_status) {
+            memcpy(random_data, chunk, n);
+            Cy_Optiga_EntropyPush(&chunk[n], (uint16_t)(read - n));
+            random_data += n;
+            random_data_length = (uint16_t)(random_data_length - n);
+            taskENTER_CRITICAL();
+            optiga_entropy_stats.chipBytes += n;
+            taskEXIT_CRITICAL();
+        }
+    }
+    memset(chunk, 0, sizeof(chunk));
+
+    return return_status;
+}
+
+optiga_lib_status_t Cy_Optiga_RandomGet(uint8_t *random_data, uint32_t random_data_length)
+{
+    optiga_lib_status_t return_status = OPTIGA_LIB_SUCCESS;
+    uint8_t seed[DRBG_SEED_LENGTH];
+
+    if (NULL == optiga_drbg_lock) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+    (void)xSemaphoreTake(optiga_drbg_lock, portMAX_DELAY);
+
+    if (!optiga_drbg.seeded) {
+        /* The first seed may have to come from the chip directly. */
+        return_status = Cy_Optiga_EntropyGet(seed, sizeof(seed));
+        if (OPTIGA_LIB_SUCCESS == return_status) {
+            Cy_Drbg_Seed(&optiga_drbg, seed, sizeof(seed));
+            optiga_drbg_since_seed = 0;
+        }
+    } else if (optiga_drbg_since_seed >= OPTIGA_ENTROPY_RESEED_BYTES) {
+        /* Reseed only from RAM, a dry pool defers it to a later call rather than stalling this one. */
+        if (sizeof(seed) == Cy_Optiga_EntropyTake(seed, sizeof(seed), true)) {
+            Cy_Drbg_Seed(&optiga_drbg, seed, sizeof(seed));
+            optiga_drbg_since_seed = 0;
+            taskENTER_CRITICAL();
+            optiga_entropy_stats.reseeds++;
+            taskEXIT_CRITICAL();
+        }
+    }
+    memset(seed, 0, sizeof(seed));
+
+    if (OPTIGA_LIB_SUCCESS == return_status) {
+        (void)Cy_Drbg_Generate(&optiga_drbg, random_data, random_data_length);
+        optiga_drbg_since_seed = (random_data_length > (UINT32_MAX - optiga_drbg_since_seed)) ?
+                                 UINT32_MAX : (optiga_drbg_since_seed + random_data_length);
+        taskENTER_CRITICAL();
+        optiga_entropy_stats.drbgBytes += random_data_length;
+        taskEXIT_CRITICAL();
+    }
+
+    (void)xSemaphoreGive(optiga_drbg_lock);
+    return return_status;
+}
+
+uint16_t Cy_Optiga_EntropyLevel(void)
+{
+    uint16_t level;
+
+    taskENTER_CRITICAL();
+    level = optiga_entropy_level;
+    taskEXIT_CRITICAL();
+    return level;
+}
+
+void Cy_Optiga_EntropyGetStats(cy_stc_optiga_entropy_stats_t *p_stats)
+{
+    taskENTER_CRITICAL();
+    *p_stats = optiga_entropy_stats;
+    taskEXIT_CRITICAL();
+}
@@ -0,0 +1,139 @@
+/***************************************************************************//**
+* \file optiga_entropy.h
+*
+* \version 1.0
+*
+* \details  RAM pool of true random bytes from the OPTIGA TRNG, refilled in the
+*           background between watermarks, and a DRBG seeded from it for high rate
+*           consumers.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _OPTIGA_ENTROPY_H_
+#define _OPTIGA_ENTROPY_H_
+
+#include "optiga_app.h"
+#include "chacha20_drbg.h"
+
+/* RAM pool of TRNG bytes */
+#ifndef OPTIGA_ENTROPY_POOL_SIZE
+#define OPTIGA_ENTROPY_POOL_SIZE                    (256u)
+#endif
+
+/* Below this level the refill runs even while the chips are busy with other work */
+#ifndef OPTIGA_ENTROPY_LOW_WATERMARK
+#define OPTIGA_ENTROPY_LOW_WATERMARK                (64u)
+#endif
+
+/* Refills while the chips are idle stop at this level, at most OPTIGA_ENTROPY_POOL_SIZE */
+#ifndef OPTIGA_ENTROPY_HIGH_WATERMARK
+#define OPTIGA_ENTROPY_HIGH_WATERMARK               (OPTIGA_ENTROPY_POOL_SIZE)
+#endif
+
+/* Bytes per optiga_crypt_random command of the refill, 8 to 256 */
+#ifndef OPTIGA_ENTROPY_CHUNK
+#define OPTIGA_ENTROPY_CHUNK                        (64u)
+#endif
+
+/* Shortest read the chip accepts */
+#define OPTIGA_ENTROPY_MIN_READ                     (8u)
+
+/* DRBG output between two reseeds from the pool */
+#ifndef OPTIGA_ENTROPY_RESEED_BYTES
+#define OPTIGA_ENTROPY_RESEED_BYTES                 (65536u)
+#endif
+
+/* Wait before checking again for idle chips, or after a failed refill */
+#ifndef OPTIGA_ENTROPY_RETRY_MS
+#define OPTIGA_ENTROPY_RETRY_MS                     (50u)
+#endif
+
+/* Below the application tasks, as the key pool refill */
+#ifndef OPTIGA_ENTROPY_TASK_PRIORITY
+#define OPTIGA_ENTROPY_TASK_PRIORITY                (tskIDLE_PRIORITY + 2)
+#endif
+
+#ifndef OPTIGA_ENTROPY_TASK_STACK
+#define OPTIGA_ENTROPY_TASK_STACK                   (1024u)
+#endif
+
+/* Pool counters */
+typedef struct
+{
+    uint32_t poolBytes;                             /* Served from RAM */
+    uint32_t chipBytes;                             /* Read from the chip by the caller, the pool was short */
+    uint32_t drbgBytes;
+    uint32_t reseeds;
+    uint32_t refills;
+    uint32_t failures;                              /* Failed refills, retried */
+    uint16_t minLevel;                              /* Lowest pool level seen by a consumer */
+} cy_stc_optiga_entropy_stats_t;
+
+/**
+ * \name Cy_Optiga_EntropyInit
+ * \brief Start the refill task. The chips must be opened by Cy_Optiga_Init.
+ * \retval true if the pool runs
+ */
+bool Cy_Optiga_EntropyInit(void);
+
+/**
+ * \name Cy_Optiga_EntropyGet
+ * \brief Copy TRNG bytes out of the pool. Only when the pool runs short the rest is read from the chip,
+ *        on the caller's time.
+ * \param random_data
+ * \param random_data_length
+ * \retval Status of the chip read, OPTIGA_LIB_SUCCESS when the pool sufficed
+ */
+optiga_lib_status_t Cy_Optiga_EntropyGet(uint8_t *random_data, uint16_t random_data_length);
+
+/**
+ * \name Cy_Optiga_RandomGet
+ * \brief Produce random bytes with the DRBG, reseeded from the pool every OPTIGA_ENTROPY_RESEED_BYTES.
+ *        Only the first call may wait on the chip for the seed.
+ * \param random_data
+ * \param random_data_length
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_RandomGet(uint8_t *random_data, uint32_t random_data_length);
+
+/**
+ * \name Cy_Optiga_EntropyLevel
+ * \brief Number of TRNG bytes in the pool
+ * \retval Level
+ */
+uint16_t Cy_Optiga_EntropyLevel(void);
+
+/**
+ * \name Cy_Optiga_EntropyGetStats
+ * \brief Copy the pool counters
+ * \param p_stats
+ * \retval None
+ */
+void Cy_Optiga_EntropyGetStats(cy_stc_optiga_entropy_stats_t *p_stats);
+
+#endif /* _OPTIGA_ENTROPY_H_ */
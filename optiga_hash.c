@@ -0,0 +1,209 @@
+/***************************************************************************//**
+* \file optiga_hash.c
+*
+* \version 1.0
+*
+* \details  This file provides the engine selection and the streaming hash on the MCU
+*           or the OPTIGA chip, and the cycles per byte measurement of both.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include "optiga_hash.h"
+#include "cy_pdl.h"
+#include <string.h>
+
+cy_en_optiga_hash_engine_t Cy_Optiga_HashSelect(cy_en_optiga_hash_alg_t alg, uint32_t expected_length,
+                                                cy_en_optiga_hash_engine_t engine)
+{
+    if (CY_OPTIGA_HASH_SHA256 != alg) {
+        return CY_OPTIGA_HASH_MCU;
+    }
+    if (CY_OPTIGA_HASH_AUTO != engine) {
+        return engine;
+    }
+    if ((expected_length > 0u) && (expected_length <= OPTIGA_HASH_CHIP_MAX_LENGTH)) {
+        return CY_OPTIGA_HASH_CHIP;
+    }
+    return CY_OPTIGA_HASH_MCU;
+}
+
+optiga_lib_status_t Cy_Optiga_HashInit(cy_stc_optiga_hash_t *p_hash, cy_en_optiga_hash_alg_t alg,
+                                       uint32_t expected_length, cy_en_optiga_hash_engine_t engine)
+{
+    optiga_lib_status_t return_status;
+
+    p_hash->alg = alg;
+    p_hash->engine = Cy_Optiga_HashSelect(alg, expected_length, engine);
+    p_hash->pInst = NULL;
+
+    if (CY_OPTIGA_HASH_MCU == p_hash->engine) {
+        if (CY_OPTIGA_HASH_SHA256 == alg) {
+            Cy_Sha256_Init(&p_hash->sw.sha256);
+        } else {
+            Cy_Sha384_Init(&p_hash->sw.sha384);
+        }
+        return OPTIGA_LIB_SUCCESS;
+    }
+
+    p_hash->pInst = Cy_Optiga_InstAcquire();
+    if (NULL == p_hash->pInst) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+
+    p_hash->chipContext.context_buffer = p_hash->chipContextBuffer;
+    p_hash->chipContext.context_buffer_length = sizeof(p_hash->chipContextBuffer);
+    p_hash->chipContext.hash_algo = (uint8_t)OPTIGA_HASH_TYPE_SHA_256;
+
+    Cy_Optiga_OpStart(&p_hash->pInst->op);
+    return_status = optiga_crypt_hash_start(p_hash->pInst->crypt, &p_hash->chipContext);
+    return_status = Cy_Optiga_OpWait(&p_hash->pInst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    if (OPTIGA_LIB_SUCCESS != return_status) {
+        Cy_Optiga_InstRelease(p_hash->pInst);
+        p_hash->pInst = NULL;
+    }
+    return return_status;
+}
+
+optiga_lib_status_t Cy_Optiga_HashUpdate(cy_stc_optiga_hash_t *p_hash, const uint8_t *data, uint32_t length)
+{
+    optiga_lib_status_t return_status;
+    hash_data_from_host_t hash_data;
+
+    if (CY_OPTIGA_HASH_MCU == p_hash->engine) {
+        if (CY_OPTIGA_HASH_SHA256 == p_hash->alg) {
+            Cy_Sha256_Update(&p_hash->sw.sha256, data, length);
+        } else {
+            Cy_Sha384_Update(&p_hash->sw.sha384, data, length);
+        }
+        return OPTIGA_LIB_SUCCESS;
+    }
+
+    if (NULL == p_hash->pInst) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+    if (0u == length) {
+        return OPTIGA_LIB_SUCCESS;
+    }
+
+    hash_data.buffer = data;
+    hash_data.length = length;
+    Cy_Optiga_OpStart(&p_hash->pInst->op);
+    return_status = optiga_crypt_hash_update(p_hash->pInst->crypt, &p_hash->chipContext, OPTIGA_CRYPT_HOST_DATA,
+                                             &hash_data);
+    return Cy_Optiga_OpWait(&p_hash->pInst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+}
+
+optiga_lib_status_t Cy_Optiga_HashFinal(cy_stc_optiga_hash_t *p_hash, uint8_t *digest)
+{
+    optiga_lib_status_t return_status;
+
+    if (CY_OPTIGA_HASH_MCU == p_hash->engine) {
+        if (CY_OPTIGA_HASH_SHA256 == p_hash->alg) {
+            Cy_Sha256_Final(&p_hash->sw.sha256, digest);
+        } else {
+            Cy_Sha384_Final(&p_hash->sw.sha384, digest);
+        }
+        return OPTIGA_LIB_SUCCESS;
+    }
+
+    if (NULL == p_hash->pInst) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+
+    Cy_Optiga_OpStart(&p_hash->pInst->op);
+    return_status = optiga_crypt_hash_finalize(p_hash->pInst->crypt, &p_hash->chipContext, digest);
+    return_status = Cy_Optiga_OpWait(&p_hash->pInst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+    Cy_Optiga_InstRelease(p_hash->pInst);
+    p_hash->pInst = NULL;
+    memset(p_hash->chipContextBuffer, 0, sizeof(p_hash->chipContextBuffer));
+
+    return return_status;
+}
+
+#if OPTIGA_HASH_BENCH_EN
+/* Message of the measurements, also the chip one, which hashes its first OPTIGA_HASH_BENCH_CHIP_LENGTH bytes */
+static uint8_t optiga_hash_bench_data[OPTIGA_HASH_BENCH_LENGTH];
+
+/**
+ * \name Cy_Optiga_HashBenchRun
+ * \brief Hash the bench message once and log the cycles per byte
+ * \param name Logged with the result
+ * \param alg
+ * \param engine
+ * \param length
+ * \retval None
+ */
+static void Cy_Optiga_HashBenchRun(const char *name, cy_en_optiga_hash_alg_t alg, cy_en_optiga_hash_engine_t engine,
+                                   uint32_t length)
+{
+    cy_stc_optiga_hash_t hash;
+    uint8_t digest[SHA384_DIGEST_LENGTH];
+    optiga_lib_status_t return_status;
+    uint32_t cycles;
+    uint32_t centi;
+
+    /* CYCCNT wraps after 28 s at 150 MHz, far beyond the chip run */
+    cycles = DWT->CYCCNT;
+    return_status = Cy_Optiga_HashInit(&hash, alg, length, engine);
+    if (OPTIGA_LIB_SUCCESS == return_status) {
+        return_status = Cy_Optiga_HashUpdate(&hash, optiga_hash_bench_data, length);
+    }
+    if (OPTIGA_LIB_SUCCESS == return_status) {
+        return_status = Cy_Optiga_HashFinal(&hash, digest);
+    } else {
+        (void)Cy_Optiga_HashFinal(&hash, digest);
+    }
+    cycles = DWT->CYCCNT - cycles;
+
+    if (OPTIGA_LIB_SUCCESS != return_status) {
+        OPTIGA_LOG_ERROR("%s hash failed: 0x%x", name, return_status);
+        return;
+    }
+    centi = (uint32_t)(((uint64_t)cycles * 100u) / length);
+    OPTIGA_LOG_MESSAGE("%s: %d bytes in %d cycles, %d.%02d cycles/byte", name, length, cycles,
+                       centi / 100u, centi % 100u);
+}
+
+void Cy_Optiga_HashBench(void)
+{
+    uint32_t i;
+
+    /* Runs on the CM4, the counter is shared with the PAL timer and the I2C trace */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (i = 0; i < OPTIGA_HASH_BENCH_LENGTH; i++) {
+        optiga_hash_bench_data[i] = (uint8_t)((i * 31u) + 7u);
+    }
+
+    Cy_Optiga_HashBenchRun("SHA-256 MCU", CY_OPTIGA_HASH_SHA256, CY_OPTIGA_HASH_MCU, OPTIGA_HASH_BENCH_LENGTH);
+    Cy_Optiga_HashBenchRun("SHA-384 MCU", CY_OPTIGA_HASH_SHA384, CY_OPTIGA_HASH_MCU, OPTIGA_HASH_BENCH_LENGTH);
+    Cy_Optiga_HashBenchRun("SHA-256 chip", CY_OPTIGA_HASH_SHA256, CY_OPTIGA_HASH_CHIP, OPTIGA_HASH_BENCH_CHIP_LENGTH);
+}
+#endif /* OPTIGA_HASH_BENCH_EN */
@@ -0,0 +1,139 @@
+/***************************************************************************//**
+* \file optiga_hash.h
+*
+* \version 1.0
+*
+* \details  Streaming SHA-256/SHA-384 front end which runs a hash on the MCU or on the
+*           OPTIGA chip, picking the faster engine for the message unless told otherwise.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _OPTIGA_HASH_H_
+#define _OPTIGA_HASH_H_
+
+#include "optiga_app.h"
+#include "sha2.h"
+
+/*
+ * Longest message CY_OPTIGA_HASH_AUTO sends to the chip. Every byte crosses the I2C bus and an
+ * update costs a full command round trip, which is slower than the MCU at any length at 400 kHz,
+ * so the default keeps all hashes on the MCU. Raise it to move small hashes off a busy CPU.
+ */
+#ifndef OPTIGA_HASH_CHIP_MAX_LENGTH
+#define OPTIGA_HASH_CHIP_MAX_LENGTH                 (0u)
+#endif
+
+/* Message sizes of Cy_Optiga_HashBench */
+#ifndef OPTIGA_HASH_BENCH_LENGTH
+#define OPTIGA_HASH_BENCH_LENGTH                    (4096u)
+#endif
+#ifndef OPTIGA_HASH_BENCH_CHIP_LENGTH
+#define OPTIGA_HASH_BENCH_CHIP_LENGTH               (1024u)
+#endif
+
+typedef enum
+{
+    CY_OPTIGA_HASH_SHA256 = 0,
+    CY_OPTIGA_HASH_SHA384
+} cy_en_optiga_hash_alg_t;
+
+typedef enum
+{
+    CY_OPTIGA_HASH_AUTO = 0,                        /* Chosen by Cy_Optiga_HashSelect */
+    CY_OPTIGA_HASH_MCU,
+    CY_OPTIGA_HASH_CHIP                             /* SHA-256 only */
+} cy_en_optiga_hash_engine_t;
+
+/* A hash in progress, prepared by Cy_Optiga_HashInit and cleared by Cy_Optiga_HashFinal */
+typedef struct
+{
+    cy_en_optiga_hash_alg_t alg;
+    cy_en_optiga_hash_engine_t engine;              /* Resolved engine, never CY_OPTIGA_HASH_AUTO */
+    union
+    {
+        cy_stc_sha256_t sha256;
+        cy_stc_sha384_t sha384;
+    } sw;
+    cy_stc_optiga_inst_t *pInst;                    /* Chip engine: instance held from init to final */
+    optiga_hash_context_t chipContext;
+    uint8_t chipContextBuffer[OPTIGA_HASH_CONTEXT_LENGTH_SHA_256];
+} cy_stc_optiga_hash_t;
+
+/**
+ * \name Cy_Optiga_HashSelect
+ * \brief Pick the engine of a hash. SHA-384 always runs on the MCU, the chip has no SHA-384.
+ * \param alg
+ * \param expected_length Message length if known, 0 otherwise
+ * \param engine Requested engine, CY_OPTIGA_HASH_AUTO to let the message length decide
+ * \retval CY_OPTIGA_HASH_MCU or CY_OPTIGA_HASH_CHIP
+ */
+cy_en_optiga_hash_engine_t Cy_Optiga_HashSelect(cy_en_optiga_hash_alg_t alg, uint32_t expected_length,
+                                                cy_en_optiga_hash_engine_t engine);
+
+/**
+ * \name Cy_Optiga_HashInit
+ * \brief Start a hash on the engine picked by Cy_Optiga_HashSelect. A chip hash holds an instance pair
+ *        until Cy_Optiga_HashFinal.
+ * \param p_hash
+ * \param alg
+ * \param expected_length Message length if known, 0 otherwise
+ * \param engine
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_HashInit(cy_stc_optiga_hash_t *p_hash, cy_en_optiga_hash_alg_t alg,
+                                       uint32_t expected_length, cy_en_optiga_hash_engine_t engine);
+
+/**
+ * \name Cy_Optiga_HashUpdate
+ * \brief Hash the next chunk of the message
+ * \param p_hash
+ * \param data
+ * \param length
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_HashUpdate(cy_stc_optiga_hash_t *p_hash, const uint8_t *data, uint32_t length);
+
+/**
+ * \name Cy_Optiga_HashFinal
+ * \brief Write the digest and end the hash, also after a failed update to release the chip
+ * \param p_hash
+ * \param digest SHA256_DIGEST_LENGTH or SHA384_DIGEST_LENGTH bytes
+ * \retval Status of the operation
+ */
+optiga_lib_status_t Cy_Optiga_HashFinal(cy_stc_optiga_hash_t *p_hash, uint8_t *digest);
+
+#if OPTIGA_HASH_BENCH_EN
+/**
+ * \name Cy_Optiga_HashBench
+ * \brief Log the cycles per byte of SHA-256 and SHA-384 on the MCU and of SHA-256 on the chip
+ * \retval None
+ */
+void Cy_Optiga_HashBench(void);
+#endif /* OPTIGA_HASH_BENCH_EN */
+
+#endif /* _OPTIGA_HASH_H_ */
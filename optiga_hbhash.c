@@ -0,0 +1,461 @@
+/***************************************************************************//**
+* \file optiga_hbhash.c
+*
+* \version 1.0
+*
+* \details  This file provides the stage hashing committed HBDMA buffers in place on
+*           the CM4 and forwarding them, and a demo streaming an image through it.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include "optiga_hbhash.h"
+#include "cy_pdl.h"
+#include "task.h"
+#include "queue.h"
+#include <string.h>
+
+/* Set up by Cy_Optiga_HbDmaInit */
+extern cy_stc_hbdma_buf_mgr_t HBW_BufMgr;
+
+/* Queued buffer, hashed unless it was committed after Cy_Optiga_HbHashFinish */
+typedef struct
+{
+    cy_stc_hbdma_buff_status_t buf;
+    bool hash;
+} cy_stc_optiga_hbhash_item_t;
+
+static QueueHandle_t optiga_hbhash_queue = NULL;
+static StaticQueue_t optiga_hbhash_queue_buffer;
+static uint8_t optiga_hbhash_queue_storage[OPTIGA_HBHASH_QUEUE_DEPTH * sizeof(cy_stc_optiga_hbhash_item_t)];
+static TaskHandle_t optiga_hbhash_task = NULL;
+
+/* Hash carried across the buffers, touched by the stage task only while active */
+static cy_stc_optiga_hash_t optiga_hbhash_ctx;
+static volatile bool optiga_hbhash_active = false;
+static cy_optiga_hbhash_forward_t optiga_hbhash_forward = NULL;
+static void *optiga_hbhash_forward_ctx = NULL;
+
+/* Buffers queued and finished, a buffer waits in the queue while they differ */
+static volatile uint32_t optiga_hbhash_queued = 0;
+static volatile uint32_t optiga_hbhash_done = 0;
+/* Queued buffers still to be hashed, Cy_Optiga_HbHashFinish waits for none */
+static volatile uint32_t optiga_hbhash_pending = 0;
+static TaskHandle_t optiga_hbhash_waiter = NULL;
+
+static cy_stc_optiga_hbhash_stats_t optiga_hbhash_stats;
+
+/**
+ * \name Cy_Optiga_HbHashQueue
+ * \brief Queue a buffer for the stage task without blocking. While a hash runs or older buffers are
+ *        still queued the buffer goes through the queue, so the consumer sees the commit order; else
+ *        it is forwarded at once. Cy_Optiga_HbHashStart sizes the queue for every buffer of the
+ *        channel, a full queue means more buffers were committed than declared.
+ * \param p_buf
+ * \param from_isr Called from the HBDMA interrupt
+ * \retval true if queued for the hash
+ */
+static bool Cy_Optiga_HbHashQueue(const cy_stc_hbdma_buff_status_t *p_buf, bool from_isr)
+{
+    cy_stc_optiga_hbhash_item_t item;
+    BaseType_t woken = pdFALSE;
+    BaseType_t queued = pdFALSE;
+    UBaseType_t saved = 0;
+    TaskHandle_t waiter = NULL;
+    bool via_queue;
+    uint32_t backlog;
+
+    item.buf = *p_buf;
+
+    /* The count is taken before the send so Cy_Optiga_HbHashFinish never sees the queue drained early */
+    if (from_isr) {
+        saved = taskENTER_CRITICAL_FROM_ISR();
+    } else {
+        taskENTER_CRITICAL();
+    }
+    item.hash = optiga_hbhash_active;
+    via_queue = (item.hash) || (optiga_hbhash_queued != optiga_hbhash_done);
+    if (item.hash) {
+        optiga_hbhash_pending++;
+    }
+    if (via_queue) {
+        optiga_hbhash_queued++;
+        backlog = optiga_hbhash_queued - optiga_hbhash_done;
+        if (backlog > optiga_hbhash_stats.maxBacklog) {
+            optiga_hbhash_stats.maxBacklog = backlog;
+        }
+    }
+    if (!item.hash) {
+        optiga_hbhash_stats.passed++;
+    }
+    if (from_isr) {
+        taskEXIT_CRITICAL_FROM_ISR(saved);
+    } else {
+        taskEXIT_CRITICAL();
+    }
+
+    if (via_queue) {
+        queued = (from_isr) ? xQueueSendFromISR(optiga_hbhash_queue, &item, &woken) :
+                              xQueueSend(optiga_hbhash_queue, &item, 0);
+    }
+    if ((via_queue) && (pdTRUE != queued)) {
+        if (from_isr) {
+            saved = taskENTER_CRITICAL_FROM_ISR();
+        } else {
+            taskENTER_CRITICAL();
+        }
+        optiga_hbhash_queued--;
+        if (item.hash) {
+            optiga_hbhash_pending--;
+            optiga_hbhash_stats.overflows++;
+        }
+        waiter = (0u == optiga_hbhash_pending) ? optiga_hbhash_waiter : NULL;
+        if (from_isr) {
+            taskEXIT_CRITICAL_FROM_ISR(saved);
+        } else {
+            taskEXIT_CRITICAL();
+        }
+        if (NULL != waiter) {
+            if (from_isr) {
+                vTaskNotifyGiveFromISR(waiter, &woken);
+            } else {
+                (void)xTaskNotifyGive(waiter);
+            }
+        }
+    }
+
+    /* Out of order, but only after a commit the channel did not declare, and the hash fails */
+    if ((pdTRUE != queued) && (NULL != optiga_hbhash_forward)) {
+        optiga_hbhash_forward(optiga_hbhash_forward_ctx, &item.buf);
+    }
+    if (from_isr) {
+        portYIELD_FROM_ISR(woken);
+    }
+    return ((pdTRUE == queued) && (item.hash));
+}
+
+/**
+ * \name Cy_Optiga_HbHashTask
+ * \brief Hash each queued buffer where the DMA left it, then forward it
+ * \param nothing
+ * \retval None
+ */
+static void Cy_Optiga_HbHashTask(void *nothing)
+{
+    cy_stc_optiga_hbhash_item_t item;
+    uint32_t cycles = 0;
+    TaskHandle_t waiter;
+
+    (void)nothing;
+    for (;;) {
+        if (pdTRUE != xQueueReceive(optiga_hbhash_queue, &item, portMAX_DELAY)) {
+            continue;
+        }
+
+        /* The CM4 has no data cache, the bytes written by the DMA are read as they are */
+        if (item.hash) {
+            cycles = DWT->CYCCNT;
+            (void)Cy_Optiga_HashUpdate(&optiga_hbhash_ctx, item.buf.pBuffer, item.buf.count);
+            cycles = DWT->CYCCNT - cycles;
+        }
+
+        if (NULL != optiga_hbhash_forward) {
+            optiga_hbhash_forward(optiga_hbhash_forward_ctx, &item.buf);
+        }
+
+        taskENTER_CRITICAL();
+        waiter = NULL;
+        if (item.hash) {
+            optiga_hbhash_stats.buffers++;
+            optiga_hbhash_stats.bytes += item.buf.count;
+            optiga_hbhash_stats.hashCycles += cycles;
+            optiga_hbhash_pending--;
+            waiter = (0u == optiga_hbhash_pending) ? optiga_hbhash_waiter : NULL;
+        }
+        optiga_hbhash_done++;
+        taskEXIT_CRITICAL();
+
+        if (NULL != waiter) {
+            (void)xTaskNotifyGive(waiter);
+        }
+    }
+}
+
+bool Cy_Optiga_HbHashInit(void)
+{
+    if (NULL == optiga_hbhash_queue) {
+        optiga_hbhash_queue = xQueueCreateStatic(OPTIGA_HBHASH_QUEUE_DEPTH, sizeof(cy_stc_optiga_hbhash_item_t),
+                                                 optiga_hbhash_queue_storage, &optiga_hbhash_queue_buffer);
+    }
+    if (NULL == optiga_hbhash_task) {
+        /* Counts the hash cycles, shared with the PAL timer and the I2C trace */
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+        if (pdPASS != xTaskCreate(Cy_Optiga_HbHashTask, "fx_optiga_hbhash", OPTIGA_HBHASH_TASK_STACK, NULL,
+                                  OPTIGA_HBHASH_TASK_PRIORITY, &optiga_hbhash_task)) {
+            OPTIGA_LOG_ERROR("HBDMA Hash Task Could NOT be Created!");
+            optiga_hbhash_task = NULL;
+        }
+    }
+    return (NULL != optiga_hbhash_task);
+}
+
+optiga_lib_status_t Cy_Optiga_HbHashStart(cy_en_optiga_hash_alg_t alg, uint32_t buffer_count,
+                                          cy_optiga_hbhash_forward_t forward, void *forward_ctx)
+{
+    optiga_lib_status_t return_status;
+    bool idle;
+
+    if (NULL == optiga_hbhash_task) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+    /* Every buffer of the channel may be committed before the task runs, a full queue breaks the order */
+    if ((0u == buffer_count) || (buffer_count > OPTIGA_HBHASH_QUEUE_DEPTH)) {
+        OPTIGA_LOG_ERROR("HBDMA hash queue holds %d buffers, the channel has %d", OPTIGA_HBHASH_QUEUE_DEPTH,
+                         buffer_count);
+        return OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    }
+    /* Buffers committed after the last hash may still wait in the queue for the previous consumer */
+    taskENTER_CRITICAL();
+    idle = (optiga_hbhash_queued == optiga_hbhash_done);
+    taskEXIT_CRITICAL();
+    if ((optiga_hbhash_active) || (!idle)) {
+        return OPTIGA_LIB_BUSY;
+    }
+
+    /* Megabytes over I2C are out of the question, the stage always hashes on the MCU */
+    return_status = Cy_Optiga_HashInit(&optiga_hbhash_ctx, alg, 0, CY_OPTIGA_HASH_MCU);
+    if (OPTIGA_LIB_SUCCESS != return_status) {
+        return return_status;
+    }
+
+    taskENTER_CRITICAL();
+    optiga_hbhash_forward = forward;
+    optiga_hbhash_forward_ctx = forward_ctx;
+    optiga_hbhash_queued = 0;
+    optiga_hbhash_done = 0;
+    memset(&optiga_hbhash_stats, 0, sizeof(optiga_hbhash_stats));
+    optiga_hbhash_active = true;
+    taskEXIT_CRITICAL();
+
+    return OPTIGA_LIB_SUCCESS;
+}
+
+bool Cy_Optiga_HbHashSubmit(const cy_stc_hbdma_buff_status_t *p_buf)
+{
+    return Cy_Optiga_HbHashQueue(p_buf, false);
+}
+
+void Cy_Optiga_HbHashChannelCb(cy_stc_hbdma_channel_t *handle, cy_en_hbdma_cb_type_t type,
+                               cy_stc_hbdma_buff_status_t *pbufStat, void *userCtx)
+{
+    (void)handle;
+    (void)userCtx;
+
+    if ((CY_HBDMA_CB_PROD_EVENT == type) && (NULL != pbufStat)) {
+        (void)Cy_Optiga_HbHashQueue(pbufStat, true);
+    }
+}
+
+void Cy_Optiga_HbHashCommit(void *ctx, cy_stc_hbdma_buff_status_t *p_buf)
+{
+    if (CY_HBDMA_MGR_SUCCESS != Cy_HBDma_Channel_CommitBuffer((cy_stc_hbdma_channel_t *)ctx, p_buf)) {
+        OPTIGA_LOG_ERROR("HBDMA commit of %d bytes failed", p_buf->count);
+    }
+}
+
+optiga_lib_status_t Cy_Optiga_HbHashFinish(uint8_t *digest, uint32_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+    TickType_t elapsed;
+    bool drained;
+
+    if (!optiga_hbhash_active) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+
+    /* Buffers committed from here on pass unhashed, the queued ones still count */
+    taskENTER_CRITICAL();
+    optiga_hbhash_active = false;
+    optiga_hbhash_waiter = xTaskGetCurrentTaskHandle();
+    taskEXIT_CRITICAL();
+
+    for (;;) {
+        taskENTER_CRITICAL();
+        drained = (0u == optiga_hbhash_pending);
+        taskEXIT_CRITICAL();
+        elapsed = xTaskGetTickCount() - start;
+        if ((drained) || (elapsed >= timeout)) {
+            break;
+        }
+        (void)ulTaskNotifyTake(pdTRUE, timeout - elapsed);
+    }
+
+    taskENTER_CRITICAL();
+    optiga_hbhash_waiter = NULL;
+    taskEXIT_CRITICAL();
+
+    if (!drained) {
+        /* The task still owns the hash, leave it alone and let the caller try again */
+        optiga_hbhash_active = true;
+        OPTIGA_LOG_ERROR("HBDMA hash queue not drained within %dms", timeout_ms);
+        return OPTIGA_APP_ERR_TIMEOUT;
+    }
+
+    (void)Cy_Optiga_HashFinal(&optiga_hbhash_ctx, digest);
+    return (0u == optiga_hbhash_stats.overflows) ? OPTIGA_LIB_SUCCESS : OPTIGA_CRYPT_ERROR;
+}
+
+void Cy_Optiga_HbHashGetStats(cy_stc_optiga_hbhash_stats_t *p_stats)
+{
+    taskENTER_CRITICAL();
+    *p_stats = optiga_hbhash_stats;
+    taskEXIT_CRITICAL();
+}
+
+/* Free buffers of the demo, handed back by the stage once hashed */
+static QueueHandle_t optiga_hbhash_demo_ring = NULL;
+static StaticQueue_t optiga_hbhash_demo_ring_buffer;
+static uint8_t optiga_hbhash_demo_ring_storage[OPTIGA_HBHASH_DEMO_BUFFERS * sizeof(uint8_t *)];
+
+/**
+ * \name Cy_Optiga_HbHashDemoForward
+ * \brief Forward function of the demo, the consumer only hands the buffer back to the producer
+ * \param ctx
+ * \param p_buf
+ * \retval None
+ */
+static void Cy_Optiga_HbHashDemoForward(void *ctx, cy_stc_hbdma_buff_status_t *p_buf)
+{
+    (void)ctx;
+    (void)xQueueSend(optiga_hbhash_demo_ring, &p_buf->pBuffer, 0);
+}
+
+/**
+ * \name Cy_Optiga_HbHashDemoFill
+ * \brief Produce the next part of the demo image, standing in for the DMA write
+ * \param buffer
+ * \param offset Position of the part in the image
+ * \param length
+ * \retval None
+ */
+static void Cy_Optiga_HbHashDemoFill(uint8_t *buffer, uint32_t offset, uint32_t length)
+{
+    uint32_t i;
+
+    for (i = 0; i < length; i++) {
+        buffer[i] = (uint8_t)(((offset + i) * 31u) + 7u);
+    }
+}
+
+void Cy_Optiga_HbHashDemo(void)
+{
+    uint8_t *buffers[OPTIGA_HBHASH_DEMO_BUFFERS] = { NULL };
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t expected[SHA256_DIGEST_LENGTH];
+    cy_stc_sha256_t reference;
+    cy_stc_hbdma_buff_status_t buf;
+    cy_stc_optiga_hbhash_stats_t stats;
+    optiga_lib_status_t return_status;
+    uint32_t time_taken;
+    uint32_t centi;
+    uint32_t offset;
+    uint32_t n;
+    uint8_t i;
+
+    if (NULL == optiga_hbhash_demo_ring) {
+        optiga_hbhash_demo_ring = xQueueCreateStatic(OPTIGA_HBHASH_DEMO_BUFFERS, sizeof(uint8_t *),
+                                                     optiga_hbhash_demo_ring_storage,
+                                                     &optiga_hbhash_demo_ring_buffer);
+    }
+
+    for (i = 0; i < OPTIGA_HBHASH_DEMO_BUFFERS; i++) {
+        buffers[i] = (uint8_t *)Cy_HBDma_BufMgr_Alloc(&HBW_BufMgr, OPTIGA_HBHASH_DEMO_BUFFER_SIZE);
+        if (NULL == buffers[i]) {
+            OPTIGA_LOG_ERROR("HBDMA buffer pool exhausted, %d bytes", OPTIGA_HBHASH_DEMO_BUFFER_SIZE);
+            break;
+        }
+        (void)xQueueSend(optiga_hbhash_demo_ring, &buffers[i], 0);
+    }
+
+    return_status = OPTIGA_CRYPT_ERROR;
+    if ((i == OPTIGA_HBHASH_DEMO_BUFFERS) && (Cy_Optiga_HbHashInit())) {
+        return_status = Cy_Optiga_HbHashStart(CY_OPTIGA_HASH_SHA256, OPTIGA_HBHASH_DEMO_BUFFERS,
+                                          Cy_Optiga_HbHashDemoForward, NULL);
+    }
+
+    if (OPTIGA_LIB_SUCCESS == return_status) {
+        START_PERFORMANCE_MEASUREMENT(time_taken);
+        for (offset = 0; offset < OPTIGA_HBHASH_DEMO_LENGTH; offset += n) {
+            n = OPTIGA_HBHASH_DEMO_LENGTH - offset;
+            if (n > OPTIGA_HBHASH_DEMO_BUFFER_SIZE) {
+                n = OPTIGA_HBHASH_DEMO_BUFFER_SIZE;
+            }
+            /* Waits while every buffer is queued for the hash, as the DMA would for a free buffer */
+            (void)xQueueReceive(optiga_hbhash_demo_ring, &buf.pBuffer, portMAX_DELAY);
+            Cy_Optiga_HbHashDemoFill(buf.pBuffer, offset, n);
+            buf.size = OPTIGA_HBHASH_DEMO_BUFFER_SIZE;
+            buf.count = n;
+            buf.status = 0;
+            (void)Cy_Optiga_HbHashSubmit(&buf);
+        }
+        return_status = Cy_Optiga_HbHashFinish(digest, OPTIGA_APP_WAIT_TIMEOUT_MS);
+        READ_PERFORMANCE_MEASUREMENT(time_taken);
+
+        Cy_Optiga_HbHashGetStats(&stats);
+        centi = (stats.bytes > 0u) ? (uint32_t)(((uint64_t)stats.hashCycles * 100u) / stats.bytes) : 0u;
+        OPTIGA_LOG_MESSAGE("HBDMA stage: %d bytes in %d buffers, %dus, %d.%02d cycles/byte hashing, backlog %d",
+                           stats.bytes, stats.buffers, time_taken, centi / 100u, centi % 100u, stats.maxBacklog);
+    }
+
+    if (OPTIGA_LIB_SUCCESS == return_status) {
+        /* Same image hashed from one reused buffer */
+        Cy_Sha256_Init(&reference);
+        for (offset = 0; offset < OPTIGA_HBHASH_DEMO_LENGTH; offset += n) {
+            n = OPTIGA_HBHASH_DEMO_LENGTH - offset;
+            if (n > OPTIGA_HBHASH_DEMO_BUFFER_SIZE) {
+                n = OPTIGA_HBHASH_DEMO_BUFFER_SIZE;
+            }
+            Cy_Optiga_HbHashDemoFill(buffers[0], offset, n);
+            Cy_Sha256_Update(&reference, buffers[0], n);
+        }
+        Cy_Sha256_Final(&reference, expected);
+        if (0 != memcmp(digest, expected, sizeof(digest))) {
+            return_status = OPTIGA_CRYPT_ERROR;
+        }
+        printArray16("HBDMA image digest", digest, sizeof(digest), false);
+    }
+    OPTIGA_LOG_STATUS("HBDMA image hash", return_status);
+
+    /* Buffers still held by a timed out hash stay with it */
+    while (pdTRUE == xQueueReceive(optiga_hbhash_demo_ring, &buf.pBuffer, 0)) {
+        (void)Cy_HBDma_BufMgr_Free(&HBW_BufMgr, buf.pBuffer);
+    }
+}
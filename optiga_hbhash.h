@@ -0,0 +1,163 @@
+/***************************************************************************//**
+* \file optiga_hbhash.h
+*
+* \version 1.0
+*
+* \details  Pipeline stage hashing HBDMA buffers in place as the producer commits them,
+*           before they are forwarded to the consumer, with the hash state carried from
+*           one buffer to the next.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _OPTIGA_HBHASH_H_
+#define _OPTIGA_HBHASH_H_
+
+#include "optiga_app.h"
+#include "optiga_hash.h"
+
+/* Committed buffers waiting for the hash, Cy_Optiga_HbHashStart refuses a channel with more buffers */
+#ifndef OPTIGA_HBHASH_QUEUE_DEPTH
+#define OPTIGA_HBHASH_QUEUE_DEPTH                   (16u)
+#endif
+
+/* Below the OPTIGA application task, above the background refills */
+#ifndef OPTIGA_HBHASH_TASK_PRIORITY
+#define OPTIGA_HBHASH_TASK_PRIORITY                 (10u)
+#endif
+
+#ifndef OPTIGA_HBHASH_TASK_STACK
+#define OPTIGA_HBHASH_TASK_STACK                    (512u)
+#endif
+
+/* Image streamed by Cy_Optiga_HbHashDemo through buffers from the HBDMA buffer pool */
+#ifndef OPTIGA_HBHASH_DEMO_LENGTH
+#define OPTIGA_HBHASH_DEMO_LENGTH                   (0x100000UL)
+#endif
+#ifndef OPTIGA_HBHASH_DEMO_BUFFERS
+#define OPTIGA_HBHASH_DEMO_BUFFERS                  (4u)
+#endif
+#ifndef OPTIGA_HBHASH_DEMO_BUFFER_SIZE
+#define OPTIGA_HBHASH_DEMO_BUFFER_SIZE              (0x4000UL)
+#endif
+
+/*
+ * Hands a hashed buffer on to its consumer. Called by the stage task, and from the channel callback
+ * for a buffer the stage could not queue, so it must not block.
+ */
+typedef void (*cy_optiga_hbhash_forward_t)(void *ctx, cy_stc_hbdma_buff_status_t *p_buf);
+
+/* Stage counters, cleared by Cy_Optiga_HbHashStart */
+typedef struct
+{
+    uint32_t buffers;                               /* Hashed and forwarded */
+    uint32_t bytes;
+    uint32_t passed;                                /* Forwarded unhashed, committed after Cy_Optiga_HbHashFinish */
+    uint32_t overflows;                             /* Forwarded out of order, more buffers than declared. Fails the hash. */
+    uint32_t maxBacklog;                            /* Most buffers waiting for the hash at once */
+    uint32_t hashCycles;                            /* CPU cycles spent hashing */
+} cy_stc_optiga_hbhash_stats_t;
+
+/**
+ * \name Cy_Optiga_HbHashInit
+ * \brief Create the queue and the task of the stage
+ * \retval true if the stage runs
+ */
+bool Cy_Optiga_HbHashInit(void);
+
+/**
+ * \name Cy_Optiga_HbHashStart
+ * \brief Start a hash over the buffers submitted from now on, until Cy_Optiga_HbHashFinish
+ * \param alg
+ * \param buffer_count Buffers of the channel, at most OPTIGA_HBHASH_QUEUE_DEPTH so none is ever forwarded
+ *        ahead of an older one
+ * \param forward Consumer of the hashed buffers, Cy_Optiga_HbHashCommit for an HBDMA channel
+ * \param forward_ctx Passed to forward, the channel for Cy_Optiga_HbHashCommit
+ * \retval Status of the operation, OPTIGA_LIB_BUSY if a hash is running or its queue still drains,
+ *         OPTIGA_CRYPT_ERROR_INVALID_INPUT if the channel has more buffers than the queue
+ */
+optiga_lib_status_t Cy_Optiga_HbHashStart(cy_en_optiga_hash_alg_t alg, uint32_t buffer_count,
+                                          cy_optiga_hbhash_forward_t forward, void *forward_ctx);
+
+/**
+ * \name Cy_Optiga_HbHashSubmit
+ * \brief Queue a committed buffer from a task. It is forwarded once hashed and must not change until then.
+ * \param p_buf Buffer and byte count, copied
+ * \retval true if queued for the hash, false if forwarded without hashing
+ */
+bool Cy_Optiga_HbHashSubmit(const cy_stc_hbdma_buff_status_t *p_buf);
+
+/**
+ * \name Cy_Optiga_HbHashChannelCb
+ * \brief HBDMA channel callback of a manual channel whose producer events feed the stage. Give it with
+ *        the stage as consumer when creating the channel, or call it from the channel's own callback.
+ *        Buffers committed before the first Cy_Optiga_HbHashStart have no consumer and stay with the channel.
+ * \param handle
+ * \param type
+ * \param pbufStat
+ * \param userCtx
+ * \retval None
+ */
+void Cy_Optiga_HbHashChannelCb(cy_stc_hbdma_channel_t *handle, cy_en_hbdma_cb_type_t type,
+                               cy_stc_hbdma_buff_status_t *pbufStat, void *userCtx);
+
+/**
+ * \name Cy_Optiga_HbHashCommit
+ * \brief Forward function committing a hashed buffer to the consumer of an HBDMA channel
+ * \param ctx The cy_stc_hbdma_channel_t
+ * \param p_buf
+ * \retval None
+ */
+void Cy_Optiga_HbHashCommit(void *ctx, cy_stc_hbdma_buff_status_t *p_buf);
+
+/**
+ * \name Cy_Optiga_HbHashFinish
+ * \brief Wait until the queued buffers are hashed and write the digest. Later buffers pass unhashed.
+ * \param digest SHA256_DIGEST_LENGTH or SHA384_DIGEST_LENGTH bytes
+ * \param timeout_ms
+ * \retval Status of the operation, OPTIGA_APP_ERR_TIMEOUT if the queue did not drain, OPTIGA_CRYPT_ERROR
+ *         if a buffer overflowed the queue
+ */
+optiga_lib_status_t Cy_Optiga_HbHashFinish(uint8_t *digest, uint32_t timeout_ms);
+
+/**
+ * \name Cy_Optiga_HbHashGetStats
+ * \brief Copy the stage counters
+ * \param p_stats
+ * \retval None
+ */
+void Cy_Optiga_HbHashGetStats(cy_stc_optiga_hbhash_stats_t *p_stats);
+
+/**
+ * \name Cy_Optiga_HbHashDemo
+ * \brief Stream OPTIGA_HBHASH_DEMO_LENGTH bytes through buffers of the HBDMA buffer pool and the stage,
+ *        check the digest and log the throughput
+ * \retval None
+ */
+void Cy_Optiga_HbHashDemo(void);
+
+#endif /* _OPTIGA_HBHASH_H_ */
@@ -0,0 +1,244 @@
+/***************************************************************************//**
+* \file optiga_keypool.c
+*
+* \version 1.0
+*
+* \details  This file provides the background refill of the pre-generated key
+*           pool and hands the keys out.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include "optiga_keypool.h"
+#include "task.h"
+
+/* Metadata of a pooled slot: change and execute access always, as for OPTIGA_FREE_ECC_KEY_ID */
+static const uint8_t optiga_keypool_metadata[] = { 0x20, 0x06, 0xD0, 0x01, 0x00, 0xD3, 0x01, 0x00 };
+
+static const optiga_key_id_t optiga_keypool_slot_ids[] = OPTIGA_KEYPOOL_SLOTS;
+
+#define OPTIGA_KEYPOOL_NUM_SLOTS    (sizeof(optiga_keypool_slot_ids) / sizeof(optiga_keypool_slot_ids[0]))
+
+static struct
+{
+    cy_en_optiga_key_state_t state;
+    uint16_t publicKeyLength;
+    uint8_t publicKey[OPTIGA_KEYPOOL_PUBKEY_MAX_LENGTH];
+} optiga_keypool_slots[OPTIGA_KEYPOOL_NUM_SLOTS];
+
+static cy_stc_optiga_keypool_stats_t optiga_keypool_stats;
+
+static TaskHandle_t optiga_keypool_task = NULL;
+
+/**
+ * \name Cy_Optiga_KeyPoolClaimEmpty
+ * \brief Mark the first empty slot as being generated
+ * \retval Slot index, -1 if every slot holds a key
+ */
+static int8_t Cy_Optiga_KeyPoolClaimEmpty(void)
+{
+    int8_t idx = -1;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_KEYPOOL_NUM_SLOTS; i++) {
+        if (CY_OPTIGA_KEY_EMPTY == optiga_keypool_slots[i].state) {
+            optiga_keypool_slots[i].state = CY_OPTIGA_KEY_GENERATING;
+            idx = (int8_t)i;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return idx;
+}
+
+/**
+ * \name Cy_Optiga_KeyPoolGenerate
+ * \brief Generate a key pair into a slot on chip 0 and cache its public key
+ * \param p_inst
+ * \param idx
+ * \retval Status of the operation
+ */
+static optiga_lib_status_t Cy_Optiga_KeyPoolGenerate(cy_stc_optiga_inst_t *p_inst, uint8_t idx)
+{
+    optiga_lib_status_t return_status;
+    optiga_key_id_t key_id = optiga_keypool_slot_ids[idx];
+    uint8_t public_key[OPTIGA_KEYPOOL_PUBKEY_MAX_LENGTH];
+    uint16_t public_key_length = sizeof(public_key);
+
+    do {
+        /* Usually a no-op thanks to the metadata shadow, the slots keep their metadata. */
+        return_status = Cy_Optiga_MetadataWrite(p_inst, (uint16_t)key_id, optiga_keypool_metadata,
+                                                sizeof(optiga_keypool_metadata));
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
+
+        Cy_Optiga_OpStart(&p_inst->op);
+        return_status = optiga_crypt_ecc_generate_keypair(p_inst->crypt, OPTIGA_ECC_CURVE_NIST_P_256,
+                                                          (uint8_t)OPTIGA_KEYPOOL_KEY_USAGE, FALSE, &key_id,
+                                                          public_key, &public_key_length);
+        Cy_Optiga_MetadataInvalidate((uint16_t)key_id);
+        return_status = Cy_Optiga_OpWait(&p_inst->op, return_status, OPTIGA_APP_WAIT_TIMEOUT_MS);
+        Cy_Optiga_MetadataInvalidate((uint16_t)key_id);
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
+
+        taskENTER_CRITICAL();
+        pal_os_memcpy(optiga_keypool_slots[idx].publicKey, public_key, public_key_length);
+        optiga_keypool_slots[idx].publicKeyLength = public_key_length;
+        optiga_keypool_slots[idx].state = CY_OPTIGA_KEY_FRESH;
+        optiga_keypool_stats.generated++;
+        if (p_inst->op.durationUs > optiga_keypool_stats.maxGenUs) {
+            optiga_keypool_stats.maxGenUs = p_inst->op.durationUs;
+        }
+        taskEXIT_CRITICAL();
+    } while (FALSE);
+
+    return return_status;
+}
+
+/**
+ * \name Cy_Optiga_KeyPoolTask
+ * \brief Refill empty slots one key at a time, whenever the chip has nothing else to do
+ * \param nothing
+ * \retval None
+ */
+static void Cy_Optiga_KeyPoolTask(void *nothing)
+{
+    cy_stc_optiga_inst_t *p_inst;
+    optiga_lib_status_t return_status;
+    int8_t idx;
+
+    (void)nothing;
+    for (;;) {
+        if (!Cy_Optiga_InstPoolIdle()) {
+            (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(OPTIGA_KEYPOOL_RETRY_MS));
+            continue;
+        }
+
+        idx = Cy_Optiga_KeyPoolClaimEmpty();
+        if (idx < 0) {
+            /* Full, sleep until a key is returned. */
+            (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        p_inst = Cy_Optiga_InstAcquire();
+        return_status = (NULL == p_inst) ? OPTIGA_CRYPT_ERROR : Cy_Optiga_KeyPoolGenerate(p_inst, (uint8_t)idx);
+        Cy_Optiga_InstRelease(p_inst);
+
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            taskENTER_CRITICAL();
+            optiga_keypool_slots[idx].state = CY_OPTIGA_KEY_EMPTY;
+            optiga_keypool_stats.failures++;
+            taskEXIT_CRITICAL();
+            OPTIGA_LOG_STATUS("Key pool refill", return_status);
+            vTaskDelay(pdMS_TO_TICKS(OPTIGA_KEYPOOL_RETRY_MS));
+        }
+    }
+}
+
+bool Cy_Optiga_KeyPoolInit(void)
+{
+    if (NULL == optiga_keypool_task) {
+        if (pdPASS != xTaskCreate(Cy_Optiga_KeyPoolTask, "fx_optiga_keys", OPTIGA_KEYPOOL_TASK_STACK, NULL,
+                                  OPTIGA_KEYPOOL_TASK_PRIORITY, &optiga_keypool_task)) {
+            OPTIGA_LOG_ERROR("Key Pool Task Could NOT be Created!");
+            optiga_keypool_task = NULL;
+        }
+    }
+    return (NULL != optiga_keypool_task);
+}
+
+optiga_lib_status_t Cy_Optiga_KeyPoolTake(optiga_key_id_t *p_key_id, uint8_t *public_key,
+                                          uint16_t *public_key_length)
+{
+    optiga_lib_status_t return_status = OPTIGA_APP_ERR_KEYPOOL_EMPTY;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_KEYPOOL_NUM_SLOTS; i++) {
+        if ((CY_OPTIGA_KEY_FRESH == optiga_keypool_slots[i].state) &&
+            (optiga_keypool_slots[i].publicKeyLength <= *public_key_length)) {
+            optiga_keypool_slots[i].state = CY_OPTIGA_KEY_TAKEN;
+            *p_key_id = optiga_keypool_slot_ids[i];
+            *public_key_length = optiga_keypool_slots[i].publicKeyLength;
+            pal_os_memcpy(public_key, optiga_keypool_slots[i].publicKey, *public_key_length);
+            optiga_keypool_stats.taken++;
+            return_status = OPTIGA_LIB_SUCCESS;
+            break;
+        }
+    }
+    if (OPTIGA_LIB_SUCCESS != return_status) {
+        optiga_keypool_stats.misses++;
+    }
+    taskEXIT_CRITICAL();
+
+    return return_status;
+}
+
+void Cy_Optiga_KeyPoolReturn(optiga_key_id_t key_id)
+{
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_KEYPOOL_NUM_SLOTS; i++) {
+        if ((optiga_keypool_slot_ids[i] == key_id) && (CY_OPTIGA_KEY_TAKEN == optiga_keypool_slots[i].state)) {
+            optiga_keypool_slots[i].state = CY_OPTIGA_KEY_EMPTY;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL != optiga_keypool_task) {
+        (void)xTaskNotifyGive(optiga_keypool_task);
+    }
+}
+
+uint8_t Cy_Optiga_KeyPoolFreshCount(void)
+{
+    uint8_t count = 0;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_KEYPOOL_NUM_SLOTS; i++) {
+        if (CY_OPTIGA_KEY_FRESH == optiga_keypool_slots[i].state) {
+            count++;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return count;
+}
+
+void Cy_Optiga_KeyPoolGetStats(cy_stc_optiga_keypool_stats_t *p_stats)
+{
+    taskENTER_CRITICAL();
+    *p_stats = optiga_keypool_stats;
+    taskEXIT_CRITICAL();
+}
@@ -0,0 +1,132 @@
+/***************************************************************************//**
+* \file optiga_keypool.h
+*
+* \version 1.0
+*
+* \details  Pool of ECC keys generated ahead of time into free Optiga key slots
+*           while the chips are idle, handed out instantly with their public key.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _OPTIGA_KEYPOOL_H_
+#define _OPTIGA_KEYPOOL_H_
+
+#include "optiga_app.h"
+
+/*
+ * Key slots refilled by the pool. OPTIGA_FREE_ECC_KEY_ID (E0F2) stays with the demo flow of Cy_Optiga_Main.
+ * Session keys are not pooled, they belong to the crypt instance which generated them.
+ */
+#ifndef OPTIGA_KEYPOOL_SLOTS
+#define OPTIGA_KEYPOOL_SLOTS                        { OPTIGA_KEY_ID_E0F1, OPTIGA_KEY_ID_E0F3 }
+#endif
+
+#ifndef OPTIGA_KEYPOOL_KEY_USAGE
+#define OPTIGA_KEYPOOL_KEY_USAGE                    (OPTIGA_KEY_USAGE_SIGN)
+#endif
+
+/* Wait before checking again for idle chips when the refill found them busy */
+#ifndef OPTIGA_KEYPOOL_RETRY_MS
+#define OPTIGA_KEYPOOL_RETRY_MS                     (50u)
+#endif
+
+/* Below the application tasks, the refill only uses time nobody else wants */
+#ifndef OPTIGA_KEYPOOL_TASK_PRIORITY
+#define OPTIGA_KEYPOOL_TASK_PRIORITY                (tskIDLE_PRIORITY + 2)
+#endif
+
+#ifndef OPTIGA_KEYPOOL_TASK_STACK
+#define OPTIGA_KEYPOOL_TASK_STACK                   (1024u)
+#endif
+
+/* Size of the cached public key, 4 byte bit string header and the uncompressed P-256 point */
+#define OPTIGA_KEYPOOL_PUBKEY_MAX_LENGTH            (68u)
+
+/* Status of a take which found no fresh key, outside the library codes */
+#define OPTIGA_APP_ERR_KEYPOOL_EMPTY                (0x0F04)
+
+typedef enum
+{
+    CY_OPTIGA_KEY_EMPTY = 0,                        /* Needs a key generated */
+    CY_OPTIGA_KEY_GENERATING,
+    CY_OPTIGA_KEY_FRESH,                            /* Holds a key nobody has used */
+    CY_OPTIGA_KEY_TAKEN                             /* Handed out, refilled once returned */
+} cy_en_optiga_key_state_t;
+
+/* Pool counters */
+typedef struct
+{
+    uint32_t taken;                                 /* Fresh keys handed out */
+    uint32_t misses;                                /* Takes which found no fresh key */
+    uint32_t generated;
+    uint32_t failures;                              /* Failed refills, the slot is retried */
+    uint32_t maxGenUs;
+} cy_stc_optiga_keypool_stats_t;
+
+/**
+ * \name Cy_Optiga_KeyPoolInit
+ * \brief Start the refill task. The chips must be opened by Cy_Optiga_Init.
+ * \retval true if the pool runs
+ */
+bool Cy_Optiga_KeyPoolInit(void);
+
+/**
+ * \name Cy_Optiga_KeyPoolTake
+ * \brief Hand out a pre-generated key, without any chip access
+ * \param p_key_id Slot holding the private key
+ * \param public_key
+ * \param public_key_length In: size of public_key, out: length of the public key (incl. header)
+ * \retval OPTIGA_LIB_SUCCESS, OPTIGA_APP_ERR_KEYPOOL_EMPTY if no key is fresh
+ */
+optiga_lib_status_t Cy_Optiga_KeyPoolTake(optiga_key_id_t *p_key_id, uint8_t *public_key,
+                                          uint16_t *public_key_length);
+
+/**
+ * \name Cy_Optiga_KeyPoolReturn
+ * \brief Give back the slot of a key no longer needed, a new key is generated into it in the background
+ * \param key_id
+ * \retval None
+ */
+void Cy_Optiga_KeyPoolReturn(optiga_key_id_t key_id);
+
+/**
+ * \name Cy_Optiga_KeyPoolFreshCount
+ * \brief Number of keys ready to be taken
+ * \retval Count
+ */
+uint8_t Cy_Optiga_KeyPoolFreshCount(void);
+
+/**
+ * \name Cy_Optiga_KeyPoolGetStats
+ * \brief Copy the pool counters
+ * \param p_stats
+ * \retval None
+ */
+void Cy_Optiga_KeyPoolGetStats(cy_stc_optiga_keypool_stats_t *p_stats);
+
+#endif /* _OPTIGA_KEYPOOL_H_ */
@@ -0,0 +1,415 @@
+/***************************************************************************//**
+* \file optiga_service.c
+*
+* \version 1.0
+*
+* \details  This file provides the crypto request queue served by a worker task
+*           through the Optiga sign/verify/random/hash functions, ordered by
+*           priority and deadline.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include "optiga_service.h"
+#include "task.h"
+
+/* Requests waiting for the worker, in submit order. The worker picks the most urgent one. */
+static cy_stc_optiga_svc_req_t *optiga_svc_pending[OPTIGA_SVC_QUEUE_DEPTH];
+static uint8_t optiga_svc_pending_count = 0;
+static uint32_t optiga_svc_seq = 0;
+
+/* Request on the chip, and when it started */
+static cy_stc_optiga_svc_req_t *optiga_svc_running = NULL;
+static uint32_t optiga_svc_running_start_us = 0;
+
+static cy_stc_optiga_svc_stats_t optiga_svc_stats;
+
+static TaskHandle_t optiga_svc_task = NULL;
+
+/**
+ * \name Cy_Optiga_SvcBefore
+ * \brief Scheduling order: higher priority, then earlier deadline (none is last), then submit order
+ * \param p_a
+ * \param p_b
+ * \retval true if p_a runs before p_b
+ */
+static bool Cy_Optiga_SvcBefore(const cy_stc_optiga_svc_req_t *p_a, const cy_stc_optiga_svc_req_t *p_b)
+{
+    if (p_a->priority != p_b->priority) {
+        return (p_a->priority > p_b->priority);
+    }
+    if ((0 != p_a->deadlineMs) && (0 != p_b->deadlineMs) && (p_a->deadlineUs != p_b->deadlineUs)) {
+        return ((int32_t)(p_a->deadlineUs - p_b->deadlineUs) < 0);
+    }
+    if ((0 != p_a->deadlineMs) != (0 != p_b->deadlineMs)) {
+        return (0 != p_a->deadlineMs);
+    }
+    return ((int32_t)(p_a->seq - p_b->seq) < 0);
+}
+
+/**
+ * \name Cy_Optiga_SvcWaitEstimate
+ * \brief Estimated time before p_req starts: the rest of the running request and the pending ones
+ *        ordered before it. The worker runs one request at a time, so
+ *        the estimates add up. Called inside a critical section.
+ * \param p_req
+ * \param now_us
+ * \retval Estimate in us
+ */
+static uint32_t Cy_Optiga_SvcWaitEstimate(const cy_stc_optiga_svc_req_t *p_req, uint32_t now_us)
+{
+    uint32_t wait_us = 0;
+    uint32_t elapsed_us;
+    uint8_t i;
+
+    if (NULL != optiga_svc_running) {
+        elapsed_us = now_us - optiga_svc_running_start_us;
+        if (elapsed_us < optiga_svc_stats.estExecUs[optiga_svc_running->type]) {
+            wait_us = optiga_svc_stats.estExecUs[optiga_svc_running->type] - elapsed_us;
+        }
+    }
+    for (i = 0; i < optiga_svc_pending_count; i++) {
+        if ((optiga_svc_pending[i] != p_req) && (Cy_Optiga_SvcBefore(optiga_svc_pending[i], p_req))) {
+            wait_us += optiga_svc_stats.estExecUs[optiga_svc_pending[i]->type];
+        }
+    }
+    return wait_us;
+}
+
+/**
+ * \name Cy_Optiga_SvcMisses
+ * \brief Check whether a request starting after wait_us is expected to complete past its deadline
+ * \param p_req
+ * \param now_us
+ * \param wait_us
+ * \retval true if the deadline cannot be met
+ */
+static bool Cy_Optiga_SvcMisses(const cy_stc_optiga_svc_req_t *p_req, uint32_t now_us, uint32_t wait_us)
+{
+    uint32_t done_us = now_us + wait_us + optiga_svc_stats.estExecUs[p_req->type];
+
+    return ((0 != p_req->deadlineMs) && ((int32_t)(done_us - p_req->deadlineUs) > 0));
+}
+
+/**
+ * \name Cy_Optiga_SvcExecute
+ * \brief Run one request on the chip, blocking the worker until it completed
+ * \param p_req
+ * \retval Status of the operation
+ */
+static optiga_lib_status_t Cy_Optiga_SvcExecute(cy_stc_optiga_svc_req_t *p_req)
+{
+    switch (p_req->type) {
+    case CY_OPTIGA_SVC_SIGN:
+        return Cy_Optiga_Sign(p_req->keyId, p_req->pIn, (uint8_t)p_req->inLength, p_req->pOut, p_req->pOutLength);
+    case CY_OPTIGA_SVC_VERIFY:
+        return Cy_Optiga_Verify(p_req->pIn, (uint8_t)p_req->inLength, p_req->pSignature, p_req->signatureLength,
+                                p_req->pPublicKey);
+    case CY_OPTIGA_SVC_RANDOM:
+        return Cy_Optiga_GetRandom(p_req->pOut, p_req->outLength);
+    case CY_OPTIGA_SVC_HASH:
+        return Cy_Optiga_Hash(p_req->pIn, p_req->inLength, p_req->pOut);
+    default:
+        return OPTIGA_CRYPT_ERROR;
+    }
+}
+
+/**
+ * \name Cy_Optiga_SvcTake
+ * \brief Remove the most urgent pending request and make it the running one
+ * \param None
+ * \retval The request, NULL if none is pending
+ */
+static cy_stc_optiga_svc_req_t *Cy_Optiga_SvcTake(void)
+{
+    cy_stc_optiga_svc_req_t *p_req = NULL;
+    uint8_t best = 0;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 1; i < optiga_svc_pending_count; i++) {
+        if (Cy_Optiga_SvcBefore(optiga_svc_pending[i], optiga_svc_pending[best])) {
+            best = i;
+        }
+    }
+    if (0 != optiga_svc_pending_count) {
+        p_req = optiga_svc_pending[best];
+        optiga_svc_pending_count--;
+        for (i = best; i < optiga_svc_pending_count; i++) {
+            optiga_svc_pending[i] = optiga_svc_pending[i + 1];
+        }
+        optiga_svc_running = p_req;
+        optiga_svc_running_start_us = pal_os_timer_get_time_in_microseconds();
+    }
+    taskEXIT_CRITICAL();
+    return p_req;
+}
+
+/**
+ * \name Cy_Optiga_SvcComplete
+ * \brief Account a finished request and signal its owner
+ * \param p_req
+ * \param status
+ * \retval None
+ */
+static void Cy_Optiga_SvcComplete(cy_stc_optiga_svc_req_t *p_req, optiga_lib_status_t status)
+{
+    uint32_t *p_est = &optiga_svc_stats.estExecUs[p_req->type];
+    bool ran = (OPTIGA_APP_ERR_DEADLINE != status);
+
+    p_req->queueUs = optiga_svc_running_start_us - p_req->op.startUs;
+    p_req->execUs = ran ? (pal_os_timer_get_time_in_microseconds() - optiga_svc_running_start_us) : 0;
+
+    taskENTER_CRITICAL();
+    optiga_svc_running = NULL;
+    if (ran) {
+        optiga_svc_stats.completed++;
+        /* Running average over about four requests, seeded by the first one. */
+        *p_est = (0 == *p_est) ? p_req->execUs : (*p_est - (*p_est / 4) + (p_req->execUs / 4));
+        if (p_req->execUs > optiga_svc_stats.maxExecUs[p_req->type]) {
+            optiga_svc_stats.maxExecUs[p_req->type] = p_req->execUs;
+        }
+    } else {
+        optiga_svc_stats.deadlineDrops++;
+    }
+    if (p_req->queueUs > optiga_svc_stats.maxQueueUs[p_req->type]) {
+        optiga_svc_stats.maxQueueUs[p_req->type] = p_req->queueUs;
+    }
+    taskEXIT_CRITICAL();
+
+    Cy_Optiga_OpCallback(&p_req->op, status);
+}
+
+/**
+ * \name Cy_Optiga_SvcTask
+ * \brief Worker draining the pending requests, the next request starts as soon as the previous one completed
+ * \param nothing
+ * \retval None
+ */
+static void Cy_Optiga_SvcTask(void *nothing)
+{
+    cy_stc_optiga_svc_req_t *p_req;
+
+    (void)nothing;
+    for (;;) {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (NULL != (p_req = Cy_Optiga_SvcTake())) {
+            /* Requests behind higher priority arrivals may no longer fit, do not spend the chip on them. */
+            if (Cy_Optiga_SvcMisses(p_req, optiga_svc_running_start_us, 0)) {
+                Cy_Optiga_SvcComplete(p_req, OPTIGA_APP_ERR_DEADLINE);
+            } else {
+                Cy_Optiga_SvcComplete(p_req, Cy_Optiga_SvcExecute(p_req));
+            }
+        }
+    }
+}
+
+bool Cy_Optiga_SvcInit(void)
+{
+    if (NULL == optiga_svc_task) {
+        if (pdPASS != xTaskCreate(Cy_Optiga_SvcTask, "fx_optiga_svc", OPTIGA_SVC_TASK_STACK, NULL,
+                                  OPTIGA_SVC_TASK_PRIORITY, &optiga_svc_task)) {
+            OPTIGA_LOG_ERROR("Service Task Could NOT be Created!");
+            optiga_svc_task = NULL;
+        }
+    }
+    return (NULL != optiga_svc_task);
+}
+
+void Cy_Optiga_SvcReqInit(cy_stc_optiga_svc_req_t *p_req, uint8_t priority, uint32_t deadline_ms)
+{
+    pal_os_memset(p_req, 0, sizeof(*p_req));
+    p_req->priority = priority;
+    p_req->deadlineMs = deadline_ms;
+}
+
+optiga_lib_status_t Cy_Optiga_SvcSubmit(cy_stc_optiga_svc_req_t *p_req)
+{
+    optiga_lib_status_t status = OPTIGA_LIB_BUSY;
+
+    if ((NULL == p_req) || (NULL == optiga_svc_task) || (p_req->type >= CY_OPTIGA_SVC_TYPE_COUNT)) {
+        return OPTIGA_CRYPT_ERROR;
+    }
+    if (Cy_Optiga_OpPending(&p_req->op)) {
+        return OPTIGA_APP_ERR_OP_PENDING;
+    }
+
+    /* Re-creating the semaphore drops a give left over from an earlier use of the request. */
+    Cy_Optiga_OpInit(&p_req->op);
+    Cy_Optiga_OpStart(&p_req->op);
+    /* Deadlines are compared as signed 32 bit us differences, keep them well inside that range. */
+    if (p_req->deadlineMs > OPTIGA_SVC_MAX_DEADLINE_MS) {
+        p_req->deadlineMs = OPTIGA_SVC_MAX_DEADLINE_MS;
+    }
+    p_req->deadlineUs = p_req->op.startUs + (p_req->deadlineMs * 1000u);
+
+    taskENTER_CRITICAL();
+    p_req->seq = optiga_svc_seq++;
+    if (OPTIGA_SVC_QUEUE_DEPTH <= optiga_svc_pending_count) {
+        status = OPTIGA_APP_ERR_QUEUE_FULL;
+    } else if (Cy_Optiga_SvcMisses(p_req, p_req->op.startUs, Cy_Optiga_SvcWaitEstimate(p_req, p_req->op.startUs))) {
+        optiga_svc_stats.deadlineRejects++;
+        status = OPTIGA_APP_ERR_DEADLINE;
+    } else {
+        optiga_svc_pending[optiga_svc_pending_count++] = p_req;
+    }
+    taskEXIT_CRITICAL();
+
+    if (OPTIGA_LIB_BUSY != status) {
+        p_req->op.status = status;
+    } else {
+        (void)xTaskNotifyGive(optiga_svc_task);
+    }
+    return status;
+}
+
+optiga_lib_status_t Cy_Optiga_SvcSubmitSign(cy_stc_optiga_svc_req_t *p_req, optiga_key_id_t key_id,
+                                            const uint8_t *digest, uint8_t digest_length,
+                                            uint8_t *signature, uint16_t *signature_length)
+{
+    /* The worker may still read the fields of a request whose wait timed out. */
+    if (Cy_Optiga_OpPending(&p_req->op)) {
+        return OPTIGA_APP_ERR_OP_PENDING;
+    }
+    p_req->type = CY_OPTIGA_SVC_SIGN;
+    p_req->keyId = key_id;
+    p_req->pIn = digest;
+    p_req->inLength = digest_length;
+    p_req->pOut = signature;
+    p_req->pOutLength = signature_length;
+    return Cy_Optiga_SvcSubmit(p_req);
+}
+
+optiga_lib_status_t Cy_Optiga_SvcSubmitVerify(cy_stc_optiga_svc_req_t *p_req, const uint8_t *digest,
+                                              uint8_t digest_length, const uint8_t *signature,
+                                              uint16_t signature_length, const public_key_from_host_t *public_key)
+{
+    if (Cy_Optiga_OpPending(&p_req->op)) {
+        return OPTIGA_APP_ERR_OP_PENDING;
+    }
+    p_req->type = CY_OPTIGA_SVC_VERIFY;
+    p_req->pIn = digest;
+    p_req->inLength = digest_length;
+    p_req->pSignature = signature;
+    p_req->signatureLength = signature_length;
+    p_req->pPublicKey = public_key;
+    return Cy_Optiga_SvcSubmit(p_req);
+}
+
+optiga_lib_status_t Cy_Optiga_SvcSubmitRandom(cy_stc_optiga_svc_req_t *p_req, uint8_t *random_data,
+                                              uint16_t random_data_length)
+{
+    if (Cy_Optiga_OpPending(&p_req->op)) {
+        return OPTIGA_APP_ERR_OP_PENDING;
+    }
+    p_req->type = CY_OPTIGA_SVC_RANDOM;
+    p_req->pOut = random_data;
+    p_req->outLength = random_data_length;
+    return Cy_Optiga_SvcSubmit(p_req);
+}
+
+optiga_lib_status_t Cy_Optiga_SvcSubmitHash(cy_stc_optiga_svc_req_t *p_req, const uint8_t *data,
+                                            uint32_t data_length, uint8_t *digest)
+{
+    if (Cy_Optiga_OpPending(&p_req->op)) {
+        return OPTIGA_APP_ERR_OP_PENDING;
+    }
+    p_req->type = CY_OPTIGA_SVC_HASH;
+    p_req->pIn = data;
+    p_req->inLength = data_length;
+    p_req->pOut = digest;
+    return Cy_Optiga_SvcSubmit(p_req);
+}
+
+bool Cy_Optiga_SvcPoll(const cy_stc_optiga_svc_req_t *p_req)
+{
+    return !Cy_Optiga_OpPending(&p_req->op);
+}
+
+optiga_lib_status_t Cy_Optiga_SvcWait(cy_stc_optiga_svc_req_t *p_req, uint32_t timeout_ms)
+{
+    return Cy_Optiga_OpWait(&p_req->op, OPTIGA_LIB_SUCCESS, timeout_ms);
+}
+
+void Cy_Optiga_SvcGetStats(cy_stc_optiga_svc_stats_t *p_stats)
+{
+    taskENTER_CRITICAL();
+    *p_stats = optiga_svc_stats;
+    taskEXIT_CRITICAL();
+}
+
+void Cy_Optiga_SvcClearStats(void)
+{
+    taskENTER_CRITICAL();
+    optiga_svc_stats.completed = 0;
+    optiga_svc_stats.deadlineRejects = 0;
+    optiga_svc_stats.deadlineDrops = 0;
+    pal_os_memset(optiga_svc_stats.maxQueueUs, 0, sizeof(optiga_svc_stats.maxQueueUs));
+    pal_os_memset(optiga_svc_stats.maxExecUs, 0, sizeof(optiga_svc_stats.maxExecUs));
+    taskEXIT_CRITICAL();
+}
+
+void Cy_Optiga_SvcDemo(void)
+{
+    static const char *names[CY_OPTIGA_SVC_TYPE_COUNT] = { "sign", "verify", "random", "hash" };
+    static uint8_t data[1024];
+    static uint8_t digest[32];
+    static uint8_t random_data[32];
+    static uint8_t signature[80];
+    static uint16_t signature_length;
+    static cy_stc_optiga_svc_req_t reqs[3];
+    cy_stc_optiga_svc_stats_t stats;
+    optiga_lib_status_t return_status;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(digest); i++) {
+        digest[i] = i;
+    }
+    pal_os_memset(data, 0xA5, sizeof(data));
+    signature_length = sizeof(signature);
+    Cy_Optiga_SvcClearStats();
+
+    /* Submitted lowest priority first, the worker still runs the sign ahead of the others. */
+    Cy_Optiga_SvcReqInit(&reqs[0], OPTIGA_SVC_PRIO_BACKGROUND, 0);
+    (void)Cy_Optiga_SvcSubmitHash(&reqs[0], data, sizeof(data), digest);
+    Cy_Optiga_SvcReqInit(&reqs[1], OPTIGA_SVC_PRIO_NORMAL, 0);
+    (void)Cy_Optiga_SvcSubmitRandom(&reqs[1], random_data, sizeof(random_data));
+    Cy_Optiga_SvcReqInit(&reqs[2], OPTIGA_SVC_PRIO_URGENT, OPTIGA_SVC_DEMO_DEADLINE_MS);
+    (void)Cy_Optiga_SvcSubmitSign(&reqs[2], OPTIGA_KEY_ID_E0F0, digest, sizeof(digest), signature,
+                                  &signature_length);
+
+    for (i = 0; i < sizeof(reqs) / sizeof(reqs[0]); i++) {
+        return_status = Cy_Optiga_SvcWait(&reqs[i], OPTIGA_APP_WAIT_TIMEOUT_MS);
+        OPTIGA_LOG_MESSAGE("Service %s, priority %d: queued %dus, ran %dus, Status - 0x%x", names[reqs[i].type],
+                           reqs[i].priority, reqs[i].queueUs, reqs[i].execUs, return_status);
+    }
+
+    Cy_Optiga_SvcGetStats(&stats);
+    OPTIGA_LOG_MESSAGE("Service: %d completed, %d deadline rejects, %d deadline drops", stats.completed,
+                       stats.deadlineRejects, stats.deadlineDrops);
+}
@@ -0,0 +1,243 @@
+/***************************************************************************//**
+* \file optiga_service.h
+*
+* \version 1.0
+*
+* \details  Queue based crypto service on top of the Optiga functions. Callers
+*           submit sign, verify, random and hash requests and wait on or poll
+*           them while a single worker task keeps the chip busy, running the
+*           pending requests by priority, then deadline.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _OPTIGA_SERVICE_H_
+#define _OPTIGA_SERVICE_H_
+
+#include "optiga_app.h"
+
+/* Requests waiting for the worker, a submit fails with OPTIGA_APP_ERR_QUEUE_FULL beyond this */
+#ifndef OPTIGA_SVC_QUEUE_DEPTH
+#define OPTIGA_SVC_QUEUE_DEPTH                      (8u)
+#endif
+
+#ifndef OPTIGA_SVC_TASK_PRIORITY
+#define OPTIGA_SVC_TASK_PRIORITY                    (12u)
+#endif
+
+#ifndef OPTIGA_SVC_TASK_STACK
+#define OPTIGA_SVC_TASK_STACK                       (1024u)
+#endif
+
+/* Longest request deadline, longer ones are cut to it. Deadlines are kept in 32 bit us. */
+#define OPTIGA_SVC_MAX_DEADLINE_MS                  (1000000u)
+
+/* Deadline of the sign submitted by Cy_Optiga_SvcDemo */
+#ifndef OPTIGA_SVC_DEMO_DEADLINE_MS
+#define OPTIGA_SVC_DEMO_DEADLINE_MS                 (500u)
+#endif
+
+/* Status of a submit which found the request queue full, outside the library codes */
+#define OPTIGA_APP_ERR_QUEUE_FULL                   (0x0F02)
+
+/* Status of a request whose deadline cannot be met, rejected at submit or dropped before running */
+#define OPTIGA_APP_ERR_DEADLINE                     (0x0F03)
+
+/* Request priorities, a pending request with a higher value runs first. A running request is never preempted. */
+#define OPTIGA_SVC_PRIO_BACKGROUND                  (0u)        /* RSA keygen/decrypt, P-521 and other long operations */
+#define OPTIGA_SVC_PRIO_NORMAL                      (2u)
+#define OPTIGA_SVC_PRIO_URGENT                      (4u)        /* Latency critical ECDSA signs */
+
+typedef enum
+{
+    CY_OPTIGA_SVC_SIGN = 0,
+    CY_OPTIGA_SVC_VERIFY,
+    CY_OPTIGA_SVC_RANDOM,
+    CY_OPTIGA_SVC_HASH,
+    CY_OPTIGA_SVC_TYPE_COUNT
+} cy_en_optiga_svc_type_t;
+
+/*
+ * A crypto request and its completion handle. Owned by the caller, the request and
+ * its buffers must stay valid until Cy_Optiga_SvcPoll reports it done, also after a
+ * Cy_Optiga_SvcWait which timed out. Prepared by Cy_Optiga_SvcReqInit before every
+ * submit, once it is done.
+ */
+typedef struct
+{
+    cy_en_optiga_svc_type_t type;
+    uint8_t priority;                               /* OPTIGA_SVC_PRIO_xxx */
+    uint32_t deadlineMs;                            /* Completion deadline after submit, 0 for none */
+    uint32_t deadlineUs;                            /* Absolute deadline, set by the submit */
+    uint32_t seq;                                   /* Submit order among equal priority and deadline */
+    optiga_key_id_t keyId;                          /* Sign only */
+    const uint8_t *pIn;                             /* Digest to sign or verify, data to hash */
+    uint32_t inLength;
+    const uint8_t *pSignature;                      /* Verify only */
+    uint16_t signatureLength;
+    const public_key_from_host_t *pPublicKey;       /* Verify only */
+    uint8_t *pOut;                                  /* Signature, random bytes or 32 byte digest */
+    uint16_t *pOutLength;                           /* Sign: in size of pOut, out signature length */
+    uint16_t outLength;                             /* Random: number of bytes */
+    cy_stc_optiga_op_t op;                          /* Completed by the worker, durationUs is queueUs + execUs */
+    uint32_t queueUs;                               /* Submit to start on the chip */
+    uint32_t execUs;                                /* Start on the chip to completion */
+} cy_stc_optiga_svc_req_t;
+
+/* Service counters, cleared by Cy_Optiga_SvcClearStats */
+typedef struct
+{
+    uint32_t completed;
+    uint32_t deadlineRejects;                       /* Refused at submit */
+    uint32_t deadlineDrops;                         /* Dropped from the queue before running */
+    uint32_t maxQueueUs[CY_OPTIGA_SVC_TYPE_COUNT];
+    uint32_t maxExecUs[CY_OPTIGA_SVC_TYPE_COUNT];
+    uint32_t estExecUs[CY_OPTIGA_SVC_TYPE_COUNT];   /* Running estimate used for the deadline checks */
+} cy_stc_optiga_svc_stats_t;
+
+/**
+ * \name Cy_Optiga_SvcInit
+ * \brief Create the request queue and the worker task. The chip must be opened by Cy_Optiga_Init.
+ * \retval true if the service runs
+ */
+bool Cy_Optiga_SvcInit(void);
+
+/**
+ * \name Cy_Optiga_SvcReqInit
+ * \brief Clear a request and set how it is scheduled, before filling it or calling a submit helper
+ * \param p_req
+ * \param priority OPTIGA_SVC_PRIO_xxx
+ * \param deadline_ms Completion deadline after submit, 0 for none, at most OPTIGA_SVC_MAX_DEADLINE_MS
+ * \retval None
+ */
+void Cy_Optiga_SvcReqInit(cy_stc_optiga_svc_req_t *p_req, uint8_t priority, uint32_t deadline_ms);
+
+/**
+ * \name Cy_Optiga_SvcSubmit
+ * \brief Queue a request filled by the caller, without waiting for it. A request with a deadline is
+ *        refused when the estimated run time of the requests ahead of it and its own does not fit.
+ * \param p_req
+ * \retval OPTIGA_LIB_BUSY if queued, OPTIGA_APP_ERR_QUEUE_FULL, OPTIGA_APP_ERR_DEADLINE,
+ *         OPTIGA_APP_ERR_OP_PENDING while the request is not done, or OPTIGA_CRYPT_ERROR otherwise
+ */
+optiga_lib_status_t Cy_Optiga_SvcSubmit(cy_stc_optiga_svc_req_t *p_req);
+
+/**
+ * \name Cy_Optiga_SvcSubmitSign
+ * \brief Queue an ECDSA sign of a digest
+ * \param p_req
+ * \param key_id
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length In: size of signature, out: length of the DER encoded signature
+ * \retval See Cy_Optiga_SvcSubmit
+ */
+optiga_lib_status_t Cy_Optiga_SvcSubmitSign(cy_stc_optiga_svc_req_t *p_req, optiga_key_id_t key_id,
+                                            const uint8_t *digest, uint8_t digest_length,
+                                            uint8_t *signature, uint16_t *signature_length);
+
+/**
+ * \name Cy_Optiga_SvcSubmitVerify
+ * \brief Queue an ECDSA verify with a host provided public key
+ * \param p_req
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param public_key
+ * \retval See Cy_Optiga_SvcSubmit
+ */
+optiga_lib_status_t Cy_Optiga_SvcSubmitVerify(cy_stc_optiga_svc_req_t *p_req, const uint8_t *digest,
+                                              uint8_t digest_length, const uint8_t *signature,
+                                              uint16_t signature_length, const public_key_from_host_t *public_key);
+
+/**
+ * \name Cy_Optiga_SvcSubmitRandom
+ * \brief Queue a read of random bytes
+ * \param p_req
+ * \param random_data
+ * \param random_data_length
+ * \retval See Cy_Optiga_SvcSubmit
+ */
+optiga_lib_status_t Cy_Optiga_SvcSubmitRandom(cy_stc_optiga_svc_req_t *p_req, uint8_t *random_data,
+                                              uint16_t random_data_length);
+
+/**
+ * \name Cy_Optiga_SvcSubmitHash
+ * \brief Queue a SHA-256 hash of a host buffer
+ * \param p_req
+ * \param data
+ * \param data_length
+ * \param digest 32 bytes
+ * \retval See Cy_Optiga_SvcSubmit
+ */
+optiga_lib_status_t Cy_Optiga_SvcSubmitHash(cy_stc_optiga_svc_req_t *p_req, const uint8_t *data,
+                                            uint32_t data_length, uint8_t *digest);
+
+/**
+ * \name Cy_Optiga_SvcPoll
+ * \brief Check whether a submitted request completed, without blocking
+ * \param p_req
+ * \retval true once the request completed, its status is then final. After a Cy_Optiga_SvcWait which
+ *         timed out, true once the worker let go of the request.
+ */
+bool Cy_Optiga_SvcPoll(const cy_stc_optiga_svc_req_t *p_req);
+
+/**
+ * \name Cy_Optiga_SvcWait
+ * \brief Block until a submitted request completes
+ * \param p_req
+ * \param timeout_ms
+ * \retval Final status of the request, OPTIGA_APP_ERR_TIMEOUT if it did not complete in time
+ */
+optiga_lib_status_t Cy_Optiga_SvcWait(cy_stc_optiga_svc_req_t *p_req, uint32_t timeout_ms);
+
+/**
+ * \name Cy_Optiga_SvcGetStats
+ * \brief Copy the service counters
+ * \param p_stats
+ * \retval None
+ */
+void Cy_Optiga_SvcGetStats(cy_stc_optiga_svc_stats_t *p_stats);
+
+/**
+ * \name Cy_Optiga_SvcClearStats
+ * \brief Clear the service counters, the run time estimates are kept
+ * \retval None
+ */
+void Cy_Optiga_SvcClearStats(void);
+
+/**
+ * \name Cy_Optiga_SvcDemo
+ * \brief Queue a background hash, a random and an urgent sign with a deadline at once, wait for them
+ *        and log when each ran. Call after Cy_Optiga_SvcInit.
+ * \retval None
+ */
+void Cy_Optiga_SvcDemo(void);
+
+#endif /* _OPTIGA_SERVICE_H_ */
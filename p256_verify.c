@@ -0,0 +1,1121 @@
+/***************************************************************************//**
+* \file p256_verify.c
+*
+* \version 1.0
+*
+* \details  This file provides ECDSA verification over NIST P-256 in software, with
+*           field arithmetic mod p, scalar arithmetic mod n and a comb based joint
+*           scalar multiplication.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include <string.h>
+#include "p256_verify.h"
+
+/*
+ * Field elements and scalars are 8 words of 32 bits, least significant first. The field
+ * multiply is a product scanning 8x8 word multiply, which GCC maps onto UMLAL on the CM4,
+ * followed by the NIST fast reduction of FIPS 186-4 D.2.3. Scalars mod n use Montgomery
+ * multiplication. Points are kept in Jacobian coordinates, a point with Z = 0 is infinity.
+ */
+#define P256_WORDS                  (8u)
+#define P256_COMB_COLUMNS           (64u)
+
+/* -n^-1 mod 2^32 */
+#define P256_N0_INV                 (0xEE00BC4FU)
+
+typedef struct
+{
+    uint32_t x[P256_WORDS];
+    uint32_t y[P256_WORDS];
+    uint32_t z[P256_WORDS];
+} cy_stc_p256_jacobian_t;
+
+static const uint32_t p256_p[P256_WORDS] =
+{
+    0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000001U, 0xFFFFFFFFU
+};
+
+static const uint32_t p256_n[P256_WORDS] =
+{
+    0xFC632551U, 0xF3B9CAC2U, 0xA7179E84U, 0xBCE6FAADU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x00000000U, 0xFFFFFFFFU
+};
+
+static const uint32_t p256_b[P256_WORDS] =
+{
+    0x27D2604BU, 0x3BCE3C3EU, 0xCC53B0F6U, 0x651D06B0U, 0x769886BCU, 0xB3EBBD55U, 0xAA3A93E7U, 0x5AC635D8U
+};
+
+/* 2^512 mod n, moves a scalar into the Montgomery domain */
+static const uint32_t p256_n_rr[P256_WORDS] =
+{
+    0xBE79EEA2U, 0x83244C95U, 0x49BD6FA6U, 0x4699799CU, 0x2B6BEC59U, 0x2845B239U, 0xF3D95620U, 0x66E12D94U
+};
+
+/*
+ * Comb table of the generator G: entry i - 1 holds the sum of 2^(64 j) G over the set bits j
+ * of i. Generated by tests/host/gen_p256_tables.py.
+ */
+static const cy_stc_p256_point_t p256_g_comb[P256_COMB_ENTRIES] =
+{
+    { { 0xD898C296U, 0xF4A13945U, 0x2DEB33A0U, 0x77037D81U, 0x63A440F2U, 0xF8BCE6E5U, 0xE12C4247U, 0x6B17D1F2U },
+      { 0x37BF51F5U, 0xCBB64068U, 0x6B315ECEU, 0x2BCE3357U, 0x7C0F9E16U, 0x8EE7EB4AU, 0xFE1A7F9BU, 0x4FE342E2U } },
+    { { 0x8E14DB63U, 0x90E75CB4U, 0xAD651F7EU, 0x29493BAAU, 0x326E25DEU, 0x8492592EU, 0x2811AAA5U, 0x0FA822BCU },
+      { 0x5F462EE7U, 0xE4112454U, 0x50FE82F5U, 0x34B1A650U, 0xB3DF188BU, 0x6F4AD4BCU, 0xF5DBA80DU, 0xBFF44AE8U } },
+    { { 0x097992AFU, 0x93391CE2U, 0x0D35F1FAU, 0xE96C98FDU, 0x95E02789U, 0xB257C0DEU, 0x89D6726FU, 0x300A4BBCU },
+      { 0xC08127A0U, 0xAA54A291U, 0xA9D806A5U, 0x5BB1EEADU, 0xFF1E3C6FU, 0x7F1DDB25U, 0xD09B4644U, 0x72AAC7E0U } },
+    { { 0xD789BD85U, 0x57C84FC9U, 0xC297EAC3U, 0xFC35FF7DU, 0x88C6766EU, 0xFB982FD5U, 0xEEDB5E67U, 0x447D739BU },
+      { 0x72E25B32U, 0x0C7E33C9U, 0xA7FAE500U, 0x3D349B95U, 0x3A4AAFF7U, 0xE12E9D95U, 0x834131EEU, 0x2D4825ABU } },
+    { { 0x2A1D367FU, 0x13949C93U, 0x1A0A11B7U, 0xEF7FBD2BU, 0xB91DFC60U, 0xDDC6068BU, 0x8A9C72FFU, 0xEF951932U },
+      { 0x7376D8A8U, 0x196035A7U, 0x95CA1740U, 0x23183B08U, 0x022C219CU, 0xC1EE9807U, 0x7DBB2C9BU, 0x611E9FC3U } },
+    { { 0x0B57F4BCU, 0xCAE2B192U, 0xC6C9BC36U, 0x2936DF5EU, 0xE11238BFU, 0x7DEA6482U, 0x7B51F5D8U, 0x55066379U },
+      { 0x348A964CU, 0x44FFE216U, 0xDBDEFBE1U, 0x9FB3D576U, 0x8D9D50E5U, 0x0AFA4001U, 0x8AECB851U, 0x15716484U } },
+    { { 0xFC5CDE01U, 0xE48ECAFFU, 0x0D715F26U, 0x7CCD84E7U, 0xF43E4391U, 0xA2E8F483U, 0xB21141EAU, 0xEB5D7745U },
+      { 0x731A3479U, 0xCAC917E2U, 0x2844B645U, 0x85F22CFEU, 0x58006CEEU, 0x0990E6A1U, 0xDBECC17BU, 0xEAFD72EBU } },
+    { { 0x313728BEU, 0x6CF20FFBU, 0xA3C6B94AU, 0x96439591U, 0x44315FC5U, 0x2736FF83U, 0xA7849276U, 0xA6D39677U },
+      { 0xC357F5F4U, 0xF2BAB833U, 0x2284059BU, 0x824A920CU, 0x2D27ECDFU, 0x66B8BABDU, 0x9B0B8816U, 0x674F8474U } },
+    { { 0x677C8A3EU, 0x2DF48C04U, 0x0203A56BU, 0x74E02F08U, 0xB8C7FEDBU, 0x31855F7DU, 0x72C9DDADU, 0x4E769E76U },
+      { 0xB824BBB0U, 0xA4C36165U, 0x3B9122A5U, 0xFB9AE16FU, 0x06947281U, 0x1EC00572U, 0xDE830663U, 0x42B99082U } },
+    { { 0xDDA868B9U, 0x6EF95150U, 0x9C0CE131U, 0xD1F89E79U, 0x08A1C478U, 0x7FDC1CA0U, 0x1C6CE04DU, 0x78878EF6U },
+      { 0x1FE0D976U, 0x9C62B912U, 0xBDE08D4FU, 0x6ACE570EU, 0x12309DEFU, 0xDE53142CU, 0x7B72C321U, 0xB6CB3F5DU } },
+    { { 0xC31A3573U, 0x7F991ED2U, 0xD54FB496U, 0x5B82DD5BU, 0x812FFCAEU, 0x595C5220U, 0x716B1287U, 0x0C88BC4DU },
+      { 0x5F48ACA8U, 0x3A57BF63U, 0xDF2564F3U, 0x7C8181F4U, 0x9C04E6AAU, 0x18D1B5B3U, 0xF3901DC6U, 0xDD5DDEA3U } },
+    { { 0x3E72AD0CU, 0xE96A79FBU, 0x42BA792FU, 0x43A0A28CU, 0x083E49F3U, 0xEFE0A423U, 0x6B317466U, 0x68F344AFU },
+      { 0x3FB24D4AU, 0xCDFE17DBU, 0x71F5C626U, 0x668BFC22U, 0x24D67FF3U, 0x604ED93CU, 0xF8540A20U, 0x31B9C405U } },
+    { { 0xA2582E7FU, 0xD36B4789U, 0x4EC39C28U, 0x0D1A1014U, 0xEDBAD7A0U, 0x663C62C3U, 0x6F461DB9U, 0x4052BF4BU },
+      { 0x188D25EBU, 0x235A27C3U, 0x99BFCC5BU, 0xE724F339U, 0x71D70CC8U, 0x862BE6BDU, 0x90B0FC61U, 0xFECF4D51U } },
+    { { 0xA1D4CFACU, 0x74346C10U, 0x8526A7A4U, 0xAFDF5CC0U, 0xF62BFF7AU, 0x123202A8U, 0xC802E41AU, 0x1EDDBAE2U },
+      { 0xD603F844U, 0x8FA0AF2DU, 0x4C701917U, 0x36E06B7EU, 0x73DB33A0U, 0x0C45F452U, 0x560EBCFCU, 0x43104D86U } },
+    { { 0x0D1D78E5U, 0x9615B511U, 0x25C4744BU, 0x66B0DE32U, 0x6AAF363AU, 0x0A4A46FBU, 0x84F7A21CU, 0xB48E26B4U },
+      { 0x21A01B2DU, 0x06EBB0F6U, 0x8B7B0F98U, 0xC004E404U, 0xFED6F668U, 0x64131BCDU, 0x4D4D3DABU, 0xFAC01540U } },
+};
+
+/**
+ * \name Cy_P256_IsZero
+ * \brief Check a field element or scalar for zero
+ * \param a
+ * \retval true if a is zero
+ */
+static bool Cy_P256_IsZero(const uint32_t *a)
+{
+    uint32_t acc = 0;
+    uint8_t i;
+
+    for (i = 0; i < P256_WORDS; i++) {
+        acc |= a[i];
+    }
+    return (0u == acc);
+}
+
+/**
+ * \name Cy_P256_Cmp
+ * \brief Compare two 256 bit values
+ * \param a
+ * \param b
+ * \retval -1, 0 or 1 as a is below, equal to or above b
+ */
+static int8_t Cy_P256_Cmp(const uint32_t *a, const uint32_t *b)
+{
+    int8_t i;
+
+    for (i = (int8_t)(P256_WORDS - 1u); i >= 0; i--) {
+        if (a[i] != b[i]) {
+            return (a[i] > b[i]) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \name Cy_P256_Add
+ * \brief r = a + b over 256 bits, r may alias a or b
+ * \param r
+ * \param a
+ * \param b
+ * \retval Carry out
+ */
+static uint32_t Cy_P256_Add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    uint64_t acc = 0;
+    uint8_t i;
+
+    for (i = 0; i < P256_WORDS; i++) {
+        acc += (uint64_t)a[i] + b[i];
+        r[i] = (uint32_t)acc;
+        acc >>= 32;
+    }
+    return (uint32_t)acc;
+}
+
+/**
+ * \name Cy_P256_Sub
+ * \brief r = a - b over 256 bits, r may alias a or b
+ * \param r
+ * \param a
+ * \param b
+ * \retval Borrow out
+ */
+static uint32_t Cy_P256_Sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    int64_t acc = 0;
+    uint8_t i;
+
+    for (i = 0; i < P256_WORDS; i++) {
+        acc += (int64_t)a[i] - b[i];
+        r[i] = (uint32_t)acc;
+        acc >>= 32;
+    }
+    return (uint32_t)(acc & 1);
+}
+
+/**
+ * \name Cy_P256_FromBytes
+ * \brief Load a 32 byte big endian value
+ * \param r
+ * \param bytes
+ * \retval None
+ */
+static void Cy_P256_FromBytes(uint32_t *r, const uint8_t *bytes)
+{
+    uint8_t i;
+
+    for (i = 0; i < P256_WORDS; i++) {
+        const uint8_t *w = &bytes[(P256_WORDS - 1u - i) * 4u];
+        r[i] = ((uint32_t)w[0] << 24) | ((uint32_t)w[1] << 16) | ((uint32_t)w[2] << 8) | w[3];
+    }
+}
+
+/**
+ * \name Cy_P256_MulWide
+ * \brief c = a * b as a 512 bit product, column by column
+ * \param c 16 words
+ * \param a
+ * \param b
+ * \retval None
+ */
+static void Cy_P256_MulWide(uint32_t *c, const uint32_t *a, const uint32_t *b)
+{
+    uint64_t acc = 0;
+    uint32_t hi = 0;
+    uint8_t k, i;
+
+    for (k = 0; k < (2u * P256_WORDS - 1u); k++) {
+        uint8_t lo = (k < P256_WORDS) ? 0u : (uint8_t)(k - P256_WORDS + 1u);
+        uint8_t top = (k < P256_WORDS) ? k : (uint8_t)(P256_WORDS - 1u);
+
+        for (i = lo; i <= top; i++) {
+            uint64_t m = (uint64_t)a[i] * b[k - i];
+            acc += m;
+            hi += (acc < m) ? 1u : 0u;
+        }
+        c[k] = (uint32_t)acc;
+        acc = (acc >> 32) | ((uint64_t)hi << 32);
+        hi = 0;
+    }
+    c[2u * P256_WORDS - 1u] = (uint32_t)acc;
+}
+
+/**
+ * \name Cy_P256_SqrWide
+ * \brief c = a * a as a 512 bit product, each cross product computed once
+ * \param c 16 words
+ * \param a
+ * \retval None
+ */
+static void Cy_P256_SqrWide(uint32_t *c, const uint32_t *a)
+{
+    uint64_t acc = 0;
+    uint32_t hi = 0;
+    uint8_t k, i;
+
+    for (k = 0; k < (2u * P256_WORDS - 1u); k++) {
+        uint8_t lo = (k < P256_WORDS) ? 0u : (uint8_t)(k - P256_WORDS + 1u);
+
+        for (i = lo; (2u * i) < k; i++) {
+            uint64_t m = (uint64_t)a[i] * a[k - i];
+            acc += m;
+            hi += (acc < m) ? 1u : 0u;
+            acc += m;
+            hi += (acc < m) ? 1u : 0u;
+        }
+        if (0u == (k & 1u)) {
+            uint64_t m = (uint64_t)a[k / 2u] * a[k / 2u];
+            acc += m;
+            hi += (acc < m) ? 1u : 0u;
+        }
+        c[k] = (uint32_t)acc;
+        acc = (acc >> 32) | ((uint64_t)hi << 32);
+        hi = 0;
+    }
+    c[2u * P256_WORDS - 1u] = (uint32_t)acc;
+}
+
+/**
+ * \name Cy_P256_FeReduce
+ * \brief r = c mod p for a 512 bit c, with the NIST P-256 fast reduction
+ * \param r
+ * \param c 16 words
+ * \retval None
+ */
+static void Cy_P256_FeReduce(uint32_t *r, const uint32_t *c)
+{
+    int64_t t[P256_WORDS];
+    int64_t acc = 0;
+    uint8_t i;
+
+    /* s1 + 2 s2 + 2 s3 + s4 + s5 - s6 - s7 - s8 - s9, summed per word */
+    t[0] = (int64_t)c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14];
+    t[1] = (int64_t)c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15];
+    t[2] = (int64_t)c[2] + c[10] + c[11] - c[13] - c[14] - c[15];
+    t[3] = (int64_t)c[3] + 2 * (int64_t)c[11] + 2 * (int64_t)c[12] + c[13] - c[15] - c[8] - c[9];
+    t[4] = (int64_t)c[4] + 2 * (int64_t)c[12] + 2 * (int64_t)c[13] + c[14] - c[9] - c[10];
+    t[5] = (int64_t)c[5] + 2 * (int64_t)c[13] + 2 * (int64_t)c[14] + c[15] - c[10] - c[11];
+    t[6] = (int64_t)c[6] + 3 * (int64_t)c[14] + 2 * (int64_t)c[15] + c[13] - c[8] - c[9];
+    t[7] = (int64_t)c[7] + 3 * (int64_t)c[15] + c[8] - c[10] - c[11] - c[12] - c[13];
+
+    for (i = 0; i < P256_WORDS; i++) {
+        acc += t[i];
+        r[i] = (uint32_t)acc;
+        acc >>= 32;
+    }
+
+    /* Fold the small signed carry back in with 2^256 = 2^224 - 2^192 - 2^96 + 1 mod p */
+    while (0 != acc) {
+        int64_t carry = acc;
+
+        acc = 0;
+        for (i = 0; i < P256_WORDS; i++) {
+            acc += r[i];
+            if ((0u == i) || (7u == i)) {
+                acc += carry;
+            } else if ((3u == i) || (6u == i)) {
+                acc -= carry;
+            }
+            r[i] = (uint32_t)acc;
+            acc >>= 32;
+        }
+    }
+
+    if (Cy_P256_Cmp(r, p256_p) >= 0) {
+        (void)Cy_P256_Sub(r, r, p256_p);
+    }
+}
+
+/**
+ * \name Cy_P256_FeAdd
+ * \brief r = a + b mod p
+ * \param r
+ * \param a
+ * \param b
+ * \retval None
+ */
+static void Cy_P256_FeAdd(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    if ((0u != Cy_P256_Add(r, a, b)) || (Cy_P256_Cmp(r, p256_p) >= 0)) {
+        (void)Cy_P256_Sub(r, r, p256_p);
+    }
+}
+
+/**
+ * \name Cy_P256_FeSub
+ * \brief r = a - b mod p
+ * \param r
+ * \param a
+ * \param b
+ * \retval None
+ */
+static void Cy_P256_FeSub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    if (0u != Cy_P256_Sub(r, a, b)) {
+        (void)Cy_P256_Add(r, r, p256_p);
+    }
+}
+
+/**
+ * \name Cy_P256_FeMul
+ * \brief r = a * b mod p, r may alias a or b
+ * \param r
+ * \param a
+ * \param b
+ * \retval None
+ */
+static void Cy_P256_FeMul(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    uint32_t c[2u * P256_WORDS];
+
+    Cy_P256_MulWide(c, a, b);
+    Cy_P256_FeReduce(r, c);
+}
+
+/**
+ * \name Cy_P256_FeSqr
+ * \brief r = a * a mod p, r may alias a
+ * \param r
+ * \param a
+ * \retval None
+ */
+static void Cy_P256_FeSqr(uint32_t *r, const uint32_t *a)
+{
+    uint32_t c[2u * P256_WORDS];
+
+    Cy_P256_SqrWide(c, a);
+    Cy_P256_FeReduce(r, c);
+}
+
+/**
+ * \name Cy_P256_FeInv
+ * \brief r = a^-1 mod p as a^(p - 2), for a non zero a
+ * \param r
+ * \param a
+ * \retval None
+ */
+static void Cy_P256_FeInv(uint32_t *r, const uint32_t *a)
+{
+    static const uint32_t exp[P256_WORDS] =
+    {
+        0xFFFFFFFDU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000001U, 0xFFFFFFFFU
+    };
+    uint32_t base[P256_WORDS];
+    uint32_t acc[P256_WORDS] = { 1u };
+    int16_t bit;
+
+    memcpy(base, a, sizeof(base));
+    for (bit = 255; bit >= 0; bit--) {
+        Cy_P256_FeSqr(acc, acc);
+        if (0u != ((exp[bit >> 5] >> (bit & 31)) & 1u)) {
+            Cy_P256_FeMul(acc, acc, base);
+        }
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+/**
+ * \name Cy_P256_ScMontMul
+ * \brief r = a * b / 2^256 mod n, for a and b below n, by word-wise Montgomery reduction
+ * \param r
+ * \param a
+ * \param b
+ * \retval None
+ */
+static void Cy_P256_ScMontMul(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+    uint32_t t[P256_WORDS + 2u] = { 0 };
+    uint64_t acc;
+    uint32_t m;
+    uint8_t i, j;
+
+    for (i = 0; i < P256_WORDS; i++) {
+        acc = 0;
+        for (j = 0; j < P256_WORDS; j++) {
+            acc += (uint64_t)a[j] * b[i] + t[j];
+            t[j] = (uint32_t)acc;
+            acc >>= 32;
+        }
+        acc += t[P256_WORDS];
+        t[P256_WORDS] = (uint32_t)acc;
+        t[P256_WORDS + 1u] = (uint32_t)(acc >> 32);
+
+        m = t[0] * P256_N0_INV;
+        acc = ((uint64_t)m * p256_n[0] + t[0]) >> 32;
+        for (j = 1; j < P256_WORDS; j++) {
+            acc += (uint64_t)m * p256_n[j] + t[j];
+            t[j - 1u] = (uint32_t)acc;
+            acc >>= 32;
+        }
+        acc += t[P256_WORDS];
+        t[P256_WORDS - 1u] = (uint32_t)acc;
+        t[P256_WORDS] = t[P256_WORDS + 1u] + (uint32_t)(acc >> 32);
+    }
+
+    if ((0u != t[P256_WORDS]) || (Cy_P256_Cmp(t, p256_n) >= 0)) {
+        (void)Cy_P256_Sub(t, t, p256_n);
+    }
+    memcpy(r, t, P256_WORDS * sizeof(uint32_t));
+}
+
+/**
+ * \name Cy_P256_ScInvMont
+ * \brief r = a^-1 * 2^256 mod n as a^(n - 2), the inverse in the Montgomery domain
+ * \param r
+ * \param a Non zero, below n
+ * \retval None
+ */
+static void Cy_P256_ScInvMont(uint32_t *r, const uint32_t *a)
+{
+    static const uint32_t exp[P256_WORDS] =
+    {
+        0xFC63254FU, 0xF3B9CAC2U, 0xA7179E84U, 0xBCE6FAADU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0x00000000U, 0xFFFFFFFFU
+    };
+    /* 2^256 mod n, one in the Montgomery domain */
+    static const uint32_t one[P256_WORDS] =
+    {
+        0x039CDAAFU, 0x0C46353DU, 0x58E8617BU, 0x43190552U, 0x00000000U, 0x00000000U, 0xFFFFFFFFU, 0x00000000U
+    };
+    uint32_t base[P256_WORDS];
+    uint32_t acc[P256_WORDS];
+    int16_t bit;
+
+    Cy_P256_ScMontMul(base, a, p256_n_rr);
+    memcpy(acc, one, sizeof(acc));
+    for (bit = 255; bit >= 0; bit--) {
+        Cy_P256_ScMontMul(acc, acc, acc);
+        if (0u != ((exp[bit >> 5] >> (bit & 31)) & 1u)) {
+            Cy_P256_ScMontMul(acc, acc, base);
+        }
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+/**
+ * \name Cy_P256_PointDouble
+ * \brief r = 2 a in Jacobian coordinates with a = -3, r may alias a
+ * \param r
+ * \param a
+ * \retval None
+ */
+static void Cy_P256_PointDouble(cy_stc_p256_jacobian_t *r, const cy_stc_p256_jacobian_t *a)
+{
+    uint32_t delta[P256_WORDS], gamma[P256_WORDS], beta[P256_WORDS], alpha[P256_WORDS];
+    uint32_t t[P256_WORDS], u[P256_WORDS];
+
+    Cy_P256_FeSqr(delta, a->z);
+    Cy_P256_FeSqr(gamma, a->y);
+    Cy_P256_FeMul(beta, a->x, gamma);
+
+    /* alpha = 3 (X - delta)(X + delta) */
+    Cy_P256_FeSub(t, a->x, delta);
+    Cy_P256_FeAdd(u, a->x, delta);
+    Cy_P256_FeMul(alpha, t, u);
+    Cy_P256_FeAdd(t, alpha, alpha);
+    Cy_P256_FeAdd(alpha, t, alpha);
+
+    /* Z3 = (Y + Z)^2 - gamma - delta, the last use of the input */
+    Cy_P256_FeAdd(t, a->y, a->z);
+    Cy_P256_FeSqr(t, t);
+    Cy_P256_FeSub(t, t, gamma);
+    Cy_P256_FeSub(r->z, t, delta);
+
+    /* X3 = alpha^2 - 8 beta */
+    Cy_P256_FeAdd(beta, beta, beta);
+    Cy_P256_FeAdd(beta, beta, beta);
+    Cy_P256_FeSqr(t, alpha);
+    Cy_P256_FeSub(t, t, beta);
+    Cy_P256_FeSub(r->x, t, beta);
+
+    /* Y3 = alpha (4 beta - X3) - 8 gamma^2 */
+    Cy_P256_FeSub(t, beta, r->x);
+    Cy_P256_FeMul(t, alpha, t);
+    Cy_P256_FeSqr(gamma, gamma);
+    Cy_P256_FeAdd(gamma, gamma, gamma);
+    Cy_P256_FeAdd(gamma, gamma, gamma);
+    Cy_P256_FeAdd(gamma, gamma, gamma);
+    Cy_P256_FeSub(r->y, t, gamma);
+}
+
+/**
+ * \name Cy_P256_PointAddMixed
+ * \brief r = a + b for a Jacobian a and an affine b, r may alias a
+ * \param r
+ * \param a
+ * \param b
+ * \retval None
+ */
+static void Cy_P256_PointAddMixed(cy_stc_p256_jacobian_t *r, const cy_stc_p256_jacobian_t *a,
+                                  const cy_stc_p256_point_t *b)
+{
+    uint32_t z1z1[P256_WORDS], h[P256_WORDS], rr[P256_WORDS], hh[P256_WORDS];
+    uint32_t i4[P256_WORDS], j[P256_WORDS], v[P256_WORDS], t[P256_WORDS];
+    cy_stc_p256_jacobian_t out;
+
+    if (Cy_P256_IsZero(a->z)) {
+        memcpy(r->x, b->x, sizeof(r->x));
+        memcpy(r->y, b->y, sizeof(r->y));
+        memset(r->z, 0, sizeof(r->z));
+        r->z[0] = 1u;
+        return;
+    }
+
+    Cy_P256_FeSqr(z1z1, a->z);
+    Cy_P256_FeMul(h, b->x, z1z1);
+    Cy_P256_FeSub(h, h, a->x);
+    Cy_P256_FeMul(rr, a->z, z1z1);
+    Cy_P256_FeMul(rr, rr, b->y);
+    Cy_P256_FeSub(rr, rr, a->y);
+
+    if (Cy_P256_IsZero(h)) {
+        if (Cy_P256_IsZero(rr)) {
+            Cy_P256_PointDouble(r, a);
+        } else {
+            memset(r->z, 0, sizeof(r->z));
+        }
+        return;
+    }
+
+    Cy_P256_FeAdd(rr, rr, rr);
+    Cy_P256_FeSqr(hh, h);
+    Cy_P256_FeAdd(i4, hh, hh);
+    Cy_P256_FeAdd(i4, i4, i4);
+    Cy_P256_FeMul(j, h, i4);
+    Cy_P256_FeMul(v, a->x, i4);
+
+    /* X3 = rr^2 - J - 2 V */
+    Cy_P256_FeSqr(t, rr);
+    Cy_P256_FeSub(t, t, j);
+    Cy_P256_FeSub(t, t, v);
+    Cy_P256_FeSub(out.x, t, v);
+
+    /* Y3 = rr (V - X3) - 2 Y1 J */
+    Cy_P256_FeSub(t, v, out.x);
+    Cy_P256_FeMul(t, rr, t);
+    Cy_P256_FeMul(j, a->y, j);
+    Cy_P256_FeAdd(j, j, j);
+    Cy_P256_FeSub(out.y, t, j);
+
+    /* Z3 = (Z1 + H)^2 - Z1Z1 - HH */
+    Cy_P256_FeAdd(t, a->z, h);
+    Cy_P256_FeSqr(t, t);
+    Cy_P256_FeSub(t, t, z1z1);
+    Cy_P256_FeSub(out.z, t, hh);
+
+    *r = out;
+}
+
+/**
+ * \name Cy_P256_PointAdd
+ * \brief r = a + b for Jacobian a and b, r may alias either
+ * \param r
+ * \param a
+ * \param b
+ * \retval None
+ */
+static void Cy_P256_PointAdd(cy_stc_p256_jacobian_t *r, const cy_stc_p256_jacobian_t *a,
+                             const cy_stc_p256_jacobian_t *b)
+{
+    uint32_t z1z1[P256_WORDS], z2z2[P256_WORDS], u1[P256_WORDS], s1[P256_WORDS];
+    uint32_t h[P256_WORDS], rr[P256_WORDS], i4[P256_WORDS], j[P256_WORDS], t[P256_WORDS];
+    cy_stc_p256_jacobian_t out;
+
+    if (Cy_P256_IsZero(a->z)) {
+        *r = *b;
+        return;
+    }
+    if (Cy_P256_IsZero(b->z)) {
+        *r = *a;
+        return;
+    }
+
+    Cy_P256_FeSqr(z1z1, a->z);
+    Cy_P256_FeSqr(z2z2, b->z);
+    Cy_P256_FeMul(u1, a->x, z2z2);
+    Cy_P256_FeMul(h, b->x, z1z1);
+    Cy_P256_FeSub(h, h, u1);
+    Cy_P256_FeMul(s1, b->z, z2z2);
+    Cy_P256_FeMul(s1, s1, a->y);
+    Cy_P256_FeMul(rr, a->z, z1z1);
+    Cy_P256_FeMul(rr, rr, b->y);
+    Cy_P256_FeSub(rr, rr, s1);
+
+    if (Cy_P256_IsZero(h)) {
+        if (Cy_P256_IsZero(rr)) {
+            Cy_P256_PointDouble(r, a);
+        } else {
+            memset(r->z, 0, sizeof(r->z));
+        }
+        return;
+    }
+
+    Cy_P256_FeAdd(rr, rr, rr);
+    Cy_P256_FeAdd(i4, h, h);
+    Cy_P256_FeSqr(i4, i4);
+    Cy_P256_FeMul(j, h, i4);
+    Cy_P256_FeMul(u1, u1, i4);              /* V */
+
+    /* X3 = rr^2 - J - 2 V */
+    Cy_P256_FeSqr(t, rr);
+    Cy_P256_FeSub(t, t, j);
+    Cy_P256_FeSub(t, t, u1);
+    Cy_P256_FeSub(out.x, t, u1);
+
+    /* Y3 = rr (V - X3) - 2 S1 J */
+    Cy_P256_FeSub(t, u1, out.x);
+    Cy_P256_FeMul(t, rr, t);
+    Cy_P256_FeMul(j, s1, j);
+    Cy_P256_FeAdd(j, j, j);
+    Cy_P256_FeSub(out.y, t, j);
+
+    /* Z3 = ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) H */
+    Cy_P256_FeAdd(t, a->z, b->z);
+    Cy_P256_FeSqr(t, t);
+    Cy_P256_FeSub(t, t, z1z1);
+    Cy_P256_FeSub(t, t, z2z2);
+    Cy_P256_FeMul(out.z, t, h);
+
+    *r = out;
+}
+
+/**
+ * \name Cy_P256_CombBuild
+ * \brief Build the comb table of an affine point, normalizing all entries with one inversion
+ * \param comb P256_COMB_ENTRIES entries
+ * \param p
+ * \retval None
+ */
+static void Cy_P256_CombBuild(cy_stc_p256_point_t *comb, const cy_stc_p256_point_t *p)
+{
+    cy_stc_p256_jacobian_t teeth[4];
+    cy_stc_p256_jacobian_t acc;
+    uint32_t z[P256_COMB_ENTRIES][P256_WORDS];
+    uint32_t prefix[P256_COMB_ENTRIES][P256_WORDS];
+    uint32_t inv[P256_WORDS], zinv[P256_WORDS], t[P256_WORDS];
+    uint8_t i, k;
+
+    /* Teeth 2^(64 k) P */
+    memcpy(teeth[0].x, p->x, sizeof(teeth[0].x));
+    memcpy(teeth[0].y, p->y, sizeof(teeth[0].y));
+    memset(teeth[0].z, 0, sizeof(teeth[0].z));
+    teeth[0].z[0] = 1u;
+    for (k = 1; k < 4u; k++) {
+        teeth[k] = teeth[k - 1u];
+        for (i = 0; i < P256_COMB_COLUMNS; i++) {
+            Cy_P256_PointDouble(&teeth[k], &teeth[k]);
+        }
+    }
+
+    /* Entry i + 1 is entry i + 1 - low bit plus the tooth of the low bit, Jacobian X and Y parked in comb */
+    for (i = 0; i < P256_COMB_ENTRIES; i++) {
+        uint8_t idx = (uint8_t)(i + 1u);
+        uint8_t low = (uint8_t)(idx & (uint8_t)(0u - idx));
+
+        for (k = 0; (1u << k) != low; k++) {
+        }
+        if (idx == low) {
+            acc = teeth[k];
+        } else {
+            uint8_t rest = (uint8_t)(idx - low - 1u);
+
+            memcpy(acc.x, comb[rest].x, sizeof(acc.x));
+            memcpy(acc.y, comb[rest].y, sizeof(acc.y));
+            memcpy(acc.z, z[rest], sizeof(acc.z));
+            Cy_P256_PointAdd(&acc, &acc, &teeth[k]);
+        }
+        memcpy(comb[i].x, acc.x, sizeof(acc.x));
+        memcpy(comb[i].y, acc.y, sizeof(acc.y));
+        memcpy(z[i], acc.z, sizeof(acc.z));
+    }
+
+    /* Invert all Z at once: prefix products, one inversion, then walk back */
+    memcpy(prefix[0], z[0], sizeof(prefix[0]));
+    for (i = 1; i < P256_COMB_ENTRIES; i++) {
+        Cy_P256_FeMul(prefix[i], prefix[i - 1u], z[i]);
+    }
+    Cy_P256_FeInv(inv, prefix[P256_COMB_ENTRIES - 1u]);
+    for (i = P256_COMB_ENTRIES; i-- > 0u;) {
+        if (i > 0u) {
+            Cy_P256_FeMul(zinv, inv, prefix[i - 1u]);
+            Cy_P256_FeMul(inv, inv, z[i]);
+        } else {
+            memcpy(zinv, inv, sizeof(zinv));
+        }
+        Cy_P256_FeSqr(t, zinv);
+        Cy_P256_FeMul(comb[i].x, comb[i].x, t);
+        Cy_P256_FeMul(t, t, zinv);
+        Cy_P256_FeMul(comb[i].y, comb[i].y, t);
+    }
+}
+
+/**
+ * \name Cy_P256_CombIndex
+ * \brief Table index of a comb column: bits col, col + 64, col + 128 and col + 192 of k
+ * \param k
+ * \param col
+ * \retval Index, 0 when no tooth is set
+ */
+static uint8_t Cy_P256_CombIndex(const uint32_t *k, uint8_t col)
+{
+    uint8_t idx = 0;
+    uint8_t tooth;
+
+    for (tooth = 0; tooth < 4u; tooth++) {
+        uint16_t bit = (uint16_t)(col + tooth * P256_COMB_COLUMNS);
+        idx |= (uint8_t)(((k[bit >> 5] >> (bit & 31u)) & 1u) << tooth);
+    }
+    return idx;
+}
+
+/**
+ * \name Cy_P256_JointComb
+ * \brief r = u1 G + u2 Q, walking both combs together so the 64 doublings are shared
+ * \param r
+ * \param u1
+ * \param u2
+ * \param q_comb
+ * \retval None
+ */
+static void Cy_P256_JointComb(cy_stc_p256_jacobian_t *r, const uint32_t *u1, const uint32_t *u2,
+                              const cy_stc_p256_point_t *q_comb)
+{
+    int8_t col;
+    uint8_t idx;
+
+    memset(r, 0, sizeof(*r));
+    for (col = (int8_t)(P256_COMB_COLUMNS - 1u); col >= 0; col--) {
+        Cy_P256_PointDouble(r, r);
+        idx = Cy_P256_CombIndex(u1, (uint8_t)col);
+        if (0u != idx) {
+            Cy_P256_PointAddMixed(r, r, &p256_g_comb[idx - 1u]);
+        }
+        idx = Cy_P256_CombIndex(u2, (uint8_t)col);
+        if (0u != idx) {
+            Cy_P256_PointAddMixed(r, r, &q_comb[idx - 1u]);
+        }
+    }
+}
+
+/**
+ * \name Cy_P256_DerInteger
+ * \brief Parse one DER INTEGER of at most 32 significant bytes
+ * \param pp In: start of the INTEGER, out: byte after it
+ * \param end
+ * \param v
+ * \retval true if parsed
+ */
+static bool Cy_P256_DerInteger(const uint8_t **pp, const uint8_t *end, uint32_t *v)
+{
+    const uint8_t *p = *pp;
+    uint8_t bytes[32] = { 0 };
+    uint8_t len;
+
+    if (((end - p) < 2) || (0x02u != p[0])) {
+        return false;
+    }
+    len = p[1];
+    p += 2;
+    if ((0u == len) || (len > (end - p)) || (0u != (p[0] & 0x80u))) {
+        return false;
+    }
+    while ((len > 1u) && (0u == p[0])) {
+        p++;
+        len--;
+    }
+    if (len > sizeof(bytes)) {
+        return false;
+    }
+    memcpy(&bytes[sizeof(bytes) - len], p, len);
+    Cy_P256_FromBytes(v, bytes);
+    *pp = p + len;
+    return true;
+}
+
+/**
+ * \name Cy_P256_DecodeSignature
+ * \brief Split a DER encoded signature into R and S
+ * \param signature
+ * \param signature_length
+ * \param r
+ * \param s
+ * \retval true if well formed
+ */
+static bool Cy_P256_DecodeSignature(const uint8_t *signature, uint16_t signature_length, uint32_t *r, uint32_t *s)
+{
+    const uint8_t *p = signature;
+    const uint8_t *end = signature + signature_length;
+
+    /* optiga_crypt_ecdsa_sign leaves out the SEQUENCE header, accept it for host signatures */
+    if ((signature_length >= 2u) && (0x30u == p[0])) {
+        if (p[1] != (signature_length - 2u)) {
+            return false;
+        }
+        p += 2;
+    }
+    return (Cy_P256_DerInteger(&p, end, r) && Cy_P256_DerInteger(&p, end, s) && (p == end));
+}
+
+/**
+ * \name Cy_P256_KeyInit
+ * \brief Decode a public key, check it lies on the curve and build its comb table
+ * \param p_key
+ * \param public_key Raw, 0x04 prefixed or DER bit string encoded uncompressed point
+ * \param public_key_length P256_PUBKEY_xxx_LENGTH
+ * \retval CY_P256_SUCCESS or CY_P256_BAD_PARAM
+ */
+cy_en_p256_status_t Cy_P256_KeyInit(cy_stc_p256_key_t *p_key, const uint8_t *public_key,
+                                    uint16_t public_key_length)
+{
+    static const uint8_t bitstring_header[] = { 0x03, 0x42, 0x00, 0x04 };
+    uint32_t lhs[P256_WORDS], rhs[P256_WORDS], t[P256_WORDS];
+
+    if ((NULL == p_key) || (NULL == public_key)) {
+        return CY_P256_BAD_PARAM;
+    }
+    if (P256_PUBKEY_BITSTRING_LENGTH == public_key_length) {
+        if (0 != memcmp(public_key, bitstring_header, sizeof(bitstring_header))) {
+            return CY_P256_BAD_PARAM;
+        }
+        public_key += sizeof(bitstring_header);
+    } else if (P256_PUBKEY_POINT_LENGTH == public_key_length) {
+        if (0x04u != public_key[0]) {
+            return CY_P256_BAD_PARAM;
+        }
+        public_key++;
+    } else if (P256_PUBKEY_RAW_LENGTH != public_key_length) {
+        return CY_P256_BAD_PARAM;
+    }
+
+    Cy_P256_FromBytes(p_key->q.x, public_key);
+    Cy_P256_FromBytes(p_key->q.y, public_key + 32);
+    if ((Cy_P256_Cmp(p_key->q.x, p256_p) >= 0) || (Cy_P256_Cmp(p_key->q.y, p256_p) >= 0)) {
+        return CY_P256_BAD_PARAM;
+    }
+
+    /* y^2 = x^3 - 3 x + b */
+    Cy_P256_FeSqr(lhs, p_key->q.y);
+    Cy_P256_FeSqr(rhs, p_key->q.x);
+    Cy_P256_FeMul(rhs, rhs, p_key->q.x);
+    Cy_P256_FeAdd(t, p_key->q.x, p_key->q.x);
+    Cy_P256_FeAdd(t, t, p_key->q.x);
+    Cy_P256_FeSub(rhs, rhs, t);
+    Cy_P256_FeAdd(rhs, rhs, p256_b);
+    if (0 != Cy_P256_Cmp(lhs, rhs)) {
+        return CY_P256_BAD_PARAM;
+    }
+
+    Cy_P256_CombBuild(p_key->comb, &p_key->q);
+    return CY_P256_SUCCESS;
+}
+
+/**
+ * \name Cy_P256_Prepare
+ * \brief Decode and range check a signature and reduce the digest, the steps before the inversion of s
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param r
+ * \param s
+ * \param e
+ * \retval CY_P256_SUCCESS to go on, CY_P256_INVALID_SIGNATURE or CY_P256_BAD_PARAM
+ */
+static cy_en_p256_status_t Cy_P256_Prepare(const uint8_t *digest, uint16_t digest_length, const uint8_t *signature,
+                                           uint16_t signature_length, uint32_t *r, uint32_t *s, uint32_t *e)
+{
+    uint8_t bytes[32] = { 0 };
+
+    if ((NULL == digest) || (NULL == signature) ||
+        (!Cy_P256_DecodeSignature(signature, signature_length, r, s))) {
+        return CY_P256_BAD_PARAM;
+    }
+    if ((Cy_P256_IsZero(r)) || (Cy_P256_IsZero(s)) ||
+        (Cy_P256_Cmp(r, p256_n) >= 0) || (Cy_P256_Cmp(s, p256_n) >= 0)) {
+        return CY_P256_INVALID_SIGNATURE;
+    }
+
+    /* e is the leftmost 256 bits of the digest, below 2n so one subtraction reduces it */
+    if (digest_length >= sizeof(bytes)) {
+        memcpy(bytes, digest, sizeof(bytes));
+    } else {
+        memcpy(&bytes[sizeof(bytes) - digest_length], digest, digest_length);
+    }
+    Cy_P256_FromBytes(e, bytes);
+    if (Cy_P256_Cmp(e, p256_n) >= 0) {
+        (void)Cy_P256_Sub(e, e, p256_n);
+    }
+    return CY_P256_SUCCESS;
+}
+
+/**
+ * \name Cy_P256_Finish
+ * \brief Check x(u1 G + u2 Q) mod n == r, with u1 = e / s and u2 = r / s
+ * \param p_key
+ * \param e
+ * \param r Overwritten
+ * \param w 1 / s in the Montgomery domain
+ * \retval CY_P256_SUCCESS or CY_P256_INVALID_SIGNATURE
+ */
+static cy_en_p256_status_t Cy_P256_Finish(const cy_stc_p256_key_t *p_key, const uint32_t *e, uint32_t *r,
+                                          const uint32_t *w)
+{
+    uint32_t u1[P256_WORDS], u2[P256_WORDS], zz[P256_WORDS], t[P256_WORDS];
+    cy_stc_p256_jacobian_t sum;
+
+    /* The Montgomery factor of w cancels in the products */
+    Cy_P256_ScMontMul(u1, e, w);
+    Cy_P256_ScMontMul(u2, r, w);
+
+    Cy_P256_JointComb(&sum, u1, u2, p_key->comb);
+    if (Cy_P256_IsZero(sum.z)) {
+        return CY_P256_INVALID_SIGNATURE;
+    }
+
+    /* x mod n == r without leaving Jacobian coordinates: X == r Z^2, or (r + n) Z^2 when r + n < p */
+    Cy_P256_FeSqr(zz, sum.z);
+    Cy_P256_FeMul(t, r, zz);
+    if (0 == Cy_P256_Cmp(t, sum.x)) {
+        return CY_P256_SUCCESS;
+    }
+    if ((0u == Cy_P256_Add(r, r, p256_n)) && (Cy_P256_Cmp(r, p256_p) < 0)) {
+        Cy_P256_FeMul(t, r, zz);
+        if (0 == Cy_P256_Cmp(t, sum.x)) {
+            return CY_P256_SUCCESS;
+        }
+    }
+    return CY_P256_INVALID_SIGNATURE;
+}
+
+/**
+ * \name Cy_P256_VerifyKey
+ * \brief ECDSA verify a digest with a key prepared by Cy_P256_KeyInit
+ * \param p_key
+ * \param digest Leftmost 32 bytes are used
+ * \param digest_length
+ * \param signature DER encoded R and S, with or without the SEQUENCE header
+ * \param signature_length
+ * \retval CY_P256_SUCCESS, CY_P256_INVALID_SIGNATURE or CY_P256_BAD_PARAM
+ */
+cy_en_p256_status_t Cy_P256_VerifyKey(const cy_stc_p256_key_t *p_key, const uint8_t *digest,
+                                      uint16_t digest_length, const uint8_t *signature,
+                                      uint16_t signature_length)
+{
+    uint32_t r[P256_WORDS], s[P256_WORDS], e[P256_WORDS], w[P256_WORDS];
+    cy_en_p256_status_t status;
+
+    if (NULL == p_key) {
+        return CY_P256_BAD_PARAM;
+    }
+    status = Cy_P256_Prepare(digest, digest_length, signature, signature_length, r, s, e);
+    if (CY_P256_SUCCESS != status) {
+        return status;
+    }
+    Cy_P256_ScInvMont(w, s);
+    return Cy_P256_Finish(p_key, e, r, w);
+}
+
+/**
+ * \name Cy_P256_VerifyBatch
+ * \brief ECDSA verify a batch of digests against a set of keys prepared by Cy_P256_KeyInit, with one
+ *        inversion of s per P256_BATCH_CHUNK items. Each item gets its own result.
+ * \param keys
+ * \param num_keys
+ * \param items
+ * \param num_items
+ * \retval Number of items whose signature verified
+ */
+uint16_t Cy_P256_VerifyBatch(const cy_stc_p256_key_t *keys, uint8_t num_keys, cy_stc_p256_batch_item_t *items,
+                             uint16_t num_items)
+{
+    uint32_t r[P256_BATCH_CHUNK][P256_WORDS], e[P256_BATCH_CHUNK][P256_WORDS];
+    uint32_t s[P256_BATCH_CHUNK][P256_WORDS], prefix[P256_BATCH_CHUNK][P256_WORDS];
+    uint32_t inv[P256_WORDS], w[P256_WORDS];
+    uint8_t slot[P256_BATCH_CHUNK];
+    uint16_t verified = 0;
+    uint32_t base, end, i;
+    uint8_t count, k;
+
+    if ((NULL == items) || ((NULL == keys) && (0u != num_keys))) {
+        return 0;
+    }
+
+    /* 32 bit indices, a 16 bit base stepped past 65535 would wrap and never reach num_items */
+    for (base = 0; base < num_items; base += P256_BATCH_CHUNK) {
+        end = ((num_items - base) > P256_BATCH_CHUNK) ? (base + P256_BATCH_CHUNK) : num_items;
+
+        /* Decode the chunk, chaining the s of the well formed items in the Montgomery domain */
+        count = 0;
+        for (i = base; i < end; i++) {
+            cy_stc_p256_batch_item_t *p_item = &items[i];
+
+            p_item->result = CY_P256_BAD_PARAM;
+            if (p_item->keyIndex < num_keys) {
+                p_item->result = Cy_P256_Prepare(p_item->digest, p_item->digestLength, p_item->signature,
+                                                 p_item->signatureLength, r[count], s[count], e[count]);
+            }
+            if (CY_P256_SUCCESS == p_item->result) {
+                Cy_P256_ScMontMul(s[count], s[count], p256_n_rr);
+                if (0u == count) {
+                    memcpy(prefix[0], s[0], sizeof(prefix[0]));
+                } else {
+                    Cy_P256_ScMontMul(prefix[count], prefix[count - 1u], s[count]);
+                }
+                slot[count] = (uint8_t)(i - base);
+                count++;
+            }
+        }
+        if (0u == count) {
+            continue;
+        }
+
+        /*
+         * Montgomery's trick: invert the product of all s once, then peel the items off from the
+         * back. ScInvMont of a Montgomery value gives the plain inverse, ScMontMul by 2^512 moves
+         * it back into the domain.
+         */
+        Cy_P256_ScInvMont(inv, prefix[count - 1u]);
+        Cy_P256_ScMontMul(inv, inv, p256_n_rr);
+        for (k = count; k-- > 0u;) {
+            cy_stc_p256_batch_item_t *p_item = &items[base + slot[k]];
+
+            if (k > 0u) {
+                Cy_P256_ScMontMul(w, inv, prefix[k - 1u]);
+                Cy_P256_ScMontMul(inv, inv, s[k]);
+            } else {
+                memcpy(w, inv, sizeof(w));
+            }
+            p_item->result = Cy_P256_Finish(&keys[p_item->keyIndex], e[k], r[k], w);
+            if (CY_P256_SUCCESS == p_item->result) {
+                verified++;
+            }
+        }
+    }
+    return verified;
+}
+
+/**
+ * \name Cy_P256_Verify
+ * \brief ECDSA verify a digest with an encoded public key. The key is decoded on the stack,
+ *        about 1.5 KB of it is used.
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param public_key
+ * \param public_key_length
+ * \retval CY_P256_SUCCESS, CY_P256_INVALID_SIGNATURE or CY_P256_BAD_PARAM
+ */
+cy_en_p256_status_t Cy_P256_Verify(const uint8_t *digest, uint16_t digest_length, const uint8_t *signature,
+                                   uint16_t signature_length, const uint8_t *public_key,
+                                   uint16_t public_key_length)
+{
+    cy_stc_p256_key_t key;
+    cy_en_p256_status_t status = Cy_P256_KeyInit(&key, public_key, public_key_length);
+
+    if (CY_P256_SUCCESS == status) {
+        status = Cy_P256_VerifyKey(&key, digest, digest_length, signature, signature_length);
+    }
+    return status;
+}
+
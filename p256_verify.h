@@ -0,0 +1,149 @@
+/***************************************************************************//**
+* \file p256_verify.h
+*
+* \version 1.0
+*
+* \details  Software ECDSA verification over NIST P-256 for the CM4, as an
+*           alternative to the verify on the OPTIGA chip. Verifies only public data,
+*           the code is not constant time.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _P256_VERIFY_H_
+#define _P256_VERIFY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Entries of a fixed-base comb table: 4 teeth, 64 bits apart */
+#define P256_COMB_ENTRIES                           (15u)
+
+/* Items of a Cy_P256_VerifyBatch call sharing one inversion, each costs 128 bytes of stack */
+#ifndef P256_BATCH_CHUNK
+#define P256_BATCH_CHUNK                            (8u)
+#endif
+
+/* Public key lengths accepted by Cy_P256_KeyInit */
+#define P256_PUBKEY_RAW_LENGTH                      (64u)       /* X || Y */
+#define P256_PUBKEY_POINT_LENGTH                    (65u)       /* 0x04 || X || Y */
+#define P256_PUBKEY_BITSTRING_LENGTH                (68u)       /* As returned by optiga_crypt_ecc_generate_keypair */
+
+typedef enum
+{
+    CY_P256_SUCCESS = 0,
+    CY_P256_INVALID_SIGNATURE,                      /* Well formed, but does not verify */
+    CY_P256_BAD_PARAM                               /* Malformed key or signature encoding, key not on the curve */
+} cy_en_p256_status_t;
+
+/* Affine point, coordinates as 32 bit words, least significant first */
+typedef struct
+{
+    uint32_t x[8];
+    uint32_t y[8];
+} cy_stc_p256_point_t;
+
+/*
+ * A decoded public key with its comb table. Building the table costs about as much as
+ * one verify, a key kept across verifies makes every further verify cheaper.
+ */
+typedef struct
+{
+    cy_stc_p256_point_t q;
+    cy_stc_p256_point_t comb[P256_COMB_ENTRIES];
+} cy_stc_p256_key_t;
+
+/* One signature of a batch, checked against keys[keyIndex] of the Cy_P256_VerifyBatch call */
+typedef struct
+{
+    const uint8_t *digest;
+    uint16_t digestLength;
+    const uint8_t *signature;
+    uint16_t signatureLength;
+    uint8_t keyIndex;
+    cy_en_p256_status_t result;                     /* Set by Cy_P256_VerifyBatch */
+} cy_stc_p256_batch_item_t;
+
+/**
+ * \name Cy_P256_KeyInit
+ * \brief Decode a public key, check it lies on the curve and build its comb table
+ * \param p_key
+ * \param public_key Raw, 0x04 prefixed or DER bit string encoded uncompressed point
+ * \param public_key_length P256_PUBKEY_xxx_LENGTH
+ * \retval CY_P256_SUCCESS or CY_P256_BAD_PARAM
+ */
+cy_en_p256_status_t Cy_P256_KeyInit(cy_stc_p256_key_t *p_key, const uint8_t *public_key,
+                                    uint16_t public_key_length);
+
+/**
+ * \name Cy_P256_VerifyKey
+ * \brief ECDSA verify a digest with a key prepared by Cy_P256_KeyInit
+ * \param p_key
+ * \param digest Leftmost 32 bytes are used
+ * \param digest_length
+ * \param signature DER encoded R and S, with or without the SEQUENCE header
+ * \param signature_length
+ * \retval CY_P256_SUCCESS, CY_P256_INVALID_SIGNATURE or CY_P256_BAD_PARAM
+ */
+cy_en_p256_status_t Cy_P256_VerifyKey(const cy_stc_p256_key_t *p_key, const uint8_t *digest,
+                                      uint16_t digest_length, const uint8_t *signature,
+                                      uint16_t signature_length);
+
+/**
+ * \name Cy_P256_Verify
+ * \brief ECDSA verify a digest with an encoded public key. The key is decoded on the stack,
+ *        about 1.5 KB of it is used.
+ * \param digest
+ * \param digest_length
+ * \param signature
+ * \param signature_length
+ * \param public_key
+ * \param public_key_length
+ * \retval CY_P256_SUCCESS, CY_P256_INVALID_SIGNATURE or CY_P256_BAD_PARAM
+ */
+cy_en_p256_status_t Cy_P256_Verify(const uint8_t *digest, uint16_t digest_length, const uint8_t *signature,
+                                   uint16_t signature_length, const uint8_t *public_key,
+                                   uint16_t public_key_length);
+
+/**
+ * \name Cy_P256_VerifyBatch
+ * \brief ECDSA verify a batch of digests against a set of keys prepared by Cy_P256_KeyInit, with one
+ *        inversion of s per P256_BATCH_CHUNK items. Each item gets its own result.
+ *
+ *        The signatures carry only the x coordinate of R, so a random linear combination of the
+ *        verification equations cannot be checked soundly without the sign of each R: every item
+ *        still runs its own joint comb, against the kept comb table of its key.
+ * \param keys
+ * \param num_keys
+ * \param items
+ * \param num_items
+ * \retval Number of items whose signature verified
+ */
+uint16_t Cy_P256_VerifyBatch(const cy_stc_p256_key_t *keys, uint8_t num_keys, cy_stc_p256_batch_item_t *items,
+                             uint16_t num_items);
+
+#endif /* _P256_VERIFY_H_ */
@@ -0,0 +1,355 @@
+/***************************************************************************//**
+* \file sha2.c
+*
+* \version 1.0
+*
+* \details  This file provides the SHA-256 and SHA-384 compression functions and the
+*           streaming init/update/final API on top of them.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+/* Includes */
+#include <string.h>
+#include "sha2.h"
+
+static const uint32_t sha256_k[64] =
+{
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+    0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+    0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+    0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+    0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+    0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+    0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+    0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U
+};
+
+static const uint32_t sha256_h0[8] =
+{
+    0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU,
+    0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U
+};
+
+static const uint64_t sha512_k[80] =
+{
+    0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL, 0xE9B5DBA58189DBBCULL,
+    0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL, 0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL,
+    0xD807AA98A3030242ULL, 0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+    0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL, 0xC19BF174CF692694ULL,
+    0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL, 0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL,
+    0x2DE92C6F592B0275ULL, 0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+    0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL, 0xBF597FC7BEEF0EE4ULL,
+    0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL, 0x06CA6351E003826FULL, 0x142929670A0E6E70ULL,
+    0x27B70A8546D22FFCULL, 0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+    0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL, 0x92722C851482353BULL,
+    0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL, 0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL,
+    0xD192E819D6EF5218ULL, 0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+    0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL, 0x34B0BCB5E19B48A8ULL,
+    0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL, 0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL,
+    0x748F82EE5DEFB2FCULL, 0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+    0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL, 0xC67178F2E372532BULL,
+    0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL, 0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL,
+    0x06F067AA72176FBAULL, 0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+    0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL, 0x431D67C49C100D4CULL,
+    0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL, 0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL
+};
+
+static const uint64_t sha384_h0[8] =
+{
+    0xCBBB9D5DC1059ED8ULL, 0x629A292A367CD507ULL, 0x9159015A3070DD17ULL, 0x152FECD8F70E5939ULL,
+    0x67332667FFC00B31ULL, 0x8EB44A8768581511ULL, 0xDB0C2E0D64F98FA7ULL, 0x47B5481DBEFA4FA4ULL
+};
+
+#define SHA_ROTR32(x, n)            (((x) >> (n)) | ((x) << (32u - (n))))
+#define SHA_ROTR64(x, n)            (((x) >> (n)) | ((x) << (64u - (n))))
+#define SHA_CH(x, y, z)             ((z) ^ ((x) & ((y) ^ (z))))
+#define SHA_MAJ(x, y, z)            (((x) & (y)) | ((z) & ((x) | (y))))
+
+#define SHA256_S0(x)                (SHA_ROTR32((x), 2u) ^ SHA_ROTR32((x), 13u) ^ SHA_ROTR32((x), 22u))
+#define SHA256_S1(x)                (SHA_ROTR32((x), 6u) ^ SHA_ROTR32((x), 11u) ^ SHA_ROTR32((x), 25u))
+#define SHA256_G0(x)                (SHA_ROTR32((x), 7u) ^ SHA_ROTR32((x), 18u) ^ ((x) >> 3))
+#define SHA256_G1(x)                (SHA_ROTR32((x), 17u) ^ SHA_ROTR32((x), 19u) ^ ((x) >> 10))
+
+#define SHA512_S0(x)                (SHA_ROTR64((x), 28u) ^ SHA_ROTR64((x), 34u) ^ SHA_ROTR64((x), 39u))
+#define SHA512_S1(x)                (SHA_ROTR64((x), 14u) ^ SHA_ROTR64((x), 18u) ^ SHA_ROTR64((x), 41u))
+#define SHA512_G0(x)                (SHA_ROTR64((x), 1u) ^ SHA_ROTR64((x), 8u) ^ ((x) >> 7))
+#define SHA512_G1(x)                (SHA_ROTR64((x), 19u) ^ SHA_ROTR64((x), 61u) ^ ((x) >> 6))
+
+/*
+ * One round. The message schedule lives in 16 words reused in place, w[i & 15] is extended for
+ * rounds 16 onwards. The eight working variables rotate through the macro arguments instead of
+ * being shifted, eight rounds per loop pass.
+ */
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i) \
+    do { \
+        uint32_t t1; \
+        if ((i) >= 16u) { \
+            w[(i) & 15u] += SHA256_G1(w[((i) - 2u) & 15u]) + w[((i) - 7u) & 15u] + SHA256_G0(w[((i) - 15u) & 15u]); \
+        } \
+        t1 = (h) + SHA256_S1(e) + SHA_CH((e), (f), (g)) + sha256_k[i] + w[(i) & 15u]; \
+        (d) += t1; \
+        (h) = t1 + SHA256_S0(a) + SHA_MAJ((a), (b), (c)); \
+    } while (0)
+
+#define SHA512_ROUND(a, b, c, d, e, f, g, h, i) \
+    do { \
+        uint64_t t1; \
+        if ((i) >= 16u) { \
+            w[(i) & 15u] += SHA512_G1(w[((i) - 2u) & 15u]) + w[((i) - 7u) & 15u] + SHA512_G0(w[((i) - 15u) & 15u]); \
+        } \
+        t1 = (h) + SHA512_S1(e) + SHA_CH((e), (f), (g)) + sha512_k[i] + w[(i) & 15u]; \
+        (d) += t1; \
+        (h) = t1 + SHA512_S0(a) + SHA_MAJ((a), (b), (c)); \
+    } while (0)
+
+/**
+ * \name Cy_Sha2_Load32
+ * \brief Big endian word load. A single load and byte reverse (LDR, REV on the CM4) where the compiler
+ *        knows the byte order, bytes otherwise.
+ * \param p Any alignment
+ * \retval Word
+ */
+static inline uint32_t Cy_Sha2_Load32(const uint8_t *p)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    uint32_t w;
+
+    memcpy(&w, p, sizeof(w));
+    return __builtin_bswap32(w);
+#else
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+#endif
+}
+
+/**
+ * \name Cy_Sha2_Store64
+ * \brief Big endian store of a 64 bit value
+ * \param p
+ * \param v
+ * \retval None
+ */
+static void Cy_Sha2_Store64(uint8_t *p, uint64_t v)
+{
+    uint8_t i;
+
+    for (i = 0; i < 8u; i++) {
+        p[i] = (uint8_t)(v >> (56u - (8u * i)));
+    }
+}
+
+/**
+ * \name Cy_Sha256_Compress
+ * \brief Run the compression function over whole blocks
+ * \param state
+ * \param data
+ * \param blocks
+ * \retval None
+ */
+static void Cy_Sha256_Compress(uint32_t *state, const uint8_t *data, uint32_t blocks)
+{
+    uint32_t w[16];
+    uint32_t a, b, c, d, e, f, g, h;
+    uint32_t i;
+
+    while (blocks-- > 0u) {
+        for (i = 0; i < 16u; i++) {
+            w[i] = Cy_Sha2_Load32(&data[4u * i]);
+        }
+        a = state[0]; b = state[1]; c = state[2]; d = state[3];
+        e = state[4]; f = state[5]; g = state[6]; h = state[7];
+
+        for (i = 0; i < 64u; i += 8u) {
+            SHA256_ROUND(a, b, c, d, e, f, g, h, i);
+            SHA256_ROUND(h, a, b, c, d, e, f, g, i + 1u);
+            SHA256_ROUND(g, h, a, b, c, d, e, f, i + 2u);
+            SHA256_ROUND(f, g, h, a, b, c, d, e, i + 3u);
+            SHA256_ROUND(e, f, g, h, a, b, c, d, i + 4u);
+            SHA256_ROUND(d, e, f, g, h, a, b, c, i + 5u);
+            SHA256_ROUND(c, d, e, f, g, h, a, b, i + 6u);
+            SHA256_ROUND(b, c, d, e, f, g, h, a, i + 7u);
+        }
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+        data += SHA256_BLOCK_LENGTH;
+    }
+}
+
+/**
+ * \name Cy_Sha512_Compress
+ * \brief Run the SHA-512 compression function, shared by SHA-384, over whole blocks
+ * \param state
+ * \param data
+ * \param blocks
+ * \retval None
+ */
+static void Cy_Sha512_Compress(uint64_t *state, const uint8_t *data, uint32_t blocks)
+{
+    uint64_t w[16];
+    uint64_t a, b, c, d, e, f, g, h;
+    uint32_t i;
+
+    while (blocks-- > 0u) {
+        for (i = 0; i < 16u; i++) {
+            w[i] = ((uint64_t)Cy_Sha2_Load32(&data[8u * i]) << 32) | Cy_Sha2_Load32(&data[(8u * i) + 4u]);
+        }
+        a = state[0]; b = state[1]; c = state[2]; d = state[3];
+        e = state[4]; f = state[5]; g = state[6]; h = state[7];
+
+        for (i = 0; i < 80u; i += 8u) {
+            SHA512_ROUND(a, b, c, d, e, f, g, h, i);
+            SHA512_ROUND(h, a, b, c, d, e, f, g, i + 1u);
+            SHA512_ROUND(g, h, a, b, c, d, e, f, i + 2u);
+            SHA512_ROUND(f, g, h, a, b, c, d, e, i + 3u);
+            SHA512_ROUND(e, f, g, h, a, b, c, d, i + 4u);
+            SHA512_ROUND(d, e, f, g, h, a, b, c, i + 5u);
+            SHA512_ROUND(c, d, e, f, g, h, a, b, i + 6u);
+            SHA512_ROUND(b, c, d, e, f, g, h, a, i + 7u);
+        }
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+        data += SHA384_BLOCK_LENGTH;
+    }
+}
+
+void Cy_Sha256_Init(cy_stc_sha256_t *p_ctx)
+{
+    memcpy(p_ctx->state, sha256_h0, sizeof(p_ctx->state));
+    p_ctx->length = 0;
+}
+
+void Cy_Sha256_Update(cy_stc_sha256_t *p_ctx, const uint8_t *data, uint32_t length)
+{
+    uint32_t used = (uint32_t)(p_ctx->length % SHA256_BLOCK_LENGTH);
+    uint32_t n;
+
+    p_ctx->length += length;
+
+    /* Complete a buffered block first */
+    if (used > 0u) {
+        n = SHA256_BLOCK_LENGTH - used;
+        if (length < n) {
+            memcpy(&p_ctx->block[used], data, length);
+            return;
+        }
+        memcpy(&p_ctx->block[used], data, n);
+        Cy_Sha256_Compress(p_ctx->state, p_ctx->block, 1u);
+        data += n;
+        length -= n;
+    }
+
+    /* Whole blocks straight from the caller's buffer, no copy */
+    n = length / SHA256_BLOCK_LENGTH;
+    if (n > 0u) {
+        Cy_Sha256_Compress(p_ctx->state, data, n);
+        data += n * SHA256_BLOCK_LENGTH;
+        length -= n * SHA256_BLOCK_LENGTH;
+    }
+    memcpy(p_ctx->block, data, length);
+}
+
+void Cy_Sha256_Final(cy_stc_sha256_t *p_ctx, uint8_t *digest)
+{
+    uint32_t used = (uint32_t)(p_ctx->length % SHA256_BLOCK_LENGTH);
+    uint8_t i;
+
+    p_ctx->block[used++] = 0x80u;
+    if (used > (SHA256_BLOCK_LENGTH - 8u)) {
+        memset(&p_ctx->block[used], 0, SHA256_BLOCK_LENGTH - used);
+        Cy_Sha256_Compress(p_ctx->state, p_ctx->block, 1u);
+        used = 0;
+    }
+    memset(&p_ctx->block[used], 0, (SHA256_BLOCK_LENGTH - 8u) - used);
+    Cy_Sha2_Store64(&p_ctx->block[SHA256_BLOCK_LENGTH - 8u], p_ctx->length << 3);
+    Cy_Sha256_Compress(p_ctx->state, p_ctx->block, 1u);
+
+    for (i = 0; i < 8u; i++) {
+        digest[4u * i] = (uint8_t)(p_ctx->state[i] >> 24);
+        digest[(4u * i) + 1u] = (uint8_t)(p_ctx->state[i] >> 16);
+        digest[(4u * i) + 2u] = (uint8_t)(p_ctx->state[i] >> 8);
+        digest[(4u * i) + 3u] = (uint8_t)p_ctx->state[i];
+    }
+    memset(p_ctx, 0, sizeof(*p_ctx));
+}
+
+void Cy_Sha384_Init(cy_stc_sha384_t *p_ctx)
+{
+    memcpy(p_ctx->state, sha384_h0, sizeof(p_ctx->state));
+    p_ctx->length = 0;
+}
+
+void Cy_Sha384_Update(cy_stc_sha384_t *p_ctx, const uint8_t *data, uint32_t length)
+{
+    uint32_t used = (uint32_t)(p_ctx->length % SHA384_BLOCK_LENGTH);
+    uint32_t n;
+
+    p_ctx->length += length;
+
+    if (used > 0u) {
+        n = SHA384_BLOCK_LENGTH - used;
+        if (length < n) {
+            memcpy(&p_ctx->block[used], data, length);
+            return;
+        }
+        memcpy(&p_ctx->block[used], data, n);
+        Cy_Sha512_Compress(p_ctx->state, p_ctx->block, 1u);
+        data += n;
+        length -= n;
+    }
+
+    n = length / SHA384_BLOCK_LENGTH;
+    if (n > 0u) {
+        Cy_Sha512_Compress(p_ctx->state, data, n);
+        data += n * SHA384_BLOCK_LENGTH;
+        length -= n * SHA384_BLOCK_LENGTH;
+    }
+    memcpy(p_ctx->block, data, length);
+}
+
+void Cy_Sha384_Final(cy_stc_sha384_t *p_ctx, uint8_t *digest)
+{
+    uint32_t used = (uint32_t)(p_ctx->length % SHA384_BLOCK_LENGTH);
+    uint8_t i;
+
+    /* The length field is 128 bits, messages here stay below 2^61 bytes so its upper half is zero */
+    p_ctx->block[used++] = 0x80u;
+    if (used > (SHA384_BLOCK_LENGTH - 16u)) {
+        memset(&p_ctx->block[used], 0, SHA384_BLOCK_LENGTH - used);
+        Cy_Sha512_Compress(p_ctx->state, p_ctx->block, 1u);
+        used = 0;
+    }
+    memset(&p_ctx->block[used], 0, (SHA384_BLOCK_LENGTH - 8u) - used);
+    Cy_Sha2_Store64(&p_ctx->block[SHA384_BLOCK_LENGTH - 8u], p_ctx->length << 3);
+    Cy_Sha512_Compress(p_ctx->state, p_ctx->block, 1u);
+
+    for (i = 0; i < (SHA384_DIGEST_LENGTH / 8u); i++) {
+        Cy_Sha2_Store64(&digest[8u * i], p_ctx->state[i]);
+    }
+    memset(p_ctx, 0, sizeof(*p_ctx));
+}
@@ -0,0 +1,114 @@
+/***************************************************************************//**
+* \file sha2.h
+*
+* \version 1.0
+*
+* \details  Streaming SHA-256 and SHA-384 in software, with unrolled rounds and word
+*           loads, for payloads too large to send to the OPTIGA chip over I2C.
+*
+* See \ref README.md ["README"]
+*
+*******************************************************************************
+* \copyright
+* The MIT License
+*
+* Copyright (c) 2021 Infineon Technologies AG
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE
+*******************************************************************************/
+
+#ifndef _SHA2_H_
+#define _SHA2_H_
+
+#include <stdint.h>
+
+#define SHA256_DIGEST_LENGTH                        (32u)
+#define SHA384_DIGEST_LENGTH                        (48u)
+#define SHA256_BLOCK_LENGTH                         (64u)
+#define SHA384_BLOCK_LENGTH                         (128u)
+
+typedef struct
+{
+    uint32_t state[8];
+    uint64_t length;                                /* Bytes hashed so far */
+    uint8_t block[SHA256_BLOCK_LENGTH];             /* Bytes of an incomplete block */
+} cy_stc_sha256_t;
+
+typedef struct
+{
+    uint64_t state[8];
+    uint64_t length;
+    uint8_t block[SHA384_BLOCK_LENGTH];
+} cy_stc_sha384_t;
+
+/**
+ * \name Cy_Sha256_Init
+ * \brief Start a SHA-256 hash
+ * \param p_ctx
+ * \retval None
+ */
+void Cy_Sha256_Init(cy_stc_sha256_t *p_ctx);
+
+/**
+ * \name Cy_Sha256_Update
+ * \brief Hash the next chunk of the message, of any length
+ * \param p_ctx
+ * \param data
+ * \param length
+ * \retval None
+ */
+void Cy_Sha256_Update(cy_stc_sha256_t *p_ctx, const uint8_t *data, uint32_t length);
+
+/**
+ * \name Cy_Sha256_Final
+ * \brief Pad the message and write the digest. The context must be initialized again for the next hash.
+ * \param p_ctx
+ * \param digest SHA256_DIGEST_LENGTH bytes
+ * \retval None
+ */
+void Cy_Sha256_Final(cy_stc_sha256_t *p_ctx, uint8_t *digest);
+
+/**
+ * \name Cy_Sha384_Init
+ * \brief Start a SHA-384 hash
+ * \param p_ctx
+ * \retval None
+ */
+void Cy_Sha384_Init(cy_stc_sha384_t *p_ctx);
+
+/**
+ * \name Cy_Sha384_Update
+ * \brief Hash the next chunk of the message, of any length
+ * \param p_ctx
+ * \param data
+ * \param length
+ * \retval None
+ */
+void Cy_Sha384_Update(cy_stc_sha384_t *p_ctx, const uint8_t *data, uint32_t length);
+
+/**
+ * \name Cy_Sha384_Final
+ * \brief Pad the message and write the digest. The context must be initialized again for the next hash.
+ * \param p_ctx
+ * \param digest SHA384_DIGEST_LENGTH bytes
+ * \retval None
+ */
+void Cy_Sha384_Final(cy_stc_sha384_t *p_ctx, uint8_t *digest);
+
+#endif /* _SHA2_H_ */
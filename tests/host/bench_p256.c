@@ -0,0 +1,92 @@
+/*
+ * Host benchmark of the software P-256 verifier: items per second for a set of signatures
+ * over two keys, one at a time with the key decoded per call, one at a time with kept keys,
+ * and through Cy_P256_VerifyBatch.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <time.h>
+#include "p256_verify.h"
+
+typedef struct
+{
+    uint8_t keyIndex;
+    uint8_t digest[32];
+    uint8_t signature[72];
+    uint16_t signatureLength;
+} bench_item_t;
+
+#include "p256_bench_vectors.h"
+
+#define NUM_KEYS        (sizeof(bench_keys) / sizeof(bench_keys[0]))
+#define NUM_ITEMS       (sizeof(bench_items) / sizeof(bench_items[0]))
+#define ROUNDS          (8u)
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static void report(const char *name, unsigned ok, double seconds)
+{
+    printf("%-28s %8.1f items/s  (%u/%u verified)\n", name, (ROUNDS * NUM_ITEMS) / seconds, ok,
+           (unsigned)(ROUNDS * NUM_ITEMS));
+}
+
+int main(void)
+{
+    static cy_stc_p256_key_t keys[NUM_KEYS];
+    static cy_stc_p256_batch_item_t batch[NUM_ITEMS];
+    unsigned ok, round, i;
+    double t0;
+
+    ok = 0;
+    t0 = now_s();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < NUM_ITEMS; i++) {
+            const bench_item_t *it = &bench_items[i];
+            ok += (CY_P256_SUCCESS == Cy_P256_Verify(it->digest, sizeof(it->digest), it->signature,
+                                                     it->signatureLength, bench_keys[it->keyIndex],
+                                                     sizeof(bench_keys[0]))) ? 1u : 0u;
+        }
+    }
+    report("one at a time", ok, now_s() - t0);
+
+    ok = 0;
+    t0 = now_s();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < NUM_KEYS; i++) {
+            (void)Cy_P256_KeyInit(&keys[i], bench_keys[i], sizeof(bench_keys[0]));
+        }
+        for (i = 0; i < NUM_ITEMS; i++) {
+            const bench_item_t *it = &bench_items[i];
+            ok += (CY_P256_SUCCESS == Cy_P256_VerifyKey(&keys[it->keyIndex], it->digest, sizeof(it->digest),
+                                                        it->signature, it->signatureLength)) ? 1u : 0u;
+        }
+    }
+    report("one at a time, kept keys", ok, now_s() - t0);
+
+    ok = 0;
+    t0 = now_s();
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = 0; i < NUM_KEYS; i++) {
+            (void)Cy_P256_KeyInit(&keys[i], bench_keys[i], sizeof(bench_keys[0]));
+        }
+        for (i = 0; i < NUM_ITEMS; i++) {
+            batch[i].digest = bench_items[i].digest;
+            batch[i].digestLength = sizeof(bench_items[i].digest);
+            batch[i].signature = bench_items[i].signature;
+            batch[i].signatureLength = bench_items[i].signatureLength;
+            batch[i].keyIndex = bench_items[i].keyIndex;
+        }
+        ok += Cy_P256_VerifyBatch(keys, NUM_KEYS, batch, NUM_ITEMS);
+    }
+    report("batch", ok, now_s() - t0);
+
+    return (ok == (ROUNDS * NUM_ITEMS)) ? 0 : 1;
+}
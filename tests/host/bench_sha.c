@@ -0,0 +1,87 @@
+/*
+ * Host benchmark of the software SHA-256 and SHA-384: nanoseconds and, on x86, time stamp
+ * counter cycles per byte over a 64 KB message. Cy_Optiga_HashBench measures the same on the
+ * target with the DWT cycle counter.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <time.h>
+#include "sha2.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC  (1)
+#endif
+
+#define LENGTH          (65536u)
+#define ROUNDS          (64u)
+
+static uint8_t msg[LENGTH];
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static unsigned long long cycles(void)
+{
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+static void report(const char *name, double seconds, unsigned long long ticks)
+{
+    double bytes = (double)LENGTH * ROUNDS;
+
+    printf("%-10s %8.2f ns/byte %8.1f MB/s", name, (seconds * 1e9) / bytes, bytes / (seconds * 1e6));
+#ifdef BENCH_HAVE_TSC
+    printf(" %8.2f TSC cycles/byte", (double)ticks / bytes);
+#else
+    (void)ticks;
+#endif
+    printf("\n");
+}
+
+int main(void)
+{
+    cy_stc_sha256_t ctx256;
+    cy_stc_sha384_t ctx384;
+    uint8_t digest[SHA384_DIGEST_LENGTH];
+    unsigned long long c0;
+    unsigned round, sink = 0;
+    uint32_t i;
+    double t0;
+
+    for (i = 0; i < LENGTH; i++) {
+        msg[i] = (uint8_t)((31u * i) + 7u);
+    }
+
+    t0 = now_s();
+    c0 = cycles();
+    for (round = 0; round < ROUNDS; round++) {
+        Cy_Sha256_Init(&ctx256);
+        Cy_Sha256_Update(&ctx256, msg, LENGTH);
+        Cy_Sha256_Final(&ctx256, digest);
+        sink += digest[0];
+    }
+    report("SHA-256", now_s() - t0, cycles() - c0);
+
+    t0 = now_s();
+    c0 = cycles();
+    for (round = 0; round < ROUNDS; round++) {
+        Cy_Sha384_Init(&ctx384);
+        Cy_Sha384_Update(&ctx384, msg, LENGTH);
+        Cy_Sha384_Final(&ctx384, digest);
+        sink += digest[0];
+    }
+    report("SHA-384", now_s() - t0, cycles() - c0);
+
+    return (sink == 0xFFFFFFFFu) ? 1 : 0;
+}
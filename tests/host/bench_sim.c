@@ -0,0 +1,191 @@
+/*
+ * Benchmark of the OPTIGA transport on the host simulator (sim/sim.h): the real PAL, SCB0 and
+ * bus manager code talking to the emulated Trust M of sim/trustm_model.c through
+ * sim/ifx_i2c_lite.c, at 100, 400 and 1000 kHz. Reports simulated microseconds per command,
+ * the CPU time spun in busy waits, the part of it spent in the RTOS timer task, the time the
+ * bus was driven and the I2C_STATE polls, and the same for a single I2C_STATE poll of the idle
+ * chip. Built once per transfer mode, and once more per mode with the register address write
+ * joined to the read (PAL_I2C_COMBINED_READ_EN): the "state poll" rows of the two builds give the
+ * split and combined poll latency. See the Makefile.
+ */
+
+#include <stdio.h>
+#include "sim.h"
+#include "semphr.h"
+#include "pal_custom.h"
+#include "trustm_model.h"
+#include "ifx_i2c_lite.h"
+
+#ifndef PAL_I2C_COMBINED_READ_EN
+#define PAL_I2C_COMBINED_READ_EN    (0u)
+#endif
+
+#define ROUNDS          (8u)
+#define TASK_PRIORITY   (12u)
+
+typedef struct {
+    const char *name;
+    const uint8_t *apdu;
+    uint16_t length;
+} bench_op_t;
+
+static const uint8_t apdu_open[] = {
+    0xF0, 0x00, 0x00, 0x10,
+    0xD2, 0x76, 0x00, 0x00, 0x04, 0x47, 0x65, 0x6E, 0x41, 0x75, 0x74, 0x68, 0x41, 0x70, 0x70, 0x6C
+};
+static const uint8_t apdu_random[] = { 0x8C, 0x00, 0x00, 0x02, 0x00, 0x20 };
+static const uint8_t apdu_metadata[] = {
+    0x82, 0x01, 0x00, 0x09, 0xE0, 0xF1, 0x00, 0x00, 0x20, 0x03, 0xD0, 0x01, 0x00
+};
+static const uint8_t apdu_keygen[] = {
+    0xB8, 0x03, 0x00, 0x09, 0x01, 0x00, 0x02, 0xE0, 0xF1, 0x02, 0x00, 0x01, 0x10
+};
+static uint8_t apdu_sign[4 + 35 + 5];
+static uint8_t apdu_verify[4 + 35 + 73 + 4 + 71];
+
+static const bench_op_t ops[] = {
+    { "open app",  apdu_open,     sizeof(apdu_open) },
+    { "random 32", apdu_random,   sizeof(apdu_random) },
+    { "metadata",  apdu_metadata, sizeof(apdu_metadata) },
+    { "keygen",    apdu_keygen,   sizeof(apdu_keygen) },
+    { "sign",      apdu_sign,     sizeof(apdu_sign) },
+    { "verify",    apdu_verify,   sizeof(apdu_verify) },
+    { "state poll", NULL,         0u },                 /* One I2C_STATE poll, no APDU */
+};
+
+static trustm_model_t chip;
+static ifx_i2c_lite_t lite;
+static SemaphoreHandle_t done_sem;
+static optiga_lib_status_t done_status;
+static int failures;
+
+static void build_apdus(void)
+{
+    uint8_t *p = apdu_sign;
+    uint16_t i;
+
+    /* CalcSign ECDSA of a digest with the key in 0xE0F0 */
+    *p++ = 0xB1; *p++ = 0x11; *p++ = 0x00; *p++ = (uint8_t)(sizeof(apdu_sign) - 4u);
+    *p++ = 0x01; *p++ = 0x00; *p++ = 0x20;
+    for (i = 0; i < 32u; i++) {
+        *p++ = (uint8_t)(i * 7u);
+    }
+    *p++ = 0x03; *p++ = 0x00; *p++ = 0x02; *p++ = 0xE0; *p++ = 0xF0;
+
+    /* VerifySign of a digest with a host supplied P-256 public key */
+    p = apdu_verify;
+    *p++ = 0xB2; *p++ = 0x11; *p++ = 0x00; *p++ = (uint8_t)(sizeof(apdu_verify) - 4u);
+    *p++ = 0x01; *p++ = 0x00; *p++ = 0x20;
+    for (i = 0; i < 32u; i++) {
+        *p++ = (uint8_t)(i * 7u);
+    }
+    *p++ = 0x02; *p++ = 0x00; *p++ = 0x46;
+    for (i = 0; i < 70u; i++) {
+        *p++ = (uint8_t)(i + 1u);
+    }
+    *p++ = 0x05; *p++ = 0x00; *p++ = 0x01; *p++ = 0x03;
+    *p++ = 0x06; *p++ = 0x00; *p++ = 0x44;
+    for (i = 0; i < 68u; i++) {
+        *p++ = (uint8_t)(0x80u + i);
+    }
+}
+
+static void apdu_done(void *p_ctx, optiga_lib_status_t status)
+{
+    (void)p_ctx;
+    done_status = status;
+    xSemaphoreGive(done_sem);
+}
+
+static bool run_apdu(const bench_op_t *p_op)
+{
+    uint8_t response[TRUSTM_FRAME_SIZE];
+    uint16_t length = sizeof(response);
+
+    if (NULL == p_op->apdu) {
+        if (OPTIGA_LIB_BUSY != ifx_i2c_lite_poll(&lite, apdu_done, NULL)) {
+            return false;
+        }
+        xSemaphoreTake(done_sem, portMAX_DELAY);
+        return (OPTIGA_LIB_SUCCESS == done_status);
+    }
+
+    if (OPTIGA_LIB_BUSY != ifx_i2c_lite_transceive(&lite, p_op->apdu, p_op->length, response, &length,
+                                                   apdu_done, NULL)) {
+        return false;
+    }
+    xSemaphoreTake(done_sem, portMAX_DELAY);
+    return (OPTIGA_LIB_SUCCESS == done_status) && (length >= 4u) && (0x00 == response[0]);
+}
+
+static void bench_task(void *p_arg)
+{
+    static const uint16_t rates[] = { 100, 400, 1000 };
+    sim_stats_t stats;
+    sim_i2c_stats_t bus;
+    uint64_t t0;
+    uint32_t polls0;
+    unsigned r, o, round;
+
+    (void)p_arg;
+    done_sem = xSemaphoreCreateBinary();
+    if (!ifx_i2c_lite_open(&lite, optiga_pal_i2c_contexts[0])) {
+        printf("PAL I2C init failed\n");
+        failures++;
+        return;
+    }
+
+    printf("%-10s %5s %10s %10s %10s %10s %7s %7s\n", "command", "kHz", "us/op", "cpu us", "daemon us",
+           "bus us", "polls", "naks");
+    for (r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        if (PAL_STATUS_SUCCESS != pal_i2c_set_bitrate(optiga_pal_i2c_contexts[0], rates[r])) {
+            printf("bitrate %u kHz refused\n", rates[r]);
+            failures++;
+            continue;
+        }
+        for (o = 0; o < sizeof(ops) / sizeof(ops[0]); o++) {
+            sim_clear_stats();
+            sim_i2c_clear_stats();
+            polls0 = lite.stats.polls;
+            t0 = sim_now_ns();
+            for (round = 0; round < ROUNDS; round++) {
+                if (!run_apdu(&ops[o])) {
+                    printf("%s failed at %u kHz\n", ops[o].name, rates[r]);
+                    failures++;
+                    break;
+                }
+            }
+            sim_get_stats(&stats);
+            sim_i2c_get_stats(&bus);
+            printf("%-10s %5u %10.1f %10.1f %10.1f %10.1f %7.1f %7.1f\n", ops[o].name,
+                   (unsigned)(bus.dataRate / 1000u),
+                   (double)(sim_now_ns() - t0) / (1e3 * ROUNDS),
+                   (double)stats.busyNs / (1e3 * ROUNDS),
+                   (double)stats.timerTaskBusyNs / (1e3 * ROUNDS),
+                   (double)bus.busNs / (1e3 * ROUNDS),
+                   (double)(lite.stats.polls - polls0) / ROUNDS,
+                   (double)bus.addrNaks / ROUNDS);
+            if (0u != stats.timerTaskBlocks) {
+                printf("  timer task blocked %u times, %.1f us\n", (unsigned)stats.timerTaskBlocks,
+                       (double)stats.timerTaskBlockedNs / 1e3);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    build_apdus();
+    printf("bench_sim: %s transfers, OPTIGA events in the %s%s, register address %s\n",
+           I2C_INTR_MODE_EN ? "interrupt driven" : "blocking",
+           PAL_OS_EVENT_TASK_EN ? "OPTIGA service task" : "RTOS timer task",
+           PAL_OS_EVENT_HW_TIMER_EN ? " with the TCPWM compare timer" : "",
+           PAL_I2C_COMBINED_READ_EN ? "joined to the read" : "written on its own");
+
+    trustm_model_init(&chip, OPTIGA_FX_ADDR);
+    if ((0 != sim_run(bench_task, NULL, TASK_PRIORITY)) || (0 != failures)) {
+        printf("FAILED\n");
+        return 1;
+    }
+    return 0;
+}
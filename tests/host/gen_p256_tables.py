@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+"""Print the fixed-base comb table of the P-256 generator used by p256_verify.c."""
+
+from p256_ref import G, comb_table
+
+
+def limbs(v):
+    return ", ".join("0x%08XU" % ((v >> (32 * i)) & 0xFFFFFFFF) for i in range(8))
+
+
+def main():
+    print("static const cy_stc_p256_point_t p256_g_comb[P256_COMB_ENTRIES] =")
+    print("{")
+    for pt in comb_table(G):
+        print("    { { %s }," % limbs(pt[0]))
+        print("      { %s } }," % limbs(pt[1]))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
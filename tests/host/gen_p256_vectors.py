@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Generate p256_vectors.h: ECDSA P-256 verify vectors checked against the big integer reference."""
+
+import hashlib
+import random
+import sys
+
+from p256_ref import (N, P, G, mul, sign, verify, on_curve, der_int,
+                      optiga_signature, optiga_public_key)
+
+SUCCESS, INVALID, BAD_PARAM = 0, 1, 2
+
+
+def vector(name, key, digest, sig, expected):
+    return (name, key, digest, sig, expected)
+
+
+def arr(b):
+    return "{ " + ", ".join("0x%02X" % v for v in b) + " }"
+
+
+def bench():
+    """A few keys shared by many valid signatures, as for firmware chunks checked against a key set."""
+    rng = random.Random(0xBE)
+    privs = [rng.randrange(1, N) for _ in range(2)]
+    print("/* Generated by gen_p256_vectors.py --bench */")
+    print("")
+    print("static const uint8_t bench_keys[][68] =")
+    print("{")
+    for x in privs:
+        print("    %s," % arr(optiga_public_key(mul(x, G))))
+    print("};")
+    print("")
+    print("static const bench_item_t bench_items[] =")
+    print("{")
+    for i in range(64):
+        k = i % len(privs)
+        d = bytes(rng.randrange(256) for _ in range(32))
+        r, s = sign(privs[k], d)
+        sig = optiga_signature(r, s)
+        assert verify(mul(privs[k], G), d, r, s)
+        print("    { %d, %s, %s, %d }," % (k, arr(d), arr(sig), len(sig)))
+    print("};")
+
+
+def main():
+    if sys.argv[1:] == ["--bench"]:
+        bench()
+        return
+
+    rng = random.Random(0x256)
+    vectors = []
+
+    # RFC 6979 A.2.5, SHA-256 of "sample" and "test"
+    x = 0xC9AFA9D845BA75166B5C215767B1D6934E50C3DB36E89B127B8A622B120F6721
+    pub = mul(x, G)
+    for msg in (b"sample", b"test"):
+        d = hashlib.sha256(msg).digest()
+        r, s = sign(x, d)
+        vectors.append(vector("rfc6979 " + msg.decode(), optiga_public_key(pub), d, optiga_signature(r, s), SUCCESS))
+
+    keys = []
+    for i in range(24):
+        x = rng.randrange(1, N)
+        pub = mul(x, G)
+        keys.append(pub)
+        dlen = (32, 32, 20, 48, 64)[i % 5]
+        d = bytes(rng.randrange(256) for _ in range(dlen))
+        r, s = sign(x, d)
+        key = optiga_public_key(pub)
+        sig = optiga_signature(r, s)
+        vectors.append(vector("random %d" % i, key, d, sig, SUCCESS))
+        vectors.append(vector("random %d high s" % i, key, d, optiga_signature(r, N - s), SUCCESS))
+        vectors.append(vector("random %d raw key" % i, key[4:], d, sig, SUCCESS))
+        vectors.append(vector("random %d point key" % i, key[3:], d, sig, SUCCESS))
+        seq = der_int(r) + der_int(s)
+        vectors.append(vector("random %d sequence" % i, key, d, bytes([0x30, len(seq)]) + seq, SUCCESS))
+        bad = bytearray(d)
+        bad[rng.randrange(len(bad[:32]))] ^= 1 << rng.randrange(8)
+        vectors.append(vector("random %d digest bit" % i, key, bytes(bad), sig, INVALID))
+        vectors.append(vector("random %d r + 1" % i, key, d, optiga_signature((r + 1) % N or 1, s), INVALID))
+        vectors.append(vector("random %d s + 1" % i, key, d, optiga_signature(r, (s + 1) % N or 1), INVALID))
+        if i > 0:
+            vectors.append(vector("random %d other key" % i, optiga_public_key(keys[i - 1]), d, sig, INVALID))
+
+    # Scalar edge cases
+    x = rng.randrange(1, N)
+    pub = mul(x, G)
+    key = optiga_public_key(pub)
+    for name, d in (("zero digest", bytes(32)), ("digest above n", b"\xff" * 32)):
+        r, s = sign(x, d)
+        vectors.append(vector(name, key, d, optiga_signature(r, s), SUCCESS))
+    d = bytes(32)
+    r, s = sign(x, d)
+    vectors.append(vector("r zero", key, d, der_int(0) + der_int(s), INVALID))
+    vectors.append(vector("s zero", key, d, der_int(r) + der_int(0), INVALID))
+    vectors.append(vector("r equals n", key, d, der_int(N) + der_int(s), INVALID))
+    vectors.append(vector("s equals n", key, d, der_int(r) + der_int(N), INVALID))
+
+    # Malformed encodings
+    sig = optiga_signature(r, s)
+    vectors.append(vector("trailing byte", key, d, sig + b"\x00", BAD_PARAM))
+    vectors.append(vector("truncated", key, d, sig[:-1], BAD_PARAM))
+    vectors.append(vector("negative r", key, d, bytes([0x02, 0x01, 0x80]) + der_int(s), BAD_PARAM))
+    vectors.append(vector("bad sequence length", key, d, bytes([0x30, len(sig) + 1]) + sig, BAD_PARAM))
+    off = (pub[0], (pub[1] + 1) % P)
+    vectors.append(vector("key off curve", optiga_public_key(off), d, sig, BAD_PARAM))
+    vectors.append(vector("key x equals p", key[:4] + P.to_bytes(32, 'big') + key[36:], d, sig, BAD_PARAM))
+    vectors.append(vector("bad key header", bytes([0x03, 0x42, 0x00, 0x02]) + key[4:], d, sig, BAD_PARAM))
+    vectors.append(vector("short key", key[:-1], d, sig, BAD_PARAM))
+
+    for name, key, d, sig, expected in vectors:
+        if expected != BAD_PARAM:
+            pk = (int.from_bytes(key[-64:-32], 'big'), int.from_bytes(key[-32:], 'big'))
+            assert on_curve(pk), name
+            body = sig[2:] if sig[0] == 0x30 else sig
+            rl = body[1]
+            rv = int.from_bytes(body[2:2 + rl], 'big')
+            sv = int.from_bytes(body[4 + rl:], 'big')
+            assert verify(pk, d, rv, sv) == (expected == SUCCESS), name
+
+    print("/* Generated by gen_p256_vectors.py, checked against the big integer reference in p256_ref.py */")
+    print("")
+    for name, key, d, sig, expected in vectors:
+        print("    { \"%s\", %d, %s, %d, %s, %d, %s, %d }," % (
+            name, expected, arr(key), len(key), arr(d), len(d), arr(sig), len(sig)))
+
+
+if __name__ == "__main__":
+    main()
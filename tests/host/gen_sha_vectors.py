@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+"""Print sha_vectors.h: SHA-256 and SHA-384 digests from hashlib for the pattern
+messages of test_sha.c, at every length around the block and padding edges."""
+
+import hashlib
+
+LENGTHS = [0, 1, 3, 55, 56, 57, 63, 64, 65, 111, 112, 113, 119, 120, 127, 128, 129, 255, 256, 1000, 4096]
+
+
+def pattern(length):
+    """Message of test_sha.c, byte i is (31 * i + 7) mod 256."""
+    return bytes(((31 * i) + 7) & 0xFF for i in range(length))
+
+
+def c_bytes(data):
+    return ", ".join("0x%02X" % b for b in data)
+
+
+def main():
+    print("/* Generated by gen_sha_vectors.py, do not edit */")
+    print()
+    print("static const sha_vector_t sha_vectors[] =")
+    print("{")
+    for length in LENGTHS:
+        msg = pattern(length)
+        print("    { %uu," % length)
+        print("      { %s }," % c_bytes(hashlib.sha256(msg).digest()))
+        print("      { %s } }," % c_bytes(hashlib.sha384(msg).digest()))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
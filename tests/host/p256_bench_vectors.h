@@ -0,0 +1,75 @@
+/* Generated by gen_p256_vectors.py --bench */
+
+static const uint8_t bench_keys[][68] =
+{
+    { 0x03, 0x42, 0x00, 0x04, 0x34, 0xBE, 0x83, 0x3F, 0x8E, 0x96, 0x7E, 0x58, 0xE2, 0x05, 0x80, 0xB7, 0x9F, 0x66, 0x14, 0xEF, 0x28, 0xCC, 0x0B, 0x4E, 0x69, 0x03, 0x56, 0x7E, 0x7D, 0x4D, 0xD4, 0x10, 0xF5, 0x55, 0xDD, 0x6E, 0x9B, 0xC6, 0x33, 0x59, 0xE3, 0xFE, 0x31, 0xA4, 0x02, 0x2C, 0x0D, 0x80, 0x58, 0xC4, 0x0E, 0x78, 0x2C, 0x0D, 0xEA, 0x6E, 0xBD, 0x6F, 0xD3, 0x43, 0x80, 0xEF, 0x35, 0x8A, 0x4F, 0xB9, 0xEA, 0x0B },
+    { 0x03, 0x42, 0x00, 0x04, 0x47, 0x19, 0x81, 0xD6, 0x1D, 0xDF, 0x28, 0xE6, 0x7E, 0x5C, 0xDA, 0x89, 0x22, 0xB1, 0xC6, 0xD1, 0xD1, 0x52, 0x5B, 0x97, 0x07, 0xCB, 0x6E, 0xEF, 0x9A, 0x3C, 0x04, 0xE2, 0x56, 0x3F, 0xD3, 0xFB, 0x14, 0x26, 0x72, 0x00, 0x7A, 0x3F, 0x7B, 0x7F, 0x61, 0x1F, 0xBC, 0x19, 0x36, 0x7E, 0xD4, 0xD4, 0x5E, 0x53, 0x9F, 0x5B, 0xD0, 0x1C, 0xF2, 0xF3, 0x81, 0xB6, 0x1D, 0x7D, 0x4F, 0xDE, 0xA4, 0x56 },
+};
+
+static const bench_item_t bench_items[] =
+{
+    { 0, { 0x1C, 0x23, 0xB7, 0x9F, 0xCB, 0x18, 0xAE, 0x6B, 0xC5, 0x22, 0xE4, 0xF7, 0x91, 0x3F, 0x44, 0xAA, 0x6A, 0x01, 0xC0, 0x66, 0xC8, 0xF8, 0xC0, 0xF0, 0xAF, 0x7B, 0x8D, 0x51, 0x87, 0x54, 0x62, 0xBE }, { 0x02, 0x21, 0x00, 0xAB, 0x64, 0x6E, 0x9A, 0xBB, 0x6F, 0x19, 0x4E, 0x80, 0xD4, 0x3D, 0xF2, 0x92, 0x86, 0x17, 0x9B, 0x95, 0x5A, 0x57, 0x33, 0x7A, 0x89, 0x5F, 0x11, 0x85, 0xFF, 0x40, 0x9A, 0xF7, 0x38, 0xF1, 0xC9, 0x02, 0x21, 0x00, 0xCE, 0x9E, 0xCD, 0x0D, 0xD4, 0xF2, 0xAC, 0xA2, 0x72, 0x30, 0x96, 0xDD, 0xD8, 0x19, 0xED, 0x83, 0xB6, 0x83, 0x04, 0x78, 0x01, 0xA7, 0xC0, 0x1B, 0x2D, 0x31, 0x51, 0xB5, 0x6F, 0xF4, 0xB1, 0xFC }, 70 },
+    { 1, { 0x23, 0xEC, 0x39, 0x1B, 0x77, 0x65, 0xA5, 0x8D, 0xA7, 0xC9, 0x65, 0xC1, 0xE4, 0x9A, 0x85, 0x4E, 0xE1, 0xCC, 0xA7, 0x86, 0x56, 0x75, 0x1A, 0xD2, 0x89, 0xD4, 0xB0, 0x9E, 0xEE, 0x3E, 0x78, 0xC0 }, { 0x02, 0x20, 0x74, 0x8C, 0x38, 0xD9, 0xE7, 0x0A, 0x67, 0xBB, 0x79, 0x71, 0x8D, 0x68, 0x07, 0xDA, 0xDA, 0xA8, 0xFC, 0xF8, 0x8C, 0x91, 0xA4, 0x47, 0x71, 0x43, 0xBC, 0xF6, 0x7A, 0xBC, 0xFC, 0x46, 0x27, 0x90, 0x02, 0x20, 0x5A, 0x0F, 0x49, 0x31, 0xAB, 0x07, 0xC8, 0x89, 0x4D, 0x4C, 0xE2, 0x99, 0x0A, 0x03, 0x9C, 0xD5, 0xAD, 0xF7, 0xDD, 0xB2, 0x2B, 0xA0, 0x97, 0xE0, 0x81, 0xFD, 0xFF, 0x44, 0xA9, 0xC0, 0x59, 0x82 }, 68 },
+    { 0, { 0x94, 0xF4, 0x42, 0x55, 0xC1, 0xF9, 0xEC, 0xED, 0x0D, 0xA7, 0xDB, 0x04, 0x94, 0x9D, 0x75, 0x07, 0xF5, 0x13, 0xDB, 0x57, 0x35, 0x7C, 0x90, 0x44, 0x2F, 0xA2, 0x97, 0xF4, 0x32, 0x86, 0x82, 0x19 }, { 0x02, 0x20, 0x4F, 0x59, 0x69, 0x20, 0x9D, 0xBE, 0xD7, 0x3B, 0x40, 0x7B, 0x14, 0x6F, 0x33, 0x4E, 0x9B, 0x0B, 0x8E, 0xC1, 0x74, 0x16, 0x64, 0x15, 0x32, 0xCD, 0x18, 0xB7, 0x3E, 0x6F, 0x9D, 0xBE, 0xA6, 0xF3, 0x02, 0x21, 0x00, 0xEE, 0x11, 0x6C, 0xFA, 0x34, 0xE5, 0xD1, 0x9F, 0x87, 0xD4, 0xD5, 0x05, 0xD7, 0xAB, 0x18, 0x0D, 0x1E, 0xE1, 0x20, 0x5C, 0xD3, 0xAF, 0x7A, 0x59, 0x27, 0x76, 0x89, 0x68, 0x38, 0xE5, 0x0F, 0x37 }, 69 },
+    { 1, { 0xB9, 0x20, 0xFC, 0x89, 0x50, 0xEF, 0x12, 0x32, 0x56, 0xE9, 0x2C, 0xA8, 0xBE, 0x8E, 0x20, 0x11, 0x40, 0x95, 0xB8, 0x7F, 0x06, 0xD7, 0xD3, 0x21, 0xDC, 0x86, 0x9F, 0x86, 0xC5, 0x74, 0x6E, 0x41 }, { 0x02, 0x21, 0x00, 0xD2, 0xAC, 0xC4, 0x52, 0x1F, 0xD5, 0xEF, 0x69, 0xA3, 0x2B, 0xF7, 0xAB, 0xA8, 0x30, 0xA9, 0xAA, 0xCB, 0xB6, 0x3B, 0x0A, 0x8E, 0x6F, 0x03, 0xC4, 0xE1, 0x67, 0xA3, 0x3F, 0xBA, 0xBC, 0x80, 0x88, 0x02, 0x20, 0x32, 0xF7, 0x2C, 0x38, 0xE9, 0x67, 0x9F, 0x18, 0x5F, 0x76, 0xAF, 0x64, 0xAA, 0x4D, 0x1A, 0x1F, 0x76, 0xD7, 0x11, 0x46, 0xD2, 0x5C, 0xFF, 0xA2, 0x54, 0x04, 0xC5, 0x3D, 0x96, 0xF7, 0x6C, 0x2E }, 69 },
+    { 0, { 0xCF, 0xBF, 0xF0, 0x8F, 0x9F, 0xA8, 0x19, 0xD4, 0xD5, 0x4C, 0x80, 0x69, 0xEC, 0x3C, 0xE5, 0x70, 0xFC, 0x89, 0x9E, 0x98, 0x6A, 0xFC, 0x1D, 0xF7, 0x7C, 0x8E, 0xDA, 0xE8, 0xDB, 0x30, 0x21, 0x50 }, { 0x02, 0x20, 0x67, 0xFE, 0x50, 0xAC, 0x59, 0xA2, 0x5E, 0x3A, 0xB8, 0x8D, 0x85, 0x9E, 0xAF, 0x56, 0x29, 0x3F, 0xDF, 0x16, 0x0E, 0xF1, 0x1E, 0xD9, 0xAC, 0x80, 0xC1, 0x96, 0x34, 0x73, 0xD2, 0x54, 0x1D, 0xE3, 0x02, 0x20, 0x20, 0x23, 0xE1, 0x12, 0xF7, 0x59, 0x12, 0x3A, 0x49, 0xC3, 0xB9, 0xE5, 0xB7, 0x16, 0x9B, 0x63, 0xBB, 0x57, 0xCD, 0xAF, 0xF3, 0xB6, 0xB6, 0x1F, 0xA6, 0x20, 0x03, 0xB0, 0x23, 0x90, 0x9C, 0x63 }, 68 },
+    { 1, { 0x2A, 0xAA, 0x23, 0xF3, 0xC7, 0x54, 0x67, 0x9B, 0x91, 0x1E, 0x20, 0x4F, 0x42, 0x58, 0x44, 0x80, 0x7E, 0x9B, 0x67, 0x52, 0xC2, 0x42, 0x9B, 0x94, 0x3A, 0x9C, 0xA5, 0x75, 0x35, 0x88, 0x0A, 0x69 }, { 0x02, 0x21, 0x00, 0xC5, 0x11, 0xE0, 0x53, 0x5B, 0x3A, 0x3D, 0xB5, 0x91, 0x90, 0x91, 0xA2, 0x85, 0xC0, 0x79, 0x65, 0x5A, 0x4D, 0x37, 0xAC, 0x2A, 0x9F, 0x13, 0xF2, 0xDF, 0x17, 0xE1, 0x02, 0x06, 0x34, 0x08, 0x03, 0x02, 0x20, 0x25, 0x97, 0x36, 0xAD, 0xC3, 0x17, 0x67, 0xA8, 0x09, 0x06, 0x8F, 0x81, 0x52, 0x78, 0xD1, 0xBB, 0xF0, 0x2B, 0x28, 0xF3, 0xD2, 0x00, 0x63, 0x85, 0x4C, 0xC3, 0x6B, 0x5D, 0xA8, 0x87, 0xDD, 0x48 }, 69 },
+    { 0, { 0xF9, 0x0D, 0x55, 0x2E, 0x62, 0xD0, 0xC6, 0xB4, 0x8F, 0x7D, 0xFB, 0x2A, 0xCC, 0x52, 0xC6, 0x35, 0xD3, 0xFA, 0x46, 0xAB, 0x8A, 0x81, 0x3B, 0x88, 0x72, 0x9D, 0xEE, 0x9D, 0x23, 0x25, 0x0C, 0xC2 }, { 0x02, 0x21, 0x00, 0x9F, 0x49, 0xD6, 0x8D, 0xBE, 0x2D, 0x20, 0xA6, 0x03, 0x84, 0xF7, 0xE0, 0xE1, 0xEF, 0x50, 0xC3, 0xC4, 0x83, 0xCD, 0xE1, 0xC6, 0x21, 0x44, 0x0A, 0x32, 0x82, 0x8C, 0xBB, 0xC5, 0x21, 0xA3, 0x0C, 0x02, 0x20, 0x26, 0x88, 0xD3, 0x5F, 0xE2, 0x8F, 0xE9, 0x99, 0x56, 0x6B, 0x99, 0xD6, 0xC0, 0x45, 0x36, 0x29, 0xA3, 0xAB, 0x2C, 0xDA, 0x52, 0x3A, 0x01, 0xFE, 0x8A, 0xFE, 0xC9, 0xB8, 0xF4, 0x9E, 0x99, 0x19 }, 69 },
+    { 1, { 0x53, 0xF3, 0x9F, 0x1F, 0x76, 0x8E, 0x9A, 0x30, 0x1E, 0xF7, 0xCC, 0xFB, 0x3A, 0xFE, 0x23, 0x36, 0x16, 0x10, 0xB4, 0x01, 0x67, 0x52, 0x29, 0x75, 0x6C, 0x53, 0x24, 0x85, 0x8B, 0x72, 0xEC, 0xF5 }, { 0x02, 0x20, 0x2D, 0xF8, 0x2D, 0x66, 0x42, 0x98, 0xE0, 0x89, 0xC8, 0x8A, 0x0F, 0x7F, 0x47, 0x27, 0x90, 0x2F, 0xD5, 0x1F, 0xF6, 0x4E, 0x05, 0x98, 0x17, 0xF4, 0x75, 0x14, 0x80, 0x34, 0xEB, 0x20, 0x04, 0x64, 0x02, 0x20, 0x5E, 0xA2, 0xB9, 0x93, 0xD1, 0x04, 0x3B, 0x61, 0x67, 0xA7, 0x91, 0xC9, 0x50, 0x87, 0x04, 0xFA, 0xD1, 0x65, 0x02, 0x44, 0x2B, 0x38, 0x9D, 0x94, 0x94, 0xDE, 0xDC, 0xC6, 0xB4, 0xA3, 0x10, 0x78 }, 68 },
+    { 0, { 0x65, 0xEB, 0x0E, 0x0E, 0xD2, 0xB7, 0xB0, 0xE5, 0xF2, 0x0C, 0x64, 0x84, 0x1F, 0xFF, 0x31, 0xC1, 0xB2, 0x51, 0x10, 0x19, 0xA4, 0xAF, 0x0A, 0x4C, 0x55, 0xFF, 0x42, 0x58, 0xD6, 0x72, 0xCB, 0xB3 }, { 0x02, 0x21, 0x00, 0xC3, 0x52, 0x3C, 0x28, 0x48, 0x9E, 0xD5, 0xDC, 0xD7, 0x6C, 0x39, 0x4C, 0xF7, 0x42, 0x46, 0x68, 0x4F, 0xC8, 0x2C, 0x9A, 0x7C, 0xE5, 0xC6, 0xB6, 0x14, 0xEB, 0xBD, 0x63, 0x29, 0xB4, 0x28, 0x4F, 0x02, 0x21, 0x00, 0x98, 0x27, 0x41, 0x20, 0xBB, 0x95, 0xB7, 0xD0, 0x04, 0xEE, 0x41, 0xD7, 0x8B, 0x39, 0xD2, 0xCF, 0xBC, 0x9B, 0x4F, 0x7A, 0xF7, 0x81, 0xF8, 0x21, 0xE2, 0xDD, 0x67, 0x31, 0xE4, 0xBD, 0xA0, 0xF0 }, 70 },
+    { 1, { 0xCC, 0x86, 0x15, 0x73, 0xDA, 0x77, 0x83, 0x6C, 0x25, 0x5F, 0x8F, 0xFA, 0xC3, 0xBA, 0x3F, 0xF8, 0x73, 0x31, 0x06, 0x1B, 0x5A, 0xFC, 0xA5, 0x19, 0xCB, 0xF5, 0x6D, 0x1E, 0xCB, 0x6F, 0x79, 0xED }, { 0x02, 0x21, 0x00, 0xEA, 0x83, 0xE5, 0x24, 0x23, 0x52, 0xAA, 0x0A, 0x67, 0xCE, 0xD9, 0xA6, 0xCD, 0x2C, 0x1D, 0x8A, 0xD3, 0xAE, 0x6B, 0x5D, 0xA3, 0xB5, 0xE9, 0x39, 0xD2, 0xBA, 0xA4, 0x62, 0xA5, 0xE3, 0x24, 0x59, 0x02, 0x20, 0x28, 0x72, 0x94, 0x63, 0xA4, 0xC8, 0xAF, 0xE3, 0xA8, 0xE4, 0xB9, 0x27, 0xDF, 0xEA, 0x3C, 0x61, 0x61, 0xC4, 0x53, 0x34, 0x63, 0x25, 0x4E, 0x28, 0xD9, 0x61, 0xBB, 0x17, 0x19, 0xA4, 0xA0, 0x63 }, 69 },
+    { 0, { 0xDF, 0x43, 0x40, 0x97, 0x09, 0x1E, 0x01, 0x6C, 0x7E, 0x58, 0x02, 0x85, 0x2F, 0xE5, 0x75, 0xED, 0xCF, 0x55, 0xF9, 0x1D, 0x5D, 0x54, 0xC0, 0x6E, 0x32, 0x5C, 0x42, 0x4E, 0x3C, 0x66, 0xB0, 0xAC }, { 0x02, 0x21, 0x00, 0xCC, 0xF1, 0x84, 0x53, 0x75, 0x57, 0xB2, 0x83, 0xFC, 0xDB, 0xA4, 0xF8, 0x49, 0x96, 0x01, 0x1B, 0xF6, 0xB6, 0xF7, 0x20, 0x00, 0x65, 0x6F, 0x15, 0xBE, 0x51, 0xAF, 0x9B, 0x5F, 0x99, 0xBC, 0x3D, 0x02, 0x20, 0x19, 0x4F, 0xE6, 0x43, 0xC5, 0x12, 0xF1, 0x5E, 0xC8, 0x07, 0x68, 0x73, 0xDA, 0x7E, 0xDD, 0xB2, 0x84, 0xC6, 0x0E, 0x15, 0x82, 0x10, 0x92, 0xCB, 0x8B, 0x3E, 0xC1, 0xF2, 0x65, 0xDA, 0x92, 0x10 }, 69 },
+    { 1, { 0xA3, 0xD5, 0xE4, 0xB1, 0x0A, 0xAD, 0x67, 0x0D, 0x5E, 0x01, 0x71, 0x75, 0x60, 0x63, 0x3A, 0x52, 0xFB, 0xA8, 0x52, 0x97, 0x07, 0x83, 0xF4, 0xDD, 0x6E, 0x9C, 0xEC, 0xE9, 0xC9, 0xB6, 0x24, 0xF7 }, { 0x02, 0x21, 0x00, 0xBD, 0x02, 0x10, 0x2C, 0xE4, 0x1C, 0x85, 0x1D, 0x44, 0x5D, 0x0E, 0x27, 0x53, 0xD6, 0x4F, 0x4F, 0xC0, 0x1E, 0x8A, 0xF7, 0xF2, 0x95, 0x60, 0xE1, 0x7B, 0xDC, 0xA4, 0xFB, 0x2E, 0x9A, 0x24, 0xFD, 0x02, 0x20, 0x73, 0x3B, 0x92, 0xEC, 0x45, 0x9A, 0xF2, 0xC6, 0x4D, 0x91, 0x62, 0xEA, 0xE5, 0x9B, 0x74, 0xC2, 0x1A, 0xDF, 0xD2, 0x98, 0x13, 0x37, 0x69, 0x3D, 0x16, 0x42, 0xE9, 0x2D, 0x7D, 0xEC, 0x6C, 0x35 }, 69 },
+    { 0, { 0x4D, 0x77, 0x5A, 0x2E, 0xC0, 0xBB, 0x13, 0xA1, 0xB9, 0x16, 0x98, 0x81, 0x3E, 0x31, 0x9C, 0x8A, 0x66, 0xFA, 0x24, 0x83, 0x93, 0x1C, 0x85, 0x1F, 0xDC, 0x31, 0x0D, 0xD6, 0xAD, 0xD0, 0x29, 0xD4 }, { 0x02, 0x20, 0x6F, 0x48, 0xD6, 0x0C, 0xFF, 0x1F, 0xC8, 0x96, 0x63, 0x01, 0x2B, 0x23, 0xE9, 0x5F, 0x36, 0xF8, 0x92, 0x8B, 0x86, 0x50, 0x21, 0x83, 0x66, 0x52, 0x8C, 0x03, 0x7E, 0xAD, 0x62, 0xEC, 0xE5, 0xA0, 0x02, 0x20, 0x67, 0x62, 0x6F, 0xC6, 0x9F, 0xBE, 0x5F, 0x8C, 0xFB, 0x8E, 0xFE, 0x2E, 0x60, 0x46, 0x0B, 0x8A, 0x19, 0xE2, 0x1B, 0x5E, 0x24, 0x3B, 0x2A, 0xBB, 0x10, 0x55, 0x05, 0x19, 0x8B, 0x6D, 0x07, 0xBF }, 68 },
+    { 1, { 0xB9, 0x4B, 0xDE, 0x9B, 0x18, 0x4D, 0xD9, 0x62, 0x18, 0xEE, 0xB6, 0x9F, 0x49, 0x7F, 0xC2, 0xB1, 0xC1, 0x48, 0x99, 0x65, 0x5E, 0x0E, 0xA1, 0xA1, 0x77, 0x85, 0xEB, 0x92, 0xE8, 0x3E, 0x10, 0xF5 }, { 0x02, 0x21, 0x00, 0xC7, 0xE6, 0xB0, 0xA0, 0x73, 0x46, 0xB8, 0xE2, 0x8C, 0x3F, 0xF4, 0xDA, 0x4D, 0xBD, 0xC8, 0x41, 0x90, 0x8F, 0xF2, 0x03, 0x17, 0x7B, 0xF8, 0x6E, 0xE0, 0x50, 0x9E, 0xB2, 0x8F, 0xC9, 0x76, 0xB7, 0x02, 0x20, 0x77, 0xD6, 0xC3, 0x43, 0x2A, 0x9A, 0x48, 0xE5, 0x3B, 0xFB, 0x07, 0xD4, 0x4C, 0x7F, 0x92, 0x90, 0xF7, 0xE5, 0x6B, 0xF2, 0xEF, 0x40, 0x3C, 0xBC, 0xEE, 0xF4, 0xCD, 0x3B, 0x24, 0xCF, 0x69, 0x84 }, 69 },
+    { 0, { 0x08, 0xFB, 0xE8, 0x7F, 0x2D, 0x2A, 0x0F, 0x5D, 0x85, 0xF9, 0xC9, 0x9A, 0xA0, 0xF6, 0x66, 0x8D, 0x54, 0x3B, 0xDE, 0x1D, 0x07, 0x32, 0x80, 0xF5, 0x78, 0xC4, 0x85, 0xE8, 0x75, 0xF7, 0x40, 0xD1 }, { 0x02, 0x21, 0x00, 0xBE, 0xFD, 0xBC, 0x01, 0x07, 0x0C, 0x36, 0xA9, 0x56, 0x60, 0x8B, 0x62, 0xA0, 0x92, 0x9F, 0x01, 0x2D, 0xCA, 0xBF, 0x06, 0x1E, 0x4F, 0xE3, 0xE3, 0x4C, 0xF9, 0x99, 0x8F, 0xCF, 0x53, 0x9A, 0x76, 0x02, 0x21, 0x00, 0xC1, 0x6A, 0x99, 0x89, 0x4D, 0x1D, 0xDE, 0x46, 0xB1, 0x3B, 0x59, 0x36, 0xE1, 0x7E, 0x03, 0xDB, 0xFA, 0x8E, 0x8F, 0xC8, 0x71, 0x47, 0x17, 0x7B, 0xA2, 0xA6, 0xAF, 0x2B, 0x82, 0xCD, 0x80, 0x94 }, 70 },
+    { 1, { 0x09, 0x50, 0x15, 0x66, 0xFE, 0x6F, 0x51, 0x1F, 0xA7, 0x63, 0x82, 0xE2, 0x5C, 0x03, 0x17, 0x61, 0xAF, 0x0D, 0xB3, 0xFA, 0xC8, 0x54, 0xA5, 0x9B, 0x76, 0x05, 0x64, 0x5E, 0x6B, 0xA6, 0x08, 0x56 }, { 0x02, 0x21, 0x00, 0xA5, 0x32, 0xC5, 0xF5, 0xEA, 0x93, 0x53, 0x46, 0x46, 0x69, 0x52, 0x07, 0xD1, 0x1F, 0xEC, 0x1D, 0x3F, 0xEF, 0x58, 0xE8, 0xB3, 0x0B, 0xE1, 0x23, 0x92, 0xEF, 0x16, 0x08, 0x1A, 0xD8, 0xB3, 0x48, 0x02, 0x21, 0x00, 0x9B, 0x17, 0x75, 0xE0, 0x12, 0x99, 0xD7, 0x5C, 0xF6, 0xC3, 0xFD, 0x90, 0x18, 0x43, 0x5D, 0x89, 0x0B, 0x13, 0x78, 0x45, 0xCD, 0xAC, 0x5C, 0x46, 0x90, 0x6D, 0x55, 0x6D, 0x51, 0x0F, 0x64, 0xE3 }, 70 },
+    { 0, { 0x52, 0x86, 0xFA, 0x2A, 0xDE, 0x63, 0x61, 0x90, 0x81, 0xE6, 0x84, 0x2C, 0xB3, 0x13, 0xA4, 0x54, 0x9E, 0xCD, 0xE9, 0xB9, 0x1D, 0x3C, 0x60, 0x2C, 0x12, 0x88, 0x18, 0x8C, 0x7D, 0xDC, 0xC2, 0xE7 }, { 0x02, 0x20, 0x47, 0xCD, 0xF4, 0xE9, 0xCD, 0xF8, 0x08, 0xBB, 0x5C, 0xA8, 0x29, 0x7D, 0x8B, 0xB0, 0xCA, 0x22, 0x56, 0xC8, 0x29, 0xCC, 0x4C, 0xA9, 0x3A, 0xA7, 0x19, 0xAD, 0x10, 0xFA, 0x93, 0x47, 0xB2, 0xE8, 0x02, 0x20, 0x63, 0xE5, 0xA0, 0xFE, 0x29, 0xFB, 0xE4, 0x24, 0x60, 0x1B, 0xFA, 0xEE, 0x9D, 0xE3, 0xBB, 0xEF, 0x18, 0xC5, 0xE6, 0xE2, 0x55, 0x0A, 0x61, 0x5D, 0xD1, 0x7E, 0xBF, 0x92, 0x32, 0xFC, 0x12, 0xAD }, 68 },
+    { 1, { 0x37, 0xD3, 0xC4, 0x0E, 0xFC, 0x78, 0x06, 0x55, 0xE8, 0xBD, 0x46, 0x03, 0x73, 0x50, 0x41, 0xB0, 0x23, 0xDC, 0x93, 0x36, 0x1A, 0x70, 0xEB, 0x8F, 0xE0, 0x8B, 0xDC, 0xA7, 0x2F, 0xAD, 0x5A, 0xE7 }, { 0x02, 0x20, 0x2A, 0xF8, 0xD8, 0x39, 0x76, 0x84, 0x91, 0xD1, 0x7A, 0xEE, 0xB3, 0x4C, 0xC3, 0xF2, 0x12, 0x19, 0x27, 0xA4, 0xBE, 0x06, 0x38, 0x00, 0x9D, 0x2C, 0x39, 0xF9, 0x8B, 0xDC, 0x32, 0x04, 0xB1, 0x6C, 0x02, 0x20, 0x15, 0xD1, 0xAB, 0xC4, 0x15, 0xB4, 0xBF, 0x83, 0x7B, 0x7F, 0x41, 0xD3, 0x30, 0xD7, 0xA2, 0x3A, 0xDC, 0x37, 0xD7, 0x62, 0xE0, 0x51, 0x0D, 0x42, 0x04, 0x6B, 0xAF, 0x82, 0x11, 0x24, 0x32, 0x1E }, 68 },
+    { 0, { 0x25, 0xB0, 0x4D, 0x37, 0x36, 0x67, 0xBB, 0xB2, 0x5E, 0x9F, 0x9B, 0x88, 0xDB, 0xF8, 0x4B, 0xD0, 0xFA, 0x61, 0x28, 0x64, 0x8F, 0xBD, 0x0F, 0xBF, 0x8D, 0xD4, 0xFB, 0x88, 0xFF, 0x73, 0x02, 0x6F }, { 0x02, 0x20, 0x4E, 0xCC, 0x5F, 0xDC, 0x84, 0xF9, 0xC5, 0xA3, 0x9D, 0xF9, 0x9A, 0x66, 0xCF, 0x89, 0x8D, 0xF9, 0x26, 0x0D, 0xF3, 0xCB, 0xC6, 0xDE, 0x3D, 0x54, 0x32, 0xC7, 0xB8, 0xE6, 0x03, 0x7B, 0x29, 0x31, 0x02, 0x21, 0x00, 0x8B, 0x5C, 0x81, 0x6E, 0x2F, 0xE4, 0xCE, 0xD6, 0xAD, 0xB9, 0x0D, 0x78, 0x62, 0xE5, 0x56, 0xD1, 0x79, 0x26, 0x73, 0x9C, 0x72, 0xAB, 0xAF, 0xA4, 0xF7, 0xD3, 0x12, 0x16, 0x50, 0x31, 0x03, 0xF8 }, 69 },
+    { 1, { 0x88, 0x62, 0x1A, 0x9E, 0x22, 0xC3, 0x3B, 0x82, 0xF6, 0xC8, 0xE9, 0xDE, 0x64, 0x06, 0x73, 0xDD, 0xDA, 0x16, 0xDF, 0x35, 0xD9, 0x92, 0x94, 0x37, 0xDC, 0x07, 0xC3, 0xFA, 0x26, 0x37, 0x3E, 0x43 }, { 0x02, 0x20, 0x06, 0x1A, 0xE2, 0xB3, 0x57, 0xD0, 0x92, 0x96, 0x1E, 0xFC, 0xFE, 0x5D, 0xBA, 0xB0, 0x05, 0x15, 0x5D, 0xC3, 0x39, 0x61, 0x21, 0xBF, 0x14, 0xBC, 0x19, 0xEF, 0xC5, 0x58, 0xA9, 0x10, 0x0C, 0x89, 0x02, 0x20, 0x46, 0xCF, 0x40, 0x8B, 0x5D, 0x15, 0x11, 0x85, 0x7D, 0x4D, 0x0E, 0xF4, 0xD3, 0x10, 0xB8, 0x00, 0x26, 0x69, 0x31, 0x6D, 0x33, 0x0C, 0x9D, 0x41, 0xE7, 0x45, 0xDA, 0xBE, 0x7E, 0xD1, 0xD5, 0x9C }, 68 },
+    { 0, { 0x15, 0xD2, 0xB9, 0xBC, 0xE6, 0x81, 0x33, 0x75, 0xEC, 0xB3, 0x73, 0x73, 0x97, 0x42, 0xF4, 0xB3, 0x28, 0x58, 0xEE, 0x2F, 0x05, 0x34, 0xE3, 0xFA, 0x05, 0x29, 0x5A, 0xBE, 0xA9, 0x3E, 0xD8, 0xED }, { 0x02, 0x21, 0x00, 0x8B, 0x81, 0x39, 0xD2, 0xA8, 0x6B, 0x3C, 0xE3, 0x3A, 0xA7, 0xF2, 0xA1, 0xEA, 0xD9, 0xAF, 0xB0, 0x0D, 0xB7, 0x8D, 0xA4, 0x06, 0x03, 0x03, 0x8F, 0xFE, 0xAA, 0xF2, 0xDC, 0x40, 0x9E, 0xB4, 0x7C, 0x02, 0x21, 0x00, 0x9E, 0xC5, 0xFF, 0x98, 0x1A, 0xD9, 0x31, 0x58, 0xD0, 0xDB, 0xED, 0xBD, 0xBD, 0x57, 0x5D, 0xB2, 0x18, 0x02, 0x84, 0x08, 0x08, 0x9C, 0x7C, 0xD5, 0x98, 0x07, 0xFC, 0xB5, 0x65, 0x6E, 0x2B, 0x64 }, 70 },
+    { 1, { 0xA9, 0x93, 0x17, 0x2B, 0xC6, 0xB8, 0xCE, 0xEA, 0x74, 0x14, 0x44, 0x99, 0x59, 0x51, 0xA1, 0xDD, 0x40, 0xB0, 0x04, 0x38, 0xB6, 0xAC, 0xA8, 0x12, 0x48, 0xC8, 0xA1, 0xF8, 0x85, 0xE5, 0x3A, 0x09 }, { 0x02, 0x20, 0x25, 0x8B, 0x21, 0x89, 0xA6, 0x53, 0x3F, 0xBB, 0x0B, 0x2A, 0x01, 0x48, 0x2A, 0x60, 0xC2, 0xA6, 0x4E, 0xCB, 0xC5, 0xE7, 0x71, 0x75, 0x3B, 0x46, 0xF2, 0x08, 0xD1, 0x9A, 0x32, 0x01, 0xCC, 0x9C, 0x02, 0x21, 0x00, 0x81, 0xD6, 0xC1, 0x6C, 0x13, 0x72, 0x1A, 0x54, 0x0B, 0xF5, 0x58, 0xBB, 0x80, 0xD6, 0xB5, 0x1C, 0xD2, 0x9B, 0x21, 0x7C, 0xF4, 0x15, 0xAB, 0xC4, 0x23, 0x40, 0xFD, 0xFE, 0x35, 0xD6, 0xD4, 0xA5 }, 69 },
+    { 0, { 0x6C, 0x2D, 0x64, 0xE8, 0x67, 0x5C, 0x24, 0xCA, 0xEF, 0x2A, 0x57, 0xC5, 0xBA, 0x25, 0xFE, 0x40, 0x2F, 0xE8, 0x20, 0x25, 0xFC, 0xFF, 0xC7, 0xD7, 0xC3, 0x40, 0xC2, 0xF2, 0x37, 0x76, 0xC0, 0x95 }, { 0x02, 0x20, 0x40, 0x8A, 0xB8, 0x8B, 0x74, 0x32, 0x8C, 0x12, 0xD1, 0xD2, 0xCE, 0x30, 0x7B, 0x75, 0xDB, 0xB7, 0xF8, 0x5E, 0x55, 0x6D, 0x76, 0xBF, 0x1A, 0x7F, 0x60, 0xB7, 0xC2, 0x72, 0x54, 0x68, 0xFB, 0xE2, 0x02, 0x20, 0x18, 0x6A, 0xE6, 0x23, 0x19, 0x46, 0x02, 0x09, 0xD5, 0xC9, 0x99, 0xD0, 0x47, 0x90, 0x92, 0x58, 0x61, 0xA4, 0xFF, 0xA9, 0x8B, 0xDC, 0xB8, 0xFC, 0xA8, 0xC8, 0xFB, 0x70, 0xA9, 0x4C, 0xDA, 0xD9 }, 68 },
+    { 1, { 0xF2, 0x44, 0x53, 0xAD, 0x42, 0x1A, 0x5F, 0x08, 0x03, 0x8D, 0xC2, 0xC4, 0x74, 0xC5, 0xF2, 0x89, 0xE3, 0x39, 0x08, 0x46, 0x7C, 0x52, 0x32, 0x82, 0xBC, 0x9A, 0xB3, 0xF8, 0xDE, 0xB6, 0xA2, 0x9E }, { 0x02, 0x20, 0x2D, 0x3E, 0xC8, 0xFD, 0xC4, 0xB2, 0x0D, 0x2A, 0x0A, 0x27, 0xF7, 0xF3, 0xB0, 0xB4, 0x6C, 0xEF, 0x46, 0xDA, 0xD9, 0x5B, 0x3E, 0xE6, 0x3A, 0x4C, 0x2D, 0x90, 0xA0, 0x6D, 0x32, 0x90, 0xC9, 0xA2, 0x02, 0x21, 0x00, 0x80, 0xCE, 0x5B, 0x23, 0xC4, 0xB8, 0xD5, 0x69, 0x55, 0x57, 0x9E, 0x43, 0xD2, 0xF0, 0x77, 0x56, 0xE5, 0x02, 0x44, 0x8E, 0xCC, 0xC5, 0x05, 0x47, 0xCB, 0xF4, 0xC7, 0xA2, 0x0D, 0x41, 0x24, 0xC3 }, 69 },
+    { 0, { 0x72, 0x32, 0x1D, 0xB0, 0x84, 0xA6, 0xDF, 0x43, 0x3C, 0xCE, 0xC2, 0xFD, 0xCF, 0x3E, 0x79, 0x65, 0xBA, 0xEA, 0xBC, 0x99, 0x63, 0x28, 0xB5, 0xDC, 0xE0, 0x63, 0x47, 0xA7, 0x3E, 0xD6, 0x0C, 0x02 }, { 0x02, 0x20, 0x78, 0xF3, 0x4A, 0x93, 0x07, 0xED, 0x6B, 0xD2, 0xF8, 0x36, 0x32, 0x28, 0x87, 0xA1, 0x69, 0xFD, 0x1F, 0x87, 0x08, 0xF0, 0x54, 0x30, 0x9A, 0xAC, 0x59, 0x8B, 0x39, 0x30, 0x0A, 0x1E, 0xF0, 0x55, 0x02, 0x20, 0x0C, 0xB7, 0x37, 0xD3, 0x35, 0x27, 0x7C, 0x92, 0x18, 0xF1, 0x68, 0xA0, 0x76, 0x3A, 0xFB, 0x05, 0xCA, 0x4F, 0x23, 0x80, 0x25, 0x5E, 0xD8, 0xD3, 0x23, 0xB6, 0x35, 0x58, 0x3E, 0x2D, 0x6D, 0xB8 }, 68 },
+    { 1, { 0x68, 0xFB, 0x2A, 0x60, 0x27, 0x60, 0xD8, 0x7C, 0x24, 0x2C, 0xB9, 0x75, 0x2D, 0xDA, 0x1B, 0xB7, 0x89, 0x85, 0x44, 0x5E, 0x04, 0x54, 0xF7, 0xB0, 0xE1, 0x84, 0x3F, 0x02, 0xD9, 0xC4, 0xCC, 0xD4 }, { 0x02, 0x21, 0x00, 0x82, 0xC5, 0x4C, 0x11, 0x2E, 0x4A, 0x59, 0xE5, 0x35, 0x92, 0x29, 0x27, 0x14, 0x50, 0x0B, 0x9D, 0xDE, 0x21, 0x8A, 0x5D, 0x20, 0x46, 0xBC, 0x65, 0xAE, 0xD3, 0xAC, 0xE1, 0xCC, 0xF4, 0x10, 0xA3, 0x02, 0x20, 0x71, 0x1A, 0xAC, 0x36, 0x52, 0xF0, 0x71, 0x85, 0x55, 0x00, 0x4E, 0xA8, 0x26, 0xA0, 0xDE, 0x74, 0xEA, 0x3C, 0xDC, 0x9E, 0xDC, 0xB0, 0x1E, 0x91, 0xA2, 0xF2, 0x26, 0xE4, 0xEC, 0x00, 0x6B, 0x7D }, 69 },
+    { 0, { 0x77, 0x17, 0x29, 0xA8, 0xD3, 0x1B, 0xFC, 0x5F, 0x08, 0xDC, 0xA4, 0x8B, 0x7E, 0x8E, 0xE2, 0xCD, 0x72, 0xAF, 0xB0, 0xC0, 0x65, 0x5F, 0xEF, 0x1E, 0x99, 0x3A, 0xE8, 0xAC, 0xEE, 0x4E, 0x11, 0x89 }, { 0x02, 0x20, 0x50, 0xEC, 0x76, 0x00, 0x4C, 0xEC, 0xB2, 0x9F, 0x88, 0x01, 0xEF, 0xF8, 0x9E, 0xAF, 0x95, 0x04, 0x1A, 0xF8, 0x03, 0x9A, 0xA0, 0x3D, 0xFD, 0xFF, 0x87, 0xCA, 0xDB, 0x12, 0xB1, 0x83, 0x0C, 0xBB, 0x02, 0x21, 0x00, 0xC4, 0x34, 0x3F, 0xBC, 0xA7, 0x1B, 0x30, 0xF5, 0x79, 0xE6, 0x24, 0x46, 0x3D, 0xE6, 0x82, 0xB4, 0xFC, 0x0A, 0xC4, 0xB0, 0xFD, 0x40, 0xAB, 0x1D, 0x56, 0x3E, 0x22, 0x29, 0x47, 0x7F, 0xF4, 0x7B }, 69 },
+    { 1, { 0xDD, 0x2F, 0xB3, 0x68, 0x31, 0xE1, 0xE0, 0x57, 0x41, 0x42, 0x4C, 0x8E, 0x7D, 0x95, 0x5A, 0x6D, 0x56, 0xE9, 0xAB, 0x93, 0xBF, 0x96, 0xE8, 0x2D, 0xDA, 0x6D, 0xAC, 0x4C, 0xC4, 0x2F, 0x1E, 0x61 }, { 0x02, 0x21, 0x00, 0xFF, 0xAA, 0xF5, 0xFB, 0xC3, 0xA4, 0xAF, 0x54, 0x3B, 0x4A, 0x11, 0xDF, 0xA0, 0x17, 0xBE, 0xC5, 0x07, 0xD0, 0x6E, 0x43, 0xB4, 0xD8, 0xFA, 0x32, 0x67, 0x4A, 0xCC, 0xBB, 0xF6, 0xD0, 0x65, 0x86, 0x02, 0x20, 0x51, 0xC3, 0x4A, 0xCF, 0x0A, 0xF9, 0x3C, 0x28, 0x35, 0x4B, 0x82, 0x5E, 0x7A, 0x12, 0xB6, 0x52, 0xD9, 0xE5, 0x5A, 0x57, 0xD5, 0xE6, 0x1D, 0x0D, 0x18, 0x99, 0x16, 0x37, 0xBE, 0x23, 0x22, 0xEC }, 69 },
+    { 0, { 0xD5, 0x68, 0x41, 0x18, 0x8A, 0xC2, 0x7E, 0x0A, 0xF8, 0x3B, 0x19, 0x67, 0x85, 0xE4, 0x89, 0x3F, 0x0E, 0xA1, 0x83, 0x5E, 0x1B, 0xFA, 0x82, 0x87, 0x90, 0xDF, 0x3D, 0x44, 0xD0, 0x38, 0x9B, 0x88 }, { 0x02, 0x21, 0x00, 0xD2, 0x1B, 0x04, 0x77, 0x31, 0x2C, 0x29, 0x6A, 0x9D, 0xA8, 0x78, 0xCC, 0x11, 0xBD, 0x30, 0xFF, 0x73, 0xC3, 0x86, 0xAE, 0xA4, 0x69, 0x81, 0xF7, 0x0B, 0x1F, 0x1A, 0x05, 0x7A, 0xAE, 0x46, 0x97, 0x02, 0x21, 0x00, 0xA2, 0x89, 0x40, 0x5B, 0x5B, 0x0D, 0xDA, 0x6E, 0x63, 0x89, 0x2C, 0xF7, 0x8F, 0xA7, 0x59, 0xF0, 0x39, 0xBF, 0x08, 0x70, 0x15, 0xCE, 0xD8, 0xF2, 0x3E, 0xA4, 0x85, 0xBD, 0xD8, 0x01, 0xE5, 0x47 }, 70 },
+    { 1, { 0x27, 0x44, 0x58, 0x14, 0x6D, 0xC6, 0x86, 0x92, 0xDB, 0xC8, 0x58, 0x2D, 0x61, 0x51, 0xA4, 0xC1, 0x68, 0xBC, 0xA9, 0x4A, 0xFE, 0x1A, 0x69, 0xB0, 0xF4, 0xD7, 0x29, 0x2D, 0xB6, 0x81, 0xF4, 0x68 }, { 0x02, 0x21, 0x00, 0xDF, 0x2D, 0x72, 0x29, 0xED, 0x83, 0x65, 0xAA, 0xD5, 0x2F, 0x32, 0x18, 0xB0, 0x46, 0xDF, 0xEC, 0x9A, 0x72, 0xF1, 0xB0, 0xD0, 0x3E, 0x19, 0x59, 0x18, 0xFB, 0xD2, 0xE9, 0x3B, 0x1A, 0xB8, 0x7E, 0x02, 0x21, 0x00, 0xC7, 0xB6, 0xCF, 0x83, 0xD1, 0x75, 0xE6, 0x6D, 0x2A, 0x27, 0xC4, 0x27, 0x82, 0xD5, 0x3E, 0xE2, 0x83, 0x89, 0xD2, 0x72, 0xDC, 0x9D, 0x63, 0x25, 0xB1, 0x61, 0x58, 0x4A, 0xB2, 0x11, 0xC7, 0xA3 }, 70 },
+    { 0, { 0xC1, 0xBB, 0xAF, 0xA4, 0x69, 0x7E, 0x39, 0xC9, 0xB4, 0x9A, 0x65, 0x32, 0x3F, 0x12, 0x3D, 0x58, 0x11, 0x47, 0x0B, 0x02, 0x38, 0x4C, 0x86, 0x0F, 0x4D, 0x76, 0xC8, 0xDB, 0x60, 0x63, 0xEB, 0xE5 }, { 0x02, 0x21, 0x00, 0x8B, 0x57, 0xC5, 0x67, 0xD7, 0x39, 0x9F, 0x81, 0xB1, 0xE5, 0xDF, 0x22, 0xE7, 0xD7, 0x83, 0x14, 0xF1, 0x68, 0xB7, 0x2A, 0x62, 0x84, 0xAA, 0xEE, 0xC2, 0x21, 0x85, 0x8C, 0xAF, 0xA2, 0x34, 0x45, 0x02, 0x21, 0x00, 0xAA, 0xFF, 0xD1, 0x49, 0x4E, 0x12, 0x39, 0xFD, 0xB4, 0x73, 0x50, 0xAC, 0x80, 0xCD, 0xB6, 0x7C, 0x5A, 0xA7, 0x45, 0x4D, 0x66, 0x58, 0x7D, 0x26, 0x1C, 0xEA, 0xE6, 0x87, 0xEB, 0x0F, 0x66, 0xB6 }, 70 },
+    { 1, { 0xFD, 0x4F, 0xB2, 0x4C, 0xEE, 0xF2, 0x48, 0x63, 0x47, 0x1B, 0x23, 0xE2, 0x6B, 0x0F, 0xB8, 0xED, 0x83, 0xB4, 0xDD, 0x2B, 0x94, 0x95, 0x8C, 0xBC, 0xC5, 0xE9, 0xDB, 0xFC, 0x08, 0x04, 0xA5, 0x74 }, { 0x02, 0x20, 0x22, 0xB1, 0x12, 0x8A, 0x07, 0x4B, 0x3F, 0x23, 0x58, 0x51, 0x1F, 0x8E, 0xB5, 0x33, 0xA5, 0x3C, 0x40, 0x9F, 0x34, 0x4E, 0x49, 0xBE, 0xD6, 0xCC, 0xF7, 0x3A, 0x2C, 0x3D, 0xB6, 0xBE, 0xE8, 0x47, 0x02, 0x21, 0x00, 0xBD, 0x15, 0xD4, 0xB3, 0xD9, 0xE3, 0xD8, 0x55, 0x1A, 0xF5, 0xED, 0x9B, 0x7B, 0x0F, 0x08, 0x5E, 0xE6, 0x93, 0xB0, 0x47, 0x08, 0x71, 0x47, 0xC5, 0x39, 0xBD, 0x31, 0xA8, 0xCA, 0x96, 0x9A, 0xDF }, 69 },
+    { 0, { 0x72, 0xA0, 0x0C, 0xCE, 0x4D, 0x7F, 0x4F, 0x8E, 0xD2, 0x05, 0x7A, 0x61, 0xDD, 0x37, 0xD9, 0x1F, 0xEA, 0x67, 0xA1, 0xC6, 0x04, 0x77, 0xCC, 0x49, 0xA3, 0xD0, 0x6E, 0xF8, 0x8A, 0x19, 0xA6, 0xED }, { 0x02, 0x21, 0x00, 0x82, 0xD3, 0xDE, 0x18, 0xE1, 0xE6, 0x68, 0x6D, 0x62, 0xD9, 0xC5, 0xB3, 0x16, 0x6C, 0x7B, 0x39, 0xD7, 0xEC, 0x75, 0x46, 0x59, 0x62, 0x38, 0xF6, 0xBC, 0x64, 0x57, 0x0F, 0xC9, 0x9B, 0x8C, 0x11, 0x02, 0x20, 0x06, 0x36, 0x1D, 0xE9, 0xE9, 0xD4, 0xE2, 0xA0, 0xA5, 0x20, 0x5F, 0x30, 0xF7, 0xB3, 0x7F, 0xA7, 0xD9, 0x37, 0xD0, 0x69, 0x20, 0x0C, 0xD8, 0x62, 0x2A, 0xA6, 0x1F, 0x2A, 0xE0, 0x61, 0x1D, 0xD8 }, 69 },
+    { 1, { 0xFE, 0xC5, 0x46, 0x2B, 0x61, 0x63, 0x6A, 0x1C, 0xDB, 0xC6, 0xEC, 0x2F, 0x14, 0x87, 0xCA, 0x8C, 0x74, 0x03, 0xE8, 0x74, 0x23, 0x55, 0xB9, 0x2C, 0x72, 0xAE, 0x03, 0x23, 0xFF, 0x6C, 0xE1, 0xC7 }, { 0x02, 0x21, 0x00, 0x8B, 0x8B, 0x78, 0x60, 0xAC, 0xDB, 0x58, 0x5B, 0x81, 0xCF, 0xF6, 0xE7, 0xB6, 0x6F, 0xD8, 0xD1, 0x27, 0x7C, 0xC2, 0x65, 0xDE, 0xCB, 0x31, 0x7E, 0x5D, 0x49, 0xCB, 0xF7, 0xBB, 0x85, 0xE1, 0x57, 0x02, 0x21, 0x00, 0xAC, 0x77, 0x08, 0x45, 0xAE, 0x38, 0x8D, 0x45, 0xB0, 0x17, 0xE9, 0x0A, 0x23, 0x44, 0x84, 0xBF, 0xB4, 0xE3, 0xF9, 0x88, 0xE7, 0x9C, 0x3F, 0xF2, 0x38, 0x68, 0x88, 0xF9, 0x61, 0x9A, 0xC4, 0x84 }, 70 },
+    { 0, { 0x36, 0xB2, 0xDB, 0x5F, 0x14, 0xBE, 0xA4, 0xA3, 0x19, 0x33, 0x70, 0x25, 0x6B, 0x4A, 0x8E, 0xDE, 0xEC, 0xD9, 0x8D, 0x69, 0x56, 0x99, 0x19, 0x42, 0x8E, 0x3F, 0xEB, 0x04, 0xAF, 0x6E, 0x90, 0xD7 }, { 0x02, 0x20, 0x70, 0xEE, 0x70, 0x2A, 0xC9, 0x5B, 0xFE, 0x0B, 0x7E, 0xCE, 0x1F, 0x5D, 0x18, 0xA6, 0x0B, 0x0A, 0xCE, 0x21, 0xB1, 0xE2, 0xE4, 0x34, 0x83, 0xA7, 0xCB, 0x8D, 0x94, 0x1B, 0xAC, 0xD1, 0x7A, 0xE1, 0x02, 0x21, 0x00, 0xB5, 0xD6, 0xB5, 0x16, 0xB5, 0xFE, 0x11, 0xE1, 0x78, 0x28, 0x9C, 0x02, 0x9C, 0xA2, 0x19, 0xCE, 0xC4, 0x18, 0x87, 0x00, 0xCF, 0x8F, 0x28, 0xDD, 0x52, 0x0E, 0xD9, 0xB3, 0x34, 0x3F, 0xBC, 0x2F }, 69 },
+    { 1, { 0xF3, 0xB1, 0xF5, 0x68, 0x4F, 0x29, 0x5E, 0xAD, 0xD3, 0xC8, 0x06, 0xB3, 0x53, 0xCD, 0x54, 0xB2, 0x71, 0x22, 0x2F, 0x37, 0x33, 0x43, 0x92, 0xAD, 0x9F, 0xE2, 0x40, 0x46, 0xFD, 0xD7, 0xE7, 0xD2 }, { 0x02, 0x21, 0x00, 0x9B, 0x04, 0x67, 0x6B, 0xF8, 0x80, 0x0F, 0xEC, 0x84, 0x3F, 0x7D, 0x45, 0xBC, 0xDF, 0xC8, 0x79, 0x4F, 0xA3, 0xBF, 0x2A, 0xC8, 0x01, 0xB2, 0xF4, 0x27, 0x70, 0xCB, 0x71, 0x74, 0xFC, 0xD3, 0xC5, 0x02, 0x20, 0x2E, 0x54, 0x34, 0xC7, 0x04, 0x8D, 0xCC, 0x9A, 0xAD, 0x73, 0x99, 0x68, 0x51, 0x88, 0xD3, 0x7A, 0x85, 0x49, 0x58, 0xB8, 0x4F, 0x1E, 0xCB, 0x2B, 0xD2, 0x63, 0x10, 0x6B, 0xA7, 0x47, 0xE6, 0xFC }, 69 },
+    { 0, { 0x84, 0xC8, 0x09, 0xED, 0x45, 0xD3, 0xD6, 0x60, 0xEB, 0x13, 0x54, 0xFD, 0x3C, 0x20, 0x69, 0x3C, 0x04, 0xB5, 0x80, 0x3D, 0x7D, 0x42, 0x96, 0x03, 0x78, 0x14, 0x36, 0x04, 0x10, 0x50, 0x6F, 0x52 }, { 0x02, 0x21, 0x00, 0x96, 0x0B, 0x9F, 0x44, 0x85, 0x3D, 0xFE, 0xF6, 0xCB, 0xE5, 0x35, 0x54, 0x25, 0x27, 0xF8, 0x8D, 0xEF, 0x00, 0xFB, 0x34, 0x26, 0xF8, 0x54, 0x58, 0x35, 0x0A, 0xE2, 0x4B, 0xE0, 0xCC, 0x6D, 0x06, 0x02, 0x21, 0x00, 0xEB, 0x6B, 0x9E, 0x8F, 0xFD, 0xD3, 0x87, 0x3D, 0xDA, 0x42, 0xFF, 0x1C, 0x18, 0xF8, 0xBE, 0xDC, 0xB4, 0x95, 0xB4, 0x14, 0x43, 0x5C, 0x3B, 0xE7, 0xD4, 0x73, 0x99, 0x69, 0xC4, 0x8F, 0x42, 0xCA }, 70 },
+    { 1, { 0x17, 0x2D, 0x11, 0xE0, 0x43, 0x76, 0x29, 0xA5, 0xB6, 0x79, 0x68, 0x4E, 0xB6, 0x41, 0xC0, 0x89, 0x02, 0x52, 0xA0, 0x6F, 0x81, 0x72, 0x6F, 0x20, 0x82, 0xEE, 0x59, 0xDB, 0x03, 0x09, 0x3D, 0xD6 }, { 0x02, 0x21, 0x00, 0xE5, 0xBA, 0x82, 0x29, 0x9A, 0x34, 0xD8, 0x83, 0x6E, 0x9B, 0xF7, 0xF5, 0x81, 0x9A, 0x8D, 0xB5, 0x94, 0xA2, 0x96, 0xCA, 0xD1, 0xE5, 0x17, 0xDF, 0x90, 0x93, 0x81, 0x84, 0x7E, 0x40, 0x8E, 0xEC, 0x02, 0x20, 0x5E, 0xE4, 0x10, 0x2E, 0x34, 0x9B, 0x10, 0x76, 0x6B, 0xA9, 0xB2, 0x6A, 0x0A, 0x9C, 0x53, 0xBE, 0x0A, 0x5F, 0xF3, 0x48, 0xC8, 0x43, 0xE2, 0x62, 0x93, 0x07, 0xEE, 0xA3, 0x9B, 0x97, 0x01, 0x93 }, 69 },
+    { 0, { 0x13, 0x74, 0xBB, 0x73, 0x9D, 0xE9, 0x44, 0xB3, 0xB3, 0xA8, 0xC6, 0xF2, 0xDB, 0x34, 0xD9, 0x3C, 0x16, 0x03, 0x84, 0x7C, 0x84, 0x55, 0x87, 0x0F, 0x5A, 0x56, 0x20, 0xD5, 0x42, 0x99, 0xFB, 0x8F }, { 0x02, 0x21, 0x00, 0xF4, 0x4A, 0x7F, 0x8A, 0xC6, 0xDD, 0x46, 0x3A, 0x88, 0xF0, 0xBB, 0xEE, 0x70, 0xC1, 0xA6, 0x5C, 0xD0, 0x18, 0x81, 0x1E, 0x38, 0x8E, 0x59, 0xBF, 0x4A, 0xE8, 0xE9, 0x83, 0x14, 0xC6, 0xB6, 0xDC, 0x02, 0x21, 0x00, 0x81, 0x32, 0xAD, 0x78, 0xD2, 0x46, 0x11, 0x4C, 0x75, 0xBE, 0x97, 0x90, 0x41, 0xF0, 0xF8, 0xC6, 0xFC, 0xF6, 0xE2, 0x5C, 0x28, 0x70, 0x4F, 0x21, 0xD3, 0x56, 0x50, 0x96, 0x5E, 0x34, 0x2F, 0x09 }, 70 },
+    { 1, { 0xE5, 0x49, 0x6E, 0x2A, 0x49, 0x7D, 0xD0, 0x8C, 0x39, 0x4B, 0x7F, 0x3C, 0x55, 0x5C, 0xB6, 0x44, 0x52, 0xD2, 0x5C, 0x6D, 0xF5, 0x41, 0x4F, 0x21, 0x49, 0x6C, 0x92, 0xE5, 0xC9, 0xF3, 0x3D, 0x78 }, { 0x02, 0x20, 0x64, 0x2C, 0x74, 0x62, 0x27, 0x62, 0x65, 0x34, 0x1E, 0x44, 0x71, 0x89, 0x2E, 0x62, 0x56, 0x55, 0x4C, 0xE2, 0x8E, 0xD8, 0x8B, 0x3F, 0xF6, 0x65, 0xBF, 0x5A, 0x33, 0xE2, 0x0F, 0x63, 0x56, 0x0C, 0x02, 0x20, 0x48, 0x8C, 0xFC, 0x46, 0x60, 0x85, 0x63, 0x74, 0x6E, 0xD3, 0x42, 0xC4, 0xAC, 0x42, 0xF4, 0x3B, 0x2C, 0x20, 0xAF, 0x9B, 0xB9, 0xCB, 0xA7, 0xF1, 0x6D, 0x34, 0x21, 0xE7, 0x91, 0x78, 0x36, 0x12 }, 68 },
+    { 0, { 0x2C, 0xC0, 0x11, 0x42, 0x26, 0x2F, 0x5C, 0xE9, 0x6E, 0x16, 0xDD, 0xAD, 0xF9, 0x2C, 0x2C, 0xD7, 0xDD, 0xF1, 0xBE, 0x33, 0x3F, 0x5D, 0x26, 0xEE, 0x32, 0xEB, 0xD6, 0x79, 0x07, 0xB6, 0x0A, 0xA7 }, { 0x02, 0x21, 0x00, 0x9F, 0xC2, 0x8D, 0xA8, 0x4D, 0x14, 0x58, 0x99, 0x34, 0x1C, 0x73, 0xCF, 0xA9, 0x6B, 0x9F, 0xFE, 0x28, 0x72, 0xB2, 0xD0, 0xD6, 0xAA, 0x0A, 0x06, 0xEC, 0x5B, 0x00, 0x60, 0x83, 0xF3, 0x67, 0x74, 0x02, 0x21, 0x00, 0xE9, 0x04, 0xD7, 0xD2, 0x45, 0x28, 0xCE, 0x1F, 0x2A, 0xA3, 0x98, 0x18, 0xAF, 0x9C, 0x45, 0x74, 0xD1, 0x30, 0x70, 0x5E, 0x4F, 0x42, 0x7B, 0x23, 0x5E, 0x1D, 0x81, 0x66, 0x1F, 0x97, 0xC0, 0x59 }, 70 },
+    { 1, { 0x45, 0x8D, 0xCD, 0xDF, 0x62, 0x36, 0xA8, 0xDB, 0x9F, 0xAA, 0x20, 0x62, 0xBA, 0xCB, 0x52, 0xB5, 0x23, 0x7B, 0x57, 0xB3, 0x1E, 0x6A, 0x99, 0x96, 0x9A, 0x20, 0x49, 0x42, 0x8F, 0xF5, 0x94, 0x7B }, { 0x02, 0x21, 0x00, 0xD3, 0xA2, 0xB1, 0xD2, 0xDF, 0x08, 0x7F, 0x79, 0x8D, 0x08, 0x0C, 0xF4, 0xE9, 0xE3, 0xDE, 0xE0, 0x46, 0x93, 0x53, 0x8E, 0x9D, 0x86, 0xD1, 0x41, 0x67, 0x29, 0xE5, 0x14, 0x91, 0x90, 0xFF, 0x29, 0x02, 0x21, 0x00, 0xA1, 0x90, 0x10, 0x8D, 0x31, 0x97, 0xA2, 0xBA, 0x25, 0xE2, 0x20, 0x88, 0xB8, 0x9D, 0x4A, 0xCE, 0xDF, 0x5E, 0x1A, 0x85, 0x10, 0x7D, 0x3B, 0x16, 0xD9, 0x52, 0x10, 0x69, 0x00, 0x5D, 0x74, 0xFB }, 70 },
+    { 0, { 0xCC, 0x6D, 0x96, 0x45, 0x8C, 0xFD, 0xE1, 0x01, 0xFD, 0xC9, 0xEB, 0xE0, 0xD4, 0xF0, 0x2B, 0x8C, 0x2F, 0x6D, 0xCA, 0xE4, 0x13, 0xA3, 0x0F, 0x10, 0xE3, 0xD0, 0x80, 0x58, 0x25, 0x92, 0xD5, 0xF3 }, { 0x02, 0x20, 0x0D, 0xF5, 0x0F, 0x19, 0x53, 0x69, 0x97, 0x5F, 0xBA, 0x06, 0x4D, 0xF5, 0x70, 0x75, 0x66, 0xDC, 0x28, 0x24, 0xBC, 0x51, 0xE2, 0xFC, 0xB7, 0xF1, 0x2F, 0x47, 0xEC, 0x99, 0xD2, 0x9D, 0x7A, 0x23, 0x02, 0x21, 0x00, 0xDA, 0x79, 0x87, 0xBC, 0x87, 0x72, 0x3F, 0x96, 0x78, 0xE4, 0x25, 0x71, 0xBF, 0xFF, 0x86, 0xB6, 0x03, 0xA0, 0x56, 0x50, 0x50, 0xBB, 0xAC, 0x0B, 0x65, 0x33, 0x03, 0xE9, 0x4F, 0x17, 0xDB, 0x76 }, 69 },
+    { 1, { 0xC8, 0x20, 0xB6, 0xC2, 0x55, 0x47, 0xEF, 0xEC, 0xC1, 0x22, 0x8C, 0x6A, 0xE8, 0x86, 0xC9, 0x16, 0xF8, 0x4A, 0x05, 0xBD, 0xBC, 0xE1, 0x57, 0x85, 0x54, 0x80, 0x25, 0x9B, 0xDA, 0x37, 0x5E, 0x17 }, { 0x02, 0x20, 0x77, 0xBF, 0x4B, 0xF0, 0xB7, 0x1D, 0x72, 0xAD, 0x73, 0x02, 0x28, 0x45, 0x7A, 0xCD, 0x8A, 0x90, 0x19, 0x9A, 0x84, 0x14, 0x35, 0x84, 0xF9, 0x4F, 0x08, 0xA6, 0x08, 0x5E, 0xBB, 0x6D, 0xB0, 0x96, 0x02, 0x21, 0x00, 0xE0, 0x49, 0xAD, 0xDB, 0xB4, 0xAD, 0x0A, 0x89, 0x24, 0x31, 0xF4, 0xE8, 0x43, 0xC2, 0x4F, 0x80, 0xEC, 0x87, 0x50, 0xF6, 0x18, 0x39, 0x8A, 0x55, 0x7D, 0xBD, 0xAE, 0xF8, 0x28, 0xA8, 0xB3, 0xA7 }, 69 },
+    { 0, { 0x9D, 0xD7, 0x2C, 0xD6, 0x7C, 0x1E, 0xF9, 0xC3, 0xF2, 0x7A, 0x2C, 0xFB, 0x19, 0xD0, 0x18, 0x61, 0x08, 0x03, 0x7E, 0x1E, 0x78, 0xDE, 0x8C, 0x51, 0x6C, 0x66, 0xB9, 0xEF, 0x01, 0x8F, 0xD9, 0xF4 }, { 0x02, 0x21, 0x00, 0xFA, 0x12, 0xF2, 0x8F, 0xF2, 0x30, 0x5B, 0xDA, 0x0F, 0x14, 0x39, 0x48, 0xA1, 0x1F, 0x97, 0x8F, 0x9A, 0x49, 0xF5, 0x48, 0x59, 0xC0, 0xFB, 0xCB, 0xBB, 0xC4, 0x86, 0x8C, 0x2C, 0x01, 0x64, 0x90, 0x02, 0x20, 0x6A, 0x91, 0xCE, 0x68, 0x59, 0x67, 0x1F, 0xB7, 0x1D, 0x90, 0x0D, 0xE1, 0x34, 0xF2, 0xAF, 0x4B, 0xAE, 0x3F, 0x65, 0x6A, 0xEC, 0x08, 0x72, 0xD3, 0x40, 0xD9, 0x73, 0x13, 0x78, 0x12, 0xA9, 0x69 }, 69 },
+    { 1, { 0x35, 0xA8, 0xD8, 0x65, 0x1C, 0xD5, 0xA9, 0xD5, 0x4F, 0x07, 0x56, 0x39, 0xBD, 0x85, 0x32, 0x87, 0x8B, 0x64, 0x5D, 0x98, 0x0B, 0x3A, 0x1F, 0x0C, 0x5F, 0x96, 0x13, 0x1F, 0xAA, 0x49, 0x1E, 0x3C }, { 0x02, 0x20, 0x19, 0xCD, 0xDD, 0x62, 0xDD, 0x84, 0x1A, 0x46, 0xE4, 0xBE, 0x2D, 0x73, 0xAC, 0x49, 0xB4, 0xA7, 0x7B, 0x3C, 0xE3, 0x33, 0x73, 0x7C, 0xAA, 0xDD, 0x91, 0x0F, 0x86, 0x59, 0xA7, 0xEF, 0xE6, 0xA5, 0x02, 0x21, 0x00, 0xD7, 0xA8, 0x96, 0xD4, 0xA6, 0x5F, 0x85, 0x8C, 0xB9, 0xB2, 0x15, 0x48, 0x87, 0x4F, 0x53, 0x64, 0xDF, 0x28, 0x8E, 0xCA, 0xFF, 0x0C, 0xDF, 0x7D, 0x66, 0xDB, 0x85, 0xEC, 0x81, 0xE4, 0x1B, 0xDB }, 69 },
+    { 0, { 0x96, 0xCD, 0x09, 0x95, 0xAA, 0xDC, 0xED, 0x35, 0xA6, 0x46, 0x2D, 0x78, 0xA2, 0x46, 0x6C, 0x53, 0xCD, 0x35, 0x32, 0x9A, 0x3A, 0x45, 0xBD, 0xDB, 0xDD, 0x54, 0x29, 0x19, 0x5B, 0x8B, 0xC5, 0xEB }, { 0x02, 0x21, 0x00, 0xEB, 0x67, 0x72, 0xFF, 0x57, 0x78, 0xE3, 0xF5, 0x73, 0x05, 0xFE, 0xB3, 0xEF, 0xC2, 0x54, 0x11, 0x74, 0x58, 0x8A, 0xBA, 0xC9, 0xD5, 0x55, 0x2E, 0x73, 0x09, 0x99, 0x69, 0x1B, 0x0D, 0x3D, 0xF1, 0x02, 0x20, 0x31, 0x94, 0xDC, 0xB6, 0xE0, 0x71, 0xBE, 0x98, 0x01, 0xBF, 0xFA, 0x69, 0x95, 0x13, 0x74, 0x30, 0x18, 0x21, 0x4E, 0xD7, 0xF1, 0x87, 0xFB, 0xD0, 0x2A, 0xF4, 0xC0, 0x9C, 0xEC, 0x30, 0x8B, 0x7D }, 69 },
+    { 1, { 0x88, 0xB4, 0xBA, 0x48, 0xC3, 0x27, 0xAD, 0x31, 0xB5, 0x52, 0x1D, 0x62, 0x69, 0x3E, 0x4C, 0xE8, 0x49, 0xAC, 0x0D, 0xAB, 0xFC, 0x9E, 0xB8, 0xC8, 0x96, 0x75, 0x1B, 0xCD, 0xD5, 0x28, 0x76, 0x1F }, { 0x02, 0x20, 0x0E, 0xC0, 0x3C, 0x4E, 0x48, 0xDA, 0x4A, 0xE4, 0x7E, 0xB8, 0xDD, 0xE0, 0x13, 0xDC, 0x61, 0x57, 0xE4, 0xF8, 0xE5, 0xA3, 0xC4, 0x0F, 0xE3, 0x12, 0x78, 0x82, 0x65, 0xD8, 0x30, 0x73, 0x70, 0x57, 0x02, 0x21, 0x00, 0x8C, 0xE2, 0x8A, 0x66, 0xB1, 0xEB, 0x43, 0x45, 0xF2, 0x6D, 0x63, 0x5C, 0xC9, 0xDE, 0xE4, 0x65, 0x6E, 0xB3, 0x2D, 0x84, 0xF1, 0x50, 0xCA, 0xF9, 0x60, 0x21, 0xF6, 0x1F, 0x70, 0x7C, 0x52, 0xCD }, 69 },
+    { 0, { 0xA6, 0x55, 0x86, 0xB9, 0xD8, 0x55, 0x1E, 0x1C, 0xA4, 0x14, 0x94, 0x23, 0xFF, 0x43, 0x11, 0x8D, 0x67, 0x99, 0x9F, 0x17, 0xD5, 0x38, 0xF5, 0x7D, 0x10, 0xD1, 0x82, 0x6B, 0x14, 0x29, 0x13, 0xD0 }, { 0x02, 0x20, 0x46, 0x3F, 0x7B, 0x29, 0xE2, 0xC0, 0xCC, 0x6A, 0xD2, 0x6A, 0xB9, 0xE3, 0x64, 0x12, 0xA7, 0xB2, 0x05, 0xDC, 0x9A, 0x65, 0x5A, 0x06, 0xCD, 0xFF, 0xD9, 0x8B, 0x96, 0xAE, 0xEF, 0xF5, 0x4C, 0x28, 0x02, 0x20, 0x28, 0x49, 0xDC, 0x86, 0xC2, 0xAF, 0xA6, 0xDA, 0x24, 0x91, 0x10, 0xAC, 0xA1, 0x9F, 0xF7, 0x7B, 0x2B, 0x1B, 0xBA, 0xA8, 0x74, 0x37, 0x27, 0x62, 0xAE, 0xE6, 0x93, 0x09, 0xA8, 0xDB, 0xF9, 0x10 }, 68 },
+    { 1, { 0x7E, 0xC6, 0x93, 0xA7, 0x77, 0xF6, 0x0F, 0x32, 0x09, 0xDA, 0xCE, 0x58, 0x5A, 0x89, 0x15, 0x1C, 0xF9, 0x71, 0xC6, 0x8A, 0x1C, 0x46, 0xE4, 0x8D, 0xA4, 0x07, 0xAE, 0xD3, 0xEF, 0xF4, 0x85, 0x00 }, { 0x02, 0x21, 0x00, 0xE8, 0x4C, 0x0D, 0x1B, 0xB9, 0xC3, 0x56, 0x38, 0xC4, 0x20, 0x5D, 0x8D, 0x6A, 0x1C, 0x7D, 0xE6, 0x3C, 0xEC, 0x1D, 0xB2, 0xA7, 0x2E, 0xC4, 0xB5, 0x75, 0xE2, 0xA3, 0x60, 0xF6, 0xF7, 0x49, 0x51, 0x02, 0x21, 0x00, 0xC7, 0x42, 0xBE, 0x08, 0x0C, 0x96, 0x3C, 0x3D, 0x50, 0xFC, 0xE1, 0x42, 0xB4, 0xED, 0xE0, 0xA8, 0x3F, 0x63, 0x27, 0xC9, 0x7C, 0xF4, 0x25, 0x49, 0xD1, 0xD8, 0xD2, 0xC4, 0x45, 0x6F, 0xA4, 0xE1 }, 70 },
+    { 0, { 0xBC, 0x8A, 0x07, 0xCA, 0x41, 0x00, 0xE1, 0xBC, 0xC4, 0x39, 0xF3, 0x50, 0x3B, 0x4E, 0x82, 0xF6, 0x45, 0x57, 0xCC, 0x55, 0x87, 0x67, 0x25, 0x84, 0xBE, 0x34, 0x54, 0x25, 0xE5, 0xAD, 0xA9, 0x79 }, { 0x02, 0x20, 0x35, 0xE3, 0xC5, 0xCD, 0x10, 0x03, 0x42, 0x45, 0x17, 0x0E, 0x48, 0x6A, 0x65, 0xE1, 0x0C, 0xCD, 0x9C, 0x75, 0x60, 0x00, 0x3A, 0x1B, 0x1E, 0xAF, 0x28, 0xC7, 0xBE, 0x98, 0x69, 0x10, 0x3A, 0x50, 0x02, 0x21, 0x00, 0xED, 0x4C, 0xFF, 0x6F, 0x37, 0xBA, 0xDB, 0x96, 0x1A, 0x56, 0xA3, 0x65, 0xCD, 0xD2, 0x52, 0x37, 0xF2, 0x28, 0x06, 0xA5, 0x24, 0x09, 0xBB, 0x81, 0xC5, 0x63, 0xAE, 0x7D, 0x60, 0x66, 0x0D, 0x3C }, 69 },
+    { 1, { 0x16, 0xE3, 0x9A, 0xE0, 0x00, 0x15, 0x1B, 0x33, 0x0D, 0xF0, 0xC4, 0xE7, 0x5D, 0x90, 0x94, 0x29, 0xC2, 0x55, 0x68, 0x0B, 0xA6, 0x89, 0x8E, 0x98, 0x09, 0x14, 0x6F, 0x77, 0xEE, 0xFD, 0x4C, 0xBA }, { 0x02, 0x20, 0x09, 0x2D, 0x82, 0xAF, 0x63, 0xF2, 0x9D, 0x8D, 0x2F, 0x3E, 0xE2, 0xFD, 0x2B, 0x62, 0x6E, 0x4B, 0xBC, 0x31, 0xE8, 0x9A, 0x2A, 0x0E, 0x54, 0x72, 0x89, 0xBD, 0x50, 0x6F, 0x38, 0x13, 0xB1, 0xDC, 0x02, 0x20, 0x6D, 0x4D, 0xB8, 0x15, 0x7E, 0x48, 0x5B, 0xF7, 0xA0, 0x15, 0x80, 0x78, 0x1F, 0xE3, 0x06, 0xC1, 0x0B, 0x94, 0x00, 0xBC, 0xC7, 0x90, 0x0C, 0x54, 0xDC, 0xC1, 0xED, 0xF4, 0x79, 0x59, 0x33, 0x9E }, 68 },
+    { 0, { 0x0E, 0xD6, 0xE5, 0xF7, 0xE9, 0x6D, 0x87, 0x88, 0x12, 0xE9, 0x00, 0x23, 0xFD, 0x31, 0x36, 0xF9, 0xAC, 0x26, 0xD8, 0xAA, 0x09, 0x5A, 0xC9, 0x9C, 0x33, 0x89, 0x8B, 0xBD, 0x65, 0xC1, 0xB4, 0xB7 }, { 0x02, 0x20, 0x51, 0xDF, 0x12, 0xB8, 0xA4, 0x70, 0x21, 0xD3, 0xF8, 0x1F, 0x8A, 0xE0, 0x28, 0x1E, 0xA0, 0xF8, 0xF6, 0xD3, 0x4E, 0x16, 0xF0, 0x15, 0xE5, 0x6B, 0xC6, 0xDC, 0xFA, 0xF1, 0x12, 0x75, 0xD1, 0x7A, 0x02, 0x20, 0x67, 0x1F, 0x42, 0xA7, 0x6B, 0xE6, 0xB8, 0x3F, 0x17, 0x3C, 0xC6, 0x99, 0x91, 0xC2, 0x25, 0x11, 0x87, 0xAE, 0x88, 0xF0, 0x61, 0xC2, 0xAE, 0xA1, 0x3C, 0x41, 0x72, 0x18, 0xB1, 0x88, 0x02, 0x0C }, 68 },
+    { 1, { 0x89, 0xDA, 0xED, 0xB0, 0xBD, 0x11, 0xF7, 0x3D, 0x9B, 0x88, 0xF5, 0xCE, 0xAE, 0x92, 0x8C, 0x40, 0xAE, 0xD3, 0xE0, 0xCC, 0x99, 0x9E, 0xF6, 0xB3, 0x3B, 0x55, 0x25, 0xB8, 0x4C, 0xF7, 0xC0, 0xFC }, { 0x02, 0x21, 0x00, 0xB3, 0x16, 0xD8, 0x78, 0xBE, 0xC6, 0xEE, 0x7C, 0xC3, 0x2B, 0x0B, 0xD3, 0xDF, 0x67, 0xC9, 0x37, 0x21, 0xD4, 0x47, 0xF3, 0xCD, 0xE8, 0x61, 0x73, 0x68, 0xF7, 0xA2, 0xBA, 0xDD, 0xA6, 0x7C, 0x66, 0x02, 0x21, 0x00, 0xFC, 0xB1, 0xE1, 0x91, 0x92, 0xB3, 0x5F, 0x4D, 0x72, 0x76, 0xE4, 0x43, 0xAC, 0x0D, 0xBA, 0x41, 0xCA, 0xDA, 0x9A, 0x94, 0x31, 0x4C, 0x6B, 0x90, 0xAE, 0xD8, 0xD1, 0x1B, 0xBE, 0x9B, 0x9A, 0x7E }, 70 },
+    { 0, { 0xFC, 0xCF, 0xAD, 0x21, 0xAD, 0xF6, 0xB7, 0xDD, 0xAC, 0x9C, 0x56, 0x96, 0xA4, 0x16, 0x1D, 0x98, 0xB4, 0x83, 0x30, 0xD9, 0xFE, 0x0F, 0xCC, 0xE7, 0x43, 0xD7, 0x7E, 0x37, 0xFE, 0x6B, 0x70, 0xDD }, { 0x02, 0x21, 0x00, 0xA4, 0xDC, 0x4C, 0x2F, 0x6D, 0xFC, 0xEC, 0x5B, 0xFA, 0x35, 0x8E, 0x69, 0x6E, 0xB9, 0x13, 0xFB, 0x41, 0x3D, 0x8C, 0xB0, 0x38, 0x85, 0x58, 0x76, 0x48, 0x2B, 0x43, 0x27, 0x6D, 0xA6, 0x76, 0x88, 0x02, 0x21, 0x00, 0xD3, 0x61, 0x22, 0x53, 0x8D, 0xFC, 0x02, 0xC1, 0xE0, 0x29, 0x67, 0x43, 0x9F, 0x0B, 0x1D, 0xA6, 0x47, 0xD0, 0x9D, 0x98, 0x9C, 0x34, 0x7A, 0x97, 0xCA, 0x0C, 0xE6, 0xD9, 0x8E, 0x18, 0x7D, 0x4B }, 70 },
+    { 1, { 0xB6, 0x76, 0x86, 0xEA, 0x3D, 0x83, 0x9B, 0xD8, 0x06, 0xB2, 0x22, 0x97, 0x78, 0x04, 0x8C, 0x36, 0x73, 0xC7, 0x0D, 0x35, 0x21, 0x88, 0x78, 0xC4, 0x74, 0xB0, 0x9A, 0xEE, 0xF5, 0xFD, 0x77, 0xB8 }, { 0x02, 0x21, 0x00, 0xF6, 0xF3, 0x39, 0x19, 0xD8, 0x5F, 0x1E, 0xD0, 0x95, 0x99, 0xF0, 0xB3, 0x0E, 0x13, 0x9D, 0x39, 0xB7, 0x9A, 0xC5, 0x34, 0xF0, 0xD6, 0x2A, 0x52, 0x94, 0xDF, 0xA9, 0x59, 0x7D, 0x22, 0x17, 0xE7, 0x02, 0x20, 0x74, 0xC5, 0x9D, 0x4F, 0x9F, 0x6C, 0xFA, 0x53, 0x47, 0x2C, 0xA1, 0x20, 0xF9, 0x84, 0x72, 0x67, 0xD8, 0x84, 0xF9, 0x0A, 0xD1, 0xB1, 0x22, 0xA6, 0x85, 0x09, 0xF5, 0x45, 0xB9, 0x10, 0xF2, 0x4B }, 69 },
+    { 0, { 0x95, 0x2B, 0xD0, 0xFF, 0x5D, 0xFD, 0xD3, 0xD2, 0xB0, 0xB9, 0xF1, 0x1F, 0xE5, 0xAC, 0x0C, 0x34, 0x5E, 0x7E, 0xD4, 0x7D, 0x4C, 0x37, 0x83, 0x2B, 0xC8, 0xB6, 0x71, 0x46, 0xCC, 0x84, 0x63, 0x08 }, { 0x02, 0x20, 0x4A, 0x1F, 0xF2, 0x51, 0x31, 0x00, 0x27, 0x30, 0x7D, 0x67, 0x4E, 0x91, 0x5F, 0x2C, 0x20, 0x20, 0x53, 0x64, 0x18, 0x94, 0x73, 0x03, 0x08, 0xA1, 0x43, 0x17, 0xAA, 0x65, 0x25, 0x0C, 0x93, 0x89, 0x02, 0x21, 0x00, 0xC9, 0xC4, 0x42, 0x59, 0x11, 0xA4, 0x54, 0x19, 0x5C, 0xA5, 0xFD, 0xDA, 0x39, 0xDB, 0x3F, 0x41, 0x54, 0x87, 0x2B, 0x1B, 0x39, 0x21, 0x94, 0xB6, 0xBA, 0x80, 0xC4, 0xA4, 0x86, 0xC4, 0xF6, 0x4B }, 69 },
+    { 1, { 0xC7, 0xB7, 0x3C, 0x49, 0x36, 0xB3, 0x41, 0x43, 0x1B, 0x99, 0x6B, 0xD8, 0xD2, 0x3A, 0x52, 0x44, 0x54, 0xE0, 0x96, 0x9C, 0x67, 0xD4, 0xCD, 0x49, 0xE8, 0x1D, 0x29, 0x41, 0x5F, 0xCF, 0x1A, 0xAB }, { 0x02, 0x21, 0x00, 0x82, 0xDA, 0xC9, 0x12, 0xC2, 0x8C, 0x5D, 0x44, 0x0A, 0xED, 0x77, 0xD6, 0x64, 0xF9, 0xF2, 0x09, 0x5B, 0x70, 0x2D, 0x05, 0x74, 0xB6, 0x85, 0x96, 0xC5, 0x7A, 0x92, 0xAA, 0xFC, 0xC5, 0xC4, 0x21, 0x02, 0x21, 0x00, 0x85, 0xAB, 0x17, 0xD3, 0xBA, 0xF9, 0xBE, 0x0D, 0xFE, 0xB7, 0xE7, 0x4F, 0x6E, 0x1B, 0xC1, 0xC2, 0x29, 0x57, 0x8A, 0x49, 0xFE, 0x3C, 0xCC, 0x4E, 0xD6, 0xB9, 0x87, 0x57, 0xD3, 0xA6, 0xBF, 0x8B }, 70 },
+    { 0, { 0x95, 0x89, 0xBF, 0x6E, 0x6A, 0xB3, 0x08, 0xDA, 0xBE, 0x36, 0x82, 0x21, 0x85, 0x70, 0xE5, 0x29, 0xBD, 0xA2, 0x7C, 0xB0, 0x15, 0x62, 0xF7, 0xCB, 0xDF, 0x5A, 0x73, 0x60, 0x82, 0xD0, 0x2D, 0x00 }, { 0x02, 0x20, 0x3D, 0x9C, 0x42, 0xE5, 0x09, 0xF2, 0xEB, 0x0C, 0x7C, 0xB8, 0xD8, 0x1F, 0xB1, 0x35, 0xE1, 0x10, 0x87, 0x65, 0x7A, 0x91, 0x11, 0x14, 0x17, 0x1A, 0x96, 0xC5, 0x73, 0x17, 0xB4, 0x48, 0x1B, 0x15, 0x02, 0x21, 0x00, 0x9B, 0x06, 0xF7, 0x7F, 0x81, 0x3D, 0x7A, 0x1F, 0x11, 0x45, 0xD5, 0x2E, 0x02, 0xBF, 0x51, 0x52, 0x5F, 0x9F, 0x5B, 0xEA, 0x3F, 0x9B, 0xD6, 0xF0, 0x5F, 0x78, 0x11, 0x14, 0x1D, 0x69, 0x80, 0x51 }, 69 },
+    { 1, { 0x49, 0xCF, 0x38, 0xFA, 0x34, 0xCA, 0x33, 0x3A, 0x45, 0x42, 0x34, 0xC1, 0xF1, 0x8B, 0x0B, 0x07, 0x47, 0xBB, 0xE9, 0x9F, 0xF3, 0xC5, 0x66, 0xE6, 0xD9, 0xA7, 0x26, 0xC0, 0x1F, 0x9D, 0xA5, 0x5C }, { 0x02, 0x21, 0x00, 0xA9, 0xDE, 0xC6, 0xC3, 0x58, 0x6A, 0x46, 0xF4, 0x2A, 0x19, 0xA8, 0x9E, 0x77, 0x23, 0x7D, 0x9E, 0xE8, 0x83, 0xF6, 0xC2, 0x47, 0x0A, 0x65, 0xB3, 0x87, 0xAD, 0xA3, 0x47, 0xB1, 0x6A, 0xBB, 0x4A, 0x02, 0x21, 0x00, 0xDD, 0xAF, 0xFB, 0x75, 0xA9, 0xB8, 0x38, 0x17, 0x1B, 0x6C, 0xBC, 0x87, 0xBA, 0x4D, 0xC4, 0x38, 0xFE, 0xBF, 0x38, 0xAC, 0xDE, 0x0A, 0xB4, 0x8A, 0x23, 0xEF, 0x88, 0xE1, 0x3A, 0x2C, 0x9B, 0x17 }, 70 },
+    { 0, { 0x8A, 0x57, 0x17, 0x0C, 0xD4, 0xF1, 0xF2, 0x59, 0xC4, 0x74, 0x50, 0xB2, 0xD5, 0x5A, 0xFE, 0xD0, 0x73, 0x3B, 0x9B, 0xD9, 0x71, 0x26, 0x18, 0x2B, 0x2F, 0x20, 0x0B, 0x2F, 0x8A, 0x58, 0x9A, 0x41 }, { 0x02, 0x20, 0x78, 0x42, 0x75, 0xAA, 0x4D, 0x9C, 0x13, 0x6D, 0xB0, 0x94, 0x72, 0x42, 0x93, 0x53, 0xD5, 0x9D, 0x21, 0x94, 0x17, 0x72, 0x42, 0x99, 0x1D, 0xE4, 0x18, 0x35, 0x91, 0x40, 0xC2, 0x62, 0xB8, 0x9E, 0x02, 0x20, 0x6F, 0xA5, 0x95, 0x3A, 0x0A, 0x86, 0x9E, 0x84, 0x4F, 0xD6, 0x65, 0xF7, 0x88, 0x20, 0x44, 0xC9, 0x22, 0xD2, 0x25, 0xA2, 0x22, 0x45, 0xA2, 0xAF, 0x35, 0x9F, 0xB6, 0xDF, 0xAC, 0x57, 0xBC, 0xA6 }, 68 },
+    { 1, { 0x1F, 0x3E, 0xD6, 0xFA, 0x04, 0x1A, 0x5B, 0xE3, 0x9D, 0x93, 0x85, 0x9A, 0x6F, 0x5F, 0x6F, 0x06, 0xF9, 0x21, 0x3F, 0xBF, 0xB7, 0x0B, 0xB2, 0xFA, 0x3A, 0x97, 0x23, 0x32, 0x7F, 0x08, 0x31, 0xBD }, { 0x02, 0x21, 0x00, 0xB6, 0x5B, 0xEC, 0x6B, 0x8C, 0x28, 0x6E, 0x6C, 0x4A, 0x0E, 0x64, 0x70, 0x18, 0x07, 0x16, 0x67, 0xA0, 0xFF, 0x7A, 0x29, 0x11, 0xBE, 0x70, 0xFC, 0x36, 0x92, 0xD6, 0xEA, 0xD8, 0xB2, 0x43, 0xFA, 0x02, 0x20, 0x11, 0x62, 0xD4, 0xC6, 0xE0, 0xF5, 0xAF, 0x9E, 0xD6, 0x56, 0xED, 0xD2, 0xE2, 0xC8, 0x01, 0x4B, 0x0F, 0x22, 0xB5, 0x58, 0x04, 0x4F, 0xC0, 0x17, 0x41, 0x21, 0x5A, 0xA1, 0x62, 0x40, 0x26, 0xEC }, 69 },
+    { 0, { 0xD7, 0xC7, 0x5C, 0x9E, 0x58, 0xA4, 0x97, 0x63, 0xA3, 0x0B, 0x34, 0x8C, 0x99, 0x13, 0xB0, 0x1C, 0xC9, 0x8B, 0xAA, 0x98, 0xB4, 0x4F, 0xD9, 0x09, 0xB5, 0x44, 0xBA, 0xEA, 0x06, 0xC6, 0x6C, 0x15 }, { 0x02, 0x21, 0x00, 0xFC, 0x58, 0x03, 0x4A, 0x64, 0x16, 0x26, 0x55, 0xBE, 0x3C, 0x46, 0x6C, 0x4E, 0xF6, 0xF7, 0x46, 0x9A, 0x02, 0x0E, 0xD2, 0xFF, 0x0E, 0x5F, 0x2F, 0x1D, 0x43, 0x9C, 0xDA, 0xF6, 0x04, 0x5F, 0xC9, 0x02, 0x20, 0x52, 0xC6, 0x7A, 0x31, 0xF8, 0x65, 0xF1, 0x70, 0x18, 0xDB, 0x0C, 0xDF, 0x92, 0xA1, 0x52, 0x40, 0xA0, 0x09, 0xD0, 0xC9, 0xF3, 0x70, 0x91, 0xE6, 0x21, 0x7C, 0x32, 0xDD, 0xC9, 0x23, 0x91, 0x12 }, 69 },
+    { 1, { 0x88, 0x67, 0x2B, 0xAD, 0x63, 0xD3, 0x06, 0xF2, 0x23, 0xA1, 0x3B, 0x9B, 0x5A, 0x46, 0xB6, 0x85, 0xB9, 0x59, 0x81, 0x19, 0x28, 0x96, 0x19, 0x35, 0x6E, 0x9B, 0x98, 0xE4, 0xC1, 0x06, 0x3C, 0x3F }, { 0x02, 0x20, 0x0E, 0x2F, 0xB1, 0x41, 0x76, 0xA9, 0xE9, 0xB9, 0x79, 0x13, 0x4E, 0x72, 0x09, 0x45, 0x44, 0x3D, 0xBF, 0xB7, 0x66, 0xE1, 0x2C, 0xA7, 0x39, 0xC7, 0xFE, 0x08, 0x10, 0x83, 0x1F, 0x87, 0x8A, 0x16, 0x02, 0x21, 0x00, 0xEE, 0x85, 0x1D, 0xA5, 0xEF, 0xE5, 0x54, 0x91, 0x20, 0x5D, 0x33, 0xFC, 0xE5, 0x53, 0x75, 0xFB, 0x0D, 0x05, 0x29, 0x4E, 0x10, 0xD0, 0x0F, 0x8A, 0xE4, 0xA4, 0xEB, 0xB2, 0xEB, 0xA9, 0xE7, 0x59 }, 69 },
+};
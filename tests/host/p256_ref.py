@@ -0,0 +1,112 @@
+"""Plain big integer NIST P-256 reference, used to generate the tables and the test vectors."""
+
+import hashlib
+import hmac
+
+P = 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+N = 0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551
+A = P - 3
+B = 0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B
+G = (0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5)
+
+
+def on_curve(pt):
+    x, y = pt
+    return (y * y - (x * x * x + A * x + B)) % P == 0
+
+
+def add(p1, p2):
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    if p1[0] == p2[0]:
+        if (p1[1] + p2[1]) % P == 0:
+            return None
+        lam = (3 * p1[0] * p1[0] + A) * pow(2 * p1[1], -1, P) % P
+    else:
+        lam = (p2[1] - p1[1]) * pow(p2[0] - p1[0], -1, P) % P
+    x = (lam * lam - p1[0] - p2[0]) % P
+    return (x, (lam * (p1[0] - x) - p1[1]) % P)
+
+
+def mul(k, pt):
+    res = None
+    while k:
+        if k & 1:
+            res = add(res, pt)
+        pt = add(pt, pt)
+        k >>= 1
+    return res
+
+
+def comb_table(pt):
+    """Entries 1..15 of the 4 teeth, 64 columns comb: sum of bit i of idx times 2^(64 i) pt."""
+    teeth = [mul(1 << (64 * i), pt) for i in range(4)]
+    table = []
+    for idx in range(1, 16):
+        acc = None
+        for i in range(4):
+            if idx & (1 << i):
+                acc = add(acc, teeth[i])
+        table.append(acc)
+    return table
+
+
+def bits2int(digest):
+    e = int.from_bytes(digest, 'big')
+    if len(digest) > 32:
+        e >>= 8 * (len(digest) - 32)
+    return e
+
+
+def rfc6979_k(x, h1):
+    """Deterministic nonce of RFC 6979 with HMAC-SHA256."""
+    xb = x.to_bytes(32, 'big')
+    hb = (bits2int(h1) % N).to_bytes(32, 'big')
+    v = b'\x01' * 32
+    k = b'\x00' * 32
+    k = hmac.new(k, v + b'\x00' + xb + hb, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    k = hmac.new(k, v + b'\x01' + xb + hb, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    while True:
+        v = hmac.new(k, v, hashlib.sha256).digest()
+        cand = int.from_bytes(v, 'big')
+        if 1 <= cand < N:
+            return cand
+        k = hmac.new(k, v + b'\x00', hashlib.sha256).digest()
+        v = hmac.new(k, v, hashlib.sha256).digest()
+
+
+def sign(x, digest):
+    k = rfc6979_k(x, digest)
+    r = mul(k, G)[0] % N
+    s = pow(k, -1, N) * (bits2int(digest) + r * x) % N
+    return r, s
+
+
+def verify(pub, digest, r, s):
+    if not (1 <= r < N and 1 <= s < N) or pub is None or not on_curve(pub):
+        return False
+    w = pow(s, -1, N)
+    pt = add(mul(bits2int(digest) * w % N, G), mul(r * w % N, pub))
+    return pt is not None and pt[0] % N == r
+
+
+def der_int(v):
+    b = v.to_bytes(32, 'big').lstrip(b'\x00') or b'\x00'
+    if b[0] & 0x80:
+        b = b'\x00' + b
+    return bytes([0x02, len(b)]) + b
+
+
+def optiga_signature(r, s):
+    """R and S as DER integers without the SEQUENCE header, as returned by optiga_crypt_ecdsa_sign."""
+    return der_int(r) + der_int(s)
+
+
+def optiga_public_key(pub):
+    """Uncompressed point in a DER BIT STRING, as returned by optiga_crypt_ecc_generate_keypair."""
+    return bytes([0x03, 0x42, 0x00, 0x04]) + pub[0].to_bytes(32, 'big') + pub[1].to_bytes(32, 'big')
@@ -0,0 +1,233 @@
+/* Generated by gen_p256_vectors.py, checked against the big integer reference in p256_ref.py */
+
+    { "rfc6979 sample", 0, { 0x03, 0x42, 0x00, 0x04, 0x60, 0xFE, 0xD4, 0xBA, 0x25, 0x5A, 0x9D, 0x31, 0xC9, 0x61, 0xEB, 0x74, 0xC6, 0x35, 0x6D, 0x68, 0xC0, 0x49, 0xB8, 0x92, 0x3B, 0x61, 0xFA, 0x6C, 0xE6, 0x69, 0x62, 0x2E, 0x60, 0xF2, 0x9F, 0xB6, 0x79, 0x03, 0xFE, 0x10, 0x08, 0xB8, 0xBC, 0x99, 0xA4, 0x1A, 0xE9, 0xE9, 0x56, 0x28, 0xBC, 0x64, 0xF2, 0xF1, 0xB2, 0x0C, 0x2D, 0x7E, 0x9F, 0x51, 0x77, 0xA3, 0xC2, 0x94, 0xD4, 0x46, 0x22, 0x99 }, 68, { 0xAF, 0x2B, 0xDB, 0xE1, 0xAA, 0x9B, 0x6E, 0xC1, 0xE2, 0xAD, 0xE1, 0xD6, 0x94, 0xF4, 0x1F, 0xC7, 0x1A, 0x83, 0x1D, 0x02, 0x68, 0xE9, 0x89, 0x15, 0x62, 0x11, 0x3D, 0x8A, 0x62, 0xAD, 0xD1, 0xBF }, 32, { 0x02, 0x21, 0x00, 0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40, 0xDD, 0x9C, 0xD4, 0x5E, 0x81, 0xD6, 0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA, 0xF9, 0x91, 0xC3, 0x4D, 0x0E, 0xA8, 0x4E, 0xAF, 0x37, 0x16, 0x02, 0x21, 0x00, 0xF7, 0xCB, 0x1C, 0x94, 0x2D, 0x65, 0x7C, 0x41, 0xD4, 0x36, 0xC7, 0xA1, 0xB6, 0xE2, 0x9F, 0x65, 0xF3, 0xE9, 0x00, 0xDB, 0xB9, 0xAF, 0xF4, 0x06, 0x4D, 0xC4, 0xAB, 0x2F, 0x84, 0x3A, 0xCD, 0xA8 }, 70 },
+    { "rfc6979 test", 0, { 0x03, 0x42, 0x00, 0x04, 0x60, 0xFE, 0xD4, 0xBA, 0x25, 0x5A, 0x9D, 0x31, 0xC9, 0x61, 0xEB, 0x74, 0xC6, 0x35, 0x6D, 0x68, 0xC0, 0x49, 0xB8, 0x92, 0x3B, 0x61, 0xFA, 0x6C, 0xE6, 0x69, 0x62, 0x2E, 0x60, 0xF2, 0x9F, 0xB6, 0x79, 0x03, 0xFE, 0x10, 0x08, 0xB8, 0xBC, 0x99, 0xA4, 0x1A, 0xE9, 0xE9, 0x56, 0x28, 0xBC, 0x64, 0xF2, 0xF1, 0xB2, 0x0C, 0x2D, 0x7E, 0x9F, 0x51, 0x77, 0xA3, 0xC2, 0x94, 0xD4, 0x46, 0x22, 0x99 }, 68, { 0x9F, 0x86, 0xD0, 0x81, 0x88, 0x4C, 0x7D, 0x65, 0x9A, 0x2F, 0xEA, 0xA0, 0xC5, 0x5A, 0xD0, 0x15, 0xA3, 0xBF, 0x4F, 0x1B, 0x2B, 0x0B, 0x82, 0x2C, 0xD1, 0x5D, 0x6C, 0x15, 0xB0, 0xF0, 0x0A, 0x08 }, 32, { 0x02, 0x21, 0x00, 0xF1, 0xAB, 0xB0, 0x23, 0x51, 0x83, 0x51, 0xCD, 0x71, 0xD8, 0x81, 0x56, 0x7B, 0x1E, 0xA6, 0x63, 0xED, 0x3E, 0xFC, 0xF6, 0xC5, 0x13, 0x2B, 0x35, 0x4F, 0x28, 0xD3, 0xB0, 0xB7, 0xD3, 0x83, 0x67, 0x02, 0x20, 0x01, 0x9F, 0x41, 0x13, 0x74, 0x2A, 0x2B, 0x14, 0xBD, 0x25, 0x92, 0x6B, 0x49, 0xC6, 0x49, 0x15, 0x5F, 0x26, 0x7E, 0x60, 0xD3, 0x81, 0x4B, 0x4C, 0x0C, 0xC8, 0x42, 0x50, 0xE4, 0x6F, 0x00, 0x83 }, 69 },
+    { "random 0", 0, { 0x03, 0x42, 0x00, 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 68, { 0x31, 0xEE, 0xBD, 0xB9, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x93, 0x02, 0x21, 0x00, 0xA7, 0x17, 0xF3, 0x63, 0x48, 0x00, 0x52, 0x02, 0x2C, 0xC2, 0x65, 0x3F, 0x20, 0xFD, 0xA6, 0xA9, 0x0F, 0x7F, 0xCF, 0x71, 0x6C, 0x6A, 0xD0, 0x93, 0x44, 0xE6, 0xB3, 0xA2, 0xF3, 0x78, 0x93, 0xBE }, 69 },
+    { "random 0 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 68, { 0x31, 0xEE, 0xBD, 0xB9, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x93, 0x02, 0x20, 0x58, 0xE8, 0x0C, 0x9B, 0xB7, 0xFF, 0xAD, 0xFE, 0xD3, 0x3D, 0x9A, 0xC0, 0xDF, 0x02, 0x59, 0x56, 0xAD, 0x67, 0x2B, 0x3C, 0x3A, 0xAC, 0xCD, 0xF1, 0xAE, 0xD3, 0x17, 0x20, 0x08, 0xEA, 0x91, 0x93 }, 68 },
+    { "random 0 raw key", 0, { 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 64, { 0x31, 0xEE, 0xBD, 0xB9, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x93, 0x02, 0x21, 0x00, 0xA7, 0x17, 0xF3, 0x63, 0x48, 0x00, 0x52, 0x02, 0x2C, 0xC2, 0x65, 0x3F, 0x20, 0xFD, 0xA6, 0xA9, 0x0F, 0x7F, 0xCF, 0x71, 0x6C, 0x6A, 0xD0, 0x93, 0x44, 0xE6, 0xB3, 0xA2, 0xF3, 0x78, 0x93, 0xBE }, 69 },
+    { "random 0 point key", 0, { 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 65, { 0x31, 0xEE, 0xBD, 0xB9, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x93, 0x02, 0x21, 0x00, 0xA7, 0x17, 0xF3, 0x63, 0x48, 0x00, 0x52, 0x02, 0x2C, 0xC2, 0x65, 0x3F, 0x20, 0xFD, 0xA6, 0xA9, 0x0F, 0x7F, 0xCF, 0x71, 0x6C, 0x6A, 0xD0, 0x93, 0x44, 0xE6, 0xB3, 0xA2, 0xF3, 0x78, 0x93, 0xBE }, 69 },
+    { "random 0 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 68, { 0x31, 0xEE, 0xBD, 0xB9, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x30, 0x45, 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x93, 0x02, 0x21, 0x00, 0xA7, 0x17, 0xF3, 0x63, 0x48, 0x00, 0x52, 0x02, 0x2C, 0xC2, 0x65, 0x3F, 0x20, 0xFD, 0xA6, 0xA9, 0x0F, 0x7F, 0xCF, 0x71, 0x6C, 0x6A, 0xD0, 0x93, 0x44, 0xE6, 0xB3, 0xA2, 0xF3, 0x78, 0x93, 0xBE }, 71 },
+    { "random 0 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 68, { 0x31, 0xEE, 0xBD, 0x99, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x93, 0x02, 0x21, 0x00, 0xA7, 0x17, 0xF3, 0x63, 0x48, 0x00, 0x52, 0x02, 0x2C, 0xC2, 0x65, 0x3F, 0x20, 0xFD, 0xA6, 0xA9, 0x0F, 0x7F, 0xCF, 0x71, 0x6C, 0x6A, 0xD0, 0x93, 0x44, 0xE6, 0xB3, 0xA2, 0xF3, 0x78, 0x93, 0xBE }, 69 },
+    { "random 0 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 68, { 0x31, 0xEE, 0xBD, 0xB9, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x94, 0x02, 0x21, 0x00, 0xA7, 0x17, 0xF3, 0x63, 0x48, 0x00, 0x52, 0x02, 0x2C, 0xC2, 0x65, 0x3F, 0x20, 0xFD, 0xA6, 0xA9, 0x0F, 0x7F, 0xCF, 0x71, 0x6C, 0x6A, 0xD0, 0x93, 0x44, 0xE6, 0xB3, 0xA2, 0xF3, 0x78, 0x93, 0xBE }, 69 },
+    { "random 0 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 68, { 0x31, 0xEE, 0xBD, 0xB9, 0xA1, 0x01, 0xAF, 0xEC, 0xB9, 0x48, 0x27, 0xF3, 0x5E, 0xF0, 0xA0, 0x40, 0x34, 0x77, 0xCC, 0x30, 0x26, 0xD1, 0x82, 0x83, 0x32, 0x9B, 0x44, 0x4F, 0x1D, 0x2D, 0xE0, 0x60 }, 32, { 0x02, 0x20, 0x29, 0x2A, 0x76, 0xFF, 0xD6, 0x42, 0x49, 0xAE, 0xE8, 0x28, 0x98, 0x08, 0xE3, 0x33, 0x38, 0x9D, 0x3C, 0x0E, 0xDA, 0xA2, 0xDC, 0xC4, 0x31, 0xDA, 0x7B, 0xD7, 0xE9, 0x44, 0x9E, 0x31, 0x1D, 0x93, 0x02, 0x21, 0x00, 0xA7, 0x17, 0xF3, 0x63, 0x48, 0x00, 0x52, 0x02, 0x2C, 0xC2, 0x65, 0x3F, 0x20, 0xFD, 0xA6, 0xA9, 0x0F, 0x7F, 0xCF, 0x71, 0x6C, 0x6A, 0xD0, 0x93, 0x44, 0xE6, 0xB3, 0xA2, 0xF3, 0x78, 0x93, 0xBF }, 69 },
+    { "random 1", 0, { 0x03, 0x42, 0x00, 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 68, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE0 }, 70 },
+    { "random 1 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 68, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x20, 0x22, 0x09, 0x2E, 0x86, 0xCE, 0x36, 0xE6, 0x11, 0xFF, 0x15, 0x59, 0x63, 0x9B, 0x76, 0xE9, 0x95, 0x83, 0xC0, 0x12, 0x3C, 0x36, 0xB9, 0x4F, 0x06, 0xC3, 0xB5, 0x36, 0xA5, 0x84, 0x78, 0x3C, 0x71 }, 69 },
+    { "random 1 raw key", 0, { 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 64, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE0 }, 70 },
+    { "random 1 point key", 0, { 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 65, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE0 }, 70 },
+    { "random 1 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 68, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x30, 0x46, 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE0 }, 72 },
+    { "random 1 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 68, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDF, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE0 }, 70 },
+    { "random 1 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 68, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x93, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE0 }, 70 },
+    { "random 1 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 68, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE1 }, 70 },
+    { "random 1 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x7A, 0xB1, 0x54, 0x09, 0x85, 0xB5, 0x5B, 0x47, 0xB3, 0xAB, 0x44, 0x67, 0xE3, 0xCA, 0x54, 0x7D, 0x99, 0x86, 0xD6, 0xB5, 0x25, 0xDE, 0x59, 0xCC, 0x77, 0x8E, 0x9C, 0x57, 0x86, 0x01, 0x02, 0x7D, 0xEC, 0xA0, 0x03, 0x7B, 0xD0, 0x5B, 0x1A, 0xAF, 0x9E, 0x1F, 0x3B, 0xA6, 0x99, 0x1D, 0x34, 0xBF, 0x7E, 0x57, 0x4A, 0xF1, 0xB9, 0x11, 0x37, 0x35, 0x86, 0x00, 0xA9, 0x07, 0x8C, 0xFD, 0xC3, 0xC0 }, 68, { 0x91, 0x81, 0x23, 0x67, 0x3C, 0xA3, 0x79, 0x29, 0x18, 0xB6, 0xA5, 0x4A, 0xD4, 0xCC, 0x41, 0x7A, 0xDB, 0xB3, 0x74, 0x5C, 0x9C, 0x2C, 0xC4, 0xA4, 0x96, 0x0D, 0x57, 0x02, 0x6D, 0xC1, 0xAA, 0x9B }, 32, { 0x02, 0x21, 0x00, 0x87, 0x3F, 0x7C, 0xD1, 0x3A, 0x98, 0x32, 0x10, 0x29, 0x59, 0x27, 0xC9, 0x3E, 0x67, 0xAF, 0x8B, 0x34, 0xA3, 0xB9, 0x64, 0xE7, 0x85, 0x3C, 0x72, 0x5A, 0xAB, 0x00, 0x3F, 0xEC, 0xD9, 0x11, 0x92, 0x02, 0x21, 0x00, 0xDD, 0xF6, 0xD1, 0x78, 0x31, 0xC9, 0x19, 0xEF, 0x00, 0xEA, 0xA6, 0x9C, 0x64, 0x89, 0x16, 0x6A, 0x39, 0x26, 0xE8, 0x71, 0x70, 0x5E, 0x4F, 0x7E, 0x30, 0x04, 0x94, 0x1D, 0x77, 0xEA, 0xE8, 0xE0 }, 70 },
+    { "random 2", 0, { 0x03, 0x42, 0x00, 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 68, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x39 }, 68 },
+    { "random 2 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 68, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x21, 0x00, 0x9F, 0xF3, 0xFA, 0x65, 0x7A, 0x5E, 0x1F, 0x71, 0xC6, 0x38, 0xAE, 0x48, 0x7F, 0x7E, 0x6C, 0xC4, 0xD2, 0x8B, 0x8C, 0x9A, 0xF7, 0xFE, 0x63, 0xAC, 0x14, 0x02, 0x3B, 0xFA, 0x21, 0x1E, 0xBA, 0x18 }, 69 },
+    { "random 2 raw key", 0, { 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 64, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x39 }, 68 },
+    { "random 2 point key", 0, { 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 65, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x39 }, 68 },
+    { "random 2 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 68, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x30, 0x44, 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x39 }, 70 },
+    { "random 2 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 68, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x22 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x39 }, 68 },
+    { "random 2 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 68, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAC, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x39 }, 68 },
+    { "random 2 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 68, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x3A }, 68 },
+    { "random 2 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x82, 0xB9, 0x51, 0x8F, 0x2C, 0x0B, 0x8A, 0x51, 0x0F, 0x93, 0xFD, 0xBF, 0x01, 0x91, 0xC0, 0x60, 0xDE, 0xAD, 0xA7, 0x28, 0xC2, 0xE2, 0x99, 0x0F, 0x58, 0xA7, 0x76, 0xFC, 0x68, 0xC7, 0xFD, 0x97, 0x8A, 0x7F, 0x98, 0xAF, 0xEB, 0x28, 0xE1, 0x0D, 0xEE, 0x13, 0x04, 0x1D, 0x1A, 0x69, 0x67, 0x7D, 0xCB, 0xFB, 0x10, 0x19, 0xB6, 0x88, 0xBA, 0x81, 0xB1, 0xE5, 0x4A, 0x8C, 0x6B, 0x99, 0x22, 0x3D }, 68, { 0xAD, 0x5E, 0xBC, 0xD9, 0xFC, 0x00, 0x29, 0xCD, 0xA6, 0x86, 0xAE, 0xEB, 0x47, 0xCA, 0x2C, 0x4E, 0x28, 0xF4, 0x2C, 0x02 }, 20, { 0x02, 0x20, 0x4E, 0x32, 0x0F, 0xE6, 0x08, 0xD4, 0xFF, 0x9B, 0x23, 0xBF, 0x4F, 0x38, 0xAE, 0x7B, 0x70, 0x02, 0xD4, 0x5C, 0x21, 0x2E, 0xFA, 0x65, 0x99, 0xD1, 0xA0, 0x3E, 0xCB, 0x7D, 0x5A, 0xAF, 0x81, 0xAB, 0x02, 0x20, 0x60, 0x0C, 0x05, 0x99, 0x85, 0xA1, 0xE0, 0x8F, 0x39, 0xC7, 0x51, 0xB7, 0x80, 0x81, 0x93, 0x3A, 0xEA, 0x5B, 0x6E, 0x12, 0xAF, 0x19, 0x3A, 0xD8, 0xDF, 0xB7, 0x8E, 0xC8, 0xDB, 0x44, 0x6B, 0x39 }, 68 },
+    { "random 3", 0, { 0x03, 0x42, 0x00, 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 68, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x65 }, 70 },
+    { "random 3 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 68, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x20, 0x2D, 0xC2, 0x3B, 0x6C, 0xDA, 0x88, 0xB3, 0x0F, 0x79, 0xFE, 0x6D, 0x20, 0xF8, 0xD6, 0xB2, 0x9A, 0xE1, 0x26, 0x9E, 0x25, 0xD4, 0x15, 0x42, 0xB2, 0x29, 0x83, 0xC8, 0x93, 0x38, 0xBB, 0xB8, 0xEC }, 69 },
+    { "random 3 raw key", 0, { 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 64, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x65 }, 70 },
+    { "random 3 point key", 0, { 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 65, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x65 }, 70 },
+    { "random 3 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 68, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x30, 0x46, 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x65 }, 72 },
+    { "random 3 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 68, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x25, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x65 }, 70 },
+    { "random 3 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 68, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x91, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x65 }, 70 },
+    { "random 3 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 68, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x66 }, 70 },
+    { "random 3 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x8D, 0x47, 0x9B, 0x97, 0x2A, 0xC4, 0x13, 0xB2, 0x66, 0x3D, 0xEE, 0x88, 0x08, 0x0A, 0x27, 0x4B, 0x72, 0x0D, 0x62, 0x33, 0x90, 0xB8, 0xB0, 0x54, 0x5D, 0x70, 0x28, 0x21, 0x7D, 0xD1, 0xAE, 0xB4, 0x3D, 0xE6, 0x45, 0x6C, 0x85, 0xF4, 0xE6, 0x28, 0xFA, 0xCA, 0x39, 0x60, 0xDE, 0x06, 0x69, 0x81, 0xCB, 0x81, 0x67, 0xE7, 0x00, 0xAA, 0xF7, 0x4F, 0xB9, 0x56, 0x83, 0x54, 0xE1, 0x58, 0x3B, 0x22 }, 68, { 0x90, 0xAC, 0x55, 0x2E, 0xD9, 0xE6, 0x65, 0x40, 0xEA, 0x94, 0x35, 0x86, 0x48, 0xEE, 0xCB, 0xFD, 0xAE, 0x8E, 0x84, 0x65, 0x00, 0x26, 0x98, 0xBF, 0xDD, 0x92, 0x37, 0x23, 0xC3, 0xF5, 0x31, 0xEC, 0x9C, 0x7A, 0xC7, 0xE7, 0x7A, 0xBA, 0x42, 0x9C, 0x27, 0x61, 0xBC, 0xF7, 0x87, 0xD2, 0x36, 0x99 }, 48, { 0x02, 0x21, 0x00, 0xF3, 0x1B, 0xBF, 0x23, 0x02, 0x9A, 0xC8, 0x87, 0x51, 0x16, 0xF1, 0x40, 0xF9, 0xB8, 0xFB, 0xB3, 0xCA, 0x9A, 0xB2, 0xA9, 0x1E, 0x87, 0xC4, 0xC3, 0x6D, 0x01, 0x3F, 0x5B, 0xF2, 0xFB, 0x7E, 0x90, 0x02, 0x21, 0x00, 0xD2, 0x3D, 0xC4, 0x92, 0x25, 0x77, 0x4C, 0xF1, 0x86, 0x01, 0x92, 0xDF, 0x07, 0x29, 0x4D, 0x64, 0xDB, 0xC0, 0x5C, 0x87, 0xD3, 0x02, 0x5B, 0xD2, 0xCA, 0x36, 0x02, 0x2F, 0xC3, 0xA7, 0x6C, 0x65 }, 70 },
+    { "random 4", 0, { 0x03, 0x42, 0x00, 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 68, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6E }, 69 },
+    { "random 4 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 68, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x21, 0x00, 0xE7, 0xE5, 0xDA, 0x81, 0x5C, 0xF0, 0xD4, 0x16, 0xF1, 0x80, 0x48, 0x50, 0xB4, 0xB7, 0x3D, 0x2A, 0x3C, 0xC3, 0xDC, 0x0C, 0x16, 0x57, 0xE3, 0x67, 0x35, 0x72, 0x8D, 0x2C, 0xCC, 0xBC, 0x9C, 0xE3 }, 70 },
+    { "random 4 raw key", 0, { 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 64, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6E }, 69 },
+    { "random 4 point key", 0, { 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 65, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6E }, 69 },
+    { "random 4 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 68, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6E }, 71 },
+    { "random 4 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 68, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0xB6, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6E }, 69 },
+    { "random 4 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 68, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2B, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6E }, 69 },
+    { "random 4 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 68, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6F }, 69 },
+    { "random 4 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x56, 0xA3, 0x3B, 0x98, 0x15, 0x4E, 0xB2, 0x8B, 0xCB, 0xFB, 0x46, 0x06, 0xF6, 0x42, 0xD1, 0xB4, 0x2A, 0xE1, 0xD9, 0x73, 0x66, 0xCE, 0x0A, 0xD8, 0x3B, 0xFE, 0x72, 0x72, 0xB9, 0x62, 0x86, 0x04, 0x98, 0x7C, 0x2E, 0xF6, 0x53, 0x0F, 0xF2, 0x23, 0x31, 0xB6, 0x94, 0x6D, 0xE5, 0x32, 0x7E, 0x71, 0x66, 0x82, 0x89, 0x16, 0xB7, 0x23, 0x7E, 0x96, 0x93, 0xD3, 0xC3, 0x5D, 0xFB, 0xB4, 0x9E, 0x91 }, 68, { 0x26, 0xF4, 0xE5, 0x56, 0xD0, 0x45, 0x5D, 0x88, 0x9C, 0x79, 0x09, 0x4B, 0x87, 0x57, 0x31, 0x4C, 0x5B, 0x04, 0xA6, 0x2F, 0x8C, 0x10, 0x12, 0x2C, 0xAA, 0xDC, 0x90, 0x77, 0xF0, 0x6D, 0x96, 0x6F, 0x43, 0x49, 0x94, 0x3B, 0x61, 0xA1, 0x04, 0x9B, 0x58, 0xBD, 0x62, 0xD6, 0x72, 0xE5, 0x61, 0x0A, 0x0F, 0x16, 0xB5, 0x47, 0x54, 0xE2, 0xD9, 0xB6, 0xC5, 0x70, 0xCD, 0xC5, 0x84, 0x04, 0x3A, 0x42 }, 64, { 0x02, 0x21, 0x00, 0xCC, 0x6B, 0x93, 0xC9, 0x89, 0x46, 0x58, 0xAF, 0xC5, 0x27, 0x18, 0x56, 0xAD, 0xFC, 0x58, 0x48, 0xAC, 0x80, 0xD8, 0x4F, 0x0A, 0x16, 0x95, 0x0D, 0x43, 0x7D, 0x90, 0x54, 0xD4, 0xF6, 0x2D, 0x2A, 0x02, 0x20, 0x18, 0x1A, 0x25, 0x7D, 0xA3, 0x0F, 0x2B, 0xEA, 0x0E, 0x7F, 0xB7, 0xAF, 0x4B, 0x48, 0xC2, 0xD5, 0x80, 0x23, 0x1E, 0xA1, 0x90, 0xBF, 0xBB, 0x1D, 0xBE, 0x47, 0x3D, 0x96, 0x2F, 0xA6, 0x88, 0x6E }, 69 },
+    { "random 5", 0, { 0x03, 0x42, 0x00, 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 68, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE4 }, 70 },
+    { "random 5 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 68, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x20, 0x4D, 0x2B, 0x80, 0xD0, 0x10, 0x07, 0x3C, 0x17, 0xF6, 0xE6, 0xDC, 0x77, 0xD5, 0x56, 0x1D, 0x69, 0xE0, 0x34, 0xEA, 0x11, 0x8F, 0xD4, 0x7B, 0x7B, 0x82, 0xC1, 0x96, 0x31, 0x5B, 0xBA, 0xC8, 0x6D }, 69 },
+    { "random 5 raw key", 0, { 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 64, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE4 }, 70 },
+    { "random 5 point key", 0, { 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 65, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE4 }, 70 },
+    { "random 5 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 68, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x30, 0x46, 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE4 }, 72 },
+    { "random 5 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 68, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x6B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE4 }, 70 },
+    { "random 5 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 68, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x93, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE4 }, 70 },
+    { "random 5 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 68, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE5 }, 70 },
+    { "random 5 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x9E, 0x62, 0x78, 0x96, 0x1E, 0xC2, 0x7B, 0x72, 0x44, 0x24, 0x24, 0x3B, 0x5F, 0xBF, 0x29, 0xB1, 0x59, 0xEB, 0x88, 0x9D, 0x7B, 0xF2, 0xDF, 0x10, 0x34, 0xB9, 0x9D, 0xFA, 0x50, 0x00, 0x58, 0xAD, 0x89, 0xA8, 0xC6, 0x7E, 0xF7, 0x5A, 0xEC, 0x9E, 0x86, 0xC3, 0xE2, 0x5E, 0x88, 0x5D, 0x11, 0x4A, 0x34, 0x8B, 0x81, 0x1C, 0x0E, 0x68, 0x49, 0xEA, 0x70, 0x92, 0xD8, 0x76, 0x9A, 0xB0, 0xC8, 0xCC }, 68, { 0xE4, 0x0C, 0xEA, 0xD2, 0xCA, 0x4B, 0x72, 0x7C, 0x94, 0xC2, 0x96, 0x94, 0xFB, 0x40, 0x65, 0x43, 0x16, 0xF1, 0x24, 0x2F, 0x91, 0x6B, 0x45, 0x94, 0xCB, 0x18, 0xD7, 0x54, 0xCA, 0x35, 0xD8, 0x28 }, 32, { 0x02, 0x21, 0x00, 0xB0, 0x93, 0x04, 0x06, 0x57, 0xCD, 0xDA, 0x34, 0x7C, 0xDA, 0x01, 0xF8, 0xB9, 0xEB, 0x74, 0xDF, 0x2C, 0x31, 0x32, 0x06, 0x25, 0x35, 0xD4, 0xF0, 0x2F, 0x1C, 0xF5, 0x18, 0xD4, 0xD8, 0xA7, 0x92, 0x02, 0x21, 0x00, 0xB2, 0xD4, 0x7F, 0x2E, 0xEF, 0xF8, 0xC3, 0xE9, 0x09, 0x19, 0x23, 0x88, 0x2A, 0xA9, 0xE2, 0x95, 0xDC, 0xB2, 0x10, 0x9C, 0x17, 0x43, 0x23, 0x09, 0x70, 0xF8, 0x34, 0x91, 0xA0, 0xA8, 0x5C, 0xE4 }, 70 },
+    { "random 6", 0, { 0x03, 0x42, 0x00, 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 68, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xEF }, 69 },
+    { "random 6 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 68, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x21, 0x00, 0xC1, 0xFB, 0x73, 0xAA, 0x56, 0xDF, 0xBD, 0xE0, 0x2A, 0x89, 0x94, 0x0A, 0xAF, 0x8B, 0x30, 0x80, 0x9F, 0x9B, 0xB0, 0x4C, 0x43, 0xDF, 0x29, 0xFA, 0x8B, 0x1F, 0x8D, 0xED, 0xC7, 0x15, 0x81, 0x62 }, 70 },
+    { "random 6 raw key", 0, { 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 64, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xEF }, 69 },
+    { "random 6 point key", 0, { 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 65, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xEF }, 69 },
+    { "random 6 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 68, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xEF }, 71 },
+    { "random 6 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 68, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0xA0, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xEF }, 69 },
+    { "random 6 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 68, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x26, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xEF }, 69 },
+    { "random 6 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 68, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xF0 }, 69 },
+    { "random 6 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x69, 0xEF, 0xA4, 0x49, 0xB4, 0x6D, 0x01, 0x36, 0x2F, 0x83, 0x96, 0x87, 0x63, 0xCF, 0x12, 0x1E, 0x78, 0xE8, 0xF8, 0x5C, 0x5A, 0x44, 0x84, 0x0F, 0x9D, 0x2D, 0x6C, 0xBF, 0x86, 0x1B, 0xAA, 0xF8, 0x5E, 0x5A, 0x87, 0x36, 0xCC, 0xEE, 0x2D, 0xF4, 0xBC, 0xFD, 0x75, 0x60, 0x4B, 0x5D, 0x36, 0xD2, 0x32, 0x39, 0xFA, 0x13, 0x42, 0x2D, 0xD8, 0x52, 0x31, 0xA4, 0x49, 0x3B, 0xA1, 0x79, 0x5C, 0xCF }, 68, { 0x97, 0x01, 0xD2, 0xD5, 0xEB, 0x1C, 0x61, 0x44, 0x90, 0x20, 0xD7, 0xC8, 0xC2, 0xC7, 0xA7, 0xC6, 0x3C, 0x73, 0x35, 0x81, 0x87, 0xE3, 0xD4, 0x8A, 0xC0, 0x16, 0x30, 0xBB, 0x9C, 0x18, 0x2C, 0xE2 }, 32, { 0x02, 0x21, 0x00, 0xA7, 0xBB, 0xD1, 0xFA, 0x93, 0x74, 0xB3, 0xDB, 0xB8, 0xDD, 0xA0, 0x8E, 0xA3, 0xBD, 0xD6, 0x60, 0x5D, 0xD2, 0x27, 0xCD, 0x1B, 0xFD, 0x69, 0x56, 0xFF, 0x86, 0x57, 0xF0, 0x54, 0x2C, 0xF4, 0x25, 0x02, 0x20, 0x3E, 0x04, 0x8C, 0x54, 0xA9, 0x20, 0x42, 0x20, 0xD5, 0x76, 0x6B, 0xF5, 0x50, 0x74, 0xCF, 0x7F, 0x1D, 0x4B, 0x4A, 0x61, 0x63, 0x38, 0x74, 0x8A, 0x68, 0x9A, 0x3C, 0xD5, 0x35, 0x4D, 0xA3, 0xEF }, 69 },
+    { "random 7", 0, { 0x03, 0x42, 0x00, 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 68, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6E }, 70 },
+    { "random 7 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 68, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x20, 0x1E, 0x80, 0x72, 0x8F, 0x26, 0x73, 0xE6, 0xBD, 0x1E, 0x10, 0x2A, 0x57, 0xE4, 0xF8, 0xCB, 0x2E, 0x6A, 0x31, 0x36, 0x79, 0x6D, 0xCD, 0x01, 0x2E, 0x22, 0xC2, 0xC5, 0xB1, 0xA8, 0xA9, 0x75, 0xE3 }, 69 },
+    { "random 7 raw key", 0, { 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 64, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6E }, 70 },
+    { "random 7 point key", 0, { 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 65, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6E }, 70 },
+    { "random 7 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 68, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x30, 0x46, 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6E }, 72 },
+    { "random 7 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 68, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4E }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6E }, 70 },
+    { "random 7 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 68, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x84, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6E }, 70 },
+    { "random 7 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 68, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6F }, 70 },
+    { "random 7 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xE9, 0xA6, 0x2F, 0x9B, 0x2F, 0xA4, 0x11, 0xD9, 0x55, 0xFB, 0x03, 0xFF, 0xD3, 0xDA, 0x66, 0x72, 0x23, 0x13, 0xAB, 0xEF, 0xA4, 0xF2, 0xBF, 0xC3, 0x59, 0xEF, 0x78, 0x0A, 0x2B, 0x74, 0x0D, 0x17, 0x64, 0xA6, 0x49, 0x7F, 0x87, 0xA4, 0xB6, 0xBC, 0x6D, 0xC3, 0x61, 0x98, 0xA3, 0x9B, 0x93, 0xB0, 0xD7, 0x5E, 0x42, 0x70, 0xEB, 0xC9, 0x17, 0xD0, 0xCF, 0xF2, 0x81, 0xE3, 0x26, 0x76, 0xA0, 0x09 }, 68, { 0xA2, 0x03, 0x21, 0x1D, 0x6E, 0xF0, 0x0B, 0x45, 0xB4, 0x8A, 0x14, 0xCA, 0x96, 0x14, 0x7E, 0xA5, 0xD4, 0xBD, 0xB2, 0x4F }, 20, { 0x02, 0x21, 0x00, 0xE5, 0xAD, 0x83, 0xC3, 0xA8, 0x69, 0x80, 0x1D, 0xD9, 0xFC, 0xD2, 0x99, 0x18, 0x0C, 0x8D, 0xFF, 0xC2, 0x66, 0x2C, 0xE6, 0x40, 0x15, 0xF5, 0xE8, 0x60, 0xAB, 0x4F, 0x81, 0x94, 0xFC, 0x4C, 0x83, 0x02, 0x21, 0x00, 0xE1, 0x7F, 0x8D, 0x6F, 0xD9, 0x8C, 0x19, 0x43, 0xE1, 0xEF, 0xD5, 0xA8, 0x1B, 0x07, 0x34, 0xD1, 0x52, 0xB5, 0xC4, 0x34, 0x39, 0x4A, 0x9D, 0x56, 0xD0, 0xF7, 0x05, 0x11, 0x53, 0xB9, 0xAF, 0x6E }, 70 },
+    { "random 8", 0, { 0x03, 0x42, 0x00, 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 68, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAC }, 69 },
+    { "random 8 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 68, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x21, 0x00, 0xFB, 0xED, 0xD2, 0x36, 0x81, 0x63, 0x6A, 0xC3, 0x20, 0x01, 0xC0, 0x32, 0xE9, 0x40, 0xC5, 0x38, 0x43, 0xA9, 0xB6, 0x52, 0x34, 0xEA, 0x91, 0x69, 0x76, 0x7F, 0x54, 0x4A, 0x05, 0x7B, 0x09, 0xA5 }, 70 },
+    { "random 8 raw key", 0, { 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 64, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAC }, 69 },
+    { "random 8 point key", 0, { 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 65, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAC }, 69 },
+    { "random 8 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 68, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAC }, 71 },
+    { "random 8 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 68, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xAB, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAC }, 69 },
+    { "random 8 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 68, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x97, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAC }, 69 },
+    { "random 8 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 68, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAD }, 69 },
+    { "random 8 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xD5, 0x01, 0xEB, 0x6E, 0x1A, 0x09, 0x19, 0x46, 0x6C, 0x55, 0xC1, 0x17, 0xC2, 0x29, 0xFC, 0x23, 0x73, 0x93, 0x93, 0xF0, 0x58, 0xB7, 0x5F, 0x7B, 0xD5, 0x95, 0xA5, 0x2E, 0x5F, 0xA3, 0x11, 0x9E, 0xBE, 0x14, 0x1C, 0x8D, 0x40, 0xA3, 0x70, 0xDB, 0x16, 0x7D, 0x61, 0x98, 0xDC, 0xAD, 0x5C, 0x99, 0x3D, 0x08, 0x86, 0xF6, 0x49, 0x40, 0x95, 0x72, 0xA0, 0x88, 0x3A, 0xBA, 0xAB, 0x3C, 0x0D, 0xAB }, 68, { 0xCA, 0xC2, 0x39, 0x34, 0x52, 0xA8, 0x05, 0x32, 0x4A, 0x09, 0xA9, 0x07, 0x88, 0x62, 0xCE, 0xDB, 0x0C, 0x4F, 0x15, 0xB5, 0x9C, 0x7D, 0x44, 0x47, 0x52, 0x0A, 0x95, 0xA6, 0x8B, 0xB7, 0x67, 0x54, 0x3A, 0x42, 0x09, 0x88, 0x5C, 0x4C, 0xDA, 0xAB, 0xCA, 0x1F, 0x20, 0x5D, 0x32, 0x08, 0x57, 0xB3 }, 48, { 0x02, 0x21, 0x00, 0xD5, 0xAC, 0x86, 0xD9, 0x4D, 0x58, 0x84, 0x04, 0x45, 0x4E, 0x68, 0xAD, 0x0D, 0xA0, 0x76, 0x3B, 0x84, 0xC3, 0x09, 0xE0, 0x58, 0x48, 0x34, 0x95, 0x26, 0x58, 0x0B, 0xEF, 0xCB, 0x57, 0x23, 0x96, 0x02, 0x20, 0x04, 0x12, 0x2D, 0xC8, 0x7E, 0x9C, 0x95, 0x3D, 0xDF, 0xFE, 0x3F, 0xCD, 0x16, 0xBF, 0x3A, 0xC7, 0x79, 0x3D, 0x44, 0x5B, 0x72, 0x2D, 0x0D, 0x1B, 0x7D, 0x3A, 0x76, 0x78, 0xF6, 0xE8, 0x1B, 0xAC }, 69 },
+    { "random 9", 0, { 0x03, 0x42, 0x00, 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 68, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x8F }, 69 },
+    { "random 9 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 68, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x21, 0x00, 0xD1, 0x4F, 0x02, 0x8A, 0xE3, 0xC9, 0xC0, 0x69, 0x3C, 0x43, 0x67, 0x95, 0x6F, 0x5A, 0xCB, 0x7B, 0x61, 0xBB, 0x1C, 0xA6, 0xE7, 0xEF, 0x94, 0xDC, 0xDD, 0x33, 0x90, 0x3B, 0xE9, 0x61, 0xE1, 0xC2 }, 70 },
+    { "random 9 raw key", 0, { 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 64, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x8F }, 69 },
+    { "random 9 point key", 0, { 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 65, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x8F }, 69 },
+    { "random 9 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 68, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x8F }, 71 },
+    { "random 9 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 68, { 0xDE, 0x9B, 0xC0, 0x3F, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x8F }, 69 },
+    { "random 9 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 68, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC4, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x8F }, 69 },
+    { "random 9 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 68, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x90 }, 69 },
+    { "random 9 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xA5, 0x43, 0x14, 0xC9, 0xAE, 0x7B, 0x13, 0xD5, 0x6D, 0xA3, 0x6F, 0xE2, 0x80, 0x14, 0xF0, 0xBE, 0x12, 0x61, 0xA4, 0x53, 0xFE, 0x60, 0xCA, 0xFA, 0xA8, 0x62, 0x34, 0x68, 0xE7, 0xF4, 0xBE, 0xE1, 0x31, 0x28, 0xEC, 0xA7, 0xC3, 0x56, 0xF7, 0xBF, 0x8F, 0x7F, 0xD9, 0xA7, 0xF3, 0xE8, 0x98, 0x79, 0x27, 0xDF, 0x30, 0x8C, 0xF1, 0x2C, 0xA9, 0x04, 0x65, 0xC1, 0x39, 0x9C, 0x5C, 0x07, 0x7A, 0xE4 }, 68, { 0xDE, 0x9B, 0xC0, 0x3E, 0x3B, 0xB9, 0x5A, 0x7F, 0x3B, 0xBC, 0xEB, 0x43, 0xA3, 0xA0, 0xCA, 0x4E, 0xD5, 0x51, 0x53, 0x37, 0x20, 0x31, 0x39, 0x78, 0x77, 0x9E, 0x4A, 0x99, 0x71, 0x09, 0x1C, 0x8A, 0xD8, 0x1F, 0xAD, 0x75, 0xD9, 0xFF, 0xC0, 0x4D, 0xCF, 0x51, 0x93, 0xEA, 0x27, 0x83, 0xA3, 0xAC, 0x1E, 0x20, 0x7B, 0x4F, 0x6F, 0xB7, 0xF2, 0xC3, 0x01, 0xC8, 0x70, 0xE3, 0x94, 0x92, 0x99, 0x72 }, 64, { 0x02, 0x21, 0x00, 0xF7, 0x57, 0x13, 0x18, 0x57, 0x57, 0x5C, 0x44, 0x05, 0x48, 0x49, 0x82, 0xC5, 0x6A, 0xBB, 0x5F, 0xE5, 0x4F, 0x3D, 0x14, 0x16, 0x0E, 0x0D, 0x17, 0x56, 0x83, 0x77, 0xDA, 0xDF, 0x73, 0x69, 0xC3, 0x02, 0x20, 0x2E, 0xB0, 0xFD, 0x74, 0x1C, 0x36, 0x3F, 0x97, 0xC3, 0xBC, 0x98, 0x6A, 0x90, 0xA5, 0x34, 0x84, 0x5B, 0x2B, 0xDE, 0x06, 0xBF, 0x28, 0x09, 0xA8, 0x16, 0x86, 0x3A, 0x87, 0x13, 0x01, 0x43, 0x8F }, 69 },
+    { "random 10", 0, { 0x03, 0x42, 0x00, 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 68, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCD }, 69 },
+    { "random 10 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 68, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x20, 0x2D, 0x42, 0x96, 0x69, 0x66, 0x61, 0x8F, 0x89, 0x37, 0x8A, 0x94, 0x2F, 0xA1, 0xFC, 0xBD, 0x6E, 0x89, 0x83, 0x5F, 0xED, 0x1E, 0x86, 0x94, 0x87, 0x5A, 0xEB, 0xF9, 0x60, 0x20, 0xA3, 0xFC, 0x84 }, 68 },
+    { "random 10 raw key", 0, { 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 64, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCD }, 69 },
+    { "random 10 point key", 0, { 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 65, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCD }, 69 },
+    { "random 10 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 68, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x30, 0x45, 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCD }, 71 },
+    { "random 10 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 68, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x8B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCD }, 69 },
+    { "random 10 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 68, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x58, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCD }, 69 },
+    { "random 10 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 68, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCE }, 69 },
+    { "random 10 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x4D, 0xAB, 0x92, 0x6A, 0x27, 0xE0, 0x03, 0xD9, 0x99, 0x3A, 0x20, 0x4D, 0x02, 0x81, 0xD8, 0x85, 0xF1, 0xC8, 0x37, 0x90, 0x1F, 0x95, 0xB8, 0xCB, 0x84, 0xF7, 0x58, 0x18, 0xD6, 0x43, 0x3C, 0x50, 0x18, 0x59, 0xB9, 0x18, 0x6F, 0x74, 0x4E, 0x72, 0x73, 0x9F, 0xB3, 0xE8, 0xF7, 0xDC, 0xD2, 0xB2, 0xF3, 0xCD, 0x32, 0x39, 0x14, 0x77, 0x2A, 0x4F, 0x33, 0xB3, 0x4D, 0x1C, 0x47, 0x68, 0xFA, 0xF1 }, 68, { 0xCE, 0x6D, 0x05, 0x69, 0xE5, 0x97, 0x67, 0xDB, 0x53, 0x5D, 0x47, 0x39, 0x1A, 0x76, 0xBC, 0x95, 0xFB, 0x0B, 0x7C, 0x3A, 0xA6, 0x05, 0xE2, 0x64, 0x5D, 0x78, 0x75, 0xB4, 0x64, 0xBB, 0xA5, 0xC6 }, 32, { 0x02, 0x20, 0x28, 0xE4, 0x0D, 0xDC, 0x69, 0x22, 0x71, 0xB2, 0x6D, 0x22, 0x44, 0x45, 0x2B, 0x42, 0x5A, 0x76, 0x00, 0xEF, 0x71, 0x69, 0x0B, 0xC4, 0x19, 0xB4, 0x6D, 0x46, 0x5B, 0x5C, 0xE6, 0xBB, 0x99, 0x57, 0x02, 0x21, 0x00, 0xD2, 0xBD, 0x69, 0x95, 0x99, 0x9E, 0x70, 0x77, 0xC8, 0x75, 0x6B, 0xD0, 0x5E, 0x03, 0x42, 0x91, 0x33, 0x63, 0x9A, 0xC0, 0x88, 0x91, 0x09, 0xFD, 0x98, 0xCD, 0xD1, 0x62, 0xDB, 0xBF, 0x28, 0xCD }, 69 },
+    { "random 11", 0, { 0x03, 0x42, 0x00, 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 68, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC8 }, 70 },
+    { "random 11 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 68, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x20, 0x71, 0x39, 0x70, 0x51, 0xF4, 0xFE, 0x62, 0x52, 0xE0, 0x81, 0x2E, 0xDB, 0x44, 0xE0, 0xBE, 0xD1, 0xBA, 0x98, 0xBB, 0x39, 0x69, 0x59, 0xB5, 0x8A, 0xB8, 0xE9, 0x2D, 0xB1, 0x04, 0x74, 0xE9, 0x89 }, 69 },
+    { "random 11 raw key", 0, { 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 64, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC8 }, 70 },
+    { "random 11 point key", 0, { 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 65, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC8 }, 70 },
+    { "random 11 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 68, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x30, 0x46, 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC8 }, 72 },
+    { "random 11 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 68, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x22, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC8 }, 70 },
+    { "random 11 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 68, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x47, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC8 }, 70 },
+    { "random 11 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 68, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC9 }, 70 },
+    { "random 11 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x92, 0x17, 0xC2, 0xFB, 0x6E, 0x8B, 0xA5, 0xAA, 0xE8, 0x43, 0x42, 0x30, 0xC3, 0xD7, 0xA1, 0x3D, 0x24, 0x61, 0xFA, 0x4D, 0x42, 0x5C, 0x93, 0x9D, 0x41, 0x96, 0x7B, 0x0C, 0xB5, 0x03, 0x45, 0xA2, 0x41, 0x31, 0x8C, 0xFF, 0xBB, 0x8A, 0x58, 0xF5, 0x3F, 0x90, 0x1A, 0x3C, 0x7A, 0x03, 0xFE, 0xCC, 0x7E, 0x51, 0x4C, 0xC7, 0x52, 0xAF, 0x1D, 0x6C, 0xDA, 0x72, 0xFF, 0xC5, 0x54, 0x8B, 0xEC, 0x7B }, 68, { 0xA5, 0x02, 0xCB, 0x86, 0x85, 0x6E, 0x8C, 0x3F, 0x01, 0xA8, 0xE4, 0x5C, 0xE5, 0xED, 0x0B, 0x56, 0x4C, 0x77, 0x33, 0x26, 0x44, 0x9E, 0x7F, 0xC1, 0xB7, 0x89, 0xA6, 0xB0, 0xA4, 0x2B, 0xB5, 0x42 }, 32, { 0x02, 0x21, 0x00, 0xB5, 0x81, 0x67, 0x43, 0xBA, 0x53, 0x21, 0x72, 0x34, 0xEA, 0xDB, 0xA6, 0xD7, 0x61, 0x05, 0x1F, 0x27, 0xA2, 0xD9, 0x9A, 0x54, 0xBD, 0x80, 0x24, 0x31, 0x28, 0x8D, 0x85, 0x9D, 0xC5, 0x7A, 0x46, 0x02, 0x21, 0x00, 0x8E, 0xC6, 0x8F, 0xAD, 0x0B, 0x01, 0x9D, 0xAE, 0x1F, 0x7E, 0xD1, 0x24, 0xBB, 0x1F, 0x41, 0x2E, 0x02, 0x4E, 0x3F, 0x74, 0x3D, 0xBD, 0xE8, 0xFA, 0x3A, 0xD0, 0x9D, 0x11, 0xF7, 0xEE, 0x3B, 0xC8 }, 70 },
+    { "random 12", 0, { 0x03, 0x42, 0x00, 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 68, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8E }, 69 },
+    { "random 12 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 68, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x21, 0x00, 0xEF, 0x5A, 0x01, 0x30, 0xDE, 0x9B, 0xF7, 0xD2, 0xFE, 0x6C, 0x1E, 0x9C, 0xAD, 0x9E, 0x52, 0x9F, 0xBD, 0x3D, 0x20, 0xF7, 0x86, 0xD9, 0x6B, 0xBC, 0x0A, 0xC8, 0xD5, 0x59, 0x9E, 0xE2, 0xAA, 0xC3 }, 70 },
+    { "random 12 raw key", 0, { 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 64, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8E }, 69 },
+    { "random 12 point key", 0, { 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 65, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8E }, 69 },
+    { "random 12 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 68, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8E }, 71 },
+    { "random 12 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 68, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x20, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8E }, 69 },
+    { "random 12 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 68, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0D, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8E }, 69 },
+    { "random 12 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 68, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8F }, 69 },
+    { "random 12 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x12, 0x1B, 0xCD, 0xF7, 0x36, 0x02, 0xA3, 0x96, 0x4D, 0x26, 0xC6, 0x4B, 0x87, 0x8F, 0xF4, 0xDB, 0xDB, 0x10, 0x38, 0x70, 0xC5, 0x1D, 0x76, 0xE7, 0x9D, 0x9A, 0x8D, 0x05, 0x02, 0x04, 0x08, 0x9B, 0x32, 0xA5, 0x59, 0xD2, 0x4A, 0x2A, 0x65, 0x76, 0x84, 0xF2, 0x8C, 0xFC, 0xEA, 0x72, 0x5B, 0xE2, 0x13, 0xF9, 0x72, 0x12, 0x37, 0x67, 0xD6, 0x04, 0xE1, 0x54, 0xB6, 0x49, 0x1C, 0xD5, 0x83, 0xAE }, 68, { 0xB6, 0xEB, 0x55, 0x56, 0xD6, 0xD6, 0xCB, 0x51, 0xFB, 0x3A, 0xFD, 0xB3, 0x98, 0xB2, 0x28, 0xE9, 0xA4, 0x02, 0xC2, 0x29 }, 20, { 0x02, 0x21, 0x00, 0xD6, 0x14, 0x98, 0xCB, 0xAC, 0x90, 0x6E, 0x6B, 0x8A, 0x3E, 0xA9, 0x02, 0xAA, 0x1C, 0x90, 0x3D, 0x86, 0xBD, 0x1A, 0xC8, 0x5A, 0x77, 0x3F, 0x79, 0xDD, 0x7B, 0xEF, 0x96, 0xED, 0x30, 0x4F, 0x0C, 0x02, 0x20, 0x10, 0xA5, 0xFE, 0xCE, 0x21, 0x64, 0x08, 0x2E, 0x01, 0x93, 0xE1, 0x63, 0x52, 0x61, 0xAD, 0x5F, 0xFF, 0xA9, 0xD9, 0xB6, 0x20, 0x3E, 0x32, 0xC8, 0xE8, 0xF0, 0xF5, 0x69, 0x5D, 0x80, 0x7A, 0x8E }, 69 },
+    { "random 13", 0, { 0x03, 0x42, 0x00, 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 68, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x07 }, 68 },
+    { "random 13 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 68, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x21, 0x00, 0xB9, 0x5B, 0x34, 0x50, 0x4A, 0x95, 0x9C, 0xAB, 0x82, 0x4A, 0xD9, 0x3A, 0x6B, 0xDC, 0x97, 0x1D, 0x61, 0x07, 0xD9, 0x62, 0x2E, 0x48, 0x96, 0xAF, 0x4F, 0x4D, 0x6C, 0x3D, 0x1E, 0x81, 0xC4, 0x4A }, 69 },
+    { "random 13 raw key", 0, { 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 64, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x07 }, 68 },
+    { "random 13 point key", 0, { 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 65, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x07 }, 68 },
+    { "random 13 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 68, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x30, 0x44, 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x07 }, 70 },
+    { "random 13 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 68, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x80, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x07 }, 68 },
+    { "random 13 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 68, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x40, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x07 }, 68 },
+    { "random 13 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 68, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x08 }, 68 },
+    { "random 13 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x96, 0x3D, 0x06, 0x68, 0xA5, 0x9F, 0xD6, 0x52, 0xBB, 0xB0, 0x7D, 0x31, 0x98, 0x2E, 0xBC, 0xBC, 0x5A, 0x24, 0x3A, 0x49, 0xA0, 0x29, 0x20, 0xD4, 0x25, 0x7F, 0x60, 0x40, 0xB1, 0x79, 0xD7, 0x57, 0x9B, 0xAD, 0x89, 0xED, 0xEC, 0x4F, 0x25, 0xF9, 0xE7, 0x54, 0x8F, 0x05, 0x8B, 0x3B, 0x73, 0xDF, 0x76, 0x8B, 0x7F, 0xAF, 0x22, 0x6D, 0x56, 0x1D, 0x22, 0x5C, 0x76, 0x6E, 0x90, 0x0C, 0x80, 0x4A }, 68, { 0x7F, 0x07, 0xC0, 0xCE, 0x6F, 0x0E, 0x5A, 0x00, 0xCA, 0xDB, 0xA1, 0xEC, 0x7D, 0x0E, 0x4C, 0x10, 0x32, 0x31, 0x2C, 0xF9, 0x18, 0x23, 0xD0, 0x43, 0xAB, 0x74, 0x69, 0xB1, 0x42, 0x6D, 0x6C, 0xB8, 0x5F, 0xC5, 0xA9, 0x7B, 0xA9, 0xE0, 0x02, 0x2B, 0x97, 0x0E, 0x03, 0x98, 0xC9, 0xD4, 0x06, 0x14 }, 48, { 0x02, 0x20, 0x26, 0x30, 0xCA, 0x40, 0x6D, 0x18, 0x81, 0x5F, 0xC2, 0xA9, 0xE3, 0xFF, 0xD3, 0xB5, 0xF6, 0xC8, 0xDB, 0xE0, 0xA8, 0xBE, 0xEE, 0xAC, 0xFE, 0xB6, 0x42, 0x8E, 0xBE, 0xD7, 0xA3, 0x96, 0xAA, 0x3F, 0x02, 0x20, 0x46, 0xA4, 0xCB, 0xAE, 0xB5, 0x6A, 0x63, 0x55, 0x7D, 0xB5, 0x26, 0xC5, 0x94, 0x23, 0x68, 0xE2, 0x5B, 0xDF, 0x21, 0x4B, 0x78, 0xCF, 0x07, 0xD5, 0xA4, 0x6C, 0x5E, 0x85, 0xDD, 0xE1, 0x61, 0x07 }, 68 },
+    { "random 14", 0, { 0x03, 0x42, 0x00, 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 68, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD7 }, 68 },
+    { "random 14 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 68, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x21, 0x00, 0xD3, 0xA7, 0x21, 0x8A, 0xBF, 0x5A, 0x24, 0xF9, 0x51, 0xF1, 0xAF, 0x62, 0xCD, 0xAB, 0xC6, 0xFB, 0xDA, 0xD0, 0xFF, 0xE5, 0x7F, 0x54, 0xAE, 0x4C, 0x1E, 0x08, 0xD2, 0x61, 0xC9, 0xE9, 0xEB, 0x7A }, 69 },
+    { "random 14 raw key", 0, { 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 64, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD7 }, 68 },
+    { "random 14 point key", 0, { 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 65, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD7 }, 68 },
+    { "random 14 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 68, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x30, 0x44, 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD7 }, 70 },
+    { "random 14 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 68, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x28, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD7 }, 68 },
+    { "random 14 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 68, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCD, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD7 }, 68 },
+    { "random 14 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 68, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD8 }, 68 },
+    { "random 14 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xAD, 0xE0, 0x85, 0xBF, 0xA1, 0x6A, 0xDB, 0x30, 0x28, 0x33, 0xF9, 0x6A, 0x08, 0x3A, 0xDD, 0x2E, 0x99, 0x05, 0x9C, 0x69, 0xA3, 0x1A, 0x3F, 0x3B, 0xAB, 0x69, 0x70, 0xC9, 0x72, 0x8E, 0x5A, 0xC8, 0x49, 0xE5, 0x53, 0xAE, 0x07, 0xE5, 0x87, 0x02, 0xD0, 0x3B, 0x21, 0x7A, 0x00, 0x71, 0xC2, 0xBF, 0xE1, 0x04, 0x7E, 0xF7, 0x05, 0xF7, 0x49, 0xFF, 0xAC, 0x9F, 0x9C, 0xB5, 0x22, 0xB1, 0xF7, 0x6C }, 68, { 0x58, 0x8D, 0x2D, 0x13, 0xFF, 0xB9, 0x40, 0x75, 0x77, 0x9C, 0x4D, 0x61, 0xFE, 0x75, 0xB7, 0x2D, 0x5E, 0x5E, 0xAF, 0xAA, 0x83, 0xB3, 0xFC, 0xE9, 0x3A, 0x24, 0xCA, 0xF9, 0x28, 0x0F, 0x38, 0x98, 0x81, 0xBB, 0x98, 0x50, 0xA3, 0x5B, 0x21, 0x65, 0xC8, 0xD9, 0x0D, 0xCB, 0x58, 0xCD, 0x34, 0x87, 0x67, 0x6D, 0xA8, 0x9E, 0x37, 0x05, 0x3D, 0x6F, 0x77, 0xA5, 0xE2, 0x92, 0xB4, 0xF7, 0xFA, 0xE4 }, 64, { 0x02, 0x20, 0x29, 0x83, 0xD8, 0xA9, 0x73, 0x1A, 0x36, 0x70, 0x13, 0x17, 0x6A, 0xF6, 0x46, 0x9A, 0x54, 0x14, 0x16, 0x88, 0x03, 0xA9, 0xDA, 0x0B, 0x27, 0xD6, 0x0B, 0xFA, 0xFD, 0x4F, 0x43, 0x00, 0xDC, 0xCC, 0x02, 0x20, 0x2C, 0x58, 0xDE, 0x74, 0x40, 0xA5, 0xDB, 0x07, 0xAE, 0x0E, 0x50, 0x9D, 0x32, 0x54, 0x39, 0x03, 0xE2, 0x15, 0xFA, 0xC8, 0x27, 0xC2, 0xF0, 0x38, 0xD5, 0xB0, 0xF8, 0x61, 0x32, 0x79, 0x39, 0xD7 }, 68 },
+    { "random 15", 0, { 0x03, 0x42, 0x00, 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 68, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x10 }, 69 },
+    { "random 15 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 68, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x21, 0x00, 0x96, 0xD2, 0xC3, 0x2B, 0x38, 0x97, 0x32, 0xE1, 0xCE, 0x04, 0xDB, 0x29, 0xDB, 0x10, 0xF7, 0xAB, 0x38, 0x85, 0x9B, 0xBC, 0xF0, 0x12, 0xF3, 0xE6, 0x30, 0xFD, 0x4F, 0xEC, 0x92, 0xCB, 0xAC, 0x41 }, 70 },
+    { "random 15 raw key", 0, { 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 64, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x10 }, 69 },
+    { "random 15 point key", 0, { 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 65, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x10 }, 69 },
+    { "random 15 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 68, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x10 }, 71 },
+    { "random 15 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 68, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0xB1, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x10 }, 69 },
+    { "random 15 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 68, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x52, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x10 }, 69 },
+    { "random 15 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 68, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x11 }, 69 },
+    { "random 15 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x91, 0xF8, 0x1C, 0x42, 0xCD, 0x9E, 0x9A, 0xCF, 0xF0, 0x2E, 0xC9, 0xF5, 0xE5, 0x00, 0x60, 0x8B, 0x23, 0x4D, 0x79, 0x41, 0x88, 0xE9, 0xF2, 0x5C, 0x37, 0xA3, 0xE7, 0x6C, 0xF3, 0xBC, 0x95, 0xE9, 0xBB, 0xE5, 0xD1, 0xA5, 0x42, 0x8A, 0x6B, 0x5D, 0x40, 0x45, 0x30, 0x8C, 0x25, 0xBC, 0xF1, 0x74, 0x2A, 0x28, 0xBD, 0xFA, 0xC0, 0x07, 0xE2, 0xA9, 0x0D, 0x5B, 0xA7, 0xE2, 0xAD, 0xF8, 0xC9, 0x6C }, 68, { 0x86, 0x3D, 0xCA, 0x1B, 0x03, 0x8C, 0xC6, 0xC6, 0xAF, 0x38, 0xE5, 0x28, 0x31, 0x8B, 0x67, 0x43, 0x95, 0xCC, 0x5B, 0x49, 0xCF, 0x3B, 0x85, 0x46, 0x9F, 0x2D, 0x1E, 0x5B, 0x79, 0xB0, 0xC7, 0x2A }, 32, { 0x02, 0x21, 0x00, 0xC8, 0x43, 0xD3, 0xFD, 0x85, 0xD6, 0x97, 0x9C, 0xA8, 0x72, 0x82, 0x93, 0x4A, 0x13, 0x05, 0x4B, 0x50, 0x72, 0x90, 0xCD, 0x22, 0xAD, 0x7E, 0x5C, 0x34, 0x4B, 0xB1, 0x67, 0x13, 0x77, 0x09, 0x51, 0x02, 0x20, 0x69, 0x2D, 0x3C, 0xD3, 0xC7, 0x68, 0xCD, 0x1F, 0x31, 0xFB, 0x24, 0xD6, 0x24, 0xEF, 0x08, 0x54, 0x84, 0x61, 0x5E, 0xF0, 0xB7, 0x04, 0xAA, 0x9E, 0xC2, 0xBC, 0x7A, 0xD6, 0x69, 0x97, 0x79, 0x10 }, 69 },
+    { "random 16", 0, { 0x03, 0x42, 0x00, 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 68, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDA }, 69 },
+    { "random 16 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 68, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x20, 0x37, 0xD1, 0x12, 0xBE, 0xB7, 0xAA, 0x64, 0x04, 0xCF, 0x31, 0x8A, 0x52, 0xC0, 0x48, 0x16, 0xFB, 0x91, 0x4D, 0x24, 0x07, 0x1A, 0xC6, 0xF1, 0x69, 0x80, 0x89, 0xCC, 0x64, 0x48, 0x1A, 0x1A, 0x77 }, 68 },
+    { "random 16 raw key", 0, { 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 64, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDA }, 69 },
+    { "random 16 point key", 0, { 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 65, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDA }, 69 },
+    { "random 16 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 68, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x30, 0x45, 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDA }, 71 },
+    { "random 16 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 68, { 0x5E, 0x8F, 0x8C, 0x65, 0x07, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDA }, 69 },
+    { "random 16 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 68, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD9, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDA }, 69 },
+    { "random 16 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 68, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDB }, 69 },
+    { "random 16 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x06, 0xD0, 0x55, 0x31, 0xB9, 0x3A, 0x2C, 0x40, 0x71, 0xA9, 0x97, 0x8D, 0x92, 0xE8, 0x8E, 0x02, 0x1D, 0x13, 0x3E, 0x3C, 0x45, 0x44, 0x5A, 0x0E, 0x07, 0x7C, 0x5C, 0x43, 0x99, 0x81, 0x4B, 0xA4, 0xDD, 0xD1, 0x88, 0x0A, 0x5F, 0x9F, 0x9D, 0xD8, 0xCF, 0x37, 0x8A, 0x39, 0x51, 0xB6, 0xA7, 0x66, 0xFF, 0x06, 0x3B, 0xFD, 0x77, 0x07, 0x16, 0xC5, 0xA8, 0x56, 0x86, 0x0B, 0x43, 0xDD, 0x3D, 0x76 }, 68, { 0x5E, 0x8F, 0x8C, 0x65, 0x0F, 0x1F, 0x3D, 0x18, 0x2D, 0xA9, 0x81, 0xB0, 0x1F, 0xCA, 0x7C, 0xE2, 0xDE, 0x1F, 0xF1, 0xD6, 0x4D, 0x6F, 0x8B, 0x20, 0x72, 0x2E, 0xD2, 0x71, 0x92, 0xD1, 0xCA, 0x0F }, 32, { 0x02, 0x20, 0x24, 0x27, 0xE2, 0x35, 0x79, 0x9D, 0x42, 0xAF, 0x6B, 0x2F, 0xB4, 0xCF, 0x9A, 0x44, 0xDC, 0x88, 0x43, 0xD6, 0x46, 0x76, 0xBD, 0xDC, 0xF6, 0xBF, 0x38, 0x31, 0x18, 0x45, 0x71, 0xAE, 0x5F, 0xD8, 0x02, 0x21, 0x00, 0xC8, 0x2E, 0xED, 0x40, 0x48, 0x55, 0x9B, 0xFC, 0x30, 0xCE, 0x75, 0xAD, 0x3F, 0xB7, 0xE9, 0x04, 0x2B, 0x99, 0xD6, 0xA6, 0x8C, 0x50, 0xAD, 0x1B, 0x73, 0x2F, 0xFE, 0x5E, 0xB4, 0x49, 0x0A, 0xDA }, 69 },
+    { "random 17", 0, { 0x03, 0x42, 0x00, 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 68, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x35 }, 69 },
+    { "random 17 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 68, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x21, 0x00, 0xA2, 0x02, 0xF4, 0x20, 0x46, 0x68, 0x5A, 0x12, 0x88, 0xF2, 0x9A, 0xD4, 0x22, 0x47, 0xF4, 0xE9, 0x12, 0x9C, 0x2F, 0xF2, 0xFC, 0x65, 0x9C, 0xFA, 0x46, 0x14, 0x30, 0x15, 0x0E, 0x0F, 0x46, 0x1C }, 70 },
+    { "random 17 raw key", 0, { 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 64, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x35 }, 69 },
+    { "random 17 point key", 0, { 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 65, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x35 }, 69 },
+    { "random 17 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 68, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x35 }, 71 },
+    { "random 17 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 68, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x24, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x35 }, 69 },
+    { "random 17 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 68, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x74, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x35 }, 69 },
+    { "random 17 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 68, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x36 }, 69 },
+    { "random 17 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x29, 0xCB, 0x4C, 0x22, 0xCA, 0x87, 0xD4, 0x5E, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0x84, 0xF0, 0xC9, 0x08, 0x9A, 0xEF, 0x1C, 0x23, 0x7A, 0x39, 0x79, 0xAD, 0x38, 0x77, 0xB4, 0x4D, 0x1A, 0xB2, 0x83, 0x07, 0xB8, 0xD2, 0x28, 0xE5, 0x9F, 0xBE, 0xD3, 0x1E, 0x8D, 0x99, 0x26, 0xD1, 0xC0, 0x14, 0x84, 0x55, 0xE2, 0x4D, 0xBD, 0x47, 0xFC, 0xF3, 0x49, 0xB3, 0x00, 0x4B, 0x07, 0xB6, 0xDF, 0xA2, 0xE7 }, 68, { 0x02, 0x87, 0x84, 0x33, 0x6A, 0x1A, 0xD7, 0xAD, 0x6C, 0xF2, 0xD1, 0x0E, 0x63, 0x98, 0x58, 0xCF, 0x34, 0xE6, 0xA1, 0x14 }, 20, { 0x02, 0x21, 0x00, 0xA9, 0xAE, 0x67, 0x29, 0xD5, 0x09, 0xFC, 0x55, 0x58, 0x02, 0x36, 0x49, 0x40, 0x76, 0xAD, 0x7F, 0xC2, 0x66, 0x1F, 0x14, 0x35, 0x37, 0x1C, 0xD7, 0xFD, 0x7C, 0x6A, 0xFD, 0xFC, 0xCE, 0x96, 0x73, 0x02, 0x20, 0x5D, 0xFD, 0x0B, 0xDE, 0xB9, 0x97, 0xA5, 0xEE, 0x77, 0x0D, 0x65, 0x2B, 0xDD, 0xB8, 0x0B, 0x16, 0xAA, 0x4A, 0xCA, 0xBA, 0xAA, 0xB2, 0x01, 0x8A, 0xAD, 0xA5, 0x9A, 0xAD, 0xEE, 0x53, 0xDF, 0x35 }, 69 },
+    { "random 18", 0, { 0x03, 0x42, 0x00, 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 68, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAC }, 68 },
+    { "random 18 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 68, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x21, 0x00, 0x94, 0x30, 0x8A, 0xA0, 0x0E, 0x78, 0x93, 0xB2, 0x84, 0x4A, 0xAF, 0x75, 0x50, 0xCF, 0xDE, 0xB1, 0x1D, 0xDC, 0x74, 0x56, 0x21, 0x08, 0xF8, 0xA6, 0x7A, 0x04, 0x35, 0x7D, 0x28, 0x57, 0xD4, 0xA5 }, 69 },
+    { "random 18 raw key", 0, { 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 64, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAC }, 68 },
+    { "random 18 point key", 0, { 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 65, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAC }, 68 },
+    { "random 18 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 68, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x30, 0x44, 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAC }, 70 },
+    { "random 18 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 68, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xEC, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAC }, 68 },
+    { "random 18 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 68, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0C, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAC }, 68 },
+    { "random 18 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 68, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAD }, 68 },
+    { "random 18 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x93, 0xB8, 0xCE, 0xBC, 0xC3, 0x0E, 0x6F, 0xE5, 0x20, 0x10, 0xE0, 0x51, 0x58, 0xDA, 0x15, 0xB9, 0x7D, 0xD8, 0xBB, 0xDB, 0x91, 0xEF, 0x49, 0xF2, 0x2A, 0x12, 0x65, 0x12, 0xC1, 0x9D, 0xFD, 0xBB, 0xC7, 0x6A, 0xF8, 0x74, 0x36, 0xEB, 0x9A, 0xA9, 0xA8, 0x89, 0x03, 0x96, 0x57, 0xD3, 0x0A, 0x3D, 0xE5, 0x34, 0x70, 0x74, 0xB9, 0xBA, 0x59, 0x62, 0xCF, 0xFD, 0x9E, 0x6B, 0x44, 0x23, 0x6A, 0x28 }, 68, { 0xAE, 0x8E, 0x53, 0xA1, 0xD2, 0xF0, 0x2F, 0x57, 0x72, 0x50, 0x27, 0x73, 0x3F, 0xA2, 0x44, 0xA3, 0x9C, 0x5B, 0xE8, 0x8B, 0x60, 0x01, 0xDE, 0x04, 0x38, 0xFD, 0xBE, 0xEF, 0xAE, 0xCD, 0xC6, 0x19, 0x79, 0xA1, 0x12, 0x17, 0xBD, 0x90, 0xF1, 0x7C, 0xAE, 0x35, 0x4B, 0xC6, 0xE7, 0x80, 0x56, 0x27 }, 48, { 0x02, 0x20, 0x0B, 0x0F, 0x9A, 0x47, 0xAB, 0x57, 0x18, 0xF1, 0xCD, 0x8C, 0x6C, 0x32, 0xDD, 0x38, 0xAB, 0x0C, 0x90, 0x2C, 0x10, 0xD5, 0xF2, 0x8D, 0xF2, 0xA4, 0xE2, 0x06, 0xC3, 0xEF, 0xF5, 0x92, 0x60, 0x0B, 0x02, 0x20, 0x6B, 0xCF, 0x75, 0x5E, 0xF1, 0x87, 0x6C, 0x4E, 0x7B, 0xB5, 0x50, 0x8A, 0xAF, 0x30, 0x21, 0x4E, 0x9F, 0x0A, 0x86, 0x57, 0x86, 0x0E, 0xA5, 0xDE, 0x79, 0xB5, 0x95, 0x45, 0xD4, 0x0B, 0x50, 0xAC }, 68 },
+    { "random 19", 0, { 0x03, 0x42, 0x00, 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 68, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1A }, 70 },
+    { "random 19 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 68, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x20, 0x76, 0x8B, 0x01, 0xDD, 0xD4, 0x81, 0x86, 0x9B, 0x6F, 0xFD, 0x0D, 0xAA, 0xB5, 0x78, 0x14, 0x8D, 0x04, 0xE7, 0xC6, 0x70, 0xBA, 0xFA, 0x2A, 0xD6, 0xDC, 0x7E, 0x0E, 0x5C, 0x68, 0xB3, 0xDB, 0x37 }, 69 },
+    { "random 19 raw key", 0, { 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 64, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1A }, 70 },
+    { "random 19 point key", 0, { 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 65, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1A }, 70 },
+    { "random 19 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 68, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x30, 0x46, 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1A }, 72 },
+    { "random 19 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 68, { 0xA5, 0x5D, 0x60, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1A }, 70 },
+    { "random 19 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 68, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCC, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1A }, 70 },
+    { "random 19 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 68, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1B }, 70 },
+    { "random 19 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xEB, 0x10, 0x3B, 0x32, 0x41, 0x6C, 0xE2, 0x90, 0x41, 0xAB, 0x55, 0xF1, 0x7D, 0x11, 0x3B, 0x31, 0x92, 0x48, 0x26, 0x2D, 0x04, 0xA2, 0x43, 0x4D, 0x75, 0x11, 0x84, 0x40, 0xC9, 0x93, 0xDB, 0x5C, 0xF2, 0x30, 0xC3, 0x3A, 0x79, 0xE6, 0x9E, 0x5C, 0x76, 0x59, 0xC3, 0x5F, 0xB8, 0x6D, 0x1B, 0x9E, 0xD9, 0xAA, 0x2B, 0x61, 0xA6, 0x41, 0xAB, 0xDF, 0x24, 0x67, 0x13, 0xC5, 0xDF, 0x7B, 0x5F, 0xFD }, 68, { 0xA5, 0x5D, 0x64, 0x58, 0x74, 0x6D, 0xBC, 0xB6, 0x62, 0x5B, 0x26, 0x84, 0xCF, 0xC2, 0x98, 0xE4, 0x80, 0x04, 0x01, 0x4F, 0x36, 0xB0, 0x98, 0xBB, 0xBE, 0x3D, 0x9D, 0xA3, 0x54, 0xE0, 0x16, 0xDC, 0x2C, 0xE8, 0x81, 0x5D, 0x66, 0x80, 0x6C, 0xE8, 0x24, 0x8C, 0x03, 0x3D, 0x31, 0x32, 0xDB, 0x1E, 0x0F, 0xB2, 0x72, 0x3E, 0xBB, 0x86, 0x8E, 0x40, 0x57, 0x4C, 0xC8, 0x4E, 0x8C, 0xAF, 0xBF, 0xCF }, 64, { 0x02, 0x21, 0x00, 0xB6, 0x13, 0xF9, 0x3F, 0x62, 0xBC, 0x26, 0x67, 0x89, 0xEB, 0x60, 0x19, 0x23, 0xF4, 0xD3, 0x31, 0x09, 0xAA, 0xC9, 0xEA, 0x28, 0xD4, 0xAF, 0x96, 0x3D, 0x82, 0x4C, 0xB2, 0xD0, 0xBD, 0xEB, 0xCB, 0x02, 0x21, 0x00, 0x89, 0x74, 0xFE, 0x21, 0x2B, 0x7E, 0x79, 0x65, 0x90, 0x02, 0xF2, 0x55, 0x4A, 0x87, 0xEB, 0x72, 0xB7, 0xFF, 0x34, 0x3C, 0xEC, 0x1D, 0x73, 0xAE, 0x17, 0x3B, 0xBC, 0x66, 0x93, 0xAF, 0x4A, 0x1A }, 70 },
+    { "random 20", 0, { 0x03, 0x42, 0x00, 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 68, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD1 }, 69 },
+    { "random 20 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 68, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x20, 0x31, 0x3E, 0xC5, 0xD3, 0x5A, 0xC0, 0xAC, 0x78, 0x11, 0xD2, 0x06, 0x4F, 0x33, 0xAB, 0xC5, 0x84, 0xB7, 0x10, 0x50, 0x99, 0x28, 0x62, 0x6B, 0x61, 0x1D, 0x20, 0x0D, 0x36, 0x9C, 0xD1, 0x92, 0x80 }, 68 },
+    { "random 20 raw key", 0, { 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 64, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD1 }, 69 },
+    { "random 20 point key", 0, { 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 65, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD1 }, 69 },
+    { "random 20 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 68, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x30, 0x45, 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD1 }, 71 },
+    { "random 20 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 68, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xE6, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD1 }, 69 },
+    { "random 20 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 68, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8C, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD1 }, 69 },
+    { "random 20 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 68, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD2 }, 69 },
+    { "random 20 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xDB, 0xE8, 0x1A, 0x38, 0x7C, 0x67, 0xED, 0x2B, 0xC1, 0x98, 0xF1, 0xDA, 0x05, 0xA8, 0x56, 0x7D, 0x03, 0x3A, 0x66, 0x4F, 0xD7, 0x07, 0xAC, 0xD0, 0xCC, 0x37, 0x9F, 0x30, 0x7C, 0x1E, 0x7B, 0x3B, 0x57, 0x49, 0xE5, 0xD6, 0x4E, 0x68, 0x0C, 0x0D, 0x9A, 0xB4, 0x2B, 0xEF, 0xB2, 0xD8, 0x89, 0x5C, 0x08, 0xEA, 0xCF, 0xAE, 0x8F, 0xC5, 0x57, 0xD4, 0xBD, 0xD0, 0x37, 0x41, 0xD9, 0x74, 0x11, 0x13 }, 68, { 0xA3, 0xF8, 0xE8, 0xD1, 0x04, 0xCF, 0xA0, 0xB9, 0x88, 0xBD, 0xF0, 0x25, 0x07, 0x91, 0xEE, 0x75, 0x31, 0xF1, 0xA5, 0x92, 0xAB, 0x54, 0x1C, 0xE4, 0x58, 0x37, 0x90, 0xFB, 0xA4, 0xAE, 0x90, 0xDB }, 32, { 0x02, 0x20, 0x64, 0x20, 0x72, 0x37, 0xF2, 0xFD, 0x16, 0xC0, 0x81, 0xC6, 0x26, 0x8A, 0x15, 0xD4, 0x86, 0xA1, 0x7E, 0x5D, 0x68, 0xF7, 0xE6, 0xC0, 0x1C, 0x35, 0x6E, 0xD5, 0x06, 0xC8, 0x05, 0x5F, 0xA2, 0x8B, 0x02, 0x21, 0x00, 0xCE, 0xC1, 0x3A, 0x2B, 0xA5, 0x3F, 0x53, 0x88, 0xEE, 0x2D, 0xF9, 0xB0, 0xCC, 0x54, 0x3A, 0x7B, 0x05, 0xD6, 0xAA, 0x14, 0x7E, 0xB5, 0x33, 0x23, 0xD6, 0x99, 0xBD, 0x8C, 0x5F, 0x91, 0x92, 0xD1 }, 69 },
+    { "random 21", 0, { 0x03, 0x42, 0x00, 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 68, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x68 }, 69 },
+    { "random 21 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 68, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x21, 0x00, 0x85, 0xF6, 0x08, 0x5A, 0x39, 0x67, 0xA2, 0xC5, 0xCE, 0x91, 0x39, 0x7F, 0x9F, 0xCE, 0x97, 0x6A, 0x1F, 0x3B, 0xBD, 0xA9, 0xE1, 0xFD, 0x20, 0x9A, 0xDA, 0x9A, 0xD8, 0xF8, 0x78, 0xD7, 0x56, 0xE9 }, 70 },
+    { "random 21 raw key", 0, { 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 64, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x68 }, 69 },
+    { "random 21 point key", 0, { 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 65, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x68 }, 69 },
+    { "random 21 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 68, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x30, 0x45, 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x68 }, 71 },
+    { "random 21 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 68, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0x30 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x68 }, 69 },
+    { "random 21 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 68, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCE, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x68 }, 69 },
+    { "random 21 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 68, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x69 }, 69 },
+    { "random 21 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0x30, 0x94, 0x79, 0x30, 0x8C, 0xF7, 0x93, 0xBA, 0x86, 0x49, 0xDA, 0x37, 0x99, 0x7C, 0x78, 0xC4, 0xA3, 0x65, 0xF8, 0x0D, 0x6B, 0x0C, 0x55, 0x0A, 0x85, 0x4B, 0x0D, 0x46, 0x6C, 0x7A, 0xA1, 0x06, 0x19, 0x97, 0x6F, 0xAC, 0x0F, 0xAE, 0xBA, 0xED, 0xEB, 0xA6, 0x79, 0xC9, 0xBE, 0x7E, 0x55, 0x33, 0x1E, 0x3C, 0x87, 0x59, 0x09, 0x49, 0xF6, 0xE7, 0xA7, 0xE7, 0x8E, 0x7C, 0x7D, 0x7E, 0xEC, 0x69 }, 68, { 0x5E, 0x01, 0x8B, 0xFC, 0x4C, 0x2D, 0xFA, 0xCD, 0x02, 0x51, 0x34, 0xEA, 0xC7, 0xFC, 0xBE, 0x2E, 0x29, 0xC0, 0xAA, 0xCC, 0xEF, 0x34, 0x33, 0x96, 0xA8, 0x57, 0xCA, 0xED, 0x17, 0x05, 0x42, 0xB0 }, 32, { 0x02, 0x21, 0x00, 0xDE, 0x47, 0xFD, 0x30, 0x8E, 0x86, 0xC1, 0x9C, 0xFD, 0x87, 0x62, 0xD3, 0xC6, 0xE8, 0x62, 0x40, 0x56, 0x14, 0xB2, 0x66, 0xAB, 0x17, 0x0E, 0x37, 0x2D, 0x14, 0xB0, 0x2C, 0xC0, 0x09, 0x75, 0xCD, 0x02, 0x20, 0x7A, 0x09, 0xF7, 0xA4, 0xC6, 0x98, 0x5D, 0x3B, 0x31, 0x6E, 0xC6, 0x80, 0x60, 0x31, 0x68, 0x95, 0x9D, 0xAB, 0x3D, 0x03, 0xC5, 0x1A, 0x7D, 0xEA, 0x19, 0x1E, 0xF1, 0xCA, 0x83, 0x8B, 0xCE, 0x68 }, 69 },
+    { "random 22", 0, { 0x03, 0x42, 0x00, 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 68, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB4 }, 68 },
+    { "random 22 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 68, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x21, 0x00, 0xEB, 0x48, 0x15, 0x48, 0xEF, 0x22, 0xE9, 0xD2, 0x3A, 0x88, 0x42, 0xB9, 0x9C, 0x89, 0x31, 0x4F, 0x2E, 0x48, 0xDC, 0x9F, 0xBB, 0x1B, 0x20, 0x65, 0x9C, 0xF4, 0xE1, 0x28, 0x8C, 0x35, 0x6B, 0x9D }, 69 },
+    { "random 22 raw key", 0, { 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 64, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB4 }, 68 },
+    { "random 22 point key", 0, { 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 65, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB4 }, 68 },
+    { "random 22 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 68, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x30, 0x44, 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB4 }, 70 },
+    { "random 22 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 68, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x78, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB4 }, 68 },
+    { "random 22 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 68, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xDA, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB4 }, 68 },
+    { "random 22 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 68, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB5 }, 68 },
+    { "random 22 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xEA, 0xD1, 0x35, 0x29, 0xBB, 0xC3, 0xF0, 0x41, 0x42, 0x64, 0x8A, 0x63, 0x58, 0xA6, 0xED, 0x56, 0x66, 0x95, 0x51, 0x61, 0xD1, 0x05, 0x32, 0xFA, 0x38, 0xAA, 0xC4, 0x35, 0xD0, 0xE2, 0xF5, 0x64, 0xC6, 0x7C, 0x87, 0xFE, 0xCA, 0x3B, 0x3B, 0x97, 0x82, 0xA3, 0xB3, 0x56, 0x75, 0xDD, 0x99, 0x3C, 0x60, 0x33, 0x3C, 0xD6, 0x2C, 0x3F, 0x31, 0x0F, 0x62, 0xEE, 0x43, 0x1A, 0x81, 0xDF, 0x7D, 0xBB }, 68, { 0x90, 0x7D, 0x41, 0xAC, 0xE2, 0xFD, 0x27, 0xD2, 0xCE, 0xF6, 0xE0, 0x9D, 0x38, 0xEF, 0x38, 0xA9, 0x89, 0xF9, 0x12, 0x33 }, 20, { 0x02, 0x20, 0x6C, 0xDF, 0x58, 0xAF, 0x88, 0x37, 0x53, 0x18, 0x7D, 0xB3, 0x3C, 0xF8, 0x98, 0x72, 0x9C, 0x4F, 0xD7, 0xA8, 0xEF, 0x4B, 0x2A, 0x72, 0x9B, 0x9C, 0xF5, 0xA3, 0xBA, 0x53, 0xDB, 0x44, 0x62, 0xD9, 0x02, 0x20, 0x14, 0xB7, 0xEA, 0xB6, 0x10, 0xDD, 0x16, 0x2E, 0xC5, 0x77, 0xBD, 0x46, 0x63, 0x76, 0xCE, 0xB0, 0x8E, 0x9E, 0x1E, 0x0D, 0xEB, 0xFC, 0x7E, 0x1F, 0x56, 0xC4, 0xE9, 0x9A, 0x70, 0x2D, 0xB9, 0xB4 }, 68 },
+    { "random 23", 0, { 0x03, 0x42, 0x00, 0x04, 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 68, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFC }, 68 },
+    { "random 23 high s", 0, { 0x03, 0x42, 0x00, 0x04, 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 68, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x21, 0x00, 0x96, 0x9E, 0xC3, 0x70, 0x22, 0xF6, 0x94, 0xF0, 0x9A, 0x95, 0x1D, 0x18, 0x35, 0x1A, 0x32, 0x6D, 0x94, 0x32, 0xF5, 0xDD, 0x99, 0x22, 0x7F, 0x1E, 0x8F, 0xF6, 0x7E, 0x2F, 0xCF, 0x5F, 0x8E, 0x55 }, 69 },
+    { "random 23 raw key", 0, { 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 64, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFC }, 68 },
+    { "random 23 point key", 0, { 0x04, 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 65, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFC }, 68 },
+    { "random 23 sequence", 0, { 0x03, 0x42, 0x00, 0x04, 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 68, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x30, 0x44, 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFC }, 70 },
+    { "random 23 digest bit", 1, { 0x03, 0x42, 0x00, 0x04, 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 68, { 0x97, 0x78, 0x41, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFC }, 68 },
+    { "random 23 r + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 68, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE5, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFC }, 68 },
+    { "random 23 s + 1", 1, { 0x03, 0x42, 0x00, 0x04, 0x39, 0x24, 0x6A, 0x2F, 0xF5, 0x34, 0x83, 0x70, 0xC6, 0x52, 0x9A, 0xCD, 0x80, 0xEA, 0xEF, 0x85, 0x18, 0xCE, 0x28, 0xED, 0xE3, 0x49, 0xF8, 0x1C, 0xB6, 0x4D, 0x1E, 0xA8, 0xC4, 0x12, 0xCD, 0x48, 0xAF, 0x54, 0xDB, 0x27, 0xE5, 0xDC, 0x19, 0xE9, 0x72, 0xDF, 0xE8, 0x93, 0x0E, 0x27, 0x19, 0x58, 0x56, 0xDB, 0x22, 0xB2, 0x06, 0x72, 0x83, 0x29, 0xFD, 0xB1, 0x93, 0x8F, 0xFE, 0x76, 0xB7, 0xA1 }, 68, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFD }, 68 },
+    { "random 23 other key", 1, { 0x03, 0x42, 0x00, 0x04, 0xD0, 0xD6, 0x7A, 0x17, 0x6E, 0xA5, 0x07, 0x65, 0xD0, 0x7A, 0xB3, 0x2F, 0x07, 0xCA, 0xB1, 0xDE, 0xFD, 0x06, 0xFB, 0xF9, 0xEA, 0x17, 0x56, 0x2F, 0xB3, 0x8C, 0x7A, 0xA5, 0x5D, 0x47, 0x51, 0x41, 0xDC, 0x72, 0x6B, 0x65, 0x35, 0x18, 0xE7, 0xB7, 0xE4, 0x5A, 0x24, 0x9F, 0xEB, 0x8A, 0xF5, 0x05, 0xC0, 0x57, 0x76, 0x48, 0xCE, 0x09, 0xF7, 0xC8, 0x2A, 0xA9, 0xA7, 0x94, 0x86, 0xFD, 0x29, 0x74 }, 68, { 0x97, 0x78, 0x51, 0x21, 0xC4, 0x90, 0xD6, 0x66, 0x9C, 0x42, 0x7C, 0xC1, 0xC9, 0x6E, 0xD8, 0x0F, 0x1C, 0x5A, 0x4B, 0x00, 0x36, 0xD8, 0x33, 0x36, 0xB5, 0xCA, 0x95, 0x28, 0xA5, 0x89, 0x66, 0xA2, 0x54, 0xFB, 0xF2, 0x2F, 0x2D, 0x37, 0xCB, 0x4B, 0xE9, 0x3B, 0xE3, 0xE5, 0x51, 0x38, 0xF7, 0x48 }, 48, { 0x02, 0x20, 0x1C, 0xBD, 0x01, 0xDF, 0x61, 0x52, 0xD2, 0xB5, 0x84, 0xF2, 0xFA, 0x55, 0xBA, 0x6D, 0x69, 0x7F, 0xB1, 0x22, 0x7B, 0xBA, 0x7B, 0x76, 0xB7, 0x52, 0xE1, 0x5A, 0x99, 0xAB, 0x4A, 0xE2, 0x3C, 0xE4, 0x02, 0x20, 0x69, 0x61, 0x3C, 0x8E, 0xDD, 0x09, 0x6B, 0x10, 0x65, 0x6A, 0xE2, 0xE7, 0xCA, 0xE5, 0xCD, 0x92, 0x28, 0xB4, 0x04, 0xD0, 0x0D, 0xF5, 0x1F, 0x66, 0x63, 0xC3, 0x4C, 0x93, 0x2D, 0x03, 0x96, 0xFC }, 68 },
+    { "zero digest", 0, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 69 },
+    { "digest above n", 0, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, 32, { 0x02, 0x20, 0x02, 0xF4, 0x9C, 0x58, 0x0E, 0xC5, 0x75, 0xA2, 0x11, 0xC1, 0xF3, 0xA4, 0x40, 0xFB, 0x1C, 0xBA, 0x78, 0x81, 0xEC, 0x26, 0xA1, 0x52, 0xB4, 0x29, 0xD3, 0x53, 0x5B, 0x64, 0xFC, 0x9A, 0xD4, 0xD1, 0x02, 0x21, 0x00, 0xA4, 0xF8, 0xAD, 0x92, 0x03, 0x7A, 0x41, 0x68, 0x54, 0x5A, 0xE0, 0x4E, 0xA4, 0xE5, 0xA5, 0xAF, 0x72, 0x59, 0xDC, 0xFF, 0x58, 0x88, 0xB9, 0x9A, 0x70, 0x6C, 0x87, 0x31, 0x09, 0x89, 0x42, 0x9E }, 69 },
+    { "r zero", 1, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x01, 0x00, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 37 },
+    { "s zero", 1, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x01, 0x00 }, 38 },
+    { "r equals n", 1, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 69 },
+    { "s equals n", 1, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x21, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51 }, 70 },
+    { "trailing byte", 2, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5, 0x00 }, 70 },
+    { "truncated", 2, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B }, 68 },
+    { "negative r", 2, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x01, 0x80, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 37 },
+    { "bad sequence length", 2, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x30, 0x46, 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 71 },
+    { "key off curve", 2, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x63 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 69 },
+    { "key x equals p", 2, { 0x03, 0x42, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 69 },
+    { "bad key header", 2, { 0x03, 0x42, 0x00, 0x02, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8, 0x62 }, 68, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 69 },
+    { "short key", 2, { 0x03, 0x42, 0x00, 0x04, 0x48, 0xC2, 0x53, 0x2E, 0xDC, 0xC8, 0x33, 0xB3, 0x7E, 0x3C, 0x6E, 0x4C, 0x7A, 0x46, 0x01, 0xDC, 0x0B, 0x2F, 0xD5, 0x37, 0xB7, 0x6B, 0xA2, 0x74, 0xDE, 0x01, 0x8F, 0xB1, 0x02, 0xEF, 0xCF, 0xBB, 0x75, 0xEA, 0x4E, 0x58, 0x0C, 0xEA, 0x3B, 0x6E, 0x73, 0x92, 0xBD, 0x17, 0x44, 0xB0, 0xAB, 0xA7, 0x2C, 0xEA, 0x4B, 0x4C, 0xB8, 0xDC, 0x94, 0x0D, 0x89, 0xFC, 0x6B, 0x30, 0x18, 0x09, 0xC8 }, 67, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 32, { 0x02, 0x21, 0x00, 0x85, 0xB6, 0xBF, 0xF5, 0xF9, 0x8B, 0xA9, 0x3E, 0x00, 0x6F, 0xDD, 0x92, 0x4F, 0x58, 0x42, 0x0B, 0x9E, 0xA4, 0x90, 0xF8, 0x1C, 0xE9, 0xF1, 0x51, 0xA7, 0x9D, 0xD4, 0x78, 0xDF, 0xE9, 0x3E, 0xAC, 0x02, 0x20, 0x57, 0x65, 0xD2, 0x6E, 0xA1, 0xB8, 0xFD, 0x75, 0xBD, 0x08, 0x4C, 0xCC, 0xB6, 0x33, 0x3A, 0xDD, 0x05, 0x36, 0x7A, 0xD3, 0xA2, 0x43, 0xD0, 0x0F, 0xF4, 0x95, 0xDB, 0x96, 0xF0, 0x1D, 0x6B, 0xF5 }, 69 },
@@ -0,0 +1,68 @@
+/* Generated by gen_sha_vectors.py from the Python hashlib digests of the pattern messages */
+
+static const sha_vector_t sha_vectors[] =
+{
+    { 0u,
+      { 0xE3, 0xB0, 0xC4, 0x42, 0x98, 0xFC, 0x1C, 0x14, 0x9A, 0xFB, 0xF4, 0xC8, 0x99, 0x6F, 0xB9, 0x24, 0x27, 0xAE, 0x41, 0xE4, 0x64, 0x9B, 0x93, 0x4C, 0xA4, 0x95, 0x99, 0x1B, 0x78, 0x52, 0xB8, 0x55 },
+      { 0x38, 0xB0, 0x60, 0xA7, 0x51, 0xAC, 0x96, 0x38, 0x4C, 0xD9, 0x32, 0x7E, 0xB1, 0xB1, 0xE3, 0x6A, 0x21, 0xFD, 0xB7, 0x11, 0x14, 0xBE, 0x07, 0x43, 0x4C, 0x0C, 0xC7, 0xBF, 0x63, 0xF6, 0xE1, 0xDA, 0x27, 0x4E, 0xDE, 0xBF, 0xE7, 0x6F, 0x65, 0xFB, 0xD5, 0x1A, 0xD2, 0xF1, 0x48, 0x98, 0xB9, 0x5B } },
+    { 1u,
+      { 0xCA, 0x35, 0x87, 0x58, 0xF6, 0xD2, 0x7E, 0x6C, 0xF4, 0x52, 0x72, 0x93, 0x79, 0x77, 0xA7, 0x48, 0xFD, 0x88, 0x39, 0x1D, 0xB6, 0x79, 0xCE, 0xDA, 0x7D, 0xC7, 0xBF, 0x1F, 0x00, 0x5E, 0xE8, 0x79 },
+      { 0xF1, 0x2B, 0xE9, 0x50, 0x11, 0xFA, 0x37, 0xDE, 0x81, 0xBF, 0x76, 0xBE, 0xE4, 0xE7, 0x3A, 0x99, 0x2F, 0x43, 0x1A, 0x7C, 0x69, 0xB6, 0x0D, 0x24, 0x95, 0xC7, 0x38, 0x3A, 0xE0, 0x54, 0x55, 0x69, 0x84, 0x2A, 0x0C, 0x01, 0x9D, 0x89, 0xC2, 0x08, 0xAE, 0x48, 0xF8, 0x43, 0x56, 0x2B, 0x56, 0xFF } },
+    { 3u,
+      { 0x64, 0x76, 0x74, 0xA2, 0x96, 0x19, 0x74, 0x42, 0xF5, 0x18, 0xBC, 0xCA, 0x32, 0x3E, 0xC6, 0x05, 0xDD, 0x8D, 0x09, 0x8B, 0x2D, 0x4F, 0x22, 0xEE, 0x1F, 0xDC, 0xDD, 0x2B, 0xB7, 0x53, 0xA1, 0x89 },
+      { 0x8E, 0xDE, 0x49, 0x67, 0x46, 0x97, 0xFB, 0x7D, 0x10, 0xA0, 0x25, 0x27, 0x9F, 0x18, 0x8F, 0xE5, 0x43, 0xF3, 0xD3, 0x9E, 0xCB, 0xEC, 0x2C, 0x1A, 0x00, 0x23, 0x61, 0xD0, 0x07, 0x63, 0x21, 0x09, 0x86, 0xD3, 0x67, 0x41, 0xE1, 0xDE, 0xDF, 0x18, 0xAA, 0x77, 0x37, 0x56, 0x0E, 0x83, 0x84, 0x4A } },
+    { 55u,
+      { 0x8A, 0xA9, 0x94, 0x58, 0x41, 0x39, 0xD1, 0x28, 0x84, 0x8E, 0xEE, 0xBC, 0x4E, 0x81, 0x56, 0x39, 0xBA, 0x5A, 0xB6, 0xE6, 0xE3, 0x95, 0x74, 0x19, 0x5A, 0x63, 0xAC, 0x4F, 0x14, 0xF7, 0xC4, 0x3B },
+      { 0xC3, 0xFC, 0x2E, 0xFB, 0x3F, 0x7F, 0x03, 0x95, 0x7F, 0xED, 0x59, 0x46, 0x38, 0xFC, 0x1A, 0x9E, 0x5B, 0x79, 0x08, 0x44, 0x91, 0x3E, 0x7F, 0xD4, 0x3A, 0xD2, 0x9A, 0x26, 0xBD, 0x5E, 0x5A, 0xAF, 0x49, 0x4A, 0x13, 0x7C, 0xC3, 0xF2, 0x82, 0xD7, 0x3E, 0x77, 0x8D, 0x77, 0xD3, 0xC1, 0xC0, 0x36 } },
+    { 56u,
+      { 0xAD, 0x57, 0x47, 0x08, 0xF7, 0x5C, 0x04, 0x4C, 0x9B, 0x85, 0xDE, 0x64, 0xCB, 0x56, 0x8E, 0xE7, 0x71, 0x1F, 0xF4, 0xF3, 0x64, 0x48, 0xC6, 0x24, 0x2F, 0x05, 0x3B, 0xA8, 0xF6, 0xCC, 0x2B, 0x63 },
+      { 0x29, 0xD6, 0x2E, 0xDE, 0x66, 0x6E, 0xD7, 0x86, 0x53, 0xA8, 0xF0, 0x2F, 0x92, 0xEB, 0x8A, 0x02, 0xB4, 0xB6, 0x27, 0xD1, 0x5F, 0x0E, 0x6D, 0x61, 0x29, 0x1F, 0x63, 0xB0, 0xEC, 0x15, 0x95, 0x86, 0x31, 0x6F, 0xBE, 0x3F, 0x24, 0x50, 0xD0, 0x1C, 0x82, 0xD8, 0x6E, 0x52, 0xAE, 0x75, 0x44, 0x83 } },
+    { 57u,
+      { 0x5B, 0x46, 0xE5, 0x02, 0x09, 0x2B, 0xE0, 0x1B, 0x11, 0x00, 0x19, 0x3E, 0x08, 0x9F, 0xDD, 0xA9, 0x56, 0x38, 0xC1, 0x2E, 0x19, 0xA1, 0xD2, 0x4F, 0x30, 0x8E, 0xB2, 0xC3, 0xD3, 0xAE, 0x84, 0x9D },
+      { 0xF7, 0xDB, 0x52, 0xED, 0x07, 0xC2, 0x67, 0x90, 0x44, 0xCE, 0xE4, 0xA2, 0x15, 0xE7, 0x0C, 0x29, 0x7B, 0xE5, 0xE6, 0x6B, 0xF9, 0x1A, 0xD4, 0x34, 0xB4, 0x13, 0xE1, 0xDB, 0x82, 0x9B, 0x35, 0x49, 0x51, 0x16, 0x02, 0x7C, 0x13, 0xEF, 0x99, 0x44, 0x60, 0xE0, 0x46, 0xE6, 0xF9, 0x55, 0xB5, 0x3E } },
+    { 63u,
+      { 0x28, 0x0E, 0xD3, 0xE8, 0xFF, 0x1D, 0xF8, 0x45, 0xB2, 0xE7, 0xDF, 0xE6, 0xAC, 0x6C, 0xEE, 0x81, 0x7B, 0xEF, 0x20, 0xE7, 0x83, 0xCC, 0x65, 0xAB, 0xC4, 0x1B, 0x81, 0x8B, 0x4D, 0x2F, 0xE0, 0x76 },
+      { 0xCD, 0x86, 0x21, 0x42, 0x1F, 0x3E, 0xCA, 0x8F, 0x41, 0xD9, 0xD3, 0x5B, 0x21, 0x00, 0x98, 0x46, 0x01, 0x8E, 0x27, 0x62, 0x78, 0x19, 0x57, 0x98, 0xFB, 0x84, 0xE4, 0x67, 0x00, 0xBA, 0xDD, 0xD9, 0x4D, 0xD0, 0xAE, 0x8E, 0x82, 0x30, 0xD1, 0xF3, 0xBA, 0xC6, 0x69, 0x97, 0xFB, 0x62, 0xA3, 0x69 } },
+    { 64u,
+      { 0xC6, 0xAB, 0x97, 0x24, 0xAD, 0xE5, 0xB6, 0xA7, 0xA1, 0xED, 0xFF, 0xFB, 0x12, 0xF3, 0xAA, 0x91, 0x81, 0x35, 0x13, 0x55, 0xAF, 0x8F, 0xD0, 0x8C, 0x91, 0x99, 0x52, 0xAD, 0x21, 0x13, 0x39, 0xDD },
+      { 0x5A, 0x7C, 0x05, 0x8D, 0xE8, 0xF3, 0xC7, 0xE5, 0xEB, 0x66, 0xAC, 0xA0, 0xF9, 0x9B, 0x51, 0x86, 0x0F, 0x93, 0x6B, 0xAC, 0xA1, 0x31, 0xC7, 0x7D, 0x90, 0xDE, 0x19, 0xFA, 0x1B, 0xBF, 0x7C, 0x20, 0x84, 0x08, 0xB6, 0xDB, 0xE4, 0x35, 0x4A, 0x9B, 0x27, 0x9E, 0xF4, 0xEA, 0xB0, 0x9A, 0xCD, 0x6E } },
+    { 65u,
+      { 0x78, 0x83, 0x67, 0xC7, 0x3C, 0x7D, 0xDF, 0x4C, 0x53, 0xF6, 0x5E, 0x68, 0xCC, 0x0D, 0x94, 0x3E, 0x62, 0x27, 0xAB, 0x55, 0xB0, 0xE7, 0x8B, 0xA6, 0x3A, 0xCE, 0x82, 0x2B, 0x1C, 0x63, 0x01, 0xC0 },
+      { 0xD4, 0x20, 0x93, 0x20, 0xED, 0xAE, 0x69, 0x57, 0x66, 0x36, 0x8C, 0xC9, 0x42, 0x30, 0x0D, 0x25, 0x93, 0x1A, 0x76, 0x95, 0xA9, 0xAF, 0x88, 0x85, 0xE9, 0x50, 0xE1, 0x75, 0x7D, 0x66, 0xDA, 0x8A, 0xE1, 0xEB, 0x51, 0xA4, 0xFF, 0xB1, 0x3B, 0x49, 0x74, 0x52, 0x04, 0xCA, 0x84, 0xA1, 0xB2, 0x17 } },
+    { 111u,
+      { 0xDD, 0x14, 0x13, 0x17, 0x8F, 0xB6, 0x27, 0xF9, 0xAB, 0xBC, 0x04, 0x1F, 0xFE, 0x39, 0xC4, 0x4A, 0xA7, 0xAA, 0xA0, 0xE2, 0xE6, 0xD2, 0xCA, 0x5C, 0x45, 0x28, 0xAC, 0x70, 0x73, 0xA2, 0xDA, 0x45 },
+      { 0x59, 0x22, 0xD1, 0x69, 0xE5, 0x53, 0x26, 0x7E, 0x18, 0x46, 0xAE, 0x21, 0x28, 0xA0, 0x26, 0x40, 0x7F, 0xAF, 0x48, 0x7D, 0xAB, 0x98, 0xDF, 0xB3, 0x83, 0xE7, 0x51, 0xD3, 0x84, 0x6F, 0x82, 0xF6, 0xED, 0xBE, 0x70, 0xB4, 0x8B, 0x62, 0x02, 0x32, 0x75, 0x16, 0x15, 0x9D, 0x34, 0x0C, 0x56, 0xA9 } },
+    { 112u,
+      { 0xA6, 0x5C, 0x92, 0xDA, 0xC1, 0x24, 0x06, 0x2D, 0x0A, 0xB9, 0x51, 0xA4, 0x27, 0x73, 0xCB, 0x04, 0xFC, 0x98, 0xD1, 0xD4, 0xBF, 0x88, 0x97, 0xB1, 0x76, 0xF8, 0xCF, 0xF3, 0x50, 0x9D, 0x37, 0x9E },
+      { 0xB4, 0x2A, 0xFF, 0x1D, 0x6D, 0x29, 0x81, 0x52, 0x80, 0x14, 0x80, 0xCB, 0x2B, 0x58, 0x51, 0xC3, 0x2A, 0xFE, 0x5E, 0x5F, 0xBA, 0xE5, 0x83, 0xB0, 0xA9, 0xB5, 0x2F, 0xE9, 0x55, 0x44, 0x0C, 0x3F, 0x27, 0x6F, 0xD8, 0x12, 0xC0, 0xF4, 0x43, 0x9C, 0xF9, 0x4C, 0x3F, 0x9E, 0x03, 0x06, 0x8A, 0x21 } },
+    { 113u,
+      { 0x6F, 0x18, 0x4B, 0x66, 0x19, 0x12, 0x8E, 0x86, 0x5E, 0xCB, 0x2B, 0x3E, 0xA9, 0x6C, 0x03, 0xD4, 0x61, 0xF0, 0x66, 0x4D, 0x87, 0x68, 0x94, 0x80, 0x98, 0x8D, 0xBE, 0xE5, 0x3A, 0x44, 0x91, 0x61 },
+      { 0x8C, 0xB4, 0x79, 0xA9, 0xA1, 0xE2, 0xAB, 0xE9, 0xE2, 0x71, 0xA3, 0x1F, 0x09, 0x53, 0x4A, 0x46, 0xEA, 0x43, 0x88, 0x42, 0x74, 0x47, 0x03, 0x90, 0x45, 0x58, 0xCA, 0x58, 0x49, 0xE7, 0xDC, 0x5E, 0xE7, 0xB6, 0x25, 0x94, 0xE0, 0x08, 0x96, 0x2E, 0x4D, 0xAC, 0x5D, 0xA8, 0xB7, 0x46, 0xBE, 0xD6 } },
+    { 119u,
+      { 0x3D, 0x61, 0x05, 0x47, 0xD6, 0x82, 0x16, 0xDE, 0xDF, 0x74, 0x35, 0xA4, 0xFB, 0x62, 0x60, 0x35, 0x39, 0x11, 0xF6, 0xB3, 0xFD, 0x3F, 0x18, 0x80, 0x5D, 0xDB, 0x8B, 0xE2, 0x85, 0xD7, 0x26, 0xFE },
+      { 0x1A, 0x2B, 0xD6, 0x9D, 0x2B, 0x68, 0x0D, 0xB1, 0xD8, 0x3E, 0xB9, 0xB0, 0xC9, 0xEC, 0xF9, 0x47, 0xC3, 0xFE, 0x47, 0x92, 0x96, 0x58, 0x33, 0xE3, 0xDE, 0x47, 0x85, 0xDA, 0xBC, 0xDD, 0xD7, 0x26, 0xD9, 0x97, 0xBE, 0x6C, 0xC0, 0xAB, 0xED, 0xB7, 0xB6, 0xD3, 0x45, 0x5C, 0xCB, 0x93, 0x65, 0x96 } },
+    { 120u,
+      { 0x1F, 0x80, 0x15, 0x6A, 0x80, 0x4C, 0xB7, 0x86, 0x2A, 0xD1, 0x13, 0xE8, 0x20, 0x0E, 0x9D, 0x74, 0x49, 0x97, 0x23, 0xE7, 0xC7, 0x85, 0x4D, 0x5F, 0x48, 0x77, 0x6D, 0x31, 0x48, 0xE0, 0x96, 0x56 },
+      { 0x7F, 0x33, 0xA1, 0x3D, 0xC3, 0x02, 0xAA, 0x53, 0x2D, 0x01, 0x17, 0x06, 0x92, 0xB7, 0x85, 0x35, 0xD5, 0xC8, 0x46, 0xEB, 0x95, 0x43, 0xDE, 0x7A, 0x8D, 0x13, 0xA9, 0x70, 0x54, 0xDD, 0xB7, 0x35, 0x7A, 0xBC, 0x5E, 0xDF, 0x28, 0xEB, 0x6D, 0x03, 0x21, 0x63, 0x4B, 0x81, 0x25, 0x3D, 0xF2, 0x29 } },
+    { 127u,
+      { 0x19, 0x24, 0x09, 0xCD, 0x28, 0x0E, 0x14, 0xB7, 0x43, 0x64, 0x2A, 0xD1, 0x34, 0x3F, 0xBD, 0x3E, 0x82, 0xD9, 0x30, 0x5D, 0xE7, 0x2C, 0x07, 0x81, 0x17, 0x74, 0x5A, 0x67, 0x92, 0x10, 0xCC, 0x3D },
+      { 0xE0, 0xCC, 0x0D, 0xA3, 0x8B, 0x3A, 0x32, 0x57, 0x28, 0x51, 0xD1, 0x99, 0xE9, 0xE4, 0x85, 0xAF, 0xE1, 0xE6, 0x2F, 0x5C, 0x24, 0xAC, 0x1C, 0x7F, 0x0B, 0x66, 0x80, 0xA1, 0xEA, 0x9F, 0xEB, 0xBE, 0x49, 0xD0, 0x29, 0x23, 0x61, 0x7D, 0x02, 0x07, 0x4D, 0xD2, 0xAD, 0x70, 0xB5, 0x67, 0x13, 0x89 } },
+    { 128u,
+      { 0xCC, 0x54, 0x8C, 0xA2, 0xDE, 0xC1, 0xF6, 0xFE, 0x4F, 0x58, 0xB2, 0xE2, 0x7A, 0xA9, 0xC7, 0x52, 0x16, 0x07, 0xDF, 0x11, 0x30, 0xD1, 0x40, 0xB5, 0x5A, 0x4D, 0xAD, 0x06, 0x65, 0x30, 0x23, 0x56 },
+      { 0x95, 0xAB, 0x88, 0x10, 0x9C, 0xBF, 0x11, 0x75, 0x48, 0xA8, 0xAD, 0x35, 0x90, 0x9F, 0xFE, 0xFA, 0x17, 0x5D, 0x06, 0xA9, 0xC4, 0x26, 0x14, 0xB9, 0xD3, 0x59, 0x54, 0x8C, 0xFF, 0x5D, 0x55, 0x0B, 0x30, 0xAF, 0xFB, 0x36, 0xFF, 0x63, 0x8C, 0xD3, 0x2A, 0xA5, 0xF5, 0x40, 0x90, 0x66, 0xC6, 0x8A } },
+    { 129u,
+      { 0x81, 0xE8, 0x9A, 0x7B, 0x29, 0x11, 0xAA, 0xA7, 0x79, 0x5F, 0x9E, 0x3D, 0x49, 0x10, 0xCB, 0x47, 0xD6, 0xCD, 0x2B, 0x00, 0xD8, 0x3B, 0x83, 0x99, 0x48, 0x15, 0x27, 0x26, 0x1A, 0x1A, 0x75, 0x19 },
+      { 0x1D, 0x05, 0x99, 0xFA, 0x8C, 0x2D, 0x4E, 0x8D, 0x62, 0x67, 0x78, 0x05, 0x1D, 0xA6, 0x2B, 0x78, 0xA0, 0xEC, 0xC7, 0x6C, 0xBF, 0xDC, 0x56, 0x87, 0x30, 0x20, 0x48, 0x37, 0x3D, 0x1F, 0x8A, 0x5E, 0x77, 0x2F, 0x19, 0xAE, 0xAF, 0x7B, 0xE2, 0x5F, 0x68, 0xE0, 0xCC, 0xF4, 0xF0, 0xB7, 0xF8, 0xA8 } },
+    { 255u,
+      { 0xC9, 0x24, 0x1B, 0xC4, 0x5A, 0x34, 0xA7, 0xE4, 0x02, 0x8B, 0x10, 0x34, 0x6F, 0x6E, 0xDC, 0x63, 0x36, 0xC1, 0x1C, 0x4E, 0x24, 0x84, 0xDF, 0xF4, 0xE4, 0xCF, 0xF7, 0x4A, 0x00, 0x3B, 0x6D, 0xA1 },
+      { 0x8D, 0x67, 0xA2, 0x0E, 0xB6, 0x19, 0xE8, 0x7B, 0xD1, 0x08, 0x3A, 0x1B, 0x61, 0x6E, 0xB5, 0x40, 0x6D, 0x77, 0xC8, 0xFC, 0x2B, 0x08, 0x94, 0xB7, 0x08, 0x2E, 0x31, 0x6D, 0x67, 0xE5, 0xB4, 0xD4, 0x8F, 0xB4, 0x5D, 0x3C, 0xA8, 0x24, 0xFD, 0x20, 0x4A, 0x8D, 0x47, 0x89, 0x6A, 0x95, 0x36, 0x8F } },
+    { 256u,
+      { 0xC8, 0xC6, 0xE0, 0x2D, 0x59, 0x7F, 0xA6, 0xC4, 0x07, 0xA5, 0xFE, 0xC3, 0x0C, 0x98, 0x1C, 0x7B, 0xBA, 0xD0, 0x89, 0x72, 0x24, 0x0E, 0xEA, 0x89, 0x84, 0x1B, 0x8F, 0x37, 0xE2, 0xFB, 0xF3, 0x2C },
+      { 0x13, 0x09, 0x81, 0x13, 0x05, 0xEF, 0xC7, 0x36, 0x54, 0xED, 0xE7, 0x3C, 0x40, 0xAA, 0xFF, 0x0F, 0x19, 0x35, 0x3C, 0x32, 0x16, 0x89, 0xDC, 0xBB, 0x04, 0x13, 0x8A, 0xB3, 0xFF, 0xF3, 0xA6, 0xEA, 0xBB, 0xC5, 0xA6, 0x5A, 0xF0, 0x8D, 0xA0, 0x9F, 0xE4, 0x47, 0x66, 0xD9, 0xE2, 0x23, 0x82, 0x6E } },
+    { 1000u,
+      { 0x50, 0x97, 0xE7, 0xD5, 0x87, 0x35, 0x2F, 0x50, 0x97, 0x06, 0x2A, 0xE6, 0x79, 0xF3, 0x7B, 0xDA, 0x58, 0x02, 0xD9, 0xF8, 0x75, 0xAB, 0xA1, 0x4C, 0x8C, 0xB4, 0xD1, 0xA1, 0x88, 0xAD, 0xA1, 0x79 },
+      { 0x4F, 0x33, 0xE6, 0xBD, 0xC2, 0x2D, 0x21, 0x29, 0x24, 0x5D, 0x83, 0x2F, 0x3B, 0x14, 0x97, 0x70, 0xB7, 0x99, 0xAA, 0x9E, 0x63, 0xB4, 0xC7, 0x9B, 0xD3, 0x07, 0x3A, 0xCA, 0x7E, 0x5A, 0xFC, 0x83, 0x32, 0xC8, 0x3C, 0xAC, 0xE1, 0xF5, 0xD8, 0x1C, 0x22, 0xA2, 0x56, 0xF0, 0x9D, 0xCB, 0x3F, 0x98 } },
+    { 4096u,
+      { 0xD4, 0x1D, 0x43, 0x8C, 0x37, 0x91, 0x10, 0xC7, 0xF7, 0xB2, 0xC5, 0x61, 0xB1, 0xF0, 0x4F, 0x26, 0xC1, 0xB4, 0x54, 0x91, 0x10, 0x79, 0x1F, 0x8E, 0x02, 0x2F, 0x48, 0x97, 0x42, 0x80, 0xC1, 0x3E },
+      { 0x5A, 0xCD, 0x4D, 0x2B, 0x1F, 0x3E, 0x7A, 0x6D, 0x4D, 0x32, 0xDF, 0xC1, 0xAD, 0xF9, 0x9C, 0xEF, 0x86, 0xDB, 0xAD, 0x1C, 0x30, 0x7A, 0x21, 0xF8, 0x27, 0x74, 0x09, 0x03, 0x65, 0x88, 0xAB, 0xCD, 0x38, 0x07, 0xA8, 0x60, 0x9C, 0x04, 0xD9, 0xD5, 0xDF, 0x8D, 0x7B, 0x36, 0xA7, 0xDE, 0xE7, 0x10 } },
+};
@@ -0,0 +1,54 @@
+/*
+ * FreeRTOS types and port macros of the host simulator. The kernel services are implemented
+ * by sim_rtos.c on cooperative tasks, see sim.h.
+ */
+
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint16_t configSTACK_DEPTH_TYPE;
+
+#include "FreeRTOSConfig.h"
+
+#define pdTRUE                          (1)
+#define pdFALSE                         (0)
+#define pdPASS                          (1)
+#define pdFAIL                          (0)
+#define portMAX_DELAY                   ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS              ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(((TickType_t)(ms) * configTICK_RATE_HZ) / 1000U))
+#define tskIDLE_PRIORITY                (0)
+
+typedef struct sim_task * TaskHandle_t;
+typedef struct sim_sem * SemaphoreHandle_t;
+typedef struct sim_sem * QueueHandle_t;
+typedef struct sim_timer * TimerHandle_t;
+
+/* Semaphore, statically created ones live in their StaticSemaphore_t */
+struct sim_sem
+{
+    UBaseType_t count;
+    UBaseType_t maxCount;
+};
+
+typedef struct sim_sem StaticSemaphore_t;
+typedef void (*TaskFunction_t)(void *);
+
+void sim_assert_failed(const char *file, int line);
+void sim_yield_from_isr(BaseType_t woken);
+void sim_critical_enter(void);
+void sim_critical_exit(void);
+
+#define configASSERT(x)                 do { if (!(x)) { sim_assert_failed(__FILE__, __LINE__); } } while (0)
+#define portYIELD_FROM_ISR(woken)       sim_yield_from_isr(woken)
+#define portENTER_CRITICAL()            sim_critical_enter()
+#define portEXIT_CRITICAL()             sim_critical_exit()
+
+#endif /* SIM_FREERTOS_H */
@@ -0,0 +1,17 @@
+/*
+ * FreeRTOS configuration of the host simulator, with the tick rate, priorities and timer
+ * service settings of the firmware FreeRTOSConfig.h.
+ */
+
+#ifndef SIM_FREERTOS_CONFIG_H
+#define SIM_FREERTOS_CONFIG_H
+
+#define configTICK_RATE_HZ                      ((TickType_t)1000)
+#define configMAX_PRIORITIES                    (15)
+#define configMINIMAL_STACK_SIZE                ((unsigned short)100)
+#define configTIMER_TASK_PRIORITY               (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH                (20)
+#define configTIMER_TASK_STACK_DEPTH            ((unsigned short)512)
+#define configUSE_TIMERS                        (1)
+
+#endif /* SIM_FREERTOS_CONFIG_H */
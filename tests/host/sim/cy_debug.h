@@ -0,0 +1,18 @@
+/* Debug log of the host simulator: printed with the simulated time when SIM_VERBOSE is set. */
+
+#ifndef SIM_CY_DEBUG_H
+#define SIM_CY_DEBUG_H
+
+#include "cy_pdl.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+void sim_log(const char *level, const char *format, ...);
+
+#define DBG_APP_INFO(...)               sim_log("INFO", __VA_ARGS__)
+#define DBG_APP_WARN(...)               sim_log("WARN", __VA_ARGS__)
+#define DBG_APP_ERR(...)                sim_log("ERR", __VA_ARGS__)
+#define Cy_Debug_AddToLog(level, ...)   sim_log("LOG", __VA_ARGS__)
+
+#endif /* SIM_CY_DEBUG_H */
@@ -0,0 +1,2 @@
+/* Part of the PDL subset of the host simulator. */
+#include "cy_pdl.h"
@@ -0,0 +1,404 @@
+/*
+ * Subset of the CAT1A peripheral driver library used by usb_i2c.c, the OPTIGA PAL and the
+ * application, for the host simulator. SCB0 is a functional I2C master (sim_scb.c) with a bus
+ * timing model, the clock, interrupt, TCPWM and SysLib calls act on the simulated time and
+ * interrupt lines (sim_rtos.c).
+ */
+
+#ifndef SIM_CY_PDL_H
+#define SIM_CY_PDL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define CY_CPU_CORTEX_M4                (1)
+#define __CORTEX_M                      (4U)
+#define CY_UNUSED_PARAMETER(x)          (void)(x)
+#define CY_HALT()                       sim_assert_failed(__FILE__, __LINE__)
+#define CY_ASSERT(x)                    do { if (!(x)) { sim_assert_failed(__FILE__, __LINE__); } } while (0)
+
+void sim_assert_failed(const char *file, int line);
+
+/* Interrupts: a handler installed and enabled on a line runs when the simulated hardware raises it */
+typedef void (*cy_israddress)(void);
+typedef int IRQn_Type;
+
+#define NvicMux3_IRQn                   (3)
+#define NvicMux4_IRQn                   (4)
+#define scb_0_interrupt_IRQn            (10)
+#define tcpwm_0_interrupts_0_IRQn       (80)
+#define SIM_IRQ_COUNT                   (128)
+
+typedef enum
+{
+    CY_SYSINT_SUCCESS = 0,
+    CY_SYSINT_BAD_PARAM
+} cy_en_sysint_status_t;
+
+typedef struct
+{
+    IRQn_Type intrSrc;
+    IRQn_Type cm0pSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+
+/* Cycle counter, running at SystemCoreClock with the simulated time */
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type sim_dwt;
+extern CoreDebug_Type sim_core_debug;
+extern uint32_t SystemCoreClock;
+
+#define DWT                             (&sim_dwt)
+#define CoreDebug                       (&sim_core_debug)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+
+/* SysLib */
+void Cy_SysLib_DelayUs(uint16_t microseconds);
+void Cy_SysLib_Delay(uint32_t milliseconds);
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+
+/* Peripheral clock dividers */
+typedef enum
+{
+    CY_SYSCLK_DIV_8_BIT = 0,
+    CY_SYSCLK_DIV_16_BIT,
+    CY_SYSCLK_DIV_16_5_BIT,
+    CY_SYSCLK_DIV_24_5_BIT
+} cy_en_divider_types_t;
+
+typedef enum
+{
+    CY_SYSCLK_SUCCESS = 0,
+    CY_SYSCLK_BAD_PARAM
+} cy_en_sysclk_status_t;
+
+typedef int en_clk_dst_t;
+
+#define PCLK_SCB0_CLOCK                 (5)
+#define PCLK_TCPWM0_CLOCKS0             (30)
+
+uint32_t Cy_SysClk_ClkPeriGetFrequency(void);
+cy_en_sysclk_status_t Cy_SysClk_PeriphSetDivider(cy_en_divider_types_t dividerType, uint32_t dividerNum,
+                                                 uint32_t dividerValue);
+cy_en_sysclk_status_t Cy_SysClk_PeriphEnableDivider(cy_en_divider_types_t dividerType, uint32_t dividerNum);
+cy_en_sysclk_status_t Cy_SysClk_PeriphDisableDivider(cy_en_divider_types_t dividerType, uint32_t dividerNum);
+cy_en_sysclk_status_t Cy_SysClk_PeriphAssignDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                                    uint32_t dividerNum);
+
+/* GPIO: the pin configurations are kept for the tests to look at */
+typedef struct
+{
+    uint32_t port;
+} GPIO_PRT_Type;
+
+extern GPIO_PRT_Type sim_gpio_port[16];
+
+#define P10_0_PORT                      (&sim_gpio_port[10])
+#define P10_0_PIN                       (0U)
+#define P10_1_PORT                      (&sim_gpio_port[10])
+#define P10_1_PIN                       (1U)
+#define P10_0_SCB0_I2C_SCL              (14U)
+#define P10_1_SCB0_I2C_SDA              (14U)
+
+#define CY_GPIO_DM_ANALOG               (0x00UL)
+#define CY_GPIO_DM_PULLUP               (0x0AUL)
+#define CY_GPIO_DM_OD_DRIVESLOW         (0x0CUL)
+#define CY_GPIO_DM_STRONG_IN_OFF        (0x06UL)
+#define CY_GPIO_DRIVE_FULL              (0x00UL)
+#define CY_GPIO_DRIVE_1_2               (0x01UL)
+#define CY_GPIO_SLEW_FAST               (0x00UL)
+#define CY_GPIO_SLEW_SLOW               (0x01UL)
+
+typedef enum
+{
+    CY_GPIO_SUCCESS = 0,
+    CY_GPIO_BAD_PARAM
+} cy_en_gpio_status_t;
+
+typedef struct
+{
+    uint32_t outVal;
+    uint32_t driveMode;
+    uint32_t hsiom;
+    uint32_t intEdge;
+    uint32_t intMask;
+    uint32_t vtrip;
+    uint32_t slewRate;
+    uint32_t driveSel;
+    uint32_t vregEn;
+    uint32_t ibufMode;
+    uint32_t vtripSel;
+    uint32_t vrefSel;
+    uint32_t vohSel;
+} cy_stc_gpio_pin_config_t;
+
+cy_en_gpio_status_t Cy_GPIO_Pin_Init(GPIO_PRT_Type *base, uint32_t pinNum, const cy_stc_gpio_pin_config_t *config);
+void Cy_GPIO_SetSlewRate(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+void Cy_GPIO_SetDriveSel(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+
+/* SCB in I2C master mode */
+typedef struct
+{
+    volatile uint32_t CTRL;
+} CySCB_Type;
+
+extern CySCB_Type sim_scb0;
+
+#define SCB0                            (&sim_scb0)
+
+typedef enum
+{
+    CY_SCB_I2C_SUCCESS = 0,
+    CY_SCB_I2C_BAD_PARAM,
+    CY_SCB_I2C_MASTER_NOT_READY,
+    CY_SCB_I2C_MASTER_MANUAL_TIMEOUT,
+    CY_SCB_I2C_MASTER_MANUAL_ADDR_NAK,
+    CY_SCB_I2C_MASTER_MANUAL_NAK,
+    CY_SCB_I2C_MASTER_MANUAL_ARB_LOST,
+    CY_SCB_I2C_MASTER_MANUAL_BUS_ERR,
+    CY_SCB_I2C_MASTER_MANUAL_ABORT_START
+} cy_en_scb_i2c_status_t;
+
+typedef enum
+{
+    CY_SCB_I2C_WRITE_XFER = 0,
+    CY_SCB_I2C_READ_XFER = 1
+} cy_en_scb_i2c_direction_t;
+
+typedef enum
+{
+    CY_SCB_I2C_ACK = 0,
+    CY_SCB_I2C_NAK
+} cy_en_scb_i2c_command_t;
+
+typedef enum
+{
+    CY_SCB_I2C_SLAVE = 1,
+    CY_SCB_I2C_MASTER = 2
+} cy_en_scb_i2c_mode_t;
+
+/* Driver states, the bus is held by a transfer in any state but idle */
+#define CY_SCB_I2C_IDLE                 (0x10000000UL)
+#define CY_SCB_I2C_MASTER_ACTIVE        (0x00100000UL)
+#define CY_SCB_I2C_MASTER_WAIT          (0x10100000UL)
+
+/* Master status */
+#define CY_SCB_I2C_MASTER_BUSY          (0x00010000UL)
+#define CY_SCB_I2C_MASTER_ADDR_NAK      (0x00000100UL)
+#define CY_SCB_I2C_MASTER_DATA_NAK      (0x00000200UL)
+#define CY_SCB_I2C_MASTER_ARB_LOST      (0x00000400UL)
+#define CY_SCB_I2C_MASTER_BUS_ERR       (0x00000800UL)
+#define CY_SCB_I2C_MASTER_ABORT_START   (0x00001000UL)
+#define CY_SCB_I2C_MASTER_ERR           (0x00001F00UL)
+
+/* Master events */
+#define CY_SCB_I2C_MASTER_WR_IN_FIFO_EVENT  (0x00020000UL)
+#define CY_SCB_I2C_MASTER_WR_CMPLT_EVENT    (0x00040000UL)
+#define CY_SCB_I2C_MASTER_RD_CMPLT_EVENT    (0x00080000UL)
+#define CY_SCB_I2C_MASTER_ERR_EVENT         (0x00100000UL)
+
+#define CY_SCB_I2C_MASTER_INTR_ALL      (0x000003FFUL)
+
+#define CY_SCB_I2C_STD_DATA_RATE        (100000U)
+#define CY_SCB_I2C_FST_DATA_RATE        (400000U)
+#define CY_SCB_I2C_FSTP_DATA_RATE       (1000000U)
+
+/* SCB clock windows of the master in each mode */
+#define CY_SCB_I2C_MASTER_STD_CLK_MIN   (1550000U)
+#define CY_SCB_I2C_MASTER_STD_CLK_MAX   (3200000U)
+#define CY_SCB_I2C_MASTER_FST_CLK_MIN   (7820000U)
+#define CY_SCB_I2C_MASTER_FST_CLK_MAX   (10000000U)
+#define CY_SCB_I2C_MASTER_FSTP_CLK_MIN  (14320000U)
+#define CY_SCB_I2C_MASTER_FSTP_CLK_MAX  (25800000U)
+
+typedef void (*cy_cb_scb_i2c_handle_events_t)(uint32_t event);
+
+typedef struct
+{
+    uint32_t state;
+    uint32_t masterStatus;
+    uint32_t masterNumBytes;
+    cy_cb_scb_i2c_handle_events_t cbEvents;
+} cy_stc_scb_i2c_context_t;
+
+typedef struct
+{
+    uint8_t slaveAddress;
+    uint8_t *buffer;
+    uint32_t bufferSize;
+    bool xferPending;
+} cy_stc_scb_i2c_master_xfer_config_t;
+
+typedef struct
+{
+    cy_en_scb_i2c_mode_t i2cMode;
+    bool useRxFifo;
+    bool useTxFifo;
+    uint8_t slaveAddress;
+    uint8_t slaveAddressMask;
+    bool acceptAddrInFifo;
+    bool ackGeneralAddr;
+    bool enableWakeFromSleep;
+    bool enableDigitalFilter;
+    uint32_t lowPhaseDutyCycle;
+    uint32_t highPhaseDutyCycle;
+} cy_stc_scb_i2c_config_t;
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_Init(CySCB_Type *base, const cy_stc_scb_i2c_config_t *config,
+                                       cy_stc_scb_i2c_context_t *context);
+void Cy_SCB_I2C_DeInit(CySCB_Type *base);
+void Cy_SCB_I2C_Enable(CySCB_Type *base);
+void Cy_SCB_I2C_Disable(CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+uint32_t Cy_SCB_I2C_SetDataRate(CySCB_Type *base, uint32_t dataRateHz, uint32_t scbClockHz);
+void Cy_SCB_I2C_RegisterEventCallback(CySCB_Type const *base, cy_cb_scb_i2c_handle_events_t callback,
+                                      cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStart(CySCB_Type *base, uint32_t address,
+                                                  cy_en_scb_i2c_direction_t bitRnW, uint32_t timeoutMs,
+                                                  cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendReStart(CySCB_Type *base, uint32_t address,
+                                                    cy_en_scb_i2c_direction_t bitRnW, uint32_t timeoutMs,
+                                                    cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStop(CySCB_Type *base, uint32_t timeoutMs,
+                                                 cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterReadByte(CySCB_Type *base, cy_en_scb_i2c_command_t ackNack,
+                                                 uint8_t *byte, uint32_t timeoutMs,
+                                                 cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWriteByte(CySCB_Type *base, uint8_t byte, uint32_t timeoutMs,
+                                                  cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWrite(CySCB_Type *base, cy_stc_scb_i2c_master_xfer_config_t *xferConfig,
+                                              cy_stc_scb_i2c_context_t *context);
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterRead(CySCB_Type *base, cy_stc_scb_i2c_master_xfer_config_t *xferConfig,
+                                             cy_stc_scb_i2c_context_t *context);
+uint32_t Cy_SCB_I2C_MasterGetStatus(CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context);
+uint32_t Cy_SCB_I2C_MasterGetTransferCount(CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context);
+void Cy_SCB_I2C_Interrupt(CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+void Cy_SCB_ClearMasterInterrupt(CySCB_Type *base, uint32_t interruptMask);
+void Cy_SCB_ClearTxFifo(CySCB_Type *base);
+void Cy_SCB_ClearRxFifo(CySCB_Type *base);
+
+/* TCPWM counter in one-shot compare mode, counting at the divided peripheral clock */
+typedef struct
+{
+    volatile uint32_t CTRL;
+} TCPWM_Type;
+
+extern TCPWM_Type sim_tcpwm0;
+
+#define TCPWM0                          (&sim_tcpwm0)
+
+typedef enum
+{
+    CY_TCPWM_SUCCESS = 0,
+    CY_TCPWM_BAD_PARAM
+} cy_en_tcpwm_status_t;
+
+#define CY_TCPWM_COUNTER_PRESCALER_DIVBY_1  (0U)
+#define CY_TCPWM_COUNTER_ONESHOT            (1U)
+#define CY_TCPWM_COUNTER_COUNT_UP           (0U)
+#define CY_TCPWM_COUNTER_MODE_COMPARE       (1U)
+#define CY_TCPWM_INT_ON_TC                  (1U)
+#define CY_TCPWM_INPUT_LEVEL                (3U)
+#define CY_TCPWM_INPUT_1                    (1U)
+
+typedef struct
+{
+    uint32_t period;
+    uint32_t clockPrescaler;
+    uint32_t runMode;
+    uint32_t countDirection;
+    uint32_t compareOrCapture;
+    uint32_t interruptSources;
+    uint32_t countInputMode;
+    uint32_t countInput;
+} cy_stc_tcpwm_counter_config_t;
+
+cy_en_tcpwm_status_t Cy_TCPWM_Counter_Init(TCPWM_Type *base, uint32_t cntNum,
+                                           cy_stc_tcpwm_counter_config_t const *config);
+void Cy_TCPWM_Counter_Enable(TCPWM_Type *base, uint32_t cntNum);
+void Cy_TCPWM_Counter_SetCounter(TCPWM_Type *base, uint32_t cntNum, uint32_t count);
+void Cy_TCPWM_Counter_SetPeriod(TCPWM_Type *base, uint32_t cntNum, uint32_t period);
+void Cy_TCPWM_TriggerStart_Single(TCPWM_Type *base, uint32_t cntNum);
+void Cy_TCPWM_TriggerStopOrKill_Single(TCPWM_Type *base, uint32_t cntNum);
+void Cy_TCPWM_SetInterruptMask(TCPWM_Type *base, uint32_t cntNum, uint32_t source);
+uint32_t Cy_TCPWM_GetInterruptStatusMasked(TCPWM_Type const *base, uint32_t cntNum);
+void Cy_TCPWM_ClearInterrupt(TCPWM_Type *base, uint32_t cntNum, uint32_t source);
+
+/* High bandwidth DMA: the setup calls of the application, buffers come from the host heap */
+typedef struct
+{
+    volatile uint32_t CTRL;
+} LVDSSS_LVDS_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+} USB32DEV_Type;
+
+extern LVDSSS_LVDS_Type sim_lvdsss_lvds;
+extern USB32DEV_Type sim_usb32dev;
+
+#define LVDSSS_LVDS                     (&sim_lvdsss_lvds)
+#define USB32DEV                        (&sim_usb32dev)
+
+typedef enum
+{
+    CY_HBDMA_SUCCESS = 0,
+    CY_HBDMA_BAD_PARAM
+} cy_en_hbdma_status_t;
+
+typedef enum
+{
+    CY_HBDMA_MGR_SUCCESS = 0,
+    CY_HBDMA_MGR_BAD_PARAM,
+    CY_HBDMA_MGR_MEM_NOT_AVAILABLE
+} cy_en_hbdma_mgr_status_t;
+
+typedef struct
+{
+    bool initialized;
+} cy_stc_hbdma_context_t;
+
+typedef struct
+{
+    uint16_t count;
+} cy_stc_hbdma_dscr_list_t;
+
+typedef struct
+{
+    uint32_t regionSize;
+} cy_stc_hbdma_buf_mgr_t;
+
+typedef struct
+{
+    cy_stc_hbdma_context_t *pDrvContext;
+} cy_stc_hbdma_mgr_context_t;
+
+cy_en_hbdma_status_t Cy_HBDma_Init(LVDSSS_LVDS_Type *lvds_base, USB32DEV_Type *usbss_base,
+                                   cy_stc_hbdma_context_t *pDrvContext, uint32_t cb_mem_size_1, uint32_t cb_mem_size_2);
+cy_en_hbdma_mgr_status_t Cy_HBDma_DscrList_Create(cy_stc_hbdma_dscr_list_t *list_p, uint16_t dscrCnt);
+cy_en_hbdma_mgr_status_t Cy_HBDma_BufMgr_Create(cy_stc_hbdma_buf_mgr_t *pBufMgr, uint32_t *startAddr,
+                                                uint32_t regionSize);
+void *Cy_HBDma_BufMgr_Alloc(cy_stc_hbdma_buf_mgr_t *pBufMgr, uint32_t bufferSize);
+cy_en_hbdma_mgr_status_t Cy_HBDma_BufMgr_Free(cy_stc_hbdma_buf_mgr_t *pBufMgr, void *pBuffer);
+cy_en_hbdma_mgr_status_t Cy_HBDma_Mgr_Init(cy_stc_hbdma_mgr_context_t *pContext, cy_stc_hbdma_context_t *pDrvContext,
+                                           cy_stc_hbdma_dscr_list_t *pDscrList, cy_stc_hbdma_buf_mgr_t *pBufMgr);
+
+#endif /* SIM_CY_PDL_H */
@@ -0,0 +1,45 @@
+/* USB stack types named by usb_i2c.h, for the host simulator. The USB blocks are not simulated. */
+
+#ifndef SIM_CY_USBHS_DW_WRAPPER_H
+#define SIM_CY_USBHS_DW_WRAPPER_H
+
+#include "cy_pdl.h"
+
+#define CY_USB_MAX_ENDP_NUMBER          (16U)
+
+typedef enum
+{
+    CY_USB_DEVICE_STATE_DISABLE = 0
+} cy_en_usb_device_state_t;
+
+typedef enum
+{
+    CY_USBD_USB_DEV_NOT_CONFIG = 0
+} cy_en_usb_speed_t;
+
+typedef enum
+{
+    CY_USB_ENUM_METHOD_FAST = 0
+} cy_en_usb_enum_method_t;
+
+typedef struct
+{
+    uint32_t unused;
+} DW_Type;
+
+typedef struct
+{
+    uint32_t unused;
+} DMAC_Type;
+
+typedef struct
+{
+    uint32_t unused;
+} cy_stc_app_endp_dma_set_t;
+
+typedef struct
+{
+    uint32_t unused;
+} cy_stc_usb_usbd_ctxt_t;
+
+#endif /* SIM_CY_USBHS_DW_WRAPPER_H */
@@ -0,0 +1,9 @@
+/* IFX I2C configuration header named by pal_ifx_i2c_config.c, for the host simulator. */
+
+#ifndef SIM_IFX_I2C_CONFIG_H
+#define SIM_IFX_I2C_CONFIG_H
+
+#include "pal_i2c.h"
+#include "pal_gpio.h"
+
+#endif /* SIM_IFX_I2C_CONFIG_H */
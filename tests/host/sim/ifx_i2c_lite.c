@@ -0,0 +1,304 @@
+/*
+ * Minimal IFX I2C master for the host simulator, see ifx_i2c_lite.h.
+ */
+
+#include <string.h>
+#include "ifx_i2c_lite.h"
+
+#define LITE_MAX_NAKS                   (3U)
+
+typedef enum
+{
+    LITE_IDLE = 0,
+    LITE_WRITE_FRAME,                   /* DATA register and the frame */
+    LITE_POLL_SELECT,                   /* I2C_STATE register address */
+    LITE_POLL_READ,
+    LITE_DATA_SELECT,                   /* DATA register address */
+    LITE_DATA_READ,
+    LITE_WRITE_ACK
+} lite_state_t;
+
+static void lite_step(void *p_ctx);
+
+static void lite_schedule(ifx_i2c_lite_t *p_lite, lite_state_t state, uint32_t delay_us)
+{
+    p_lite->state = state;
+    pal_os_event_register_callback_oneshot(p_lite->pEvent, lite_step, p_lite, delay_us);
+}
+
+static void lite_finish(ifx_i2c_lite_t *p_lite, optiga_lib_status_t status)
+{
+    p_lite->state = LITE_IDLE;
+    if (OPTIGA_LIB_SUCCESS != status)
+    {
+        p_lite->stats.errors++;
+    }
+    p_lite->done(p_lite->pDoneCtx, status);
+}
+
+static void lite_poll_again(ifx_i2c_lite_t *p_lite)
+{
+    p_lite->stats.busyPolls++;
+    if (++p_lite->polls >= p_lite->maxPolls)
+    {
+        lite_finish(p_lite, OPTIGA_COMMS_ERROR);
+        return;
+    }
+    lite_schedule(p_lite, LITE_POLL_SELECT, p_lite->pollUs);
+}
+
+/* Response frame read: hand the APDU up, or send the frame again after a NAK */
+static void lite_frame_received(ifx_i2c_lite_t *p_lite)
+{
+    const uint8_t *p_frame = p_lite->rx;
+    uint16_t length = p_lite->rxLength;
+    uint16_t payload_length = (uint16_t)((p_frame[1] << 8) | p_frame[2]);
+
+    if ((length < 5U) || ((uint16_t)(payload_length + 5U) != length) ||
+        (trustm_crc(p_frame, (uint16_t)(length - 2U)) != (uint16_t)((p_frame[length - 2U] << 8) | p_frame[length - 1U])))
+    {
+        lite_finish(p_lite, OPTIGA_COMMS_ERROR);
+        return;
+    }
+
+    if (0U != (p_frame[0] & TRUSTM_FCTR_CONTROL))
+    {
+        if ((TRUSTM_FCTR_SEQ_NAK == (p_frame[0] & TRUSTM_FCTR_SEQ_MASK)) && (++p_lite->nakCount < LITE_MAX_NAKS))
+        {
+            p_lite->stats.retransmits++;
+            lite_schedule(p_lite, LITE_WRITE_FRAME, p_lite->guardUs);
+            return;
+        }
+        lite_finish(p_lite, OPTIGA_COMMS_ERROR);
+        return;
+    }
+
+    /* Transport: single packet, then the APDU */
+    if ((payload_length < 1U) || (0x00U != p_frame[3]) || ((uint16_t)(payload_length - 1U) > *p_lite->pResponseLength))
+    {
+        lite_finish(p_lite, OPTIGA_COMMS_ERROR);
+        return;
+    }
+    memcpy(p_lite->pResponse, &p_frame[4], (size_t)(payload_length - 1U));
+    *p_lite->pResponseLength = (uint16_t)(payload_length - 1U);
+
+    /* Acknowledge the frame before reporting the response */
+    p_lite->ack[0] = TRUSTM_REG_DATA;
+    p_lite->ack[1] = (uint8_t)(TRUSTM_FCTR_CONTROL | TRUSTM_FCTR_SEQ_ACK | TRUSTM_FCTR_FRNR(p_frame[0]));
+    p_lite->ack[2] = 0x00U;
+    p_lite->ack[3] = 0x00U;
+    {
+        uint16_t crc = trustm_crc(&p_lite->ack[1], 3U);
+
+        p_lite->ack[4] = (uint8_t)(crc >> 8);
+        p_lite->ack[5] = (uint8_t)crc;
+    }
+    lite_schedule(p_lite, LITE_WRITE_ACK, p_lite->guardUs);
+}
+
+/* Completion of the PAL transfer of the current state */
+static void lite_pal_event(void *p_ctx, optiga_lib_status_t event)
+{
+    ifx_i2c_lite_t *p_lite = (ifx_i2c_lite_t *)p_ctx;
+    bool success = (PAL_I2C_EVENT_SUCCESS == event);
+    uint16_t pending;
+
+    /* A single poll ends with its read, or with the first transfer which failed */
+    if ((p_lite->pollOnly) && ((LITE_POLL_READ == (lite_state_t)p_lite->state) || (!success)))
+    {
+        p_lite->pollOnly = false;
+        lite_finish(p_lite, success ? OPTIGA_LIB_SUCCESS : OPTIGA_COMMS_ERROR);
+        return;
+    }
+
+    switch ((lite_state_t)p_lite->state)
+    {
+        case LITE_WRITE_FRAME:
+            if (success)
+            {
+                p_lite->polls = 0U;
+                lite_schedule(p_lite, LITE_POLL_SELECT, p_lite->guardUs);
+            }
+            else
+            {
+                /* Still busy with a previous frame, or the bus is taken */
+                p_lite->stats.busyPolls++;
+                if (++p_lite->polls >= p_lite->maxPolls)
+                {
+                    lite_finish(p_lite, OPTIGA_COMMS_ERROR);
+                    break;
+                }
+                lite_schedule(p_lite, LITE_WRITE_FRAME, p_lite->pollUs);
+            }
+            break;
+
+        case LITE_POLL_SELECT:
+            if (success)
+            {
+                lite_schedule(p_lite, LITE_POLL_READ, p_lite->guardUs);
+            }
+            else
+            {
+                lite_poll_again(p_lite);
+            }
+            break;
+
+        case LITE_POLL_READ:
+            pending = (uint16_t)((p_lite->rx[2] << 8) | p_lite->rx[3]);
+            if ((success) && (0U == (p_lite->rx[0] & TRUSTM_STATE_BUSY)) &&
+                (0U != (p_lite->rx[0] & TRUSTM_STATE_RESP_READY)) && (0U != pending) && (pending <= TRUSTM_FRAME_SIZE))
+            {
+                p_lite->rxLength = pending;
+                lite_schedule(p_lite, LITE_DATA_SELECT, p_lite->guardUs);
+            }
+            else
+            {
+                lite_poll_again(p_lite);
+            }
+            break;
+
+        case LITE_DATA_SELECT:
+            if (success)
+            {
+                lite_schedule(p_lite, LITE_DATA_READ, p_lite->guardUs);
+            }
+            else
+            {
+                lite_poll_again(p_lite);
+            }
+            break;
+
+        case LITE_DATA_READ:
+            if (success)
+            {
+                lite_frame_received(p_lite);
+            }
+            else
+            {
+                lite_poll_again(p_lite);
+            }
+            break;
+
+        case LITE_WRITE_ACK:
+            lite_finish(p_lite, success ? OPTIGA_LIB_SUCCESS : OPTIGA_COMMS_ERROR);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* Start the PAL transfer of the current state, its completion comes through lite_pal_event */
+static void lite_step(void *p_ctx)
+{
+    ifx_i2c_lite_t *p_lite = (ifx_i2c_lite_t *)p_ctx;
+
+    switch ((lite_state_t)p_lite->state)
+    {
+        case LITE_WRITE_FRAME:
+            p_lite->stats.writes++;
+            (void)pal_i2c_write(p_lite->pPal, p_lite->tx, p_lite->txLength);
+            break;
+
+        case LITE_POLL_SELECT:
+            p_lite->stats.writes++;
+            p_lite->select[0] = TRUSTM_REG_I2C_STATE;
+            (void)pal_i2c_write(p_lite->pPal, p_lite->select, 1U);
+            break;
+
+        case LITE_POLL_READ:
+            p_lite->stats.reads++;
+            p_lite->stats.polls++;
+            memset(p_lite->rx, 0, 4U);
+            (void)pal_i2c_read(p_lite->pPal, p_lite->rx, 4U);
+            break;
+
+        case LITE_DATA_SELECT:
+            p_lite->stats.writes++;
+            p_lite->select[0] = TRUSTM_REG_DATA;
+            (void)pal_i2c_write(p_lite->pPal, p_lite->select, 1U);
+            break;
+
+        case LITE_DATA_READ:
+            p_lite->stats.reads++;
+            (void)pal_i2c_read(p_lite->pPal, p_lite->rx, p_lite->rxLength);
+            break;
+
+        case LITE_WRITE_ACK:
+            p_lite->stats.writes++;
+            (void)pal_i2c_write(p_lite->pPal, p_lite->ack, sizeof(p_lite->ack));
+            break;
+
+        default:
+            break;
+    }
+}
+
+bool ifx_i2c_lite_open(ifx_i2c_lite_t *p_lite, pal_i2c_t *p_pal)
+{
+    memset(p_lite, 0, sizeof(*p_lite));
+    p_lite->pPal = p_pal;
+    p_lite->guardUs = 50U;
+    p_lite->pollUs = 1000U;
+    p_lite->maxPolls = 400U;
+
+    p_pal->p_upper_layer_ctx = p_lite;
+    p_pal->upper_layer_event_handler = (void *)lite_pal_event;
+    if (PAL_STATUS_SUCCESS != pal_i2c_init(p_pal))
+    {
+        return false;
+    }
+    p_lite->pEvent = pal_os_event_create(NULL, NULL);
+    return (NULL != p_lite->pEvent);
+}
+
+optiga_lib_status_t ifx_i2c_lite_transceive(ifx_i2c_lite_t *p_lite, const uint8_t *p_apdu, uint16_t length,
+                                            uint8_t *p_response, uint16_t *p_response_length,
+                                            ifx_i2c_lite_done_t done, void *p_ctx)
+{
+    uint16_t payload_length = (uint16_t)(length + 1U);
+    uint16_t crc;
+
+    if ((LITE_IDLE != p_lite->state) || ((uint32_t)payload_length + 5U > TRUSTM_FRAME_SIZE))
+    {
+        return OPTIGA_LIB_ERROR;
+    }
+
+    /* DATA register, data frame, transport control byte of a single packet, APDU, FCS */
+    p_lite->tx[0] = TRUSTM_REG_DATA;
+    p_lite->tx[1] = (uint8_t)(p_lite->frameNr << 2);
+    p_lite->tx[2] = (uint8_t)(payload_length >> 8);
+    p_lite->tx[3] = (uint8_t)payload_length;
+    p_lite->tx[4] = 0x00U;
+    memcpy(&p_lite->tx[5], p_apdu, length);
+    crc = trustm_crc(&p_lite->tx[1], (uint16_t)(3U + payload_length));
+    p_lite->tx[4U + payload_length] = (uint8_t)(crc >> 8);
+    p_lite->tx[5U + payload_length] = (uint8_t)crc;
+    p_lite->txLength = (uint16_t)(6U + payload_length);
+    p_lite->frameNr = (uint8_t)((p_lite->frameNr + 1U) & 0x03U);
+
+    p_lite->pResponse = p_response;
+    p_lite->pResponseLength = p_response_length;
+    p_lite->done = done;
+    p_lite->pDoneCtx = p_ctx;
+    p_lite->polls = 0U;
+    p_lite->nakCount = 0U;
+    p_lite->stats.apdus++;
+
+    lite_schedule(p_lite, LITE_WRITE_FRAME, 0U);
+    return OPTIGA_LIB_BUSY;
+}
+
+optiga_lib_status_t ifx_i2c_lite_poll(ifx_i2c_lite_t *p_lite, ifx_i2c_lite_done_t done, void *p_ctx)
+{
+    if (LITE_IDLE != p_lite->state)
+    {
+        return OPTIGA_LIB_ERROR;
+    }
+
+    p_lite->done = done;
+    p_lite->pDoneCtx = p_ctx;
+    p_lite->pollOnly = true;
+    lite_schedule(p_lite, LITE_POLL_SELECT, 0U);
+    return OPTIGA_LIB_BUSY;
+}
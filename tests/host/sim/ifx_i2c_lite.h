@@ -0,0 +1,74 @@
+/*
+ * Minimal IFX I2C master for the host simulator, standing in for the physical, data link and
+ * transport layers of the OPTIGA host library, which is not part of this tree. Like the library
+ * it drives the real PAL: every step is a pal_i2c_write/pal_i2c_read whose completion schedules
+ * the next one through pal_os_event, polling I2C_STATE while the chip is busy.
+ *
+ * One APDU at a time, single frame packets, no chaining and no resynchronisation.
+ */
+
+#ifndef IFX_I2C_LITE_H
+#define IFX_I2C_LITE_H
+
+#include "pal_i2c.h"
+#include "pal_os_event.h"
+#include "trustm_model.h"
+
+typedef void (*ifx_i2c_lite_done_t)(void *p_ctx, optiga_lib_status_t status);
+
+typedef struct
+{
+    uint32_t apdus;
+    uint32_t writes;                    /* pal_i2c_write calls */
+    uint32_t reads;                     /* pal_i2c_read calls */
+    uint32_t polls;                     /* I2C_STATE reads */
+    uint32_t busyPolls;                 /* Polls or selects refused or answered busy */
+    uint32_t retransmits;               /* Frames sent again after a NAK */
+    uint32_t errors;                    /* APDUs failed */
+} ifx_i2c_lite_stats_t;
+
+typedef struct
+{
+    const pal_i2c_t *pPal;
+    pal_os_event_t *pEvent;
+    uint32_t guardUs;                   /* After every transfer, before the next one */
+    uint32_t pollUs;                    /* Between I2C_STATE polls while the chip is busy */
+    uint32_t maxPolls;                  /* Polls before an APDU fails */
+    bool pollOnly;                      /* Single I2C_STATE read started by ifx_i2c_lite_poll */
+
+    int state;
+    uint8_t frameNr;                    /* Of the next data frame sent */
+    uint8_t select[1];
+    uint8_t tx[1U + TRUSTM_FRAME_SIZE];
+    uint16_t txLength;
+    uint8_t ack[6];
+    uint8_t rx[TRUSTM_FRAME_SIZE];
+    uint16_t rxLength;
+    uint32_t polls;
+    uint32_t nakCount;
+    uint8_t *pResponse;
+    uint16_t *pResponseLength;
+    ifx_i2c_lite_done_t done;
+    void *pDoneCtx;
+    ifx_i2c_lite_stats_t stats;
+} ifx_i2c_lite_t;
+
+/* Initialise the PAL I2C context and take an event from the PAL, false on failure */
+bool ifx_i2c_lite_open(ifx_i2c_lite_t *p_lite, pal_i2c_t *p_pal);
+
+/*
+ * Send a command APDU and collect the response APDU into p_response, of size *p_response_length.
+ * done is called once finished, from the task running the PAL events. Returns OPTIGA_LIB_BUSY
+ * when started.
+ */
+optiga_lib_status_t ifx_i2c_lite_transceive(ifx_i2c_lite_t *p_lite, const uint8_t *p_apdu, uint16_t length,
+                                            uint8_t *p_response, uint16_t *p_response_length,
+                                            ifx_i2c_lite_done_t done, void *p_ctx);
+
+/*
+ * Read I2C_STATE once, register address write then read as the polls of an APDU, into
+ * p_lite->rx[0..3]. done is called once finished. Returns OPTIGA_LIB_BUSY when started.
+ */
+optiga_lib_status_t ifx_i2c_lite_poll(ifx_i2c_lite_t *p_lite, ifx_i2c_lite_done_t done, void *p_ctx);
+
+#endif /* IFX_I2C_LITE_H */
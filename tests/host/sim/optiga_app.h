@@ -0,0 +1,15 @@
+/*
+ * Log macros of the application header optiga_app.h, which the PAL includes for them. The PAL
+ * builds against this one; optiga_app.c and test_optiga_app.c take the real header, over the
+ * util and crypt calls of optiga_lib_lite.c.
+ */
+
+#ifndef SIM_OPTIGA_APP_H
+#define SIM_OPTIGA_APP_H
+
+#include "cy_debug.h"
+
+#define OPTIGA_LOG_MESSAGE(msg, ...)    sim_log("INFO", "[Optiga]: " msg "\r\n", ##__VA_ARGS__)
+#define OPTIGA_LOG_ERROR(msg, ...)      sim_log("ERR", "[Optiga][ERROR]: " msg "\r\n", ##__VA_ARGS__)
+
+#endif /* SIM_OPTIGA_APP_H */
@@ -0,0 +1,33 @@
+/* Crypt layer of the OPTIGA Trust M host library used by the application, for the host simulator. */
+
+#ifndef SIM_OPTIGA_CRYPT_H
+#define SIM_OPTIGA_CRYPT_H
+
+#include "optiga_lib_common.h"
+
+optiga_crypt_t *optiga_crypt_create(uint8_t optiga_instance_id, callback_handler_t handler, void *caller_context);
+optiga_lib_status_t optiga_crypt_destroy(optiga_crypt_t *me);
+optiga_lib_status_t optiga_crypt_random(optiga_crypt_t *me, optiga_rng_type_t rng_type, uint8_t *random_data,
+                                        uint16_t random_data_length);
+optiga_lib_status_t optiga_crypt_ecc_generate_keypair(optiga_crypt_t *me, optiga_ecc_curve_t curve_id,
+                                                      uint8_t key_usage, bool_t export_private_key,
+                                                      void *private_key, uint8_t *public_key,
+                                                      uint16_t *public_key_length);
+optiga_lib_status_t optiga_crypt_ecdsa_sign(optiga_crypt_t *me, const uint8_t *digest, uint8_t digest_length,
+                                            optiga_key_id_t private_key, uint8_t *signature,
+                                            uint16_t *signature_length);
+optiga_lib_status_t optiga_crypt_ecdsa_verify(optiga_crypt_t *me, const uint8_t *digest, uint8_t digest_length,
+                                              const uint8_t *signature, uint16_t signature_length,
+                                              uint8_t public_key_source_type, const void *public_key);
+
+/* The model has no CalcHash: these fail at once with OPTIGA_CRYPT_ERROR */
+optiga_lib_status_t optiga_crypt_hash(optiga_crypt_t *me, optiga_hash_type_t hash_algorithm,
+                                      uint8_t source_of_data_to_hash, const void *data_to_hash,
+                                      uint8_t *hash_output);
+optiga_lib_status_t optiga_crypt_hash_start(optiga_crypt_t *me, optiga_hash_context_t *hash_ctx);
+optiga_lib_status_t optiga_crypt_hash_update(optiga_crypt_t *me, optiga_hash_context_t *hash_ctx,
+                                             uint8_t source_of_data_to_hash, const void *data_to_hash);
+optiga_lib_status_t optiga_crypt_hash_finalize(optiga_crypt_t *me, optiga_hash_context_t *hash_ctx,
+                                               uint8_t *hash_output);
+
+#endif /* SIM_OPTIGA_CRYPT_H */
@@ -0,0 +1,90 @@
+/*
+ * Return codes, identifiers and host data types of the OPTIGA Trust M host library used by the
+ * application, for the host simulator. Values as in the library.
+ */
+
+#ifndef SIM_OPTIGA_LIB_COMMON_H
+#define SIM_OPTIGA_LIB_COMMON_H
+
+#include "optiga_lib_types.h"
+
+#ifndef OPTIGA_CMD_MAX_REGISTRATIONS
+#define OPTIGA_CMD_MAX_REGISTRATIONS    (0x06)
+#endif
+
+#define OPTIGA_INSTANCE_ID_0            (0x00)
+
+/* Chip error codes are reported as OPTIGA_DEVICE_ERROR | code */
+#define OPTIGA_DEVICE_ERROR             (0x8000)
+#define OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT (0x0203)
+#define OPTIGA_UTIL_ERROR_INVALID_INPUT (0x0301)
+#define OPTIGA_UTIL_ERROR               (0x0302)
+#define OPTIGA_UTIL_ERROR_INSTANCE_IN_USE (0x0303)
+#define OPTIGA_CRYPT_ERROR_INVALID_INPUT (0x0401)
+#define OPTIGA_CRYPT_ERROR              (0x0402)
+#define OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE (0x0403)
+
+#define OPTIGA_CRYPT_OID_DATA           (0x00)
+#define OPTIGA_CRYPT_HOST_DATA          (0x01)
+
+#define OPTIGA_HASH_CONTEXT_LENGTH_SHA_256 (209U)
+
+typedef enum
+{
+    OPTIGA_ECC_CURVE_NIST_P_256 = 0x03,
+    OPTIGA_ECC_CURVE_NIST_P_384 = 0x04
+} optiga_ecc_curve_t;
+
+typedef enum
+{
+    OPTIGA_HASH_TYPE_SHA_256 = 0xE2
+} optiga_hash_type_t;
+
+typedef enum
+{
+    OPTIGA_KEY_USAGE_AUTHENTICATION = 0x01,
+    OPTIGA_KEY_USAGE_ENCRYPTION = 0x02,
+    OPTIGA_KEY_USAGE_SIGN = 0x10,
+    OPTIGA_KEY_USAGE_KEY_AGREEMENT = 0x20
+} optiga_key_usage_t;
+
+typedef enum
+{
+    OPTIGA_RNG_TYPE_TRNG = 0x00,
+    OPTIGA_RNG_TYPE_DRNG = 0x01
+} optiga_rng_type_t;
+
+typedef enum
+{
+    OPTIGA_KEY_ID_E0F0 = 0xE0F0,
+    OPTIGA_KEY_ID_E0F1 = 0xE0F1,
+    OPTIGA_KEY_ID_E0F2 = 0xE0F2,
+    OPTIGA_KEY_ID_E0F3 = 0xE0F3,
+    OPTIGA_KEY_ID_SESSION_BASED = 0xE100
+} optiga_key_id_t;
+
+typedef struct
+{
+    const uint8_t *public_key;
+    uint16_t length;
+    uint8_t key_type;
+} public_key_from_host_t;
+
+typedef struct
+{
+    const uint8_t *buffer;
+    uint32_t length;
+} hash_data_from_host_t;
+
+typedef struct
+{
+    uint8_t *context_buffer;
+    uint16_t context_buffer_length;
+    uint8_t hash_algo;
+} optiga_hash_context_t;
+
+/* Instances of both layers, see optiga_lib_lite.c */
+typedef struct optiga_lib_lite_instance optiga_util_t;
+typedef struct optiga_lib_lite_instance optiga_crypt_t;
+
+#endif /* SIM_OPTIGA_LIB_COMMON_H */
@@ -0,0 +1,564 @@
+/*
+ * Util and crypt layers of the OPTIGA Trust M host library for the host simulator, over
+ * ifx_i2c_lite.c and the model of trustm_model.c. Like the library, every call builds its command
+ * APDU, returns OPTIGA_LIB_SUCCESS once it is queued and calls the handler of the instance with
+ * the final status from the task running the PAL events. Instances queue behind each other, one
+ * APDU on the bus at a time; a chip error is read back from its last error object and reported as
+ * OPTIGA_DEVICE_ERROR | code.
+ *
+ * Only what the application uses: the commands of the model, keys kept on the chip, public keys
+ * given by the host.
+ */
+
+#include <string.h>
+#include "optiga_util.h"
+#include "optiga_crypt.h"
+#include "ifx_i2c_lite.h"
+#include "pal_custom.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define LIB_APDU_HEADER                 (4U)
+#define LIB_APDU_SIZE                   (TRUSTM_FRAME_SIZE - 6U)
+
+/* How the response data of a command is handed to the caller */
+typedef enum
+{
+    LIB_OUT_NONE = 0,
+    LIB_OUT_COPY,                       /* Into pOut, of size *pOutLength */
+    LIB_OUT_EXACT,                      /* Into pOut, exactly outSize bytes */
+    LIB_OUT_PUBLIC_KEY                  /* Value of the public key tag, as LIB_OUT_COPY */
+} lib_out_t;
+
+struct optiga_lib_lite_instance
+{
+    bool created;
+    volatile bool busy;                 /* Queued or on the bus, until its handler was called */
+    callback_handler_t handler;
+    void *pCallerCtx;
+    optiga_lib_status_t inUseError;     /* Of the layer the instance was created for */
+    optiga_lib_status_t inputError;
+    uint8_t apdu[LIB_APDU_SIZE];
+    uint16_t apduLength;
+    bool overflow;
+    lib_out_t out;
+    uint8_t *pOut;
+    uint16_t *pOutLength;
+    uint16_t outSize;
+    struct optiga_lib_lite_instance *pNext;
+};
+
+static struct optiga_lib_lite_instance lib_instances[OPTIGA_CMD_MAX_REGISTRATIONS];
+static struct optiga_lib_lite_instance *lib_queue_head = NULL;
+static struct optiga_lib_lite_instance *lib_queue_tail = NULL;
+static struct optiga_lib_lite_instance *lib_active = NULL;
+static ifx_i2c_lite_t lib_lite;
+static bool lib_lite_open = false;
+static bool lib_reading_error = false;
+static uint8_t lib_response[TRUSTM_FRAME_SIZE];
+static uint16_t lib_response_length;
+static const uint8_t lib_last_error_apdu[] = { TRUSTM_CMD_GET_DATA_OBJECT, 0x00U, 0x00U, 0x02U,
+                                               (uint8_t)(TRUSTM_OID_LAST_ERROR >> 8), (uint8_t)TRUSTM_OID_LAST_ERROR };
+
+static void lib_start_next(void);
+
+static struct optiga_lib_lite_instance *lib_create(callback_handler_t handler, void *caller_context,
+                                                   optiga_lib_status_t in_use_error,
+                                                   optiga_lib_status_t input_error)
+{
+    struct optiga_lib_lite_instance *p_inst = NULL;
+    uint8_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < OPTIGA_CMD_MAX_REGISTRATIONS; i++)
+    {
+        if (!lib_instances[i].created)
+        {
+            p_inst = &lib_instances[i];
+            memset(p_inst, 0, sizeof(*p_inst));
+            p_inst->created = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL != p_inst)
+    {
+        p_inst->handler = handler;
+        p_inst->pCallerCtx = caller_context;
+        p_inst->inUseError = in_use_error;
+        p_inst->inputError = input_error;
+    }
+    return p_inst;
+}
+
+static optiga_lib_status_t lib_destroy(struct optiga_lib_lite_instance *p_inst)
+{
+    optiga_lib_status_t status = OPTIGA_LIB_SUCCESS;
+
+    if (NULL == p_inst)
+    {
+        return OPTIGA_LIB_ERROR;
+    }
+    taskENTER_CRITICAL();
+    if (p_inst->busy)
+    {
+        status = p_inst->inUseError;
+    }
+    else
+    {
+        p_inst->created = false;
+    }
+    taskEXIT_CRITICAL();
+    return status;
+}
+
+static void lib_apdu_begin(struct optiga_lib_lite_instance *p_inst, uint8_t cmd, uint8_t param)
+{
+    p_inst->apdu[0] = cmd;
+    p_inst->apdu[1] = param;
+    p_inst->apduLength = LIB_APDU_HEADER;
+    p_inst->overflow = false;
+    p_inst->out = LIB_OUT_NONE;
+}
+
+static void lib_apdu_put(struct optiga_lib_lite_instance *p_inst, const uint8_t *p_data, uint16_t length)
+{
+    if ((p_inst->overflow) || ((uint32_t)p_inst->apduLength + length > LIB_APDU_SIZE))
+    {
+        p_inst->overflow = true;
+        return;
+    }
+    memcpy(&p_inst->apdu[p_inst->apduLength], p_data, length);
+    p_inst->apduLength = (uint16_t)(p_inst->apduLength + length);
+}
+
+static void lib_apdu_put_u16(struct optiga_lib_lite_instance *p_inst, uint16_t value)
+{
+    uint8_t bytes[2] = { (uint8_t)(value >> 8), (uint8_t)value };
+
+    lib_apdu_put(p_inst, bytes, 2U);
+}
+
+static void lib_apdu_put_tlv(struct optiga_lib_lite_instance *p_inst, uint8_t tag, const uint8_t *p_value,
+                             uint16_t length)
+{
+    lib_apdu_put(p_inst, &tag, 1U);
+    lib_apdu_put_u16(p_inst, length);
+    lib_apdu_put(p_inst, p_value, length);
+}
+
+/* Queue the APDU built on the instance, its handler is called once it completed */
+static optiga_lib_status_t lib_submit(struct optiga_lib_lite_instance *p_inst)
+{
+    if (p_inst->overflow)
+    {
+        return p_inst->inputError;
+    }
+    p_inst->apdu[2] = (uint8_t)((p_inst->apduLength - LIB_APDU_HEADER) >> 8);
+    p_inst->apdu[3] = (uint8_t)(p_inst->apduLength - LIB_APDU_HEADER);
+
+    taskENTER_CRITICAL();
+    if (!lib_lite_open)
+    {
+        taskEXIT_CRITICAL();
+        if (!ifx_i2c_lite_open(&lib_lite, optiga_pal_i2c_contexts[0]))
+        {
+            return OPTIGA_COMMS_ERROR;
+        }
+        taskENTER_CRITICAL();
+        lib_lite_open = true;
+    }
+    p_inst->pNext = NULL;
+    if (NULL == lib_queue_tail)
+    {
+        lib_queue_head = p_inst;
+    }
+    else
+    {
+        lib_queue_tail->pNext = p_inst;
+    }
+    lib_queue_tail = p_inst;
+    taskEXIT_CRITICAL();
+
+    lib_start_next();
+    return OPTIGA_LIB_SUCCESS;
+}
+
+/* Claim an idle instance for a new command, false if it still runs one */
+static bool lib_claim(struct optiga_lib_lite_instance *p_inst)
+{
+    bool claimed = false;
+
+    taskENTER_CRITICAL();
+    if ((p_inst->created) && (!p_inst->busy))
+    {
+        p_inst->busy = true;
+        claimed = true;
+    }
+    taskEXIT_CRITICAL();
+    return claimed;
+}
+
+static optiga_lib_status_t lib_submit_claimed(struct optiga_lib_lite_instance *p_inst)
+{
+    optiga_lib_status_t status = lib_submit(p_inst);
+
+    if (OPTIGA_LIB_SUCCESS != status)
+    {
+        p_inst->busy = false;
+    }
+    return status;
+}
+
+/* Hand the response data of the active command to its caller */
+static optiga_lib_status_t lib_response_out(struct optiga_lib_lite_instance *p_inst, const uint8_t *p_data,
+                                            uint16_t length)
+{
+    switch (p_inst->out)
+    {
+        case LIB_OUT_NONE:
+            return OPTIGA_LIB_SUCCESS;
+
+        case LIB_OUT_EXACT:
+            if (length != p_inst->outSize)
+            {
+                return OPTIGA_LIB_ERROR;
+            }
+            memcpy(p_inst->pOut, p_data, length);
+            return OPTIGA_LIB_SUCCESS;
+
+        case LIB_OUT_PUBLIC_KEY:
+            if ((length < 3U) || (0x02U != p_data[0]) || ((uint16_t)((p_data[1] << 8) | p_data[2]) != length - 3U))
+            {
+                return OPTIGA_LIB_ERROR;
+            }
+            p_data += 3;
+            length = (uint16_t)(length - 3U);
+            /* fall through */
+        case LIB_OUT_COPY:
+            if (length > *p_inst->pOutLength)
+            {
+                return OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT;
+            }
+            memcpy(p_inst->pOut, p_data, length);
+            *p_inst->pOutLength = length;
+            return OPTIGA_LIB_SUCCESS;
+
+        default:
+            return OPTIGA_LIB_ERROR;
+    }
+}
+
+static void lib_complete(struct optiga_lib_lite_instance *p_inst, optiga_lib_status_t status)
+{
+    taskENTER_CRITICAL();
+    p_inst->busy = false;
+    lib_active = NULL;
+    taskEXIT_CRITICAL();
+
+    if (NULL != p_inst->handler)
+    {
+        p_inst->handler(p_inst->pCallerCtx, status);
+    }
+    lib_start_next();
+}
+
+static void lib_apdu_done(void *p_ctx, optiga_lib_status_t status)
+{
+    struct optiga_lib_lite_instance *p_inst = (struct optiga_lib_lite_instance *)p_ctx;
+    uint16_t length = 0U;
+
+    if (OPTIGA_LIB_SUCCESS == status)
+    {
+        length = (lib_response_length >= LIB_APDU_HEADER) ?
+                 (uint16_t)((lib_response[2] << 8) | lib_response[3]) : 0xFFFFU;
+        if ((uint32_t)length + LIB_APDU_HEADER != lib_response_length)
+        {
+            status = OPTIGA_COMMS_ERROR;
+        }
+    }
+
+    if (lib_reading_error)
+    {
+        lib_reading_error = false;
+        if ((OPTIGA_LIB_SUCCESS == status) && (0x00U == lib_response[0]) && (length >= 1U))
+        {
+            status = (optiga_lib_status_t)(OPTIGA_DEVICE_ERROR | lib_response[LIB_APDU_HEADER]);
+        }
+        else if (OPTIGA_LIB_SUCCESS == status)
+        {
+            status = OPTIGA_DEVICE_ERROR;
+        }
+    }
+    else if ((OPTIGA_LIB_SUCCESS == status) && (0x00U != lib_response[0]))
+    {
+        /* Failed on the chip: its error code is read from the last error object */
+        lib_reading_error = true;
+        lib_response_length = sizeof(lib_response);
+        if (OPTIGA_LIB_BUSY == ifx_i2c_lite_transceive(&lib_lite, lib_last_error_apdu, sizeof(lib_last_error_apdu),
+                                                       lib_response, &lib_response_length, lib_apdu_done, p_inst))
+        {
+            return;
+        }
+        lib_reading_error = false;
+        status = OPTIGA_DEVICE_ERROR;
+    }
+    else if (OPTIGA_LIB_SUCCESS == status)
+    {
+        status = lib_response_out(p_inst, &lib_response[LIB_APDU_HEADER], length);
+    }
+    lib_complete(p_inst, status);
+}
+
+/* Put the next queued command on the bus, unless one is already there */
+static void lib_start_next(void)
+{
+    struct optiga_lib_lite_instance *p_inst = NULL;
+
+    taskENTER_CRITICAL();
+    if ((NULL == lib_active) && (NULL != lib_queue_head))
+    {
+        p_inst = lib_queue_head;
+        lib_queue_head = p_inst->pNext;
+        if (NULL == lib_queue_head)
+        {
+            lib_queue_tail = NULL;
+        }
+        lib_active = p_inst;
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL == p_inst)
+    {
+        return;
+    }
+    lib_response_length = sizeof(lib_response);
+    if (OPTIGA_LIB_BUSY != ifx_i2c_lite_transceive(&lib_lite, p_inst->apdu, p_inst->apduLength, lib_response,
+                                                   &lib_response_length, lib_apdu_done, p_inst))
+    {
+        lib_complete(p_inst, OPTIGA_COMMS_ERROR);
+    }
+}
+
+optiga_util_t *optiga_util_create(uint8_t optiga_instance_id, callback_handler_t handler, void *caller_context)
+{
+    (void)optiga_instance_id;
+    return lib_create(handler, caller_context, OPTIGA_UTIL_ERROR_INSTANCE_IN_USE, OPTIGA_UTIL_ERROR_INVALID_INPUT);
+}
+
+optiga_lib_status_t optiga_util_destroy(optiga_util_t *me)
+{
+    return lib_destroy(me);
+}
+
+optiga_lib_status_t optiga_util_open_application(optiga_util_t *me, bool_t perform_restore)
+{
+    static const uint8_t aid[] = { 0xD2U, 0x76U, 0x00U, 0x00U, 0x04U, 0x47U, 0x65U, 0x6EU,
+                                   0x41U, 0x75U, 0x74U, 0x68U, 0x41U, 0x70U, 0x70U, 0x6CU };
+
+    if (NULL == me)
+    {
+        return OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    }
+    lib_apdu_begin(me, TRUSTM_CMD_OPEN_APPLICATION, perform_restore ? 0x01U : 0x00U);
+    lib_apdu_put(me, aid, sizeof(aid));
+    return lib_submit_claimed(me);
+}
+
+optiga_lib_status_t optiga_util_close_application(optiga_util_t *me, bool_t perform_hibernate)
+{
+    if (NULL == me)
+    {
+        return OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    }
+    lib_apdu_begin(me, TRUSTM_CMD_CLOSE_APPLICATION, perform_hibernate ? 0x01U : 0x00U);
+    return lib_submit_claimed(me);
+}
+
+optiga_lib_status_t optiga_util_read_metadata(optiga_util_t *me, uint16_t optiga_oid, uint8_t *buffer,
+                                              uint16_t *length)
+{
+    if ((NULL == me) || (NULL == buffer) || (NULL == length))
+    {
+        return OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    }
+    lib_apdu_begin(me, TRUSTM_CMD_GET_DATA_OBJECT, 0x01U);
+    lib_apdu_put_u16(me, optiga_oid);
+    me->out = LIB_OUT_COPY;
+    me->pOut = buffer;
+    me->pOutLength = length;
+    return lib_submit_claimed(me);
+}
+
+optiga_lib_status_t optiga_util_write_metadata(optiga_util_t *me, uint16_t optiga_oid, const uint8_t *buffer,
+                                               uint8_t length)
+{
+    if ((NULL == me) || (NULL == buffer))
+    {
+        return OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    }
+    lib_apdu_begin(me, TRUSTM_CMD_SET_DATA_OBJECT, 0x01U);
+    lib_apdu_put_u16(me, optiga_oid);
+    lib_apdu_put_u16(me, 0x0000U);
+    lib_apdu_put(me, buffer, length);
+    return lib_submit_claimed(me);
+}
+
+optiga_crypt_t *optiga_crypt_create(uint8_t optiga_instance_id, callback_handler_t handler, void *caller_context)
+{
+    (void)optiga_instance_id;
+    return lib_create(handler, caller_context, OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE, OPTIGA_CRYPT_ERROR_INVALID_INPUT);
+}
+
+optiga_lib_status_t optiga_crypt_destroy(optiga_crypt_t *me)
+{
+    return lib_destroy(me);
+}
+
+optiga_lib_status_t optiga_crypt_random(optiga_crypt_t *me, optiga_rng_type_t rng_type, uint8_t *random_data,
+                                        uint16_t random_data_length)
+{
+    if ((NULL == me) || (NULL == random_data))
+    {
+        return OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+    }
+    lib_apdu_begin(me, TRUSTM_CMD_GET_RANDOM, (uint8_t)rng_type);
+    lib_apdu_put_u16(me, random_data_length);
+    me->out = LIB_OUT_EXACT;
+    me->pOut = random_data;
+    me->outSize = random_data_length;
+    return lib_submit_claimed(me);
+}
+
+optiga_lib_status_t optiga_crypt_ecc_generate_keypair(optiga_crypt_t *me, optiga_ecc_curve_t curve_id,
+                                                      uint8_t key_usage, bool_t export_private_key,
+                                                      void *private_key, uint8_t *public_key,
+                                                      uint16_t *public_key_length)
+{
+    uint8_t key[3];
+
+    /* Private keys stay in a key object of the chip */
+    if ((NULL == me) || (export_private_key) || (NULL == private_key) || (NULL == public_key) ||
+        (NULL == public_key_length))
+    {
+        return OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+    }
+    key[0] = (uint8_t)(*(optiga_key_id_t *)private_key >> 8);
+    key[1] = (uint8_t)(*(optiga_key_id_t *)private_key);
+    key[2] = key_usage;
+    lib_apdu_begin(me, TRUSTM_CMD_GEN_KEY_PAIR, (uint8_t)curve_id);
+    lib_apdu_put_tlv(me, 0x01U, key, sizeof(key));
+    me->out = LIB_OUT_PUBLIC_KEY;
+    me->pOut = public_key;
+    me->pOutLength = public_key_length;
+    return lib_submit_claimed(me);
+}
+
+optiga_lib_status_t optiga_crypt_ecdsa_sign(optiga_crypt_t *me, const uint8_t *digest, uint8_t digest_length,
+                                            optiga_key_id_t private_key, uint8_t *signature,
+                                            uint16_t *signature_length)
+{
+    uint8_t key[2] = { (uint8_t)(private_key >> 8), (uint8_t)private_key };
+
+    if ((NULL == me) || (NULL == digest) || (NULL == signature) || (NULL == signature_length))
+    {
+        return OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+    }
+    lib_apdu_begin(me, TRUSTM_CMD_CALC_SIGN, 0x11U);
+    lib_apdu_put_tlv(me, 0x01U, digest, digest_length);
+    lib_apdu_put_tlv(me, 0x03U, key, sizeof(key));
+    me->out = LIB_OUT_COPY;
+    me->pOut = signature;
+    me->pOutLength = signature_length;
+    return lib_submit_claimed(me);
+}
+
+optiga_lib_status_t optiga_crypt_ecdsa_verify(optiga_crypt_t *me, const uint8_t *digest, uint8_t digest_length,
+                                              const uint8_t *signature, uint16_t signature_length,
+                                              uint8_t public_key_source_type, const void *public_key)
+{
+    const public_key_from_host_t *p_key = (const public_key_from_host_t *)public_key;
+
+    if ((NULL == me) || (NULL == digest) || (NULL == signature) || (NULL == p_key) ||
+        (OPTIGA_CRYPT_HOST_DATA != public_key_source_type) || (NULL == p_key->public_key))
+    {
+        return OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    }
+    if (!lib_claim(me))
+    {
+        return OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+    }
+    lib_apdu_begin(me, TRUSTM_CMD_VERIFY_SIGN, 0x11U);
+    lib_apdu_put_tlv(me, 0x01U, digest, digest_length);
+    lib_apdu_put_tlv(me, 0x02U, signature, signature_length);
+    lib_apdu_put_tlv(me, 0x05U, &p_key->key_type, 1U);
+    lib_apdu_put_tlv(me, 0x06U, p_key->public_key, p_key->length);
+    return lib_submit_claimed(me);
+}
+
+optiga_lib_status_t optiga_crypt_hash(optiga_crypt_t *me, optiga_hash_type_t hash_algorithm,
+                                      uint8_t source_of_data_to_hash, const void *data_to_hash,
+                                      uint8_t *hash_output)
+{
+    (void)me;
+    (void)hash_algorithm;
+    (void)source_of_data_to_hash;
+    (void)data_to_hash;
+    (void)hash_output;
+    return OPTIGA_CRYPT_ERROR;
+}
+
+optiga_lib_status_t optiga_crypt_hash_start(optiga_crypt_t *me, optiga_hash_context_t *hash_ctx)
+{
+    (void)me;
+    (void)hash_ctx;
+    return OPTIGA_CRYPT_ERROR;
+}
+
+optiga_lib_status_t optiga_crypt_hash_update(optiga_crypt_t *me, optiga_hash_context_t *hash_ctx,
+                                             uint8_t source_of_data_to_hash, const void *data_to_hash)
+{
+    (void)me;
+    (void)hash_ctx;
+    (void)source_of_data_to_hash;
+    (void)data_to_hash;
+    return OPTIGA_CRYPT_ERROR;
+}
+
+optiga_lib_status_t optiga_crypt_hash_finalize(optiga_crypt_t *me, optiga_hash_context_t *hash_ctx,
+                                               uint8_t *hash_output)
+{
+    (void)me;
+    (void)hash_ctx;
+    (void)hash_output;
+    return OPTIGA_CRYPT_ERROR;
+}
@@ -0,0 +1,31 @@
+/*
+ * Types of the OPTIGA Trust M host library used by its PAL, for the host simulator. The host
+ * library itself is not part of this tree, ifx_i2c_lite.c stands in for its IFX I2C layers and
+ * optiga_lib_lite.c for its util and crypt layers.
+ */
+
+#ifndef SIM_OPTIGA_LIB_TYPES_H
+#define SIM_OPTIGA_LIB_TYPES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+typedef uint8_t bool_t;
+typedef uint16_t optiga_lib_status_t;
+
+#ifndef TRUE
+#define TRUE                            (1U)
+#endif
+#ifndef FALSE
+#define FALSE                           (0U)
+#endif
+
+#define OPTIGA_LIB_SUCCESS              (0x0000)
+#define OPTIGA_LIB_BUSY                 (0x0001)
+#define OPTIGA_LIB_ERROR                (0xFE02)
+#define OPTIGA_COMMS_ERROR              (0x0102)
+
+typedef void (*callback_handler_t)(void *callback_ctx, optiga_lib_status_t event);
+
+#endif /* SIM_OPTIGA_LIB_TYPES_H */
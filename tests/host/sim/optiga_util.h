@@ -0,0 +1,17 @@
+/* Util layer of the OPTIGA Trust M host library used by the application, for the host simulator. */
+
+#ifndef SIM_OPTIGA_UTIL_H
+#define SIM_OPTIGA_UTIL_H
+
+#include "optiga_lib_common.h"
+
+optiga_util_t *optiga_util_create(uint8_t optiga_instance_id, callback_handler_t handler, void *caller_context);
+optiga_lib_status_t optiga_util_destroy(optiga_util_t *me);
+optiga_lib_status_t optiga_util_open_application(optiga_util_t *me, bool_t perform_restore);
+optiga_lib_status_t optiga_util_close_application(optiga_util_t *me, bool_t perform_hibernate);
+optiga_lib_status_t optiga_util_read_metadata(optiga_util_t *me, uint16_t optiga_oid, uint8_t *buffer,
+                                              uint16_t *length);
+optiga_lib_status_t optiga_util_write_metadata(optiga_util_t *me, uint16_t optiga_oid, const uint8_t *buffer,
+                                               uint8_t length);
+
+#endif /* SIM_OPTIGA_UTIL_H */
@@ -0,0 +1,18 @@
+/* PAL status codes of the OPTIGA Trust M host library, for the host simulator. */
+
+#ifndef SIM_PAL_H
+#define SIM_PAL_H
+
+#include "optiga_lib_types.h"
+
+typedef uint16_t pal_status_t;
+
+#define PAL_STATUS_SUCCESS              (0x0000)
+#define PAL_STATUS_FAILURE              (0x0001)
+#define PAL_STATUS_I2C_BUSY             (0x0002)
+#define PAL_STATUS_INVALID_INPUT        (0x0004)
+
+pal_status_t pal_init(void);
+pal_status_t pal_deinit(void);
+
+#endif /* SIM_PAL_H */
@@ -0,0 +1,13 @@
+/* GPIO PAL types of the OPTIGA Trust M host library, for the host simulator. */
+
+#ifndef SIM_PAL_GPIO_H
+#define SIM_PAL_GPIO_H
+
+#include "pal.h"
+
+typedef struct pal_gpio
+{
+    void * p_gpio_hw;
+} pal_gpio_t;
+
+#endif /* SIM_PAL_GPIO_H */
@@ -0,0 +1,28 @@
+/* I2C PAL interface of the OPTIGA Trust M host library, for the host simulator. */
+
+#ifndef SIM_PAL_I2C_H
+#define SIM_PAL_I2C_H
+
+#include "pal.h"
+
+#define PAL_I2C_EVENT_SUCCESS           (0x0000)
+#define PAL_I2C_EVENT_ERROR             (0x0001)
+#define PAL_I2C_EVENT_BUSY              (0x0002)
+
+typedef struct pal_i2c
+{
+    void * p_i2c_hw_config;
+    void * p_upper_layer_ctx;
+    void * upper_layer_event_handler;
+    uint8_t slave_address;
+} pal_i2c_t;
+
+typedef void (*upper_layer_callback_t)(void * upper_layer_ctx, optiga_lib_status_t event);
+
+pal_status_t pal_i2c_init(const pal_i2c_t * p_i2c_context);
+pal_status_t pal_i2c_deinit(const pal_i2c_t * p_i2c_context);
+pal_status_t pal_i2c_write(const pal_i2c_t * p_i2c_context, uint8_t * p_data, uint16_t length);
+pal_status_t pal_i2c_read(const pal_i2c_t * p_i2c_context, uint8_t * p_data, uint16_t length);
+pal_status_t pal_i2c_set_bitrate(const pal_i2c_t * p_i2c_context, uint16_t bitrate);
+
+#endif /* SIM_PAL_I2C_H */
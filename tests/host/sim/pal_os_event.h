@@ -0,0 +1,26 @@
+/* Event PAL interface of the OPTIGA Trust M host library, for the host simulator. */
+
+#ifndef SIM_PAL_OS_EVENT_H
+#define SIM_PAL_OS_EVENT_H
+
+#include "pal.h"
+
+typedef void (*register_callback)(void * callback_ctx);
+
+typedef struct pal_os_event
+{
+    bool_t is_event_triggered;
+    register_callback callback_registered;
+    void * callback_ctx;
+    void * os_timer;
+} pal_os_event_t;
+
+pal_os_event_t * pal_os_event_create(register_callback callback, void * callback_args);
+void pal_os_event_destroy(pal_os_event_t * pal_os_event);
+void pal_os_event_register_callback_oneshot(pal_os_event_t * p_pal_os_event, register_callback callback,
+                                            void * callback_args, uint32_t time_us);
+void pal_os_event_trigger_registered_callback(void);
+void pal_os_event_start(pal_os_event_t * p_pal_os_event, register_callback callback, void * callback_args);
+void pal_os_event_stop(pal_os_event_t * p_pal_os_event);
+
+#endif /* SIM_PAL_OS_EVENT_H */
@@ -0,0 +1,14 @@
+/* Memory PAL interface of the OPTIGA Trust M host library, for the host simulator. */
+
+#ifndef SIM_PAL_OS_MEMORY_H
+#define SIM_PAL_OS_MEMORY_H
+
+#include "pal.h"
+
+void *pal_os_malloc(uint32_t block_size);
+void *pal_os_calloc(uint32_t number_of_blocks, uint32_t block_size);
+void pal_os_free(void *p_block);
+void pal_os_memcpy(void *p_destination, const void *p_source, uint32_t size);
+void pal_os_memset(void *p_buffer, uint32_t value, uint32_t size);
+
+#endif /* SIM_PAL_OS_MEMORY_H */
@@ -0,0 +1,12 @@
+/* Timer PAL interface of the OPTIGA Trust M host library, for the host simulator. */
+
+#ifndef SIM_PAL_OS_TIMER_H
+#define SIM_PAL_OS_TIMER_H
+
+#include "pal.h"
+
+uint32_t pal_os_timer_get_time_in_milliseconds(void);
+uint32_t pal_os_timer_get_time_in_microseconds(void);
+void pal_os_timer_delay_in_milliseconds(uint16_t milliseconds);
+
+#endif /* SIM_PAL_OS_TIMER_H */
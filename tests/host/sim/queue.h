@@ -0,0 +1,8 @@
+/* Queue types of the host simulator. Only the semaphores of semphr.h are implemented. */
+
+#ifndef SIM_QUEUE_H
+#define SIM_QUEUE_H
+
+#include "FreeRTOS.h"
+
+#endif /* SIM_QUEUE_H */
@@ -0,0 +1,22 @@
+/* Semaphores of the host simulator, see sim_rtos.c. Mutexes are binary semaphores given once. */
+
+#ifndef SIM_SEMPHR_H
+#define SIM_SEMPHR_H
+
+#include "queue.h"
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count);
+SemaphoreHandle_t xSemaphoreCreateCountingStatic(UBaseType_t max_count, UBaseType_t initial_count,
+                                                 StaticSemaphore_t *p_buffer);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *p_woken);
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+
+#define xSemaphoreCreateBinary()        xSemaphoreCreateCounting(1U, 0U)
+#define xSemaphoreCreateMutex()         xSemaphoreCreateCounting(1U, 1U)
+#define xSemaphoreCreateBinaryStatic(p) xSemaphoreCreateCountingStatic(1U, 0U, (p))
+#define xSemaphoreCreateMutexStatic(p)  xSemaphoreCreateCountingStatic(1U, 1U, (p))
+
+#endif /* SIM_SEMPHR_H */
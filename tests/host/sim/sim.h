@@ -0,0 +1,114 @@
+/*
+ * Host simulator of the FX2G3 parts the OPTIGA PAL runs on: simulated time, FreeRTOS tasks,
+ * timers and semaphores on cooperative contexts, interrupt lines, the SCB0 I2C master with its
+ * bus timing, and I2C slave models attached to the bus.
+ *
+ * Code runs in zero simulated time. Time advances while every task is blocked, and in busy
+ * waits (Cy_SysLib_DelayUs, the byte by byte SCB calls), during which interrupts and more urgent
+ * tasks still run. The firmware sources are built unchanged against the stand-in headers of
+ * this directory.
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_pdl.h"
+#include "FreeRTOS.h"
+
+/* Core clock driving the DWT cycle counter and the peripheral clock of the SCB and TCPWM */
+#define SIM_CORE_CLOCK_HZ               (150000000U)
+#define SIM_PERI_CLOCK_HZ               (75000000U)
+
+/* Stack of every simulated task, independent of the depth asked for */
+#define SIM_TASK_STACK_BYTES            (64U * 1024U)
+
+uint64_t sim_now_ns(void);
+
+/*
+ * Run main_function as a task of the given priority, with the timer service task, until it
+ * returns. Returns 0, or -1 when every task blocked with nothing left to wake them, or an
+ * assertion failed.
+ */
+int sim_run(TaskFunction_t main_function, void *p_arg, UBaseType_t priority);
+
+/* Spin for ns of simulated time in the running task, letting interrupts and more urgent tasks run */
+void sim_busy_wait_ns(uint64_t ns);
+
+/* Simulated hardware: function called at time at_ns, before any task or interrupt due then */
+typedef void (*sim_hw_function_t)(void *p_arg);
+
+void sim_hw_at(uint64_t at_ns, sim_hw_function_t function, void *p_arg);
+void sim_hw_cancel(sim_hw_function_t function, void *p_arg);
+
+/* Raise an interrupt line, its handler runs once the line is enabled and no critical section is held */
+void sim_irq_raise(IRQn_Type irq);
+
+bool sim_in_isr(void);
+bool sim_in_timer_task(void);
+
+typedef struct
+{
+    uint64_t busyNs;                    /* Spent in busy waits by any task */
+    uint64_t timerTaskBusyNs;           /* Part of it spent in the timer service task */
+    uint64_t timerTaskBlockedNs;        /* Timer service task blocked outside its own queue wait */
+    uint32_t timerTaskBlocks;
+    uint32_t pendFailures;              /* xTimerPendFunctionCall(FromISR) calls refused, queue full */
+    uint32_t interrupts;
+    uint32_t contextSwitches;
+} sim_stats_t;
+
+void sim_get_stats(sim_stats_t *p_stats);
+void sim_clear_stats(void);
+
+/* Busy time of a task since it was created, by name */
+uint64_t sim_task_busy_ns(const char *name);
+
+/* Print the firmware logs with the simulated time */
+void sim_set_verbose(bool verbose);
+
+/* I2C slave on the simulated bus, answering its 7-bit address */
+typedef struct sim_i2c_slave
+{
+    uint8_t address;
+    bool (*start)(struct sim_i2c_slave *p_slave, bool read);    /* Address phase, true to acknowledge */
+    bool (*write)(struct sim_i2c_slave *p_slave, uint8_t byte); /* true to acknowledge */
+    uint8_t (*read)(struct sim_i2c_slave *p_slave);
+    void (*stop)(struct sim_i2c_slave *p_slave, bool restart);  /* STOP, or a repeated START */
+    struct sim_i2c_slave *pNext;
+} sim_i2c_slave_t;
+
+void sim_i2c_attach(sim_i2c_slave_t *p_slave);
+
+/* Bus faults injected into the next transfers, at their first data byte */
+typedef enum
+{
+    SIM_I2C_FAULT_NONE = 0,
+    SIM_I2C_FAULT_DATA_NAK,
+    SIM_I2C_FAULT_ARB_LOST,
+    SIM_I2C_FAULT_BUS_ERR
+} sim_i2c_fault_t;
+
+void sim_i2c_inject_fault(sim_i2c_fault_t fault, uint32_t transfers);
+
+typedef struct
+{
+    uint32_t transfers;                 /* Address phases */
+    uint32_t addrNaks;
+    uint32_t dataNaks;
+    uint32_t faults;                    /* Injected faults which hit a transfer */
+    uint64_t busNs;                     /* Time the bus was driven */
+    uint32_t dataRate;                  /* Hz, as set by Cy_SCB_I2C_SetDataRate */
+} sim_i2c_stats_t;
+
+void sim_i2c_get_stats(sim_i2c_stats_t *p_stats);
+void sim_i2c_clear_stats(void);
+
+/* Drive mode given to a pin by the last Cy_GPIO_Pin_Init */
+uint32_t sim_gpio_drive_mode(uint32_t port, uint32_t pin);
+
+/* Slew rate of a pin, from Cy_GPIO_Pin_Init or the last Cy_GPIO_SetSlewRate */
+uint32_t sim_gpio_slew_rate(uint32_t port, uint32_t pin);
+
+#endif /* SIM_H */
@@ -0,0 +1,266 @@
+/*
+ * Clock dividers, GPIO pins, the TCPWM counters and the HBDMA setup calls of the host simulator.
+ * The dividers only matter to the TCPWM count rate, the pins keep their configuration for the
+ * tests to check, HBDMA buffers come from the host heap.
+ */
+
+#include <stdlib.h>
+#include "sim.h"
+#include "cy_pdl.h"
+
+#define SIM_DIVIDERS                    (16U)
+#define SIM_CLOCK_DESTS                 (64)
+#define SIM_TCPWM_COUNTERS              (8U)
+
+GPIO_PRT_Type sim_gpio_port[16];
+TCPWM_Type sim_tcpwm0;
+LVDSSS_LVDS_Type sim_lvdsss_lvds;
+USB32DEV_Type sim_usb32dev;
+
+static uint32_t divider_value[SIM_DIVIDERS];
+static int clock_dest_divider[SIM_CLOCK_DESTS];
+static bool clock_dest_assigned[SIM_CLOCK_DESTS];
+static uint32_t gpio_drive_mode[16][8];
+static uint32_t gpio_slew_rate[16][8];
+
+typedef struct
+{
+    bool enabled;
+    uint32_t period;
+    uint32_t interruptMask;
+    uint32_t interruptStatus;
+} sim_tcpwm_counter_t;
+
+static sim_tcpwm_counter_t counters[SIM_TCPWM_COUNTERS];
+
+uint32_t Cy_SysClk_ClkPeriGetFrequency(void)
+{
+    return SIM_PERI_CLOCK_HZ;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PeriphSetDivider(cy_en_divider_types_t dividerType, uint32_t dividerNum,
+                                                 uint32_t dividerValue)
+{
+    if ((CY_SYSCLK_DIV_16_BIT != dividerType) || (dividerNum >= SIM_DIVIDERS) || (dividerValue > UINT16_MAX))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+    divider_value[dividerNum] = dividerValue;
+    return CY_SYSCLK_SUCCESS;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PeriphEnableDivider(cy_en_divider_types_t dividerType, uint32_t dividerNum)
+{
+    return ((CY_SYSCLK_DIV_16_BIT == dividerType) && (dividerNum < SIM_DIVIDERS)) ? CY_SYSCLK_SUCCESS :
+                                                                                    CY_SYSCLK_BAD_PARAM;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PeriphDisableDivider(cy_en_divider_types_t dividerType, uint32_t dividerNum)
+{
+    return Cy_SysClk_PeriphEnableDivider(dividerType, dividerNum);
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PeriphAssignDivider(en_clk_dst_t ipBlock, cy_en_divider_types_t dividerType,
+                                                    uint32_t dividerNum)
+{
+    if ((ipBlock < 0) || (ipBlock >= SIM_CLOCK_DESTS) || (CY_SYSCLK_DIV_16_BIT != dividerType) ||
+        (dividerNum >= SIM_DIVIDERS))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+    clock_dest_divider[ipBlock] = (int)dividerNum;
+    clock_dest_assigned[ipBlock] = true;
+    return CY_SYSCLK_SUCCESS;
+}
+
+cy_en_gpio_status_t Cy_GPIO_Pin_Init(GPIO_PRT_Type *base, uint32_t pinNum, const cy_stc_gpio_pin_config_t *config)
+{
+    ptrdiff_t port = base - sim_gpio_port;
+
+    if ((port < 0) || (port >= 16) || (pinNum >= 8U) || (NULL == config))
+    {
+        return CY_GPIO_BAD_PARAM;
+    }
+    gpio_drive_mode[port][pinNum] = config->driveMode;
+    gpio_slew_rate[port][pinNum] = config->slewRate;
+    return CY_GPIO_SUCCESS;
+}
+
+void Cy_GPIO_SetSlewRate(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    ptrdiff_t port = base - sim_gpio_port;
+
+    if ((port >= 0) && (port < 16) && (pinNum < 8U))
+    {
+        gpio_slew_rate[port][pinNum] = value;
+    }
+}
+
+void Cy_GPIO_SetDriveSel(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    (void)base;
+    (void)pinNum;
+    (void)value;
+}
+
+uint32_t sim_gpio_drive_mode(uint32_t port, uint32_t pin)
+{
+    return ((port < 16U) && (pin < 8U)) ? gpio_drive_mode[port][pin] : CY_GPIO_DM_ANALOG;
+}
+
+uint32_t sim_gpio_slew_rate(uint32_t port, uint32_t pin)
+{
+    return ((port < 16U) && (pin < 8U)) ? gpio_slew_rate[port][pin] : CY_GPIO_SLEW_FAST;
+}
+
+/* TCPWM0 counters, one-shot: the terminal count interrupt fires period counts after the start */
+
+static uint64_t sim_tcpwm_count_ns(uint32_t cntNum)
+{
+    int dest = PCLK_TCPWM0_CLOCKS0 + (int)cntNum;
+    uint32_t divider = clock_dest_assigned[dest] ? (divider_value[clock_dest_divider[dest]] + 1U) : 1U;
+
+    return (1000000000ULL * divider) / SIM_PERI_CLOCK_HZ;
+}
+
+static void sim_tcpwm_terminal_count(void *p_arg)
+{
+    uint32_t cntNum = (uint32_t)(uintptr_t)p_arg;
+
+    counters[cntNum].interruptStatus |= CY_TCPWM_INT_ON_TC;
+    if (0U != (counters[cntNum].interruptMask & CY_TCPWM_INT_ON_TC))
+    {
+        sim_irq_raise(tcpwm_0_interrupts_0_IRQn + (IRQn_Type)cntNum);
+    }
+}
+
+cy_en_tcpwm_status_t Cy_TCPWM_Counter_Init(TCPWM_Type *base, uint32_t cntNum,
+                                           cy_stc_tcpwm_counter_config_t const *config)
+{
+    (void)base;
+    if ((cntNum >= SIM_TCPWM_COUNTERS) || (NULL == config) || (CY_TCPWM_COUNTER_ONESHOT != config->runMode))
+    {
+        return CY_TCPWM_BAD_PARAM;
+    }
+    memset(&counters[cntNum], 0, sizeof(counters[cntNum]));
+    counters[cntNum].period = config->period;
+    return CY_TCPWM_SUCCESS;
+}
+
+void Cy_TCPWM_Counter_Enable(TCPWM_Type *base, uint32_t cntNum)
+{
+    (void)base;
+    counters[cntNum].enabled = true;
+}
+
+void Cy_TCPWM_Counter_SetCounter(TCPWM_Type *base, uint32_t cntNum, uint32_t count)
+{
+    (void)base;
+    (void)cntNum;
+    (void)count;
+}
+
+void Cy_TCPWM_Counter_SetPeriod(TCPWM_Type *base, uint32_t cntNum, uint32_t period)
+{
+    (void)base;
+    counters[cntNum].period = period;
+}
+
+void Cy_TCPWM_TriggerStart_Single(TCPWM_Type *base, uint32_t cntNum)
+{
+    (void)base;
+    if (!counters[cntNum].enabled)
+    {
+        return;
+    }
+    sim_hw_cancel(sim_tcpwm_terminal_count, (void *)(uintptr_t)cntNum);
+    sim_hw_at(sim_now_ns() + ((uint64_t)counters[cntNum].period * sim_tcpwm_count_ns(cntNum)),
+              sim_tcpwm_terminal_count, (void *)(uintptr_t)cntNum);
+}
+
+void Cy_TCPWM_TriggerStopOrKill_Single(TCPWM_Type *base, uint32_t cntNum)
+{
+    (void)base;
+    sim_hw_cancel(sim_tcpwm_terminal_count, (void *)(uintptr_t)cntNum);
+}
+
+void Cy_TCPWM_SetInterruptMask(TCPWM_Type *base, uint32_t cntNum, uint32_t source)
+{
+    (void)base;
+    counters[cntNum].interruptMask = source;
+}
+
+uint32_t Cy_TCPWM_GetInterruptStatusMasked(TCPWM_Type const *base, uint32_t cntNum)
+{
+    (void)base;
+    return counters[cntNum].interruptStatus & counters[cntNum].interruptMask;
+}
+
+void Cy_TCPWM_ClearInterrupt(TCPWM_Type *base, uint32_t cntNum, uint32_t source)
+{
+    (void)base;
+    counters[cntNum].interruptStatus &= ~source;
+}
+
+cy_en_hbdma_status_t Cy_HBDma_Init(LVDSSS_LVDS_Type *lvds_base, USB32DEV_Type *usbss_base,
+                                   cy_stc_hbdma_context_t *pDrvContext, uint32_t cb_mem_size_1, uint32_t cb_mem_size_2)
+{
+    (void)lvds_base;
+    (void)usbss_base;
+    (void)cb_mem_size_1;
+    (void)cb_mem_size_2;
+    if (NULL == pDrvContext)
+    {
+        return CY_HBDMA_BAD_PARAM;
+    }
+    pDrvContext->initialized = true;
+    return CY_HBDMA_SUCCESS;
+}
+
+cy_en_hbdma_mgr_status_t Cy_HBDma_DscrList_Create(cy_stc_hbdma_dscr_list_t *list_p, uint16_t dscrCnt)
+{
+    if (NULL == list_p)
+    {
+        return CY_HBDMA_MGR_BAD_PARAM;
+    }
+    list_p->count = dscrCnt;
+    return CY_HBDMA_MGR_SUCCESS;
+}
+
+cy_en_hbdma_mgr_status_t Cy_HBDma_BufMgr_Create(cy_stc_hbdma_buf_mgr_t *pBufMgr, uint32_t *startAddr,
+                                                uint32_t regionSize)
+{
+    /* The region is a device address, never touched here */
+    (void)startAddr;
+    if (NULL == pBufMgr)
+    {
+        return CY_HBDMA_MGR_BAD_PARAM;
+    }
+    pBufMgr->regionSize = regionSize;
+    return CY_HBDMA_MGR_SUCCESS;
+}
+
+void *Cy_HBDma_BufMgr_Alloc(cy_stc_hbdma_buf_mgr_t *pBufMgr, uint32_t bufferSize)
+{
+    (void)pBufMgr;
+    return calloc(1U, bufferSize);
+}
+
+cy_en_hbdma_mgr_status_t Cy_HBDma_BufMgr_Free(cy_stc_hbdma_buf_mgr_t *pBufMgr, void *pBuffer)
+{
+    (void)pBufMgr;
+    free(pBuffer);
+    return CY_HBDMA_MGR_SUCCESS;
+}
+
+cy_en_hbdma_mgr_status_t Cy_HBDma_Mgr_Init(cy_stc_hbdma_mgr_context_t *pContext, cy_stc_hbdma_context_t *pDrvContext,
+                                           cy_stc_hbdma_dscr_list_t *pDscrList, cy_stc_hbdma_buf_mgr_t *pBufMgr)
+{
+    if ((NULL == pContext) || (NULL == pDrvContext) || (NULL == pDscrList) || (NULL == pBufMgr) ||
+        (!pDrvContext->initialized))
+    {
+        return CY_HBDMA_MGR_BAD_PARAM;
+    }
+    pContext->pDrvContext = pDrvContext;
+    return CY_HBDMA_MGR_SUCCESS;
+}
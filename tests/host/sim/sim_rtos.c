@@ -0,0 +1,985 @@
+/*
+ * Simulated time, interrupts and the FreeRTOS services used by the firmware, for the host
+ * simulator. Tasks are cooperative contexts (ucontext) switched by a single scheduler loop: the
+ * most urgent ready task runs until it blocks or a more urgent one becomes ready at a kernel call
+ * or busy wait. The timer service task runs the software timers and the pended function calls at
+ * configTIMER_TASK_PRIORITY, like the FreeRTOS daemon.
+ */
+
+#define _XOPEN_SOURCE 700
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+#include "sim.h"
+#include "task.h"
+#include "timers.h"
+#include "semphr.h"
+#include "cy_pdl.h"
+
+#define SIM_TICK_NS                     (1000000000ULL / configTICK_RATE_HZ)
+#define SIM_NEVER                       (UINT64_MAX)
+
+typedef enum
+{
+    SIM_TASK_READY = 0,
+    SIM_TASK_BLOCKED,
+    SIM_TASK_DELETED
+} sim_task_state_t;
+
+struct sim_task
+{
+    ucontext_t context;
+    void *pStack;
+    char name[16];
+    UBaseType_t priority;
+    TaskFunction_t function;
+    void *pArg;
+    sim_task_state_t state;
+    uint64_t readySeq;                  /* Round robin order among equal priorities */
+    uint64_t wakeNs;                    /* Timeout of the current block */
+    bool timedOut;
+    struct sim_sem *pWaitSem;
+    bool waitNotify;
+    uint32_t notifyValue;
+    uint64_t busyNs;
+    struct sim_task *pNext;
+};
+
+struct sim_timer
+{
+    char name[16];
+    TickType_t period;
+    bool autoReload;
+    bool active;
+    uint64_t expiryNs;
+    void *pId;
+    TimerCallbackFunction_t callback;
+};
+
+typedef struct sim_hw_event
+{
+    uint64_t atNs;
+    uint64_t seq;
+    sim_hw_function_t function;
+    void *pArg;
+    struct sim_hw_event *pNext;
+} sim_hw_event_t;
+
+typedef struct
+{
+    PendedFunction_t function;
+    void *pArg;
+    uint32_t arg;
+} sim_pended_t;
+
+#define SIM_MAX_TIMERS                  (16U)
+
+static uint64_t now_ns;
+static bool scheduler_running;
+static bool verbose;
+static bool failed;
+static ucontext_t scheduler_context;
+static struct sim_task *p_tasks;
+static struct sim_task *p_current;
+static struct sim_task *p_main_task;
+static struct sim_task *p_timer_task;
+static bool timer_task_own_wait;
+static uint64_t ready_seq;
+static uint32_t critical_nesting;
+static uint32_t suspend_nesting;
+static uint32_t isr_depth;
+static sim_stats_t stats;
+
+static sim_hw_event_t *p_hw_events;
+static uint64_t hw_seq;
+
+static cy_israddress irq_handler[SIM_IRQ_COUNT];
+static bool irq_enabled[SIM_IRQ_COUNT];
+static bool irq_pending[SIM_IRQ_COUNT];
+
+static struct sim_timer timers[SIM_MAX_TIMERS];
+static sim_pended_t pended[configTIMER_QUEUE_LENGTH];
+static uint32_t pended_head;
+static uint32_t pended_count;
+
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+uint32_t SystemCoreClock = SIM_CORE_CLOCK_HZ;
+
+static void sim_set_now(uint64_t ns)
+{
+    if (ns > now_ns)
+    {
+        now_ns = ns;
+    }
+    if (0U != (sim_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        sim_dwt.CYCCNT = (uint32_t)((now_ns * (SIM_CORE_CLOCK_HZ / 1000000U)) / 1000U);
+    }
+}
+
+uint64_t sim_now_ns(void)
+{
+    return now_ns;
+}
+
+void sim_assert_failed(const char *file, int line)
+{
+    fprintf(stderr, "sim: assertion failed at %s:%d, %.3f ms, task %s\n", file, line, (double)now_ns / 1e6,
+            (NULL != p_current) ? p_current->name : "-");
+    exit(1);
+}
+
+void sim_set_verbose(bool enable)
+{
+    verbose = enable;
+}
+
+void sim_log(const char *level, const char *format, ...)
+{
+    va_list args;
+
+    if (!verbose)
+    {
+        return;
+    }
+    printf("%10.3f ms %-4s ", (double)now_ns / 1e6, level);
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
+void sim_get_stats(sim_stats_t *p_stats)
+{
+    *p_stats = stats;
+}
+
+void sim_clear_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint64_t sim_task_busy_ns(const char *name)
+{
+    struct sim_task *p_task;
+
+    for (p_task = p_tasks; NULL != p_task; p_task = p_task->pNext)
+    {
+        if (0 == strcmp(p_task->name, name))
+        {
+            return p_task->busyNs;
+        }
+    }
+    return 0U;
+}
+
+bool sim_in_isr(void)
+{
+    return (0U != isr_depth);
+}
+
+bool sim_in_timer_task(void)
+{
+    return ((0U == isr_depth) && (NULL != p_current) && (p_current == p_timer_task));
+}
+
+/* Simulated hardware */
+
+void sim_hw_at(uint64_t at_ns, sim_hw_function_t function, void *p_arg)
+{
+    sim_hw_event_t *p_event = calloc(1, sizeof(sim_hw_event_t));
+    sim_hw_event_t **pp_iter;
+
+    configASSERT(NULL != p_event);
+    p_event->atNs = (at_ns < now_ns) ? now_ns : at_ns;
+    p_event->seq = hw_seq++;
+    p_event->function = function;
+    p_event->pArg = p_arg;
+
+    for (pp_iter = &p_hw_events; NULL != *pp_iter; pp_iter = &(*pp_iter)->pNext)
+    {
+        if ((*pp_iter)->atNs > p_event->atNs)
+        {
+            break;
+        }
+    }
+    p_event->pNext = *pp_iter;
+    *pp_iter = p_event;
+}
+
+void sim_hw_cancel(sim_hw_function_t function, void *p_arg)
+{
+    sim_hw_event_t **pp_iter = &p_hw_events;
+    sim_hw_event_t *p_event;
+
+    while (NULL != *pp_iter)
+    {
+        p_event = *pp_iter;
+        if ((p_event->function == function) && (p_event->pArg == p_arg))
+        {
+            *pp_iter = p_event->pNext;
+            free(p_event);
+        }
+        else
+        {
+            pp_iter = &p_event->pNext;
+        }
+    }
+}
+
+void sim_irq_raise(IRQn_Type irq)
+{
+    configASSERT((irq >= 0) && (irq < SIM_IRQ_COUNT));
+    irq_pending[irq] = true;
+}
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr)
+{
+    if ((NULL == config) || (config->intrSrc < 0) || (config->intrSrc >= SIM_IRQ_COUNT))
+    {
+        return CY_SYSINT_BAD_PARAM;
+    }
+    irq_handler[config->intrSrc] = userIsr;
+    return CY_SYSINT_SUCCESS;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    irq_enabled[irq] = true;
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    irq_enabled[irq] = false;
+}
+
+/* Run the handlers of the raised lines, unless a critical section holds them off */
+static bool sim_dispatch_irqs(void)
+{
+    bool ran = false;
+    int irq;
+
+    if ((0U != critical_nesting) || (0U != isr_depth))
+    {
+        return false;
+    }
+    for (irq = 0; irq < SIM_IRQ_COUNT; irq++)
+    {
+        if ((irq_pending[irq]) && (irq_enabled[irq]) && (NULL != irq_handler[irq]))
+        {
+            irq_pending[irq] = false;
+            isr_depth++;
+            stats.interrupts++;
+            irq_handler[irq]();
+            isr_depth--;
+            ran = true;
+        }
+    }
+    return ran;
+}
+
+static void sim_make_ready(struct sim_task *p_task)
+{
+    p_task->state = SIM_TASK_READY;
+    p_task->pWaitSem = NULL;
+    p_task->waitNotify = false;
+    p_task->readySeq = ready_seq++;
+}
+
+/* Hardware events and interrupts due by now, then the tasks whose block timed out */
+static void sim_dispatch_due(void)
+{
+    sim_hw_event_t *p_event;
+    struct sim_task *p_task;
+    bool again = true;
+
+    while (again)
+    {
+        again = false;
+        if ((NULL != p_hw_events) && (p_hw_events->atNs <= now_ns))
+        {
+            p_event = p_hw_events;
+            p_hw_events = p_event->pNext;
+            p_event->function(p_event->pArg);
+            free(p_event);
+            again = true;
+        }
+        if (sim_dispatch_irqs())
+        {
+            again = true;
+        }
+    }
+
+    for (p_task = p_tasks; NULL != p_task; p_task = p_task->pNext)
+    {
+        if ((SIM_TASK_BLOCKED == p_task->state) && (p_task->wakeNs <= now_ns))
+        {
+            p_task->timedOut = true;
+            sim_make_ready(p_task);
+        }
+    }
+}
+
+static uint64_t sim_next_due_ns(void)
+{
+    struct sim_task *p_task;
+    uint64_t next = (NULL != p_hw_events) ? p_hw_events->atNs : SIM_NEVER;
+
+    for (p_task = p_tasks; NULL != p_task; p_task = p_task->pNext)
+    {
+        if ((SIM_TASK_BLOCKED == p_task->state) && (p_task->wakeNs < next))
+        {
+            next = p_task->wakeNs;
+        }
+    }
+    return next;
+}
+
+static struct sim_task *sim_highest_ready(void)
+{
+    struct sim_task *p_task;
+    struct sim_task *p_best = NULL;
+
+    for (p_task = p_tasks; NULL != p_task; p_task = p_task->pNext)
+    {
+        if ((SIM_TASK_READY == p_task->state) &&
+            ((NULL == p_best) || (p_task->priority > p_best->priority) ||
+             ((p_task->priority == p_best->priority) && (p_task->readySeq < p_best->readySeq))))
+        {
+            p_best = p_task;
+        }
+    }
+    return p_best;
+}
+
+static void sim_switch_out(void)
+{
+    struct sim_task *p_self = p_current;
+
+    configASSERT((NULL != p_self) && (0U == isr_depth) && (0U == critical_nesting));
+    swapcontext(&p_self->context, &scheduler_context);
+}
+
+/* Give the CPU to a more urgent ready task, the running one stays ready */
+static void sim_preempt_check(void)
+{
+    struct sim_task *p_best;
+
+    if ((NULL == p_current) || (0U != isr_depth) || (0U != critical_nesting) || (0U != suspend_nesting))
+    {
+        return;
+    }
+    p_best = sim_highest_ready();
+    if ((NULL != p_best) && (p_best->priority > p_current->priority))
+    {
+        sim_switch_out();
+    }
+}
+
+/* Block the running task until woken or until wake_ns, returns false on timeout */
+static bool sim_block(uint64_t wake_ns)
+{
+    struct sim_task *p_self = p_current;
+    bool counted = ((p_self == p_timer_task) && (!timer_task_own_wait));
+    uint64_t start_ns = now_ns;
+
+    configASSERT(0U == suspend_nesting);
+    p_self->state = SIM_TASK_BLOCKED;
+    p_self->wakeNs = wake_ns;
+    p_self->timedOut = false;
+    if (counted)
+    {
+        stats.timerTaskBlocks++;
+    }
+    sim_switch_out();
+    if (counted)
+    {
+        stats.timerTaskBlockedNs += now_ns - start_ns;
+    }
+    return !p_self->timedOut;
+}
+
+static uint64_t sim_ticks_from_now_ns(TickType_t ticks)
+{
+    if (portMAX_DELAY == ticks)
+    {
+        return SIM_NEVER;
+    }
+    return ((now_ns / SIM_TICK_NS) + (uint64_t)ticks) * SIM_TICK_NS;
+}
+
+void sim_busy_wait_ns(uint64_t ns)
+{
+    struct sim_task *p_self = p_current;
+    uint64_t end_ns = now_ns + ns;
+    uint64_t next_ns;
+
+    if ((0U != isr_depth) || (NULL == p_self))
+    {
+        sim_set_now(end_ns);
+        return;
+    }
+
+    for (;;)
+    {
+        next_ns = sim_next_due_ns();
+        if (next_ns > end_ns)
+        {
+            next_ns = end_ns;
+        }
+        if (next_ns > now_ns)
+        {
+            p_self->busyNs += next_ns - now_ns;
+            stats.busyNs += next_ns - now_ns;
+            if (p_self == p_timer_task)
+            {
+                stats.timerTaskBusyNs += next_ns - now_ns;
+            }
+            sim_set_now(next_ns);
+        }
+        sim_dispatch_due();
+        sim_preempt_check();
+        if (now_ns >= end_ns)
+        {
+            break;
+        }
+    }
+}
+
+void sim_yield_from_isr(BaseType_t woken)
+{
+    /* The scheduler picks the most urgent task once the interrupt returns */
+    (void)woken;
+}
+
+void sim_critical_enter(void)
+{
+    critical_nesting++;
+}
+
+void sim_critical_exit(void)
+{
+    configASSERT(0U != critical_nesting);
+    critical_nesting--;
+    if ((0U == critical_nesting) && (0U == isr_depth) && (NULL != p_current))
+    {
+        /* Interrupts raised meanwhile are taken now */
+        if (sim_dispatch_irqs())
+        {
+            sim_preempt_check();
+        }
+    }
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    sim_critical_enter();
+    return 0U;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    (void)savedIntrStatus;
+    sim_critical_exit();
+}
+
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    sim_busy_wait_ns((uint64_t)microseconds * 1000U);
+}
+
+void Cy_SysLib_Delay(uint32_t milliseconds)
+{
+    sim_busy_wait_ns((uint64_t)milliseconds * 1000000U);
+}
+
+/* Tasks */
+
+static void sim_task_entry(void)
+{
+    struct sim_task *p_self = p_current;
+
+    p_self->function(p_self->pArg);
+    if (p_self != p_main_task)
+    {
+        fprintf(stderr, "sim: task %s returned\n", p_self->name);
+    }
+    p_self->state = SIM_TASK_DELETED;
+    sim_switch_out();
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, configSTACK_DEPTH_TYPE stack_depth,
+                       void *p_arg, UBaseType_t priority, TaskHandle_t *p_handle)
+{
+    struct sim_task *p_task = calloc(1, sizeof(struct sim_task));
+
+    (void)stack_depth;
+    if (NULL == p_task)
+    {
+        return pdFAIL;
+    }
+    p_task->pStack = malloc(SIM_TASK_STACK_BYTES);
+    if (NULL == p_task->pStack)
+    {
+        free(p_task);
+        return pdFAIL;
+    }
+    strncpy(p_task->name, (NULL != name) ? name : "", sizeof(p_task->name) - 1U);
+    p_task->priority = (priority < configMAX_PRIORITIES) ? priority : (configMAX_PRIORITIES - 1);
+    p_task->function = function;
+    p_task->pArg = p_arg;
+    getcontext(&p_task->context);
+    p_task->context.uc_stack.ss_sp = p_task->pStack;
+    p_task->context.uc_stack.ss_size = SIM_TASK_STACK_BYTES;
+    p_task->context.uc_link = NULL;
+    makecontext(&p_task->context, sim_task_entry, 0);
+    sim_make_ready(p_task);
+
+    p_task->pNext = p_tasks;
+    p_tasks = p_task;
+    if (NULL != p_handle)
+    {
+        *p_handle = p_task;
+    }
+    sim_preempt_check();
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    struct sim_task *p_task = (NULL != task) ? task : p_current;
+
+    p_task->state = SIM_TASK_DELETED;
+    if (p_task == p_current)
+    {
+        sim_switch_out();
+    }
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    if (0U == ticks)
+    {
+        sim_yield();
+        return;
+    }
+    (void)sim_block(sim_ticks_from_now_ns(ticks));
+}
+
+void sim_yield(void)
+{
+    p_current->readySeq = ready_seq++;
+    sim_switch_out();
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(now_ns / SIM_TICK_NS);
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return xTaskGetTickCount();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return p_current;
+}
+
+BaseType_t xTaskGetSchedulerState(void)
+{
+    return scheduler_running ? taskSCHEDULER_RUNNING : taskSCHEDULER_NOT_STARTED;
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task)
+{
+    return ((NULL != task) ? task : p_current)->priority;
+}
+
+void vTaskSuspendAll(void)
+{
+    suspend_nesting++;
+}
+
+BaseType_t xTaskResumeAll(void)
+{
+    configASSERT(0U != suspend_nesting);
+    suspend_nesting--;
+    sim_preempt_check();
+    return pdFALSE;
+}
+
+static bool sim_notify(struct sim_task *p_task)
+{
+    p_task->notifyValue++;
+    if ((SIM_TASK_BLOCKED == p_task->state) && (p_task->waitNotify))
+    {
+        sim_make_ready(p_task);
+        return true;
+    }
+    return false;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)sim_notify(task);
+    sim_preempt_check();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *p_woken)
+{
+    if ((sim_notify(task)) && (NULL != p_woken))
+    {
+        *p_woken = pdTRUE;
+    }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    struct sim_task *p_self = p_current;
+    uint32_t value;
+
+    if ((0U == p_self->notifyValue) && (0U != ticks))
+    {
+        p_self->waitNotify = true;
+        (void)sim_block(sim_ticks_from_now_ns(ticks));
+    }
+    value = p_self->notifyValue;
+    if (0U != value)
+    {
+        p_self->notifyValue = (pdFALSE != clear_on_exit) ? 0U : (value - 1U);
+    }
+    return value;
+}
+
+/* Semaphores */
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    struct sim_sem *p_sem = calloc(1, sizeof(struct sim_sem));
+
+    if (NULL != p_sem)
+    {
+        p_sem->maxCount = max_count;
+        p_sem->count = initial_count;
+    }
+    return p_sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCountingStatic(UBaseType_t max_count, UBaseType_t initial_count,
+                                                 StaticSemaphore_t *p_buffer)
+{
+    p_buffer->maxCount = max_count;
+    p_buffer->count = initial_count;
+    return p_buffer;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    free(sem);
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem)
+{
+    return sem->count;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    struct sim_task *p_self = p_current;
+
+    if (0U != sem->count)
+    {
+        sem->count--;
+        return pdTRUE;
+    }
+    if ((0U == ticks) || (0U != isr_depth))
+    {
+        return pdFALSE;
+    }
+    /* A give while blocked hands the count over directly */
+    p_self->pWaitSem = sem;
+    return sim_block(sim_ticks_from_now_ns(ticks)) ? pdTRUE : pdFALSE;
+}
+
+static bool sim_sem_give(SemaphoreHandle_t sem)
+{
+    struct sim_task *p_task;
+    struct sim_task *p_waiter = NULL;
+
+    for (p_task = p_tasks; NULL != p_task; p_task = p_task->pNext)
+    {
+        if ((SIM_TASK_BLOCKED == p_task->state) && (p_task->pWaitSem == sem) &&
+            ((NULL == p_waiter) || (p_task->priority > p_waiter->priority)))
+        {
+            p_waiter = p_task;
+        }
+    }
+    if (NULL != p_waiter)
+    {
+        sim_make_ready(p_waiter);
+        return true;
+    }
+    if (sem->count >= sem->maxCount)
+    {
+        return false;
+    }
+    sem->count++;
+    return true;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    BaseType_t given = sim_sem_give(sem) ? pdTRUE : pdFALSE;
+
+    sim_preempt_check();
+    return given;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *p_woken)
+{
+    if (NULL != p_woken)
+    {
+        *p_woken = pdTRUE;
+    }
+    return sim_sem_give(sem) ? pdTRUE : pdFALSE;
+}
+
+/* Software timers and the timer service task */
+
+static void sim_timer_task_kick(void)
+{
+    if ((NULL != p_timer_task) && (SIM_TASK_BLOCKED == p_timer_task->state) && (timer_task_own_wait))
+    {
+        sim_make_ready(p_timer_task);
+    }
+}
+
+static uint64_t sim_timer_next_expiry_ns(void)
+{
+    uint64_t next = SIM_NEVER;
+    uint32_t index;
+
+    for (index = 0; index < SIM_MAX_TIMERS; index++)
+    {
+        if ((timers[index].active) && (timers[index].expiryNs < next))
+        {
+            next = timers[index].expiryNs;
+        }
+    }
+    return next;
+}
+
+static void sim_timer_task(void *p_arg)
+{
+    struct sim_timer *p_due;
+    sim_pended_t call;
+    uint32_t index;
+
+    (void)p_arg;
+    for (;;)
+    {
+        /* Expired timers first, then one pended call, like the FreeRTOS daemon */
+        p_due = NULL;
+        for (index = 0; index < SIM_MAX_TIMERS; index++)
+        {
+            if ((timers[index].active) && (timers[index].expiryNs <= now_ns) &&
+                ((NULL == p_due) || (timers[index].expiryNs < p_due->expiryNs)))
+            {
+                p_due = &timers[index];
+            }
+        }
+        if (NULL != p_due)
+        {
+            if (p_due->autoReload)
+            {
+                p_due->expiryNs += (uint64_t)p_due->period * SIM_TICK_NS;
+            }
+            else
+            {
+                p_due->active = false;
+            }
+            p_due->callback(p_due);
+            continue;
+        }
+
+        if (0U != pended_count)
+        {
+            call = pended[pended_head];
+            pended_head = (pended_head + 1U) % configTIMER_QUEUE_LENGTH;
+            pended_count--;
+            call.function(call.pArg, call.arg);
+            continue;
+        }
+
+        timer_task_own_wait = true;
+        (void)sim_block(sim_timer_next_expiry_ns());
+        timer_task_own_wait = false;
+    }
+}
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, UBaseType_t auto_reload, void *p_id,
+                           TimerCallbackFunction_t callback)
+{
+    uint32_t index;
+
+    for (index = 0; index < SIM_MAX_TIMERS; index++)
+    {
+        if (NULL == timers[index].callback)
+        {
+            memset(&timers[index], 0, sizeof(timers[index]));
+            strncpy(timers[index].name, (NULL != name) ? name : "", sizeof(timers[index].name) - 1U);
+            timers[index].period = period;
+            timers[index].autoReload = (pdFALSE != auto_reload);
+            timers[index].pId = p_id;
+            timers[index].callback = callback;
+            return &timers[index];
+        }
+    }
+    return NULL;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t ticks_to_wait)
+{
+    (void)ticks_to_wait;
+    configASSERT(0U != period);
+    timer->period = period;
+    timer->expiryNs = sim_ticks_from_now_ns(period);
+    timer->active = true;
+    sim_timer_task_kick();
+    sim_preempt_check();
+    return pdPASS;
+}
+
+BaseType_t xTimerChangePeriodFromISR(TimerHandle_t timer, TickType_t period, BaseType_t *p_woken)
+{
+    timer->period = period;
+    timer->expiryNs = sim_ticks_from_now_ns(period);
+    timer->active = true;
+    sim_timer_task_kick();
+    if (NULL != p_woken)
+    {
+        *p_woken = pdTRUE;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks_to_wait)
+{
+    return xTimerChangePeriod(timer, timer->period, ticks_to_wait);
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t ticks_to_wait)
+{
+    (void)ticks_to_wait;
+    timer->active = false;
+    return pdPASS;
+}
+
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticks_to_wait)
+{
+    (void)ticks_to_wait;
+    memset(timer, 0, sizeof(*timer));
+    return pdPASS;
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t timer)
+{
+    return timer->active ? pdTRUE : pdFALSE;
+}
+
+void *pvTimerGetTimerID(TimerHandle_t timer)
+{
+    return timer->pId;
+}
+
+static BaseType_t sim_pend(PendedFunction_t function, void *p_arg, uint32_t arg)
+{
+    uint32_t tail;
+
+    if (pended_count >= configTIMER_QUEUE_LENGTH)
+    {
+        stats.pendFailures++;
+        return pdFAIL;
+    }
+    tail = (pended_head + pended_count) % configTIMER_QUEUE_LENGTH;
+    pended[tail].function = function;
+    pended[tail].pArg = p_arg;
+    pended[tail].arg = arg;
+    pended_count++;
+    sim_timer_task_kick();
+    return pdPASS;
+}
+
+BaseType_t xTimerPendFunctionCall(PendedFunction_t function, void *p_arg, uint32_t arg, TickType_t ticks_to_wait)
+{
+    BaseType_t status;
+
+    (void)ticks_to_wait;
+    status = sim_pend(function, p_arg, arg);
+    sim_preempt_check();
+    return status;
+}
+
+BaseType_t xTimerPendFunctionCallFromISR(PendedFunction_t function, void *p_arg, uint32_t arg,
+                                         BaseType_t *p_woken)
+{
+    BaseType_t status = sim_pend(function, p_arg, arg);
+
+    if ((pdPASS == status) && (NULL != p_woken))
+    {
+        *p_woken = pdTRUE;
+    }
+    return status;
+}
+
+TaskHandle_t xTimerGetTimerDaemonTaskHandle(void)
+{
+    return p_timer_task;
+}
+
+/* Scheduler */
+
+int sim_run(TaskFunction_t main_function, void *p_arg, UBaseType_t priority)
+{
+    struct sim_task *p_next;
+    uint64_t next_ns;
+
+    if (NULL == p_timer_task)
+    {
+        (void)xTaskCreate(sim_timer_task, "Tmr Svc", configTIMER_TASK_STACK_DEPTH, NULL,
+                          configTIMER_TASK_PRIORITY, &p_timer_task);
+    }
+    (void)xTaskCreate(main_function, "main", 0, p_arg, priority, &p_main_task);
+    scheduler_running = true;
+
+    while (SIM_TASK_DELETED != p_main_task->state)
+    {
+        sim_dispatch_due();
+        p_next = sim_highest_ready();
+        if (NULL != p_next)
+        {
+            p_current = p_next;
+            stats.contextSwitches++;
+            swapcontext(&scheduler_context, &p_next->context);
+            p_current = NULL;
+            continue;
+        }
+
+        next_ns = sim_next_due_ns();
+        if (SIM_NEVER == next_ns)
+        {
+            fprintf(stderr, "sim: every task blocked with nothing to wake them at %.3f ms\n", (double)now_ns / 1e6);
+            failed = true;
+            break;
+        }
+        sim_set_now(next_ns);
+    }
+
+    scheduler_running = false;
+    return failed ? -1 : 0;
+}
@@ -0,0 +1,524 @@
+/*
+ * SCB0 I2C master of the host simulator, with the bus timing of the data rate set on it.
+ *
+ * The byte by byte driver calls spin the calling task for the time the bits take on the wire,
+ * like the PDL waiting on the FIFO flags. MasterWrite/MasterRead return at once: the address
+ * phase is resolved once the address is on the wire, the data moves to or from the slave then,
+ * and the SCB0 interrupt reports completion when the last bit and STOP have been clocked.
+ */
+
+#include <stdio.h>
+#include "sim.h"
+#include "cy_pdl.h"
+
+CySCB_Type sim_scb0;
+
+typedef struct
+{
+    uint32_t dataRate;
+    sim_i2c_slave_t *pSlaves;
+    sim_i2c_slave_t *pOwner;            /* Slave addressed in the transaction on the bus */
+    bool busHeld;                       /* No STOP since the last START */
+    bool firstData;                     /* Next data byte is the first of the transfer */
+    sim_i2c_fault_t fault;
+    uint32_t faultTransfers;
+    sim_i2c_stats_t stats;
+
+    /* Transfer started by Cy_SCB_I2C_MasterWrite/MasterRead */
+    cy_stc_scb_i2c_context_t *pContext;
+    cy_stc_scb_i2c_master_xfer_config_t *pXfer;
+    bool asyncRead;
+    uint32_t asyncStatus;
+    uint32_t asyncCount;
+    uint32_t pendingEvents;             /* Reported by the next Cy_SCB_I2C_Interrupt */
+} sim_scb_t;
+
+static sim_scb_t scb;
+
+void sim_i2c_attach(sim_i2c_slave_t *p_slave)
+{
+    p_slave->pNext = scb.pSlaves;
+    scb.pSlaves = p_slave;
+}
+
+void sim_i2c_inject_fault(sim_i2c_fault_t fault, uint32_t transfers)
+{
+    scb.fault = fault;
+    scb.faultTransfers = transfers;
+}
+
+void sim_i2c_get_stats(sim_i2c_stats_t *p_stats)
+{
+    *p_stats = scb.stats;
+    p_stats->dataRate = scb.dataRate;
+}
+
+void sim_i2c_clear_stats(void)
+{
+    memset(&scb.stats, 0, sizeof(scb.stats));
+}
+
+static uint64_t sim_scb_bits_ns(uint32_t bits)
+{
+    uint64_t ns = ((uint64_t)bits * 1000000000ULL) / ((0U != scb.dataRate) ? scb.dataRate : 100000U);
+
+    scb.stats.busNs += ns;
+    return ns;
+}
+
+/* Bus primitives, acting at the current simulated time */
+
+static void sim_scb_bus_stop(void)
+{
+    if (NULL != scb.pOwner)
+    {
+        scb.pOwner->stop(scb.pOwner, false);
+        scb.pOwner = NULL;
+    }
+    scb.busHeld = false;
+}
+
+static bool sim_scb_bus_address(uint8_t address, bool read)
+{
+    sim_i2c_slave_t *p_slave;
+
+    /* A repeated START ends the previous phase for the slave */
+    if (NULL != scb.pOwner)
+    {
+        scb.pOwner->stop(scb.pOwner, true);
+        scb.pOwner = NULL;
+    }
+    scb.busHeld = true;
+    scb.firstData = true;
+    scb.stats.transfers++;
+
+    for (p_slave = scb.pSlaves; NULL != p_slave; p_slave = p_slave->pNext)
+    {
+        if (p_slave->address == address)
+        {
+            break;
+        }
+    }
+    if ((NULL == p_slave) || (!p_slave->start(p_slave, read)))
+    {
+        scb.stats.addrNaks++;
+        return false;
+    }
+    scb.pOwner = p_slave;
+    return true;
+}
+
+/* The fault injected into the first data byte of the transfer, if any */
+static sim_i2c_fault_t sim_scb_take_fault(bool read)
+{
+    sim_i2c_fault_t fault = SIM_I2C_FAULT_NONE;
+
+    if ((scb.firstData) && (0U != scb.faultTransfers))
+    {
+        scb.faultTransfers--;
+        scb.stats.faults++;
+        fault = scb.fault;
+        if ((read) && (SIM_I2C_FAULT_DATA_NAK == fault))
+        {
+            /* The master acknowledges the bytes it reads, a disturbed read shows as a bus error */
+            fault = SIM_I2C_FAULT_BUS_ERR;
+        }
+    }
+    scb.firstData = false;
+    return fault;
+}
+
+/* Master status bit of a fault, the slave sees the transfer end */
+static uint32_t sim_scb_fault_status(sim_i2c_fault_t fault)
+{
+    switch (fault)
+    {
+        case SIM_I2C_FAULT_DATA_NAK:
+            scb.stats.dataNaks++;
+            return CY_SCB_I2C_MASTER_DATA_NAK;
+        case SIM_I2C_FAULT_ARB_LOST:
+            return CY_SCB_I2C_MASTER_ARB_LOST;
+        case SIM_I2C_FAULT_BUS_ERR:
+            return CY_SCB_I2C_MASTER_BUS_ERR;
+        default:
+            return 0U;
+    }
+}
+
+static bool sim_scb_bus_write(uint8_t byte, uint32_t *p_status)
+{
+    uint32_t status = sim_scb_fault_status(sim_scb_take_fault(false));
+
+    if ((0U == status) && ((NULL == scb.pOwner) || (!scb.pOwner->write(scb.pOwner, byte))))
+    {
+        scb.stats.dataNaks++;
+        status = CY_SCB_I2C_MASTER_DATA_NAK;
+    }
+    *p_status = status;
+    return (0U == status);
+}
+
+static bool sim_scb_bus_read(uint8_t *p_byte, uint32_t *p_status)
+{
+    uint32_t status = sim_scb_fault_status(sim_scb_take_fault(true));
+
+    *p_byte = 0xFFU;
+    if ((0U == status) && (NULL != scb.pOwner))
+    {
+        *p_byte = scb.pOwner->read(scb.pOwner);
+    }
+    *p_status = status;
+    return (0U == status);
+}
+
+static void sim_scb_async_address(void *p_arg);
+static void sim_scb_async_done(void *p_arg);
+
+/* Driver set up */
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_Init(CySCB_Type *base, const cy_stc_scb_i2c_config_t *config,
+                                       cy_stc_scb_i2c_context_t *context)
+{
+    if ((NULL == base) || (NULL == config) || (NULL == context) || (CY_SCB_I2C_MASTER != config->i2cMode))
+    {
+        return CY_SCB_I2C_BAD_PARAM;
+    }
+    memset(context, 0, sizeof(*context));
+    context->state = CY_SCB_I2C_IDLE;
+    scb.pContext = context;
+    return CY_SCB_I2C_SUCCESS;
+}
+
+void Cy_SCB_I2C_DeInit(CySCB_Type *base)
+{
+    (void)base;
+    sim_hw_cancel(sim_scb_async_address, NULL);
+    sim_hw_cancel(sim_scb_async_done, NULL);
+    scb.pendingEvents = 0U;
+    if (scb.busHeld)
+    {
+        sim_scb_bus_stop();
+    }
+}
+
+void Cy_SCB_I2C_Enable(CySCB_Type *base)
+{
+    base->CTRL |= 1U;
+}
+
+void Cy_SCB_I2C_Disable(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    base->CTRL &= ~1U;
+    if (NULL != context)
+    {
+        context->state = CY_SCB_I2C_IDLE;
+        context->masterStatus = 0U;
+    }
+}
+
+uint32_t Cy_SCB_I2C_SetDataRate(CySCB_Type *base, uint32_t dataRateHz, uint32_t scbClockHz)
+{
+    uint32_t clkMin;
+    uint32_t clkMax;
+    uint32_t oversample;
+
+    (void)base;
+    if ((0U == dataRateHz) || (0U == scbClockHz) || (dataRateHz > CY_SCB_I2C_FSTP_DATA_RATE))
+    {
+        return 0U;
+    }
+    if (dataRateHz <= CY_SCB_I2C_STD_DATA_RATE)
+    {
+        clkMin = CY_SCB_I2C_MASTER_STD_CLK_MIN;
+        clkMax = CY_SCB_I2C_MASTER_STD_CLK_MAX;
+    }
+    else if (dataRateHz <= CY_SCB_I2C_FST_DATA_RATE)
+    {
+        clkMin = CY_SCB_I2C_MASTER_FST_CLK_MIN;
+        clkMax = CY_SCB_I2C_MASTER_FST_CLK_MAX;
+    }
+    else
+    {
+        clkMin = CY_SCB_I2C_MASTER_FSTP_CLK_MIN;
+        clkMax = CY_SCB_I2C_MASTER_FSTP_CLK_MAX;
+    }
+    if ((scbClockHz < clkMin) || (scbClockHz > clkMax))
+    {
+        return 0U;
+    }
+
+    /* The SCL period is a whole number of SCB clocks, rounded up so the rate is not exceeded */
+    oversample = (scbClockHz + dataRateHz - 1U) / dataRateHz;
+    scb.dataRate = scbClockHz / oversample;
+    return scb.dataRate;
+}
+
+void Cy_SCB_I2C_RegisterEventCallback(CySCB_Type const *base, cy_cb_scb_i2c_handle_events_t callback,
+                                      cy_stc_scb_i2c_context_t *context)
+{
+    (void)base;
+    context->cbEvents = callback;
+}
+
+void Cy_SCB_ClearMasterInterrupt(CySCB_Type *base, uint32_t interruptMask)
+{
+    (void)base;
+    (void)interruptMask;
+}
+
+void Cy_SCB_ClearTxFifo(CySCB_Type *base)
+{
+    (void)base;
+}
+
+void Cy_SCB_ClearRxFifo(CySCB_Type *base)
+{
+    (void)base;
+}
+
+/* Manual (byte by byte) master calls */
+
+static cy_en_scb_i2c_status_t sim_scb_manual_status(uint32_t status)
+{
+    switch (status)
+    {
+        case CY_SCB_I2C_MASTER_DATA_NAK:
+            return CY_SCB_I2C_MASTER_MANUAL_NAK;
+        case CY_SCB_I2C_MASTER_ARB_LOST:
+            return CY_SCB_I2C_MASTER_MANUAL_ARB_LOST;
+        case CY_SCB_I2C_MASTER_BUS_ERR:
+            return CY_SCB_I2C_MASTER_MANUAL_BUS_ERR;
+        default:
+            return CY_SCB_I2C_SUCCESS;
+    }
+}
+
+/* The bus is lost with an arbitration loss or bus error, the driver goes back to idle */
+static void sim_scb_manual_lost(cy_stc_scb_i2c_context_t *context, uint32_t status)
+{
+    if (0U != (status & (CY_SCB_I2C_MASTER_ARB_LOST | CY_SCB_I2C_MASTER_BUS_ERR)))
+    {
+        sim_scb_bus_stop();
+        context->state = CY_SCB_I2C_IDLE;
+    }
+}
+
+static cy_en_scb_i2c_status_t sim_scb_manual_address(uint32_t address, cy_en_scb_i2c_direction_t bitRnW,
+                                                     cy_stc_scb_i2c_context_t *context)
+{
+    sim_busy_wait_ns(sim_scb_bits_ns(10U));
+    context->state = CY_SCB_I2C_MASTER_ACTIVE;
+    if (!sim_scb_bus_address((uint8_t)address, CY_SCB_I2C_READ_XFER == bitRnW))
+    {
+        /* Only a STOP may follow */
+        context->state = CY_SCB_I2C_MASTER_WAIT;
+        return CY_SCB_I2C_MASTER_MANUAL_ADDR_NAK;
+    }
+    return CY_SCB_I2C_SUCCESS;
+}
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStart(CySCB_Type *base, uint32_t address,
+                                                  cy_en_scb_i2c_direction_t bitRnW, uint32_t timeoutMs,
+                                                  cy_stc_scb_i2c_context_t *context)
+{
+    (void)base;
+    (void)timeoutMs;
+    if ((CY_SCB_I2C_IDLE != context->state) || (0U != (context->masterStatus & CY_SCB_I2C_MASTER_BUSY)))
+    {
+        return CY_SCB_I2C_MASTER_NOT_READY;
+    }
+    return sim_scb_manual_address(address, bitRnW, context);
+}
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendReStart(CySCB_Type *base, uint32_t address,
+                                                    cy_en_scb_i2c_direction_t bitRnW, uint32_t timeoutMs,
+                                                    cy_stc_scb_i2c_context_t *context)
+{
+    (void)base;
+    (void)timeoutMs;
+    if ((CY_SCB_I2C_MASTER_ACTIVE != context->state) || (!scb.busHeld))
+    {
+        return CY_SCB_I2C_MASTER_NOT_READY;
+    }
+    return sim_scb_manual_address(address, bitRnW, context);
+}
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterSendStop(CySCB_Type *base, uint32_t timeoutMs,
+                                                 cy_stc_scb_i2c_context_t *context)
+{
+    (void)base;
+    (void)timeoutMs;
+    if (CY_SCB_I2C_IDLE == context->state)
+    {
+        return CY_SCB_I2C_MASTER_NOT_READY;
+    }
+    sim_busy_wait_ns(sim_scb_bits_ns(1U));
+    sim_scb_bus_stop();
+    context->state = CY_SCB_I2C_IDLE;
+    return CY_SCB_I2C_SUCCESS;
+}
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWriteByte(CySCB_Type *base, uint8_t byte, uint32_t timeoutMs,
+                                                  cy_stc_scb_i2c_context_t *context)
+{
+    uint32_t status;
+
+    (void)base;
+    (void)timeoutMs;
+    if (CY_SCB_I2C_MASTER_ACTIVE != context->state)
+    {
+        return CY_SCB_I2C_MASTER_NOT_READY;
+    }
+    sim_busy_wait_ns(sim_scb_bits_ns(9U));
+    (void)sim_scb_bus_write(byte, &status);
+    sim_scb_manual_lost(context, status);
+    return sim_scb_manual_status(status);
+}
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterReadByte(CySCB_Type *base, cy_en_scb_i2c_command_t ackNack,
+                                                 uint8_t *byte, uint32_t timeoutMs,
+                                                 cy_stc_scb_i2c_context_t *context)
+{
+    uint32_t status;
+
+    (void)base;
+    (void)ackNack;
+    (void)timeoutMs;
+    if (CY_SCB_I2C_MASTER_ACTIVE != context->state)
+    {
+        return CY_SCB_I2C_MASTER_NOT_READY;
+    }
+    sim_busy_wait_ns(sim_scb_bits_ns(9U));
+    (void)sim_scb_bus_read(byte, &status);
+    sim_scb_manual_lost(context, status);
+    return sim_scb_manual_status(status);
+}
+
+/* Interrupt driven master transfers */
+
+static void sim_scb_async_done(void *p_arg)
+{
+    cy_stc_scb_i2c_context_t *context = scb.pContext;
+    bool error = (0U != scb.asyncStatus);
+
+    (void)p_arg;
+    if ((error) || (!scb.pXfer->xferPending))
+    {
+        sim_scb_bus_stop();
+    }
+    context->masterNumBytes = scb.asyncCount;
+    context->masterStatus = scb.asyncStatus;
+    scb.pendingEvents = (scb.asyncRead ? CY_SCB_I2C_MASTER_RD_CMPLT_EVENT : CY_SCB_I2C_MASTER_WR_CMPLT_EVENT) |
+                        (error ? CY_SCB_I2C_MASTER_ERR_EVENT : 0U);
+    sim_irq_raise(scb_0_interrupt_IRQn);
+}
+
+static void sim_scb_async_address(void *p_arg)
+{
+    cy_stc_scb_i2c_master_xfer_config_t *p_xfer = scb.pXfer;
+    uint32_t status = 0U;
+    uint32_t count;
+    uint64_t end_ns;
+
+    (void)p_arg;
+    if (!sim_scb_bus_address(p_xfer->slaveAddress, scb.asyncRead))
+    {
+        scb.asyncStatus = CY_SCB_I2C_MASTER_ADDR_NAK;
+        scb.asyncCount = 0U;
+        sim_hw_at(sim_now_ns() + sim_scb_bits_ns(1U), sim_scb_async_done, NULL);
+        return;
+    }
+
+    /* The slave is sampled at once, the bytes are accounted on the wire after */
+    for (count = 0U; count < p_xfer->bufferSize; count++)
+    {
+        if (scb.asyncRead)
+        {
+            if (!sim_scb_bus_read(&p_xfer->buffer[count], &status))
+            {
+                break;
+            }
+        }
+        else if (!sim_scb_bus_write(p_xfer->buffer[count], &status))
+        {
+            /* The NACKed byte went out too */
+            count++;
+            break;
+        }
+    }
+    scb.asyncStatus = status;
+    scb.asyncCount = count;
+
+    end_ns = sim_now_ns() + sim_scb_bits_ns(9U * count);
+    if ((0U != status) || (!p_xfer->xferPending))
+    {
+        end_ns += sim_scb_bits_ns(1U);
+    }
+    sim_hw_at(end_ns, sim_scb_async_done, NULL);
+}
+
+static cy_en_scb_i2c_status_t sim_scb_async_start(cy_stc_scb_i2c_master_xfer_config_t *xferConfig, bool read,
+                                                  cy_stc_scb_i2c_context_t *context)
+{
+    if ((0U != (context->masterStatus & CY_SCB_I2C_MASTER_BUSY)) || (CY_SCB_I2C_IDLE != context->state))
+    {
+        return CY_SCB_I2C_MASTER_NOT_READY;
+    }
+    if ((NULL == xferConfig) || ((NULL == xferConfig->buffer) && (0U != xferConfig->bufferSize)))
+    {
+        return CY_SCB_I2C_BAD_PARAM;
+    }
+    scb.pContext = context;
+    scb.pXfer = xferConfig;
+    scb.asyncRead = read;
+    context->state = CY_SCB_I2C_MASTER_ACTIVE;
+    context->masterStatus = CY_SCB_I2C_MASTER_BUSY;
+    context->masterNumBytes = 0U;
+
+    /* START, or a repeated START when the previous transfer left the bus held, and the address */
+    sim_hw_at(sim_now_ns() + sim_scb_bits_ns(10U), sim_scb_async_address, NULL);
+    return CY_SCB_I2C_SUCCESS;
+}
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWrite(CySCB_Type *base, cy_stc_scb_i2c_master_xfer_config_t *xferConfig,
+                                              cy_stc_scb_i2c_context_t *context)
+{
+    (void)base;
+    return sim_scb_async_start(xferConfig, false, context);
+}
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterRead(CySCB_Type *base, cy_stc_scb_i2c_master_xfer_config_t *xferConfig,
+                                             cy_stc_scb_i2c_context_t *context)
+{
+    (void)base;
+    return sim_scb_async_start(xferConfig, true, context);
+}
+
+uint32_t Cy_SCB_I2C_MasterGetStatus(CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context)
+{
+    (void)base;
+    return context->masterStatus;
+}
+
+uint32_t Cy_SCB_I2C_MasterGetTransferCount(CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context)
+{
+    (void)base;
+    return context->masterNumBytes;
+}
+
+void Cy_SCB_I2C_Interrupt(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    uint32_t events = scb.pendingEvents;
+
+    (void)base;
+    scb.pendingEvents = 0U;
+    if (0U == events)
+    {
+        return;
+    }
+    context->state = CY_SCB_I2C_IDLE;
+    if (NULL != context->cbEvents)
+    {
+        context->cbEvents(events);
+    }
+}
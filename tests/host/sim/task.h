@@ -0,0 +1,34 @@
+/* Task services of the host simulator, see sim_rtos.c. */
+
+#ifndef SIM_TASK_H
+#define SIM_TASK_H
+
+#include "FreeRTOS.h"
+
+#define taskSCHEDULER_NOT_STARTED       (1)
+#define taskSCHEDULER_RUNNING           (2)
+
+#define taskENTER_CRITICAL()            sim_critical_enter()
+#define taskEXIT_CRITICAL()             sim_critical_exit()
+#define taskENTER_CRITICAL_FROM_ISR()   (sim_critical_enter(), 0U)
+#define taskEXIT_CRITICAL_FROM_ISR(x)   do { (void)(x); sim_critical_exit(); } while (0)
+#define taskYIELD()                     sim_yield()
+
+void sim_yield(void);
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, configSTACK_DEPTH_TYPE stack_depth,
+                       void *p_arg, UBaseType_t priority, TaskHandle_t *p_handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskGetSchedulerState(void);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+void vTaskSuspendAll(void);
+BaseType_t xTaskResumeAll(void);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *p_woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+
+#endif /* SIM_TASK_H */
@@ -0,0 +1,25 @@
+/* Software timers and the timer service task of the host simulator, see sim_rtos.c. */
+
+#ifndef SIM_TIMERS_H
+#define SIM_TIMERS_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t timer);
+typedef void (*PendedFunction_t)(void *p_arg, uint32_t arg);
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, UBaseType_t auto_reload, void *p_id,
+                           TimerCallbackFunction_t callback);
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks_to_wait);
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t ticks_to_wait);
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticks_to_wait);
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t ticks_to_wait);
+BaseType_t xTimerChangePeriodFromISR(TimerHandle_t timer, TickType_t period, BaseType_t *p_woken);
+BaseType_t xTimerIsTimerActive(TimerHandle_t timer);
+void *pvTimerGetTimerID(TimerHandle_t timer);
+BaseType_t xTimerPendFunctionCall(PendedFunction_t function, void *p_arg, uint32_t arg, TickType_t ticks_to_wait);
+BaseType_t xTimerPendFunctionCallFromISR(PendedFunction_t function, void *p_arg, uint32_t arg,
+                                         BaseType_t *p_woken);
+TaskHandle_t xTimerGetTimerDaemonTaskHandle(void);
+
+#endif /* SIM_TIMERS_H */
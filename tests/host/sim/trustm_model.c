@@ -0,0 +1,552 @@
+/*
+ * Emulated OPTIGA Trust M, see trustm_model.h.
+ */
+
+#include <string.h>
+#include "trustm_model.h"
+
+/* Error codes of the last error object */
+#define TRUSTM_ERR_INVALID_OID          (0x01U)
+#define TRUSTM_ERR_INVALID_PARAM        (0x03U)
+#define TRUSTM_ERR_INVALID_LENGTH       (0x04U)
+#define TRUSTM_ERR_INVALID_DATA         (0x05U)
+#define TRUSTM_ERR_BOUNDARY             (0x08U)
+#define TRUSTM_ERR_INVALID_CMD          (0x0AU)
+#define TRUSTM_ERR_OUT_OF_SEQUENCE      (0x0BU)
+
+#define TRUSTM_APDU_HEADER              (4U)
+
+/* Largest APDU response: the frame less its header, FCS and the transport control byte */
+#define TRUSTM_APDU_SIZE                (TRUSTM_FRAME_SIZE - 6U)
+
+/* Default busy time of each command, in microseconds */
+static const uint32_t trustm_default_exec_us[TRUSTM_OP_COUNT] =
+{
+    [TRUSTM_OP_OPEN_APP] = 8000U,
+    [TRUSTM_OP_GET_DATA] = 2000U,
+    [TRUSTM_OP_SET_DATA] = 15000U,
+    [TRUSTM_OP_RANDOM]   = 3000U,
+    [TRUSTM_OP_KEYGEN]   = 60000U,
+    [TRUSTM_OP_SIGN]     = 55000U,
+    [TRUSTM_OP_VERIFY]   = 70000U,
+    [TRUSTM_OP_OTHER]    = 1000U,
+};
+
+static uint16_t trustm_crc_byte(uint16_t seed, uint8_t byte)
+{
+    uint16_t h1 = (uint16_t)((seed ^ byte) & 0xFFU);
+    uint16_t h2 = (uint16_t)(h1 & 0x0FU);
+    uint16_t h3 = (uint16_t)((uint16_t)(h2 << 4) ^ h1);
+    uint16_t h4 = (uint16_t)(h3 >> 4);
+
+    return (uint16_t)(((((((uint16_t)(h3 << 1) ^ h4) << 4) ^ h2) << 3) ^ h4 ^ (seed >> 8)) & 0xFFFFU);
+}
+
+uint16_t trustm_crc(const uint8_t *p_data, uint16_t length)
+{
+    uint16_t crc = 0U;
+    uint16_t index;
+
+    for (index = 0U; index < length; index++)
+    {
+        crc = trustm_crc_byte(crc, p_data[index]);
+    }
+    return crc;
+}
+
+static uint8_t trustm_random_byte(trustm_model_t *p_model)
+{
+    /* xorshift32 */
+    p_model->seed ^= p_model->seed << 13;
+    p_model->seed ^= p_model->seed >> 17;
+    p_model->seed ^= p_model->seed << 5;
+    return (uint8_t)p_model->seed;
+}
+
+static void trustm_random(trustm_model_t *p_model, uint8_t *p_out, uint16_t length)
+{
+    uint16_t index;
+
+    for (index = 0U; index < length; index++)
+    {
+        p_out[index] = trustm_random_byte(p_model);
+    }
+}
+
+static trustm_model_object_t *trustm_find_object(trustm_model_t *p_model, uint16_t oid, bool create)
+{
+    trustm_model_object_t *p_free = NULL;
+    uint32_t index;
+
+    for (index = 0U; index < TRUSTM_MODEL_OBJECTS; index++)
+    {
+        if (p_model->objects[index].oid == oid)
+        {
+            return &p_model->objects[index];
+        }
+        if ((NULL == p_free) && (0U == p_model->objects[index].oid))
+        {
+            p_free = &p_model->objects[index];
+        }
+    }
+    if ((create) && (NULL != p_free))
+    {
+        memset(p_free, 0, sizeof(*p_free));
+        p_free->oid = oid;
+        return p_free;
+    }
+    return NULL;
+}
+
+static uint16_t trustm_error(trustm_model_t *p_model, uint8_t error, uint8_t *p_resp)
+{
+    p_model->lastError = error;
+    p_model->stats.errors++;
+    p_resp[0] = 0xFFU;
+    p_resp[1] = 0x00U;
+    p_resp[2] = 0x00U;
+    p_resp[3] = 0x00U;
+    return TRUSTM_APDU_HEADER;
+}
+
+static uint16_t trustm_success(uint8_t *p_resp, uint16_t length)
+{
+    p_resp[0] = 0x00U;
+    p_resp[1] = 0x00U;
+    p_resp[2] = (uint8_t)(length >> 8);
+    p_resp[3] = (uint8_t)length;
+    return (uint16_t)(TRUSTM_APDU_HEADER + length);
+}
+
+static trustm_op_t trustm_op(uint8_t cmd)
+{
+    switch (cmd)
+    {
+        case TRUSTM_CMD_OPEN_APPLICATION:
+            return TRUSTM_OP_OPEN_APP;
+        case TRUSTM_CMD_GET_DATA_OBJECT:
+            return TRUSTM_OP_GET_DATA;
+        case TRUSTM_CMD_SET_DATA_OBJECT:
+            return TRUSTM_OP_SET_DATA;
+        case TRUSTM_CMD_GET_RANDOM:
+            return TRUSTM_OP_RANDOM;
+        case TRUSTM_CMD_GEN_KEY_PAIR:
+            return TRUSTM_OP_KEYGEN;
+        case TRUSTM_CMD_CALC_SIGN:
+            return TRUSTM_OP_SIGN;
+        case TRUSTM_CMD_VERIFY_SIGN:
+            return TRUSTM_OP_VERIFY;
+        default:
+            return TRUSTM_OP_OTHER;
+    }
+}
+
+static uint16_t trustm_get_data(trustm_model_t *p_model, uint8_t param, const uint8_t *p_in, uint16_t in_length,
+                                uint8_t *p_resp)
+{
+    trustm_model_object_t *p_object;
+    uint16_t oid;
+    uint16_t offset = 0U;
+    uint16_t length;
+
+    if (in_length < 2U)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_INVALID_LENGTH, p_resp);
+    }
+    oid = (uint16_t)((p_in[0] << 8) | p_in[1]);
+    if (in_length >= 4U)
+    {
+        offset = (uint16_t)((p_in[2] << 8) | p_in[3]);
+    }
+
+    if ((TRUSTM_OID_LAST_ERROR == oid) && (0x00U == param))
+    {
+        /* Read and cleared, empty when no error is recorded */
+        length = (0U != p_model->lastError) ? 1U : 0U;
+        p_resp[TRUSTM_APDU_HEADER] = p_model->lastError;
+        p_model->lastError = 0U;
+        return trustm_success(p_resp, length);
+    }
+
+    p_object = trustm_find_object(p_model, oid, false);
+    if (NULL == p_object)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_INVALID_OID, p_resp);
+    }
+    if (0x01U == param)
+    {
+        memcpy(&p_resp[TRUSTM_APDU_HEADER], p_object->meta, p_object->metaLength);
+        return trustm_success(p_resp, p_object->metaLength);
+    }
+    if (0x00U != param)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_INVALID_PARAM, p_resp);
+    }
+    if (offset > p_object->length)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_BOUNDARY, p_resp);
+    }
+    length = (uint16_t)(p_object->length - offset);
+    if ((in_length >= 6U) && ((uint16_t)((p_in[4] << 8) | p_in[5]) < length))
+    {
+        length = (uint16_t)((p_in[4] << 8) | p_in[5]);
+    }
+    memcpy(&p_resp[TRUSTM_APDU_HEADER], &p_object->data[offset], length);
+    return trustm_success(p_resp, length);
+}
+
+static uint16_t trustm_set_data(trustm_model_t *p_model, uint8_t param, const uint8_t *p_in, uint16_t in_length,
+                                uint8_t *p_resp)
+{
+    trustm_model_object_t *p_object;
+    uint16_t oid;
+    uint16_t offset;
+    uint16_t length;
+
+    if (in_length < 4U)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_INVALID_LENGTH, p_resp);
+    }
+    oid = (uint16_t)((p_in[0] << 8) | p_in[1]);
+    offset = (uint16_t)((p_in[2] << 8) | p_in[3]);
+    length = (uint16_t)(in_length - 4U);
+
+    p_object = trustm_find_object(p_model, oid, true);
+    if (NULL == p_object)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_INVALID_OID, p_resp);
+    }
+
+    if (0x01U == param)
+    {
+        /* Metadata, a 0x20 tagged list */
+        if ((length > sizeof(p_object->meta)) || (length < 2U) || (0x20U != p_in[4]))
+        {
+            return trustm_error(p_model, TRUSTM_ERR_INVALID_DATA, p_resp);
+        }
+        memcpy(p_object->meta, &p_in[4], length);
+        p_object->metaLength = length;
+        return trustm_success(p_resp, 0U);
+    }
+    if ((0x00U != param) && (0x40U != param))
+    {
+        return trustm_error(p_model, TRUSTM_ERR_INVALID_PARAM, p_resp);
+    }
+    if ((uint32_t)offset + length > TRUSTM_MODEL_OBJECT_SIZE)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_BOUNDARY, p_resp);
+    }
+    if (0x40U == param)
+    {
+        /* Erase and write */
+        p_object->length = 0U;
+    }
+    memcpy(&p_object->data[offset], &p_in[4], length);
+    if ((uint16_t)(offset + length) > p_object->length)
+    {
+        p_object->length = (uint16_t)(offset + length);
+    }
+    return trustm_success(p_resp, 0U);
+}
+
+/* Run a command APDU, returns the length of the response APDU */
+static uint16_t trustm_execute(trustm_model_t *p_model, const uint8_t *p_cmd, uint16_t length, uint8_t *p_resp)
+{
+    static const uint8_t aid_prefix[] = { 0xD2U, 0x76U, 0x00U, 0x00U, 0x04U };
+    const uint8_t *p_in = &p_cmd[TRUSTM_APDU_HEADER];
+    uint16_t in_length;
+    uint16_t out_length;
+    uint8_t *p_out = &p_resp[TRUSTM_APDU_HEADER];
+
+    if ((length < TRUSTM_APDU_HEADER) ||
+        ((uint16_t)((p_cmd[2] << 8) | p_cmd[3]) != (uint16_t)(length - TRUSTM_APDU_HEADER)))
+    {
+        return trustm_error(p_model, TRUSTM_ERR_INVALID_LENGTH, p_resp);
+    }
+    in_length = (uint16_t)(length - TRUSTM_APDU_HEADER);
+
+    if (TRUSTM_CMD_OPEN_APPLICATION == p_cmd[0])
+    {
+        if ((in_length < sizeof(aid_prefix)) || (0 != memcmp(p_in, aid_prefix, sizeof(aid_prefix))))
+        {
+            return trustm_error(p_model, TRUSTM_ERR_INVALID_DATA, p_resp);
+        }
+        p_model->appOpen = true;
+        return trustm_success(p_resp, 0U);
+    }
+    if (TRUSTM_CMD_CLOSE_APPLICATION == p_cmd[0])
+    {
+        p_model->appOpen = false;
+        return trustm_success(p_resp, 0U);
+    }
+    if (!p_model->appOpen)
+    {
+        return trustm_error(p_model, TRUSTM_ERR_OUT_OF_SEQUENCE, p_resp);
+    }
+
+    switch (p_cmd[0])
+    {
+        case TRUSTM_CMD_GET_DATA_OBJECT:
+            return trustm_get_data(p_model, p_cmd[1], p_in, in_length, p_resp);
+
+        case TRUSTM_CMD_SET_DATA_OBJECT:
+            return trustm_set_data(p_model, p_cmd[1], p_in, in_length, p_resp);
+
+        case TRUSTM_CMD_GET_RANDOM:
+            out_length = (in_length >= 2U) ? (uint16_t)((p_in[0] << 8) | p_in[1]) : 0U;
+            if ((out_length < 8U) || (out_length > 256U))
+            {
+                return trustm_error(p_model, TRUSTM_ERR_INVALID_DATA, p_resp);
+            }
+            trustm_random(p_model, p_out, out_length);
+            return trustm_success(p_resp, out_length);
+
+        case TRUSTM_CMD_GEN_KEY_PAIR:
+            /* Public key as a DER bit string of an uncompressed P-256 point */
+            p_out[0] = 0x02U;
+            p_out[1] = 0x00U;
+            p_out[2] = 0x44U;
+            p_out[3] = 0x03U;
+            p_out[4] = 0x42U;
+            p_out[5] = 0x00U;
+            p_out[6] = 0x04U;
+            trustm_random(p_model, &p_out[7], 64U);
+            return trustm_success(p_resp, 71U);
+
+        case TRUSTM_CMD_CALC_SIGN:
+            if (in_length < 3U)
+            {
+                return trustm_error(p_model, TRUSTM_ERR_INVALID_LENGTH, p_resp);
+            }
+            /* r and s as DER integers, kept positive so that no leading zero is needed */
+            p_out[0] = 0x02U;
+            p_out[1] = 0x20U;
+            trustm_random(p_model, &p_out[2], 32U);
+            p_out[2] &= 0x7FU;
+            p_out[34] = 0x02U;
+            p_out[35] = 0x20U;
+            trustm_random(p_model, &p_out[36], 32U);
+            p_out[36] &= 0x7FU;
+            return trustm_success(p_resp, 68U);
+
+        case TRUSTM_CMD_VERIFY_SIGN:
+            if (in_length < 3U)
+            {
+                return trustm_error(p_model, TRUSTM_ERR_INVALID_LENGTH, p_resp);
+            }
+            return trustm_success(p_resp, 0U);
+
+        default:
+            return trustm_error(p_model, TRUSTM_ERR_INVALID_CMD, p_resp);
+    }
+}
+
+/* Frame to send, with the data link header and FCS around payload_length bytes already in place */
+static void trustm_send_frame(trustm_model_t *p_model, uint8_t fctr, uint16_t payload_length)
+{
+    uint16_t crc;
+
+    p_model->tx[0] = fctr;
+    p_model->tx[1] = (uint8_t)(payload_length >> 8);
+    p_model->tx[2] = (uint8_t)payload_length;
+    crc = trustm_crc(p_model->tx, (uint16_t)(3U + payload_length));
+    p_model->tx[3U + payload_length] = (uint8_t)(crc >> 8);
+    p_model->tx[4U + payload_length] = (uint8_t)crc;
+    p_model->txLength = (uint16_t)(5U + payload_length);
+    p_model->txOffset = 0U;
+}
+
+static void trustm_ready(void *p_arg)
+{
+    trustm_model_t *p_model = (trustm_model_t *)p_arg;
+
+    p_model->busy = false;
+}
+
+static void trustm_receive_frame(trustm_model_t *p_model)
+{
+    const uint8_t *p_frame = p_model->rx;
+    uint16_t length = p_model->rxLength;
+    uint16_t payload_length;
+    uint16_t resp_length;
+    uint8_t fctr;
+    uint8_t host_frame;
+    trustm_op_t op;
+
+    payload_length = (length >= 5U) ? (uint16_t)((p_frame[1] << 8) | p_frame[2]) : 0U;
+    if ((length < 5U) || ((uint16_t)(payload_length + 5U) != length) ||
+        (trustm_crc(p_frame, (uint16_t)(length - 2U)) != (uint16_t)((p_frame[length - 2U] << 8) | p_frame[length - 1U])))
+    {
+        /* Answered at once with a NAK of the last frame received */
+        p_model->stats.badFrames++;
+        trustm_send_frame(p_model, (uint8_t)(TRUSTM_FCTR_CONTROL | TRUSTM_FCTR_SEQ_NAK), 0U);
+        return;
+    }
+
+    fctr = p_frame[0];
+    if (0U != (fctr & TRUSTM_FCTR_CONTROL))
+    {
+        p_model->stats.ackFrames++;
+        return;
+    }
+
+    p_model->stats.frames++;
+    host_frame = (uint8_t)TRUSTM_FCTR_FRNR(fctr);
+
+    /* Single frame transport packets only */
+    if ((payload_length < 1U) || (0x00U != p_frame[3]))
+    {
+        resp_length = trustm_error(p_model, TRUSTM_ERR_INVALID_CMD, &p_model->tx[4]);
+        op = TRUSTM_OP_OTHER;
+    }
+    else
+    {
+        op = trustm_op(p_frame[4]);
+        resp_length = trustm_execute(p_model, &p_frame[4], (uint16_t)(payload_length - 1U), &p_model->tx[4]);
+    }
+    p_model->stats.commands[op]++;
+
+    p_model->tx[3] = 0x00U;
+    trustm_send_frame(p_model, (uint8_t)((p_model->frameNr << 2) | host_frame), (uint16_t)(resp_length + 1U));
+    p_model->frameNr = (uint8_t)((p_model->frameNr + 1U) & 0x03U);
+
+    p_model->busy = true;
+    sim_hw_at(sim_now_ns() + ((uint64_t)p_model->execUs[op] * 1000U), trustm_ready, p_model);
+}
+
+/* Bus side */
+
+static bool trustm_start(sim_i2c_slave_t *p_slave, bool read)
+{
+    trustm_model_t *p_model = (trustm_model_t *)p_slave;
+    uint16_t pending;
+
+    if (sim_now_ns() < p_model->guardEndNs)
+    {
+        p_model->stats.guardNaks++;
+        return false;
+    }
+    if ((p_model->busy) && (p_model->nackWhileBusy))
+    {
+        p_model->stats.busyNaks++;
+        return false;
+    }
+
+    p_model->writing = !read;
+    p_model->wroteData = false;
+    p_model->readOffset = 0U;
+    if (!read)
+    {
+        p_model->rxLength = 0U;
+        p_model->reg = 0U;
+    }
+    else if (TRUSTM_REG_I2C_STATE == p_model->reg)
+    {
+        pending = (p_model->busy) ? 0U : (uint16_t)(p_model->txLength - p_model->txOffset);
+        p_model->state[0] = (uint8_t)(((p_model->busy) ? TRUSTM_STATE_BUSY : 0U) |
+                                      ((0U != pending) ? TRUSTM_STATE_RESP_READY : 0U));
+        p_model->state[1] = 0x00U;
+        p_model->state[2] = (uint8_t)(pending >> 8);
+        p_model->state[3] = (uint8_t)pending;
+    }
+    return true;
+}
+
+static bool trustm_write(sim_i2c_slave_t *p_slave, uint8_t byte)
+{
+    trustm_model_t *p_model = (trustm_model_t *)p_slave;
+
+    if (p_model->busy)
+    {
+        return false;
+    }
+    if (!p_model->wroteData)
+    {
+        /* Register address */
+        p_model->reg = byte;
+        p_model->wroteData = true;
+        return true;
+    }
+    if (TRUSTM_REG_DATA == p_model->reg)
+    {
+        if (p_model->rxLength >= sizeof(p_model->rx))
+        {
+            return false;
+        }
+        p_model->rx[p_model->rxLength++] = byte;
+    }
+    else if (TRUSTM_REG_SOFT_RESET == p_model->reg)
+    {
+        p_model->rxLength = 1U;
+    }
+    return true;
+}
+
+static uint8_t trustm_read(sim_i2c_slave_t *p_slave)
+{
+    static const uint8_t data_reg_len[] = { (uint8_t)(TRUSTM_FRAME_SIZE >> 8), (uint8_t)TRUSTM_FRAME_SIZE };
+    static const uint8_t max_scl_freq[] = { 0x00U, 0x00U, 0x03U, 0xE8U };
+    trustm_model_t *p_model = (trustm_model_t *)p_slave;
+    uint16_t offset = p_model->readOffset++;
+
+    switch (p_model->reg)
+    {
+        case TRUSTM_REG_DATA:
+            if ((p_model->busy) || (p_model->txOffset >= p_model->txLength))
+            {
+                return 0xFFU;
+            }
+            return p_model->tx[p_model->txOffset++];
+        case TRUSTM_REG_I2C_STATE:
+            return (offset < sizeof(p_model->state)) ? p_model->state[offset] : 0xFFU;
+        case TRUSTM_REG_DATA_REG_LEN:
+            return (offset < sizeof(data_reg_len)) ? data_reg_len[offset] : 0xFFU;
+        case TRUSTM_REG_MAX_SCL_FREQ:
+            return (offset < sizeof(max_scl_freq)) ? max_scl_freq[offset] : 0xFFU;
+        default:
+            return 0xFFU;
+    }
+}
+
+static void trustm_stop(sim_i2c_slave_t *p_slave, bool restart)
+{
+    trustm_model_t *p_model = (trustm_model_t *)p_slave;
+
+    if ((p_model->writing) && (0U != p_model->rxLength))
+    {
+        if (TRUSTM_REG_DATA == p_model->reg)
+        {
+            trustm_receive_frame(p_model);
+        }
+        else if (TRUSTM_REG_SOFT_RESET == p_model->reg)
+        {
+            sim_hw_cancel(trustm_ready, p_model);
+            p_model->busy = false;
+            p_model->appOpen = false;
+            p_model->txLength = 0U;
+            p_model->frameNr = 0U;
+        }
+    }
+    p_model->writing = false;
+    p_model->rxLength = 0U;
+
+    if (!restart)
+    {
+        p_model->guardEndNs = sim_now_ns() + ((uint64_t)p_model->guardUs * 1000U);
+    }
+}
+
+void trustm_model_init(trustm_model_t *p_model, uint8_t address)
+{
+    memset(p_model, 0, sizeof(*p_model));
+    p_model->slave.address = address;
+    p_model->slave.start = trustm_start;
+    p_model->slave.write = trustm_write;
+    p_model->slave.read = trustm_read;
+    p_model->slave.stop = trustm_stop;
+    memcpy(p_model->execUs, trustm_default_exec_us, sizeof(p_model->execUs));
+    p_model->guardUs = 50U;
+    p_model->nackWhileBusy = true;
+    p_model->seed = 0x2545F491U ^ address;
+    sim_i2c_attach(&p_model->slave);
+}
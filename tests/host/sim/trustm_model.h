@@ -0,0 +1,126 @@
+/*
+ * Emulated OPTIGA Trust M on the simulated I2C bus. It speaks the IFX I2C physical, data link
+ * and transport layers (single frames, no chaining) and answers a subset of the commands:
+ * OpenApplication, CloseApplication, GetDataObject, SetDataObject (data and metadata), GetRandom,
+ * GenKeyPair, CalcSign and VerifySign. Key pairs and signatures are well formed but not real: the model
+ * is for timing, not for cryptography.
+ *
+ * Every command keeps the chip busy for its entry of execUs, during which the chip does not
+ * acknowledge its address, like the device.
+ */
+
+#ifndef TRUSTM_MODEL_H
+#define TRUSTM_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sim.h"
+
+/* Registers of the IFX I2C physical layer */
+#define TRUSTM_REG_DATA                 (0x80U)
+#define TRUSTM_REG_DATA_REG_LEN         (0x81U)
+#define TRUSTM_REG_I2C_STATE            (0x82U)
+#define TRUSTM_REG_MAX_SCL_FREQ         (0x84U)
+#define TRUSTM_REG_SOFT_RESET           (0x88U)
+
+/* I2C_STATE flags, first byte */
+#define TRUSTM_STATE_BUSY               (0x80U)
+#define TRUSTM_STATE_RESP_READY         (0x40U)
+
+/* Largest frame, DATA_REG_LEN */
+#define TRUSTM_FRAME_SIZE               (0x0115U)
+
+/* Frame control byte of the data link layer */
+#define TRUSTM_FCTR_CONTROL             (0x80U)
+#define TRUSTM_FCTR_SEQ_ACK             (0x00U)
+#define TRUSTM_FCTR_SEQ_NAK             (0x20U)
+#define TRUSTM_FCTR_SEQ_MASK            (0x60U)
+#define TRUSTM_FCTR_FRNR(fctr)          (((fctr) >> 2) & 0x03U)
+#define TRUSTM_FCTR_ACKNR(fctr)         ((fctr) & 0x03U)
+
+/* APDU commands */
+#define TRUSTM_CMD_GET_DATA_OBJECT      (0x81U)
+#define TRUSTM_CMD_SET_DATA_OBJECT      (0x82U)
+#define TRUSTM_CMD_GET_RANDOM           (0x8CU)
+#define TRUSTM_CMD_CALC_SIGN            (0xB1U)
+#define TRUSTM_CMD_VERIFY_SIGN          (0xB2U)
+#define TRUSTM_CMD_GEN_KEY_PAIR         (0xB8U)
+#define TRUSTM_CMD_OPEN_APPLICATION     (0xF0U)
+#define TRUSTM_CMD_CLOSE_APPLICATION    (0xF1U)
+
+/* Object holding the error code of the last failed command, cleared by reading it */
+#define TRUSTM_OID_LAST_ERROR           (0xF1C2U)
+
+typedef enum
+{
+    TRUSTM_OP_OPEN_APP = 0,
+    TRUSTM_OP_GET_DATA,
+    TRUSTM_OP_SET_DATA,
+    TRUSTM_OP_RANDOM,
+    TRUSTM_OP_KEYGEN,
+    TRUSTM_OP_SIGN,
+    TRUSTM_OP_VERIFY,
+    TRUSTM_OP_OTHER,
+    TRUSTM_OP_COUNT
+} trustm_op_t;
+
+typedef struct
+{
+    uint32_t commands[TRUSTM_OP_COUNT];
+    uint32_t errors;                    /* Commands answered with an error status */
+    uint32_t frames;                    /* Data frames received */
+    uint32_t ackFrames;                 /* Control frames received */
+    uint32_t badFrames;                 /* Bad length or FCS, answered with a NAK */
+    uint32_t busyNaks;                  /* Address not acknowledged while executing */
+    uint32_t guardNaks;                 /* Address not acknowledged within the guard time */
+} trustm_model_stats_t;
+
+#define TRUSTM_MODEL_OBJECTS            (16U)
+#define TRUSTM_MODEL_OBJECT_SIZE        (128U)
+
+typedef struct
+{
+    uint16_t oid;
+    uint16_t length;
+    uint16_t metaLength;
+    uint8_t data[TRUSTM_MODEL_OBJECT_SIZE];
+    uint8_t meta[44];
+} trustm_model_object_t;
+
+typedef struct
+{
+    sim_i2c_slave_t slave;              /* Attached to the bus by trustm_model_init */
+
+    /* Timing, may be changed at any time */
+    uint32_t execUs[TRUSTM_OP_COUNT];   /* Busy time of each command from the end of its frame */
+    uint32_t guardUs;                   /* Address NACKed this long after a STOP, 0 for none */
+    bool nackWhileBusy;
+
+    /* State */
+    bool busy;
+    bool appOpen;
+    uint8_t reg;                        /* Register selected by the last write */
+    uint16_t rxLength;
+    uint8_t rx[TRUSTM_FRAME_SIZE + 1U];
+    uint16_t txLength;
+    uint16_t txOffset;
+    uint8_t tx[TRUSTM_FRAME_SIZE];
+    uint8_t state[4];
+    uint16_t readOffset;
+    bool writing;
+    bool wroteData;
+    uint64_t guardEndNs;
+    uint8_t frameNr;                    /* Of the next data frame sent */
+    uint8_t lastError;
+    uint32_t seed;
+    trustm_model_object_t objects[TRUSTM_MODEL_OBJECTS];
+    trustm_model_stats_t stats;
+} trustm_model_t;
+
+/* Reset the model with the default timing and attach it to the bus at address */
+void trustm_model_init(trustm_model_t *p_model, uint8_t address);
+
+/* CRC of the data link frame check sequence */
+uint16_t trustm_crc(const uint8_t *p_data, uint16_t length);
+
+#endif /* TRUSTM_MODEL_H */
@@ -0,0 +1,88 @@
+/*
+ * Host test of the ChaCha20 random bit generator: the block function against RFC 8439
+ * section 2.3.2, and the buffering, reseeding and wiping of the generator.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+/* Built together with the generator to reach its block function */
+#include "../../chacha20_drbg.c"
+
+#define CHECK(cond, what) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s\n", what); \
+            failures++; \
+        } \
+    } while (0)
+
+static int test_block(void)
+{
+    static const uint8_t expected[64] =
+    {
+        0x10, 0xF1, 0xE7, 0xE4, 0xD1, 0x3B, 0x59, 0x15, 0x50, 0x0F, 0xDD, 0x1F, 0xA3, 0x20, 0x71, 0xC4,
+        0xC7, 0xD1, 0xF4, 0xC7, 0x33, 0xC0, 0x68, 0x03, 0x04, 0x22, 0xAA, 0x9A, 0xC3, 0xD4, 0x6C, 0x4E,
+        0xD2, 0x82, 0x64, 0x46, 0x07, 0x9F, 0xAA, 0x09, 0x14, 0xC2, 0xD7, 0x05, 0xD9, 0x8B, 0x02, 0xA2,
+        0xB5, 0x12, 0x9C, 0xD1, 0xDE, 0x16, 0x4E, 0xB9, 0xCB, 0xD0, 0x83, 0xE8, 0xA2, 0x50, 0x3C, 0x4E
+    };
+    /* Key 00 01 .. 1f and nonce 00 00 00 09 00 00 00 4a 00 00 00 00 as little endian words */
+    static const uint32_t key[8] =
+    {
+        0x03020100U, 0x07060504U, 0x0B0A0908U, 0x0F0E0D0CU, 0x13121110U, 0x17161514U, 0x1B1A1918U, 0x1F1E1D1CU
+    };
+    static const uint32_t nonce[3] = { 0x09000000U, 0x4A000000U, 0x00000000U };
+    uint8_t out[64];
+    int failures = 0;
+
+    Cy_Drbg_ChaChaBlock(key, 1u, nonce, out);
+    CHECK(0 == memcmp(out, expected, sizeof(out)), "RFC 8439 2.3.2 block");
+    return failures;
+}
+
+static int test_generator(void)
+{
+    static const uint8_t seed[48] = "seed material for the host test of the DRBG....";
+    static const uint8_t zero[DRBG_BUFFER_LENGTH];
+    cy_stc_drbg_t a, b;
+    uint8_t one[600], split[600];
+    uint32_t off;
+    int failures = 0;
+
+    memset(&a, 0, sizeof(a));
+    CHECK(!Cy_Drbg_Generate(&a, one, sizeof(one)), "unseeded generate refused");
+
+    /* Same seed, same stream, however the requests are cut */
+    Cy_Drbg_Seed(&a, seed, sizeof(seed));
+    memset(&b, 0, sizeof(b));
+    Cy_Drbg_Seed(&b, seed, sizeof(seed));
+    CHECK(Cy_Drbg_Generate(&a, one, sizeof(one)), "seeded generate");
+    for (off = 0; off < sizeof(split); off += 7u) {
+        uint32_t n = ((sizeof(split) - off) > 7u) ? 7u : (uint32_t)(sizeof(split) - off);
+        (void)Cy_Drbg_Generate(&b, &split[off], n);
+    }
+    CHECK(0 == memcmp(one, split, sizeof(one)), "split requests match one request");
+    CHECK(0 != memcmp(one, &one[DRBG_BUFFER_LENGTH - DRBG_SEED_LENGTH], 64), "refills differ");
+
+    /* Served bytes and the key material are wiped from the buffer */
+    CHECK(0 == memcmp(a.buffer, zero, DRBG_BUFFER_LENGTH - a.available), "served bytes wiped");
+
+    /* A reseed changes the stream and drops what was buffered */
+    (void)Cy_Drbg_Generate(&a, one, 16u);
+    (void)Cy_Drbg_Generate(&b, split, 16u);
+    CHECK(0 == memcmp(one, split, 16u), "in step before reseed");
+    Cy_Drbg_Seed(&a, (const uint8_t *)"x", 1u);
+    CHECK(0u == a.available, "reseed drops the buffer");
+    (void)Cy_Drbg_Generate(&a, one, 16u);
+    (void)Cy_Drbg_Generate(&b, split, 16u);
+    CHECK(0 != memcmp(one, split, 16u), "reseed changes the stream");
+    return failures;
+}
+
+int main(void)
+{
+    int failures = test_block() + test_generator();
+
+    printf("test_drbg: %d failures\n", failures);
+    return (0 == failures) ? 0 : 1;
+}
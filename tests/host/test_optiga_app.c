@@ -0,0 +1,320 @@
+/*
+ * Host test of optiga_app.c in the simulator (sim/sim.h), over the util and crypt layers of
+ * sim/optiga_lib_lite.c and the chip model of sim/trustm_model.c: Cy_Optiga_Init/Deinit, the
+ * metadata shadows and their skipped writes, oversized shadow hits and invalidation, the
+ * operations on instance pairs borrowed from the pool, two callers queueing on the chip, pool
+ * exhaustion, chip errors and a run of the Cy_Optiga_Main demo. Built with the firmware defaults
+ * of the Makefile of the application, see the Makefile.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "sim.h"
+#include "semphr.h"
+#include "task.h"
+#include "trustm_model.h"
+/* The application header, sim/optiga_app.h only carries its log macros for the PAL */
+#include "../../optiga_app.h"
+
+#define CHECK(cond, what) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s\n", what); \
+            failures++; \
+        } \
+    } while (0)
+
+#define TASK_PRIORITY   (12u)
+#define HELPER_PRIORITY (11u)
+
+static trustm_model_t chip;
+static int total_failures;
+
+/* Metadata of OPTIGA_FREE_ECC_KEY_ID as the demo writes it, and another value of one of its tags */
+static const uint8_t key_metadata[] = { 0x20, 0x06, 0xD0, 0x01, 0x00, 0xD3, 0x01, 0x00 };
+static const uint8_t key_metadata_other[] = { 0x20, 0x03, 0xD0, 0x01, 0x01 };
+
+static const uint8_t test_digest[32] = {
+    0x61, 0xC7, 0xDE, 0xF9, 0x0F, 0xD5, 0xCD, 0x7A, 0x8B, 0x7A, 0x36, 0x41, 0x04, 0xE0, 0x0D, 0x82,
+    0x38, 0x46, 0xBF, 0xB7, 0x70, 0xEE, 0xBF, 0x8F, 0x40, 0x25, 0x2E, 0x0A, 0x21, 0x42, 0xAF, 0x9C,
+};
+
+static uint32_t chip_commands(trustm_op_t op)
+{
+    return chip.stats.commands[op];
+}
+
+static int test_init(void)
+{
+    int failures = 0;
+
+    Cy_Optiga_Init();
+    CHECK(chip.appOpen, "application opened");
+    CHECK(1u == chip_commands(TRUSTM_OP_OPEN_APP), "one OpenApplication");
+    CHECK(Cy_Optiga_InstPoolIdle(), "pool idle after init");
+    return failures;
+}
+
+static int test_metadata(void)
+{
+    cy_stc_optiga_metadata_stats_t stats;
+    cy_stc_optiga_inst_t *p_inst;
+    uint8_t buffer[OPTIGA_APP_METADATA_MAX_LENGTH];
+    uint16_t length;
+    uint32_t gets, sets;
+    optiga_lib_status_t status;
+    int failures = 0;
+
+    p_inst = Cy_Optiga_InstAcquire();
+    CHECK(NULL != p_inst, "pair for the metadata");
+    if (NULL == p_inst) {
+        return failures;
+    }
+
+    /* Object not on the chip yet: the error comes back from its last error object */
+    length = sizeof(buffer);
+    status = Cy_Optiga_MetadataRead(p_inst, OPTIGA_FREE_ECC_KEY_ID, buffer, &length);
+    CHECK(OPTIGA_DEVICE_ERROR == (status & 0xFF00u), "chip error of an unknown object");
+    CHECK(0u != (status & 0x00FFu), "chip error code reported");
+
+    /* First write: the read before it fails, the write goes to the chip */
+    sets = chip_commands(TRUSTM_OP_SET_DATA);
+    status = Cy_Optiga_MetadataWrite(p_inst, OPTIGA_FREE_ECC_KEY_ID, key_metadata, sizeof(key_metadata));
+    CHECK(OPTIGA_LIB_SUCCESS == status, "metadata written");
+    CHECK(sets + 1u == chip_commands(TRUSTM_OP_SET_DATA), "write sent to the chip");
+
+    /* A read fills the shadow, the next one is served from it */
+    Cy_Optiga_MetadataGetStats(&stats);
+    gets = chip_commands(TRUSTM_OP_GET_DATA);
+    length = sizeof(buffer);
+    status = Cy_Optiga_MetadataRead(p_inst, OPTIGA_FREE_ECC_KEY_ID, buffer, &length);
+    CHECK((OPTIGA_LIB_SUCCESS == status) && (sizeof(key_metadata) == length) &&
+          (0 == memcmp(buffer, key_metadata, length)), "metadata read from the chip");
+    length = sizeof(buffer);
+    status = Cy_Optiga_MetadataRead(p_inst, OPTIGA_FREE_ECC_KEY_ID, buffer, &length);
+    CHECK((OPTIGA_LIB_SUCCESS == status) && (sizeof(key_metadata) == length) &&
+          (0 == memcmp(buffer, key_metadata, length)), "metadata read from the shadow");
+    CHECK(gets + 1u == chip_commands(TRUSTM_OP_GET_DATA), "one chip read for two reads");
+    {
+        cy_stc_optiga_metadata_stats_t after;
+
+        Cy_Optiga_MetadataGetStats(&after);
+        CHECK((stats.reads + 1u == after.reads) && (stats.hits + 1u == after.hits), "read and hit counted");
+        stats = after;
+    }
+
+    /* A shadow longer than the buffer is refused, not truncated */
+    length = 4u;
+    status = Cy_Optiga_MetadataRead(p_inst, OPTIGA_FREE_ECC_KEY_ID, buffer, &length);
+    CHECK(OPTIGA_UTIL_ERROR_INVALID_INPUT == status, "oversized shadow hit refused");
+
+    /* The same metadata again is a no-op on the chip */
+    sets = chip_commands(TRUSTM_OP_SET_DATA);
+    status = Cy_Optiga_MetadataWrite(p_inst, OPTIGA_FREE_ECC_KEY_ID, key_metadata, sizeof(key_metadata));
+    CHECK(OPTIGA_LIB_SUCCESS == status, "unchanged metadata accepted");
+    CHECK(sets == chip_commands(TRUSTM_OP_SET_DATA), "unchanged metadata not written");
+    Cy_Optiga_MetadataGetStats(&stats);
+    CHECK(1u == stats.skippedWrites, "skipped write counted");
+
+    /* A changed tag is written, and the shadow dropped: the next read goes to the chip */
+    status = Cy_Optiga_MetadataWrite(p_inst, OPTIGA_FREE_ECC_KEY_ID, key_metadata_other, sizeof(key_metadata_other));
+    CHECK(OPTIGA_LIB_SUCCESS == status, "changed metadata written");
+    CHECK(sets + 1u == chip_commands(TRUSTM_OP_SET_DATA), "changed metadata sent to the chip");
+    gets = chip_commands(TRUSTM_OP_GET_DATA);
+    length = sizeof(buffer);
+    status = Cy_Optiga_MetadataRead(p_inst, OPTIGA_FREE_ECC_KEY_ID, buffer, &length);
+    CHECK((OPTIGA_LIB_SUCCESS == status) && (sizeof(key_metadata_other) == length) &&
+          (0 == memcmp(buffer, key_metadata_other, length)), "written metadata read back");
+    CHECK(gets + 1u == chip_commands(TRUSTM_OP_GET_DATA), "read after the write from the chip");
+
+    /* Restore what the demo expects, then a write which bypassed the layer */
+    status = Cy_Optiga_MetadataWrite(p_inst, OPTIGA_FREE_ECC_KEY_ID, key_metadata, sizeof(key_metadata));
+    CHECK(OPTIGA_LIB_SUCCESS == status, "metadata restored");
+    Cy_Optiga_MetadataInvalidate(OPTIGA_FREE_ECC_KEY_ID);
+    gets = chip_commands(TRUSTM_OP_GET_DATA);
+    length = sizeof(buffer);
+    (void)Cy_Optiga_MetadataRead(p_inst, OPTIGA_FREE_ECC_KEY_ID, buffer, &length);
+    CHECK(gets + 1u == chip_commands(TRUSTM_OP_GET_DATA), "read after an invalidate from the chip");
+
+    Cy_Optiga_InstRelease(p_inst);
+    return failures;
+}
+
+static int test_operations(void)
+{
+    public_key_from_host_t public_key;
+    uint8_t random[32];
+    uint8_t signature[80];
+    uint16_t signature_length = sizeof(signature);
+    uint8_t key[68];
+    uint8_t digest[32];
+    optiga_lib_status_t status;
+    int failures = 0;
+
+    memset(random, 0, sizeof(random));
+    status = Cy_Optiga_GetRandom(random, sizeof(random));
+    CHECK(OPTIGA_LIB_SUCCESS == status, "random read");
+    CHECK(1u == chip_commands(TRUSTM_OP_RANDOM), "one GetRandom");
+
+    /* Fewer bytes than the chip hands out: its error, not a comms failure */
+    status = Cy_Optiga_GetRandom(random, 4u);
+    CHECK(OPTIGA_DEVICE_ERROR == (status & 0xFF00u), "short random refused by the chip");
+
+    status = Cy_Optiga_Sign(OPTIGA_KEY_ID_E0F2, test_digest, sizeof(test_digest), signature, &signature_length);
+    CHECK(OPTIGA_LIB_SUCCESS == status, "digest signed");
+    CHECK(68u == signature_length, "r and s returned");
+
+    signature_length = 16u;
+    status = Cy_Optiga_Sign(OPTIGA_KEY_ID_E0F2, test_digest, sizeof(test_digest), signature, &signature_length);
+    CHECK(OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT == status, "signature larger than the buffer refused");
+
+    key[0] = 0x03;
+    key[1] = 0x42;
+    key[2] = 0x00;
+    key[3] = 0x04;
+    memset(&key[4], 0x5A, 64u);
+    public_key.public_key = key;
+    public_key.length = sizeof(key);
+    public_key.key_type = (uint8_t)OPTIGA_ECC_CURVE_NIST_P_256;
+    status = Cy_Optiga_Verify(test_digest, sizeof(test_digest), signature, 68u, &public_key);
+    CHECK(OPTIGA_LIB_SUCCESS == status, "signature verified on the chip");
+    CHECK(1u == chip_commands(TRUSTM_OP_VERIFY), "one VerifySign");
+
+    /* Short data is hashed on the MCU, SHA-256("abc") */
+    status = Cy_Optiga_Hash((const uint8_t *)"abc", 3u, digest);
+    CHECK(OPTIGA_LIB_SUCCESS == status, "short data hashed");
+    CHECK((0xBA == digest[0]) && (0x78 == digest[1]) && (0xAD == digest[31]), "SHA-256 of abc");
+
+    CHECK(Cy_Optiga_InstPoolIdle(), "pool idle after the operations");
+    return failures;
+}
+
+static SemaphoreHandle_t helper_done;
+static optiga_lib_status_t helper_status;
+
+static void helper_task(void *p_arg)
+{
+    uint8_t random[64];
+
+    (void)p_arg;
+    helper_status = Cy_Optiga_GetRandom(random, sizeof(random));
+    xSemaphoreGive(helper_done);
+    vTaskDelete(NULL);
+}
+
+static int test_queueing(void)
+{
+    uint8_t signature[80];
+    uint16_t signature_length = sizeof(signature);
+    uint32_t randoms = chip_commands(TRUSTM_OP_RANDOM);
+    uint32_t signs = chip_commands(TRUSTM_OP_SIGN);
+    optiga_lib_status_t status;
+    uint64_t t0;
+    int failures = 0;
+
+    /* A second caller on its own pair queues behind the sign on the chip */
+    helper_done = xSemaphoreCreateBinary();
+    helper_status = OPTIGA_LIB_BUSY;
+    t0 = sim_now_ns();
+    xTaskCreate(helper_task, "helper", 512, NULL, HELPER_PRIORITY, NULL);
+    status = Cy_Optiga_Sign(OPTIGA_KEY_ID_E0F2, test_digest, sizeof(test_digest), signature, &signature_length);
+    CHECK(OPTIGA_LIB_SUCCESS == status, "sign beside another caller");
+    CHECK(pdTRUE == xSemaphoreTake(helper_done, pdMS_TO_TICKS(1000)), "other caller done");
+    CHECK(OPTIGA_LIB_SUCCESS == helper_status, "random beside the sign");
+    CHECK((randoms + 1u == chip_commands(TRUSTM_OP_RANDOM)) && (signs + 1u == chip_commands(TRUSTM_OP_SIGN)),
+          "both commands reached the chip");
+    CHECK(sim_now_ns() - t0 >= 55000000ull, "sign took its chip time");
+    CHECK(Cy_Optiga_InstPoolIdle(), "pool idle after both callers");
+    vSemaphoreDelete(helper_done);
+    return failures;
+}
+
+static int test_pool_exhaustion(void)
+{
+    cy_stc_optiga_inst_t *pairs[OPTIGA_APP_INST_POOL_SIZE];
+    uint8_t signature[80];
+    uint16_t signature_length = sizeof(signature);
+    uint32_t signs = chip_commands(TRUSTM_OP_SIGN);
+    uint8_t i;
+    int failures = 0;
+
+    for (i = 0; i < OPTIGA_APP_INST_POOL_SIZE; i++) {
+        pairs[i] = Cy_Optiga_InstAcquire();
+        CHECK(NULL != pairs[i], "pair of the pool");
+    }
+    CHECK(NULL == Cy_Optiga_InstAcquire(), "pool exhausted");
+    CHECK(!Cy_Optiga_InstPoolIdle(), "pool busy while lent out");
+    CHECK(OPTIGA_CRYPT_ERROR == Cy_Optiga_Sign(OPTIGA_KEY_ID_E0F2, test_digest, sizeof(test_digest), signature,
+                                               &signature_length), "sign refused without a pair");
+    CHECK(signs == chip_commands(TRUSTM_OP_SIGN), "nothing sent without a pair");
+    for (i = 0; i < OPTIGA_APP_INST_POOL_SIZE; i++) {
+        Cy_Optiga_InstRelease(pairs[i]);
+    }
+    CHECK(Cy_Optiga_InstPoolIdle(), "pool idle once returned");
+    return failures;
+}
+
+static int test_demo(void)
+{
+    cy_stc_optiga_metadata_stats_t before, after;
+    uint32_t keygens = chip_commands(TRUSTM_OP_KEYGEN);
+    uint32_t signs = chip_commands(TRUSTM_OP_SIGN);
+    uint32_t verifies = chip_commands(TRUSTM_OP_VERIFY);
+    uint32_t errors = chip.stats.errors;
+    int failures = 0;
+
+    /* The metadata is already on the chip: the demo skips its write each time */
+    Cy_Optiga_MetadataGetStats(&before);
+    Cy_Optiga_Main();
+    Cy_Optiga_Main();
+    Cy_Optiga_MetadataGetStats(&after);
+    CHECK(keygens + 2u == chip_commands(TRUSTM_OP_KEYGEN), "demo generated its keys");
+    CHECK(signs + 2u == chip_commands(TRUSTM_OP_SIGN), "demo signed");
+    CHECK(verifies + 2u == chip_commands(TRUSTM_OP_VERIFY), "demo verified");
+    CHECK(errors == chip.stats.errors, "demo without chip errors");
+    CHECK((before.skippedWrites + 2u == after.skippedWrites) && (before.writes == after.writes),
+          "demo metadata writes skipped");
+    /* Key generation drops the shadow of its key object, the second demo reads it again */
+    CHECK(before.reads + 1u == after.reads, "demo reread the metadata after the key generation");
+    CHECK(Cy_Optiga_InstPoolIdle(), "pool idle after the demo");
+    return failures;
+}
+
+static int test_deinit(void)
+{
+    int failures = 0;
+
+    Cy_Optiga_Deinit();
+    CHECK(!chip.appOpen, "application closed");
+    CHECK(NULL == Cy_Optiga_InstAcquire(), "no pair after deinit");
+
+    /* The instances are created again, the shadows start empty */
+    Cy_Optiga_Init();
+    CHECK(chip.appOpen, "application opened again");
+    CHECK(Cy_Optiga_InstPoolIdle(), "pool created again");
+    Cy_Optiga_Deinit();
+    return failures;
+}
+
+static void test_task(void *p_arg)
+{
+    (void)p_arg;
+    total_failures += test_init();
+    total_failures += test_metadata();
+    total_failures += test_operations();
+    total_failures += test_queueing();
+    total_failures += test_pool_exhaustion();
+    total_failures += test_demo();
+    total_failures += test_deinit();
+}
+
+int main(void)
+{
+    trustm_model_init(&chip, OPTIGA_FX_ADDR);
+    if (0 != sim_run(test_task, NULL, TASK_PRIORITY)) {
+        total_failures++;
+    }
+    printf("test_optiga_app (%s): %d failures\n", I2C_INTR_MODE_EN ? "interrupt driven" : "blocking",
+           total_failures);
+    return (0 == total_failures) ? 0 : 1;
+}
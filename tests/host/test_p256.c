@@ -0,0 +1,173 @@
+/*
+ * Host test of the software P-256 verifier: known answer and mutated vectors generated by
+ * gen_p256_vectors.py from an independent big integer reference, one at a time and in
+ * batches, and the built in generator comb table against one built at run time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Built together with the verifier to reach its static tables */
+#include "../../p256_verify.c"
+
+typedef struct
+{
+    const char *name;
+    int expected;
+    uint8_t key[68];
+    uint16_t keyLength;
+    uint8_t digest[64];
+    uint16_t digestLength;
+    uint8_t signature[72];
+    uint16_t signatureLength;
+} p256_vector_t;
+
+static const p256_vector_t vectors[] =
+{
+#include "p256_vectors.h"
+};
+
+#define NUM_VECTORS     (sizeof(vectors) / sizeof(vectors[0]))
+
+static int test_g_comb(void)
+{
+    static const uint8_t g[64] =
+    {
+        0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2,
+        0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96,
+        0x4F, 0xE3, 0x42, 0xE2, 0xFE, 0x1A, 0x7F, 0x9B, 0x8E, 0xE7, 0xEB, 0x4A, 0x7C, 0x0F, 0x9E, 0x16,
+        0x2B, 0xCE, 0x33, 0x57, 0x6B, 0x31, 0x5E, 0xCE, 0xCB, 0xB6, 0x40, 0x68, 0x37, 0xBF, 0x51, 0xF5
+    };
+    cy_stc_p256_key_t key;
+
+    if ((CY_P256_SUCCESS != Cy_P256_KeyInit(&key, g, sizeof(g))) ||
+        (0 != memcmp(key.comb, p256_g_comb, sizeof(p256_g_comb)))) {
+        printf("FAIL generator comb table\n");
+        return 1;
+    }
+    return 0;
+}
+
+static int test_vectors(void)
+{
+    cy_stc_p256_key_t key;
+    int failures = 0;
+    size_t i;
+
+    for (i = 0; i < NUM_VECTORS; i++) {
+        const p256_vector_t *v = &vectors[i];
+        cy_en_p256_status_t status = Cy_P256_Verify(v->digest, v->digestLength, v->signature,
+                                                    v->signatureLength, v->key, v->keyLength);
+
+        /* The same result through a kept key */
+        if (CY_P256_SUCCESS == Cy_P256_KeyInit(&key, v->key, v->keyLength)) {
+            cy_en_p256_status_t again = Cy_P256_VerifyKey(&key, v->digest, v->digestLength, v->signature,
+                                                          v->signatureLength);
+            if (again != status) {
+                printf("FAIL %s: kept key %d, one shot %d\n", v->name, again, status);
+                failures++;
+            }
+        }
+        if ((int)status != v->expected) {
+            printf("FAIL %s: got %d, expected %d\n", v->name, status, v->expected);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+static int test_batch(void)
+{
+    static cy_stc_p256_key_t keys[10];
+    cy_stc_p256_batch_item_t items[11];
+    int failures = 0;
+    size_t base, i;
+
+    /* Chunks of vectors with a key each, plus an item naming a key outside the set */
+    for (base = 0; base < NUM_VECTORS; base += 10) {
+        uint8_t num_keys = 0;
+        uint16_t expected_ok = 0;
+        uint16_t verified;
+
+        for (i = base; (i < NUM_VECTORS) && (i < (base + 10)); i++) {
+            const p256_vector_t *v = &vectors[i];
+
+            if (CY_P256_SUCCESS != Cy_P256_KeyInit(&keys[num_keys], v->key, v->keyLength)) {
+                continue;
+            }
+            items[num_keys].digest = v->digest;
+            items[num_keys].digestLength = v->digestLength;
+            items[num_keys].signature = v->signature;
+            items[num_keys].signatureLength = v->signatureLength;
+            items[num_keys].keyIndex = num_keys;
+            expected_ok += (0 == v->expected) ? 1u : 0u;
+            num_keys++;
+        }
+        if (0u == num_keys) {
+            continue;
+        }
+        items[num_keys] = items[0];
+        items[num_keys].keyIndex = num_keys;
+
+        verified = Cy_P256_VerifyBatch(keys, num_keys, items, (uint16_t)(num_keys + 1u));
+        if (verified != expected_ok) {
+            printf("FAIL batch at %u: %u verified, expected %u\n", (unsigned)base, verified, expected_ok);
+            failures++;
+        }
+        for (i = 0; i < num_keys; i++) {
+            const p256_vector_t *v = NULL;
+            size_t j;
+
+            for (j = base; j < NUM_VECTORS; j++) {
+                if (vectors[j].signature == items[i].signature) {
+                    v = &vectors[j];
+                    break;
+                }
+            }
+            if ((NULL != v) && ((int)items[i].result != v->expected)) {
+                printf("FAIL batch %s: got %d, expected %d\n", v->name, items[i].result, v->expected);
+                failures++;
+            }
+        }
+        if (CY_P256_BAD_PARAM != items[num_keys].result) {
+            printf("FAIL batch at %u: key index outside the set accepted\n", (unsigned)base);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/* A batch whose last chunk ends at 65535 must terminate, every item outside an empty key set */
+static int test_batch_max(void)
+{
+    cy_stc_p256_batch_item_t *items = calloc(UINT16_MAX, sizeof(*items));
+    int failures = 0;
+    uint32_t i;
+
+    if (NULL == items) {
+        printf("FAIL batch max: no memory\n");
+        return 1;
+    }
+    if (0u != Cy_P256_VerifyBatch(NULL, 0, items, UINT16_MAX)) {
+        printf("FAIL batch max: items verified without keys\n");
+        failures++;
+    }
+    for (i = 0; i < UINT16_MAX; i++) {
+        if (CY_P256_BAD_PARAM != items[i].result) {
+            printf("FAIL batch max: item %u got %d\n", (unsigned)i, items[i].result);
+            failures++;
+            break;
+        }
+    }
+    free(items);
+    return failures;
+}
+
+int main(void)
+{
+    int failures = test_g_comb() + test_vectors() + test_batch() + test_batch_max();
+
+    printf("test_p256: %u vectors, %d failures\n", (unsigned)NUM_VECTORS, failures);
+    return (0 == failures) ? 0 : 1;
+}
@@ -0,0 +1,533 @@
+/*
+ * Host test of the OPTIGA PAL I2C on the simulated SCB0 (sim/sim.h): writes, reads and combined
+ * write/read transactions against a register file slave, retries under injected bus faults and
+ * address NACKs, in interrupt mode (I2C_INTR_MODE_EN=1) that the CPU is left to other tasks
+ * while a transfer is on the bus, the sharing of SCB0 with the FPGA register accesses and the
+ * queueing of OPTIGA transfers from the timer task behind another client, and the
+ * bitrate fall back after bus faults with the pin slew rate following the I2C mode. Built once per
+ * transfer mode, once more per mode with the register address writes joined to the following read
+ * (PAL_I2C_COMBINED_READ_EN) and once with the OPTIGA service task (PAL_OS_EVENT_TASK_EN), see the
+ * Makefile.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "sim.h"
+#include "semphr.h"
+#include "timers.h"
+#include "pal_custom.h"
+#include "usb_i2c.h"
+#include "i2c_bus_mgr.h"
+
+#define CHECK(cond, what) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s\n", what); \
+            failures++; \
+        } \
+    } while (0)
+
+#ifndef PAL_I2C_COMBINED_READ_EN
+#define PAL_I2C_COMBINED_READ_EN    (0u)
+#endif
+
+#define TASK_PRIORITY   (12u)
+#define EVENT_WAIT      pdMS_TO_TICKS(200)
+#define ATTEMPTS        (3u)
+
+/* Register file: the first byte written selects the register, reads go on from there */
+typedef struct {
+    sim_i2c_slave_t slave;
+    bool nack;
+    bool selecting;
+    uint8_t reg;
+    uint32_t stops;
+    uint32_t restarts;
+    uint8_t mem[256];
+} regfile_t;
+
+/* FPGA registers: FPGA_I2C_ADDRESS_WIDTH address bytes MSB first, then the data byte */
+typedef struct {
+    sim_i2c_slave_t slave;
+    uint8_t addrBytes;
+    uint16_t addr;
+    uint8_t mem[256];
+} fpga_t;
+
+static regfile_t regfile;
+static fpga_t fpga;
+static pal_i2c_t *p_pal;
+static SemaphoreHandle_t event_sem;
+static optiga_lib_status_t last_event;
+static uint32_t events;
+static int total_failures;
+
+static bool regfile_start(sim_i2c_slave_t *p_slave, bool read)
+{
+    regfile_t *p_rf = (regfile_t *)p_slave;
+
+    p_rf->selecting = !read;
+    return !p_rf->nack;
+}
+
+static bool regfile_write(sim_i2c_slave_t *p_slave, uint8_t byte)
+{
+    regfile_t *p_rf = (regfile_t *)p_slave;
+
+    if (p_rf->selecting) {
+        p_rf->reg = byte;
+        p_rf->selecting = false;
+    } else {
+        p_rf->mem[p_rf->reg++] = byte;
+    }
+    return true;
+}
+
+static uint8_t regfile_read(sim_i2c_slave_t *p_slave)
+{
+    regfile_t *p_rf = (regfile_t *)p_slave;
+
+    return p_rf->mem[p_rf->reg++];
+}
+
+static void regfile_stop(sim_i2c_slave_t *p_slave, bool restart)
+{
+    /* Also the stop of the FPGA slave, which is not counted */
+    if (p_slave == &regfile.slave) {
+        if (restart) {
+            regfile.restarts++;
+        } else {
+            regfile.stops++;
+        }
+    }
+}
+
+static bool fpga_start(sim_i2c_slave_t *p_slave, bool read)
+{
+    fpga_t *p_fpga = (fpga_t *)p_slave;
+
+    if (!read) {
+        p_fpga->addrBytes = 0u;
+    }
+    return true;
+}
+
+static bool fpga_write(sim_i2c_slave_t *p_slave, uint8_t byte)
+{
+    fpga_t *p_fpga = (fpga_t *)p_slave;
+
+    if (p_fpga->addrBytes < FPGA_I2C_ADDRESS_WIDTH) {
+        p_fpga->addr = (uint16_t)((p_fpga->addr << 8) | byte);
+        p_fpga->addrBytes++;
+    } else {
+        p_fpga->mem[(uint8_t)p_fpga->addr] = byte;
+    }
+    return true;
+}
+
+static uint8_t fpga_read(sim_i2c_slave_t *p_slave)
+{
+    fpga_t *p_fpga = (fpga_t *)p_slave;
+
+    return p_fpga->mem[(uint8_t)p_fpga->addr];
+}
+
+static void upper_layer_event(void *p_ctx, optiga_lib_status_t event)
+{
+    (void)p_ctx;
+    last_event = event;
+    events++;
+    xSemaphoreGive(event_sem);
+}
+
+/* The PAL event of the transfer just started, PAL_I2C_EVENT_BUSY on timeout */
+static optiga_lib_status_t wait_event(void)
+{
+    if (pdTRUE != xSemaphoreTake(event_sem, EVENT_WAIT)) {
+        return PAL_I2C_EVENT_BUSY;
+    }
+    return last_event;
+}
+
+static int test_transfers(void)
+{
+    uint8_t wr[1 + 64], rd[64], reg = 0x10;
+    unsigned i;
+    int failures = 0;
+
+    for (i = 0; i < 64u; i++) {
+        wr[1 + i] = (uint8_t)(i * 3u + 1u);
+    }
+    wr[0] = reg;
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_write(p_pal, wr, sizeof(wr)), "write started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "write completed");
+    CHECK(0 == memcmp(&regfile.mem[reg], &wr[1], 64u), "written bytes");
+
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_write(p_pal, &reg, 1u), "select started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "select completed");
+    memset(rd, 0, sizeof(rd));
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_read(p_pal, rd, sizeof(rd)), "read started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "read completed");
+    CHECK(0 == memcmp(rd, &wr[1], sizeof(rd)), "read bytes");
+    CHECK(3u == events, "one event per transfer");
+    return failures;
+}
+
+static int test_combined(void)
+{
+    pal_i2c_combined_stats_t stats;
+    uint8_t reg = 0x20, rd[16];
+    int failures = 0;
+
+    pal_i2c_clear_retry_stats();
+    memset(rd, 0, sizeof(rd));
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_write_read(p_pal, &reg, 1u, rd, sizeof(rd)), "write/read started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "write/read completed");
+    CHECK(0 == memcmp(rd, &regfile.mem[reg], sizeof(rd)), "write/read bytes");
+    pal_i2c_get_combined_stats(&stats);
+    CHECK((1u == stats.transfers) && (0u == stats.failures), "combined stats");
+
+    /* A lone register address, then a read: held back and sent with the read when combined */
+    regfile.stops = 0u;
+    regfile.restarts = 0u;
+    events = 0;
+    reg = 0x30;
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_write(p_pal, &reg, 1u), "select started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "select completed");
+    CHECK((PAL_I2C_COMBINED_READ_EN ? 0u : 1u) == regfile.stops, "select on the bus unless combined");
+    memset(rd, 0, sizeof(rd));
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_read(p_pal, rd, sizeof(rd)), "read started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "read completed");
+    CHECK(0 == memcmp(rd, &regfile.mem[reg], sizeof(rd)), "selected register read");
+    CHECK(2u == events, "one event per call");
+    CHECK((PAL_I2C_COMBINED_READ_EN ? 1u : 2u) == regfile.stops, "one transaction when combined");
+    CHECK((PAL_I2C_COMBINED_READ_EN ? 1u : 0u) == regfile.restarts, "repeated START only when combined");
+    pal_i2c_get_combined_stats(&stats);
+    CHECK((PAL_I2C_COMBINED_READ_EN ? 1u : 0u) == stats.deferred_writes, "deferred writes");
+    CHECK((PAL_I2C_COMBINED_READ_EN ? 2u : 1u) == stats.transfers, "combined transfers");
+    return failures;
+}
+
+static int test_retries(void)
+{
+    pal_i2c_retry_stats_t stats;
+    uint8_t wr[9] = { 0x40, 1, 2, 3, 4, 5, 6, 7, 8 }, rd[8];
+    const pal_i2c_retry_policy_t policy = { ATTEMPTS, 100u, 4000u, 0u, 1000u };
+    int failures = 0;
+
+    pal_i2c_set_retry_policy(PAL_I2C_RETRY_WRITE, &policy);
+    pal_i2c_set_retry_policy(PAL_I2C_RETRY_READ, &policy);
+
+    /* One data NACK: the second attempt goes through */
+    pal_i2c_clear_retry_stats();
+    sim_i2c_inject_fault(SIM_I2C_FAULT_DATA_NAK, 1u);
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_write(p_pal, wr, sizeof(wr)), "retried write started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "write retried after a data NACK");
+    pal_i2c_get_retry_stats(PAL_I2C_RETRY_WRITE, &stats);
+    CHECK((1u == stats.transfers) && (1u == stats.retries) && (0u == stats.failures), "write retry stats");
+
+    /* One bus error on a read */
+    sim_i2c_inject_fault(SIM_I2C_FAULT_BUS_ERR, 1u);
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_read(p_pal, rd, sizeof(rd)), "retried read started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "read retried after a bus error");
+    pal_i2c_get_retry_stats(PAL_I2C_RETRY_READ, &stats);
+    CHECK((1u == stats.transfers) && (1u == stats.retries) && (0u == stats.failures), "read retry stats");
+
+    /* Arbitration lost on every attempt: reported once, after the last one */
+    pal_i2c_clear_retry_stats();
+    sim_i2c_inject_fault(SIM_I2C_FAULT_ARB_LOST, ATTEMPTS);
+    events = 0;
+    (void)pal_i2c_write(p_pal, wr, sizeof(wr));
+    CHECK(PAL_I2C_EVENT_ERROR == wait_event(), "write failed after the last attempt");
+    pal_i2c_get_retry_stats(PAL_I2C_RETRY_WRITE, &stats);
+    CHECK((ATTEMPTS - 1u == stats.retries) && (1u == stats.failures), "failed write stats");
+
+    /* Address NACK of a busy chip, retried the same way */
+    pal_i2c_clear_retry_stats();
+    regfile.nack = true;
+    (void)pal_i2c_read(p_pal, rd, sizeof(rd));
+    CHECK(PAL_I2C_EVENT_ERROR == wait_event(), "read NACKed on every attempt");
+    pal_i2c_get_retry_stats(PAL_I2C_RETRY_READ, &stats);
+    CHECK((ATTEMPTS - 1u == stats.retries) && (1u == stats.failures), "NACKed read stats");
+    regfile.nack = false;
+    CHECK(2u == events, "one event per failed transfer");
+
+    sim_i2c_inject_fault(SIM_I2C_FAULT_NONE, 0u);
+    return failures;
+}
+
+static void write_from_timer_task(void *p_arg, uint32_t length)
+{
+    (void)pal_i2c_write(p_pal, (uint8_t *)p_arg, (uint16_t)length);
+}
+
+/* Backoffs of two ticks and more, with the transfer started from the timer task like the IFX I2C layer does */
+static int test_long_backoff(void)
+{
+    const pal_i2c_retry_policy_t policy = { ATTEMPTS, 2000u, 4000u, 0u, 1000u };
+    pal_i2c_retry_stats_t stats;
+    sim_i2c_stats_t bus;
+    sim_stats_t rtos;
+    uint8_t wr[5] = { 0x50, 1, 2, 3, 4 };
+    int failures = 0;
+
+    pal_i2c_set_retry_policy(PAL_I2C_RETRY_WRITE, &policy);
+    pal_i2c_clear_retry_stats();
+    sim_clear_stats();
+    sim_i2c_clear_stats();
+
+    /* Two data NACKs, the third attempt goes through */
+    sim_i2c_inject_fault(SIM_I2C_FAULT_DATA_NAK, ATTEMPTS - 1u);
+    (void)xTimerPendFunctionCall(write_from_timer_task, wr, sizeof(wr), 0u);
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "write retried after long backoffs");
+    CHECK(0 == memcmp(&regfile.mem[wr[0]], &wr[1], 4u), "bytes of the last attempt");
+    pal_i2c_get_retry_stats(PAL_I2C_RETRY_WRITE, &stats);
+    CHECK((ATTEMPTS - 1u == stats.retries) && (ATTEMPTS - 1u == stats.yield_waits) && (0u == stats.spin_waits),
+          "backoffs timed by pal_os_event");
+
+    sim_get_stats(&rtos);
+    sim_i2c_get_stats(&bus);
+    CHECK(0u == rtos.timerTaskBlocks, "timer task never blocked");
+    CHECK(rtos.timerTaskBusyNs <= bus.busNs + 100000u, "backoffs not spun in the timer task");
+    return failures;
+}
+
+static void background_task(void *p_arg)
+{
+    (void)p_arg;
+    for (;;) {
+        sim_busy_wait_ns(10000u);
+    }
+}
+
+/* A long read at 100 kHz while a lower priority task spins */
+static int test_cpu_release(void)
+{
+    TaskHandle_t background;
+    sim_i2c_stats_t bus;
+    uint64_t background_ns;
+    uint8_t rd[200];
+    int failures = 0;
+
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_set_bitrate(p_pal, 100u), "100 kHz");
+    (void)xTaskCreate(background_task, "background", 256u, NULL, 1u, &background);
+    vTaskDelay(1u);
+    background_ns = sim_task_busy_ns("background");
+    sim_i2c_clear_stats();
+
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_read(p_pal, rd, sizeof(rd)), "long read started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "long read completed");
+    background_ns = sim_task_busy_ns("background") - background_ns;
+    vTaskDelete(background);
+    sim_i2c_get_stats(&bus);
+
+    printf("  %u byte read: %.1f us on the bus, %.1f us left to a lower priority task\n",
+           (unsigned)sizeof(rd), (double)bus.busNs / 1e3, (double)background_ns / 1e3);
+#if I2C_INTR_MODE_EN
+    CHECK(background_ns >= bus.busNs * 9u / 10u, "CPU left to other tasks during the transfer");
+#else
+    CHECK(background_ns <= bus.busNs / 10u, "blocking transfer keeps the CPU");
+#endif
+    return failures;
+}
+
+/* Address NACKs of a busy chip leave Fast-mode Plus alone, data NACKs make it fall back */
+static int test_fault_fallback(void)
+{
+    const pal_i2c_retry_policy_t policy = { ATTEMPTS, 100u, 4000u, 0u, 1000u };
+    uint8_t wr[3] = { 0x60, 1, 2 };
+    int failures = 0;
+    int i;
+
+    pal_i2c_set_retry_policy(PAL_I2C_RETRY_WRITE, &policy);
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_set_bitrate(p_pal, 1000u), "1000 kHz");
+    CHECK(1000u == pal_i2c_get_bitrate(), "Fast-mode Plus");
+    CHECK((CY_GPIO_DM_OD_DRIVESLOW == sim_gpio_drive_mode(10u, 0u)) &&
+          (CY_GPIO_DM_OD_DRIVESLOW == sim_gpio_drive_mode(10u, 1u)), "SCL and SDA open drain");
+    CHECK((CY_GPIO_SLEW_FAST == sim_gpio_slew_rate(10u, 0u)) && (CY_GPIO_SLEW_FAST == sim_gpio_slew_rate(10u, 1u)),
+          "fast slew rate in Fast-mode Plus");
+
+    regfile.nack = true;
+    for (i = 0; i < 2; i++) {
+        (void)pal_i2c_write(p_pal, wr, sizeof(wr));
+        CHECK(PAL_I2C_EVENT_ERROR == wait_event(), "write NACKed by a busy chip");
+    }
+    regfile.nack = false;
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_write(p_pal, wr, sizeof(wr)), "write started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "write after the address NACKs");
+    CHECK(1000u == pal_i2c_get_bitrate(), "address NACKs are no bus faults");
+
+    sim_i2c_inject_fault(SIM_I2C_FAULT_DATA_NAK, ATTEMPTS);
+    (void)pal_i2c_write(p_pal, wr, sizeof(wr));
+    CHECK(PAL_I2C_EVENT_ERROR == wait_event(), "write data NACKed on every attempt");
+    CHECK(PAL_STATUS_SUCCESS == pal_i2c_write(p_pal, wr, sizeof(wr)), "write started");
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "write after the data NACKs");
+    /* Fast-mode, at the rate the SCB clock divider achieves */
+    CHECK((pal_i2c_get_bitrate() > 100u) && (pal_i2c_get_bitrate() <= 400u), "data NACKs make Fast-mode Plus fall back");
+    CHECK((CY_GPIO_SLEW_SLOW == sim_gpio_slew_rate(10u, 0u)) && (CY_GPIO_SLEW_SLOW == sim_gpio_slew_rate(10u, 1u)),
+          "slow slew rate in Fast-mode");
+    return failures;
+}
+
+static cy_stc_i2c_bus_client_t timer_client;
+static cy_en_i2c_bus_status_t timer_acquire_status;
+
+static void acquire_from_timer_task(void *p_arg, uint32_t unused)
+{
+    (void)unused;
+    timer_acquire_status = Cy_USB_I2CBusAcquire(&timer_client, pdMS_TO_TICKS(50));
+    if (CY_I2C_BUS_SUCCESS == timer_acquire_status) {
+        Cy_USB_I2CBusRelease(&timer_client);
+    }
+    xSemaphoreGive((SemaphoreHandle_t)p_arg);
+}
+
+/* FPGA register accesses by a bulk client of the bus manager, nested acquires, and no blocking in the timer task */
+static int test_bus_sharing(void)
+{
+    static cy_stc_i2c_bus_client_t client;
+    SemaphoreHandle_t done_sem = xSemaphoreCreateBinary();
+    sim_stats_t rtos;
+    uint8_t wr[FPGA_I2C_ADDRESS_WIDTH + FPGA_I2C_DATA_WIDTH] = { 0x01u, 0x23u, 0x5Au };
+    uint8_t value = 0u;
+    int failures = 0;
+
+    Cy_USB_I2CBusClientInit(&client, "test", I2C_BUS_PRIO_BULK);
+    Cy_USB_I2CBusClientInit(&timer_client, "timer", I2C_BUS_PRIO_OPTIGA);
+    CHECK(CY_I2C_BUS_SUCCESS == Cy_USB_I2CBusAcquire(&client, 0u), "bus acquired");
+    CHECK(CY_SCB_I2C_SUCCESS == cyi2c_master_write(SCB0, FPGASLAVE_ADDR, wr, sizeof(wr), true),
+          "FPGA register written");
+    CHECK((0x0123u == fpga.addr) && (0x5Au == fpga.mem[0x23]), "FPGA register address and value");
+    fpga.mem[0x42] = 0xC3u;
+    wr[0] = 0x00u;
+    wr[1] = 0x42u;
+    CHECK(CY_SCB_I2C_SUCCESS == cyi2c_master_write_read(SCB0, FPGASLAVE_ADDR, wr, FPGA_I2C_ADDRESS_WIDTH, &value, 1u),
+          "FPGA register read");
+    CHECK(0xC3u == value, "FPGA register value read");
+    CHECK(CY_I2C_BUS_SUCCESS == Cy_USB_I2CBusAcquire(&client, 0u), "bus acquired again by its owner");
+    Cy_USB_I2CBusRelease(&client);
+
+    /* Still owned after the first release, the timer task must not wait for it */
+    sim_clear_stats();
+    (void)xTimerPendFunctionCall(acquire_from_timer_task, done_sem, 0u, 0u);
+    CHECK(pdTRUE == xSemaphoreTake(done_sem, EVENT_WAIT), "timer task acquire returned");
+    CHECK(CY_I2C_BUS_TIMEOUT == timer_acquire_status, "timer task acquire of an owned bus times out");
+    sim_get_stats(&rtos);
+    CHECK(0u == rtos.timerTaskBlocks, "timer task never blocked on the bus");
+
+    Cy_USB_I2CBusRelease(&client);
+    (void)xTimerPendFunctionCall(acquire_from_timer_task, done_sem, 0u, 0u);
+    CHECK(pdTRUE == xSemaphoreTake(done_sem, EVENT_WAIT), "timer task acquire returned");
+    CHECK(CY_I2C_BUS_SUCCESS == timer_acquire_status, "bus free after the nested release");
+    vSemaphoreDelete(done_sem);
+    return failures;
+}
+
+static cy_stc_i2c_bus_client_t bulk_client;
+static cy_stc_i2c_bus_client_t waiter_client;
+static volatile bool waiter_granted;
+static volatile bool waiter_granted_first;
+
+/* A bulk client blocked on the bus, at the lowest task priority */
+static void bulk_waiter_task(void *p_arg)
+{
+    if (CY_I2C_BUS_SUCCESS == Cy_USB_I2CBusAcquire(&waiter_client, pdMS_TO_TICKS(100))) {
+        waiter_granted = true;
+        waiter_granted_first = (0u == events);
+        Cy_USB_I2CBusRelease(&waiter_client);
+    }
+    xSemaphoreGive((SemaphoreHandle_t)p_arg);
+    vTaskDelete(NULL);
+}
+
+/* Transfers started from the timer task while a bulk client owns SCB0 are queued, not refused */
+static int test_bus_queueing(void)
+{
+    SemaphoreHandle_t done_sem = xSemaphoreCreateBinary();
+    uint8_t wr[4] = { 0x70, 7, 8, 9 };
+    sim_stats_t rtos;
+    int failures = 0;
+
+    Cy_USB_I2CBusClientInit(&bulk_client, "bulk", I2C_BUS_PRIO_BULK);
+    Cy_USB_I2CBusClientInit(&waiter_client, "waiter", I2C_BUS_PRIO_BULK);
+
+    /* Released within PAL_I2C_BUS_WAIT_MS: the OPTIGA write goes ahead of a bulk client queued earlier */
+    CHECK(CY_I2C_BUS_SUCCESS == Cy_USB_I2CBusAcquire(&bulk_client, 0u), "bus taken by a bulk client");
+    waiter_granted = false;
+    (void)xTaskCreate(bulk_waiter_task, "waiter", 256u, done_sem, 1u, NULL);
+    vTaskDelay(1u);
+    events = 0;
+    sim_clear_stats();
+    (void)xTimerPendFunctionCall(write_from_timer_task, wr, sizeof(wr), 0u);
+    vTaskDelay(pdMS_TO_TICKS(5));
+    CHECK(0u == events, "write queued behind the owner instead of reported busy");
+    Cy_USB_I2CBusRelease(&bulk_client);
+    CHECK(PAL_I2C_EVENT_SUCCESS == wait_event(), "queued write completed once the bus was released");
+    CHECK(0 == memcmp(&regfile.mem[wr[0]], &wr[1], 3u), "bytes of the queued write");
+    CHECK(pdTRUE == xSemaphoreTake(done_sem, EVENT_WAIT), "bulk waiter returned");
+    CHECK(waiter_granted && !waiter_granted_first, "OPTIGA granted the bus ahead of the bulk waiter");
+    CHECK((waiter_client.maxWaitUs >= 5000u) && (waiter_client.maxWaitUs < 100000u), "bulk wait in microseconds");
+    sim_get_stats(&rtos);
+    CHECK(0u == rtos.timerTaskBlocks, "timer task never blocked on the bus");
+
+    /* Held for longer: reported busy once PAL_I2C_BUS_WAIT_MS have passed, and no longer queued */
+    CHECK(CY_I2C_BUS_SUCCESS == Cy_USB_I2CBusAcquire(&bulk_client, 0u), "bus taken by a bulk client");
+    events = 0;
+    (void)xTimerPendFunctionCall(write_from_timer_task, wr, sizeof(wr), 0u);
+    (void)wait_event();
+    CHECK((1u == events) && (PAL_I2C_EVENT_BUSY == last_event), "busy once the wait timed out");
+    Cy_USB_I2CBusRelease(&bulk_client);
+    CHECK(CY_I2C_BUS_SUCCESS == Cy_USB_I2CBusAcquire(&bulk_client, 0u), "bus free after the timed out wait");
+    Cy_USB_I2CBusRelease(&bulk_client);
+    CHECK(1u == events, "no transfer after the timed out wait");
+
+    vSemaphoreDelete(done_sem);
+    return failures;
+}
+
+static void test_task(void *p_arg)
+{
+    (void)p_arg;
+    event_sem = xSemaphoreCreateBinary();
+    p_pal = optiga_pal_i2c_contexts[0];
+    p_pal->upper_layer_event_handler = (void *)upper_layer_event;
+    p_pal->p_upper_layer_ctx = NULL;
+
+    if (PAL_STATUS_SUCCESS != pal_i2c_init(p_pal)) {
+        printf("FAIL pal_i2c_init\n");
+        total_failures++;
+        return;
+    }
+    total_failures += test_transfers();
+    total_failures += test_combined();
+    total_failures += test_cpu_release();
+    total_failures += test_retries();
+    total_failures += test_long_backoff();
+    total_failures += test_bus_sharing();
+    total_failures += test_bus_queueing();
+    total_failures += test_fault_fallback();
+}
+
+int main(void)
+{
+    regfile.slave.address = OPTIGA_FX_ADDR;
+    regfile.slave.start = regfile_start;
+    regfile.slave.write = regfile_write;
+    regfile.slave.read = regfile_read;
+    regfile.slave.stop = regfile_stop;
+    sim_i2c_attach(&regfile.slave);
+    fpga.slave.address = FPGASLAVE_ADDR;
+    fpga.slave.start = fpga_start;
+    fpga.slave.write = fpga_write;
+    fpga.slave.read = fpga_read;
+    fpga.slave.stop = regfile_stop;
+    sim_i2c_attach(&fpga.slave);
+
+    if (0 != sim_run(test_task, NULL, TASK_PRIORITY)) {
+        total_failures++;
+    }
+    printf("test_pal_i2c (%s%s%s): %d failures\n", I2C_INTR_MODE_EN ? "interrupt driven" : "blocking",
+           PAL_I2C_COMBINED_READ_EN ? ", combined reads" : "",
+           PAL_OS_EVENT_TASK_EN ? ", OPTIGA service task" : "", total_failures);
+    return (0 == total_failures) ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/*
+ * Host test of the software SHA-256 and SHA-384: FIPS 180-4 example messages, digests of
+ * pattern messages at every block and padding edge, and the same messages fed in chunks.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "sha2.h"
+
+typedef struct
+{
+    uint32_t length;
+    uint8_t sha256[SHA256_DIGEST_LENGTH];
+    uint8_t sha384[SHA384_DIGEST_LENGTH];
+} sha_vector_t;
+
+#include "sha_vectors.h"
+
+#define NUM_VECTORS     (sizeof(sha_vectors) / sizeof(sha_vectors[0]))
+#define MAX_LENGTH      (4096u)
+
+#define CHECK(cond, what, arg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s %u\n", what, (unsigned)(arg)); \
+            failures++; \
+        } \
+    } while (0)
+
+static void sha256(const uint8_t *data, uint32_t length, uint32_t chunk, uint8_t *digest)
+{
+    cy_stc_sha256_t ctx;
+    uint32_t n;
+
+    Cy_Sha256_Init(&ctx);
+    while (length > 0u) {
+        n = (length < chunk) ? length : chunk;
+        Cy_Sha256_Update(&ctx, data, n);
+        data += n;
+        length -= n;
+    }
+    Cy_Sha256_Final(&ctx, digest);
+}
+
+static void sha384(const uint8_t *data, uint32_t length, uint32_t chunk, uint8_t *digest)
+{
+    cy_stc_sha384_t ctx;
+    uint32_t n;
+
+    Cy_Sha384_Init(&ctx);
+    while (length > 0u) {
+        n = (length < chunk) ? length : chunk;
+        Cy_Sha384_Update(&ctx, data, n);
+        data += n;
+        length -= n;
+    }
+    Cy_Sha384_Final(&ctx, digest);
+}
+
+static int test_fips(void)
+{
+    /* FIPS 180-4 examples "abc" and the two block message of 448 bits */
+    static const char *abc = "abc";
+    static const char *two = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    static const uint8_t abc256[32] =
+    {
+        0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+        0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD
+    };
+    static const uint8_t two256[32] =
+    {
+        0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26, 0x93, 0x0C, 0x3E, 0x60, 0x39,
+        0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF, 0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1
+    };
+    static const uint8_t abc384[48] =
+    {
+        0xCB, 0x00, 0x75, 0x3F, 0x45, 0xA3, 0x5E, 0x8B, 0xB5, 0xA0, 0x3D, 0x69, 0x9A, 0xC6, 0x50, 0x07,
+        0x27, 0x2C, 0x32, 0xAB, 0x0E, 0xDE, 0xD1, 0x63, 0x1A, 0x8B, 0x60, 0x5A, 0x43, 0xFF, 0x5B, 0xED,
+        0x80, 0x86, 0x07, 0x2B, 0xA1, 0xE7, 0xCC, 0x23, 0x58, 0xBA, 0xEC, 0xA1, 0x34, 0xC8, 0x25, 0xA7
+    };
+    uint8_t digest[SHA384_DIGEST_LENGTH];
+    int failures = 0;
+
+    sha256((const uint8_t *)abc, 3u, 3u, digest);
+    CHECK(0 == memcmp(digest, abc256, sizeof(abc256)), "SHA-256 abc", 0);
+    sha256((const uint8_t *)two, (uint32_t)strlen(two), 64u, digest);
+    CHECK(0 == memcmp(digest, two256, sizeof(two256)), "SHA-256 448 bit message", 0);
+    sha384((const uint8_t *)abc, 3u, 3u, digest);
+    CHECK(0 == memcmp(digest, abc384, sizeof(abc384)), "SHA-384 abc", 0);
+    return failures;
+}
+
+static int test_vectors(void)
+{
+    /* One call, byte by byte, and chunk sizes which straddle the blocks in different ways */
+    static const uint32_t chunks[] = { MAX_LENGTH, 1u, 7u, 64u, 100u, 128u, 129u };
+    static uint8_t msg[MAX_LENGTH];
+    uint8_t digest[SHA384_DIGEST_LENGTH];
+    uint32_t i, c;
+    int failures = 0;
+
+    for (i = 0; i < MAX_LENGTH; i++) {
+        msg[i] = (uint8_t)((31u * i) + 7u);
+    }
+
+    for (i = 0; i < NUM_VECTORS; i++) {
+        const sha_vector_t *v = &sha_vectors[i];
+
+        for (c = 0; c < (sizeof(chunks) / sizeof(chunks[0])); c++) {
+            sha256(msg, v->length, chunks[c], digest);
+            CHECK(0 == memcmp(digest, v->sha256, SHA256_DIGEST_LENGTH), "SHA-256 length", v->length);
+            sha384(msg, v->length, chunks[c], digest);
+            CHECK(0 == memcmp(digest, v->sha384, SHA384_DIGEST_LENGTH), "SHA-384 length", v->length);
+        }
+    }
+    return failures;
+}
+
+static int test_wipe(void)
+{
+    static const uint8_t zero[sizeof(cy_stc_sha256_t)];
+    cy_stc_sha256_t ctx;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    int failures = 0;
+
+    Cy_Sha256_Init(&ctx);
+    Cy_Sha256_Update(&ctx, (const uint8_t *)"secret", 6u);
+    Cy_Sha256_Final(&ctx, digest);
+    CHECK(0 == memcmp(&ctx, zero, sizeof(ctx)), "context wiped by final", 0);
+    return failures;
+}
+
+int main(void)
+{
+    int failures = test_fips() + test_vectors() + test_wipe();
+
+    printf("test_sha: %d failures\n", failures);
+    return (0 == failures) ? 0 : 1;
+}
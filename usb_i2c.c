@@ -29,6 +29,7 @@
 #include "cy_debug.h"
 #include "usb_i2c.h"
 #include "pal_custom.h"
+#include "i2c_trace.h"
 
 /* Global variables */
 cy_stc_scb_i2c_context_t I2C_context;
@@ -41,6 +42,41 @@ cy_stc_scb_i2c_master_xfer_config_t write_i2c_slave = {
         .xferPending = false
 };
 
+#if I2C_INTR_MODE_EN
+/* Transfer configuration of the interrupt driven transfer in progress on SCB0. */
+static cy_stc_scb_i2c_master_xfer_config_t i2c_async_xfer;
+static bool i2c_async_read;
+
+/* Read phase of a combined transfer, started with a ReSTART once the write phase completes. */
+static bool i2c_async_combined;
+static uint8_t *i2c_async_rd_data;
+static uint16_t i2c_async_rd_size;
+#endif /* I2C_INTR_MODE_EN */
+
+#if I2C_DMA_EN
+/* State of the DataWire driven transfer in progress on SCB0. */
+typedef struct
+{
+    bool active;                    /* SCB0 interrupts belong to the DMA path while set. */
+    bool readXfer;                  /* Transfer direction. */
+    bool failed;                    /* An error was detected, report it once STOP is done. */
+    bool addrAcked;                 /* The slave acknowledged its address, a NACK after it is a data NACK. */
+    DW_Type *pDwBase;               /* DataWire block of the active channel. */
+    uint32_t dwChannel;             /* DataWire channel moving the data. */
+    uint16_t devAddr;
+    uint16_t size;
+    uint8_t *pData;
+    uint8_t *pTail;                 /* Read: bytes collected from the RX FIFO by the CPU. */
+    uint32_t tailSize;
+    uint32_t i2cCtrl;               /* I2C_CTRL value to restore after the transfer. */
+} cy_stc_i2c_dma_xfer_t;
+
+static cy_stc_i2c_dma_xfer_t i2c_dma_xfer;
+
+/* A 2D descriptor for the whole multiples of the X loop size and a 1D one for the remainder. */
+static cy_stc_dma_descriptor_t i2c_dma_tx_dscr[2];
+static cy_stc_dma_descriptor_t i2c_dma_rx_dscr[2];
+#endif /* I2C_DMA_EN */
 
 /* Functions */
 
@@ -58,9 +94,14 @@ cy_en_scb_i2c_status_t cyi2c_master_read(CySCB_Type *base, uint16_t dev_addr, ui
                         uint16_t size, bool send_stop)
 {
     uint32_t timeout = 0;
+    uint8_t *pStart = data;
+    uint16_t total = size;
 
     cy_en_scb_i2c_command_t ack = CY_SCB_I2C_ACK;
 
+    I2C_TRACE_ADD((I2C_context.state == CY_SCB_I2C_IDLE) ? I2C_TRACE_EVT_START : I2C_TRACE_EVT_RESTART,
+                  dev_addr, true, 0, 0, NULL);
+
     /* Start transaction, send dev_addr */
     cy_en_scb_i2c_status_t status = (I2C_context.state == CY_SCB_I2C_IDLE)
         ? Cy_SCB_I2C_MasterSendStart(base, dev_addr, CY_SCB_I2C_READ_XFER, timeout,  &I2C_context)
@@ -83,11 +124,14 @@ cy_en_scb_i2c_status_t cyi2c_master_read(CySCB_Type *base, uint16_t dev_addr, ui
         }
     }
 
+    I2C_TRACE_ADD(I2C_TRACE_EVT_DATA, dev_addr, true, total - size, status, pStart);
+
     if (send_stop)
     {
         /* SCB in I2C mode is very time sensitive. In practice we have to request STOP after */
         /* each block, otherwise it may break the transmission */
         Cy_SCB_I2C_MasterSendStop(base, timeout,  &I2C_context);
+        I2C_TRACE_ADD(I2C_TRACE_EVT_STOP, dev_addr, true, 0, 0, NULL);
     }
     return status;
 }
@@ -105,10 +149,15 @@ cy_en_scb_i2c_status_t cyi2c_master_read(CySCB_Type *base, uint16_t dev_addr, ui
 cy_en_scb_i2c_status_t cyi2c_master_write(CySCB_Type *base, uint16_t dev_addr, const uint8_t *data, 
                                             uint16_t size, bool send_stop)
 {
+    const uint8_t *pStart = data;
+    uint16_t total = size;
+
     /* Clean-up hardware before transfer. Note RX FIFO is empty at here. */
     Cy_SCB_ClearMasterInterrupt(base, CY_SCB_I2C_MASTER_INTR_ALL);
     Cy_SCB_ClearTxFifo(base);
     cy_en_scb_i2c_status_t status;
+    I2C_TRACE_ADD((I2C_context.state == CY_SCB_I2C_IDLE) ? I2C_TRACE_EVT_START : I2C_TRACE_EVT_RESTART,
+                  dev_addr, false, 0, 0, NULL);
     status = (I2C_context.state == CY_SCB_I2C_IDLE)
         ? Cy_SCB_I2C_MasterSendStart(base, dev_addr, CY_SCB_I2C_WRITE_XFER, 0, &I2C_context)
         : Cy_SCB_I2C_MasterSendReStart(base, dev_addr, CY_SCB_I2C_WRITE_XFER,0, &I2C_context);
@@ -127,71 +176,595 @@ cy_en_scb_i2c_status_t cyi2c_master_write(CySCB_Type *base, uint16_t dev_addr, c
         }
     }
 
+    I2C_TRACE_ADD(I2C_TRACE_EVT_DATA, dev_addr, false, total - size, status, pStart);
+
     if (send_stop)
     {
         /* SCB in I2C mode is very time sensitive. In practice we have to request STOP after */
         /* each block, otherwise it may break the transmission */
         Cy_SCB_I2C_MasterSendStop(base, 0, &I2C_context);
+        I2C_TRACE_ADD(I2C_TRACE_EVT_STOP, dev_addr, false, 0, 0, NULL);
+    }
+
+    return status;
+}
+
+/**
+ * \name cyi2c_master_write_read
+ * \brief Write to the slave and read back its response in one transaction, joined by a ReSTART
+ * \param base
+ * \param dev_addr
+ * \param wr_data
+ * \param wr_size
+ * \param rd_data
+ * \param rd_size
+ * \retval status Exit code of the failing phase, or of the read phase
+ */
+cy_en_scb_i2c_status_t cyi2c_master_write_read(CySCB_Type *base, uint16_t dev_addr, const uint8_t *wr_data,
+                        uint16_t wr_size, uint8_t *rd_data, uint16_t rd_size)
+{
+    cy_en_scb_i2c_status_t status;
+
+    /* The bus stays owned after the write, so the read starts with a ReSTART. */
+    status = cyi2c_master_write(base, dev_addr, wr_data, wr_size, false);
+    if (status != CY_SCB_I2C_SUCCESS)
+    {
+        Cy_SCB_I2C_MasterSendStop(base, 0, &I2C_context);
+        I2C_TRACE_ADD(I2C_TRACE_EVT_STOP, dev_addr, false, 0, 0, NULL);
+        return status;
+    }
+
+    return cyi2c_master_read(base, dev_addr, rd_data, rd_size, true);
+}
+
+#if I2C_DMA_EN
+/**
+ * \name Cy_USB_I2CDmaSetupDscr
+ * \brief Build the DataWire descriptor chain moving count bytes between memory and a SCB FIFO
+ * \param pDscr Array of two descriptors
+ * \param pSrc
+ * \param pDst
+ * \param count
+ * \param toFifo true when the destination is the TX FIFO, false when the source is the RX FIFO
+ * \retval First descriptor of the chain
+ */
+static cy_stc_dma_descriptor_t *Cy_USB_I2CDmaSetupDscr(cy_stc_dma_descriptor_t *pDscr, void *pSrc, void *pDst,
+                                                       uint32_t count, bool toFifo)
+{
+    cy_stc_dma_descriptor_config_t dscrCfg;
+    uint32_t yCount = count / I2C_DMA_MAX_XLOOP_COUNT;
+    uint32_t remain = count % I2C_DMA_MAX_XLOOP_COUNT;
+    cy_stc_dma_descriptor_t *pFirst = (yCount != 0U) ? &pDscr[0] : &pDscr[1];
+
+    memset((void *)&dscrCfg, 0, sizeof(dscrCfg));
+
+    /* One byte per FIFO trigger. The channel switches itself off at the end of the chain. */
+    dscrCfg.retrigger       = CY_DMA_RETRIG_4CYC;
+    dscrCfg.interruptType   = CY_DMA_DESCR_CHAIN;
+    dscrCfg.triggerOutType  = CY_DMA_DESCR_CHAIN;
+    dscrCfg.triggerInType   = CY_DMA_1ELEMENT;
+    dscrCfg.dataSize        = CY_DMA_BYTE;
+    dscrCfg.srcTransferSize = toFifo ? CY_DMA_TRANSFER_SIZE_DATA : CY_DMA_TRANSFER_SIZE_WORD;
+    dscrCfg.dstTransferSize = toFifo ? CY_DMA_TRANSFER_SIZE_WORD : CY_DMA_TRANSFER_SIZE_DATA;
+    dscrCfg.srcXincrement   = toFifo ? 1 : 0;
+    dscrCfg.dstXincrement   = toFifo ? 0 : 1;
+
+    if (yCount != 0U)
+    {
+        dscrCfg.descriptorType = CY_DMA_2D_TRANSFER;
+        dscrCfg.channelState   = (remain != 0U) ? CY_DMA_CHANNEL_ENABLED : CY_DMA_CHANNEL_DISABLED;
+        dscrCfg.srcAddress     = pSrc;
+        dscrCfg.dstAddress     = pDst;
+        dscrCfg.xCount         = I2C_DMA_MAX_XLOOP_COUNT;
+        dscrCfg.yCount         = yCount;
+        dscrCfg.srcYincrement  = toFifo ? (int32_t)I2C_DMA_MAX_XLOOP_COUNT : 0;
+        dscrCfg.dstYincrement  = toFifo ? 0 : (int32_t)I2C_DMA_MAX_XLOOP_COUNT;
+        dscrCfg.nextDescriptor = (remain != 0U) ? &pDscr[1] : NULL;
+        Cy_DMA_Descriptor_Init(&pDscr[0], &dscrCfg);
+    }
+
+    if (remain != 0U)
+    {
+        dscrCfg.descriptorType = CY_DMA_1D_TRANSFER;
+        dscrCfg.channelState   = CY_DMA_CHANNEL_DISABLED;
+        dscrCfg.srcAddress     = toFifo ? (void *)((uint8_t *)pSrc + (count - remain)) : pSrc;
+        dscrCfg.dstAddress     = toFifo ? pDst : (void *)((uint8_t *)pDst + (count - remain));
+        dscrCfg.xCount         = remain;
+        dscrCfg.yCount         = 1U;
+        dscrCfg.srcYincrement  = 0;
+        dscrCfg.dstYincrement  = 0;
+        dscrCfg.nextDescriptor = NULL;
+        Cy_DMA_Descriptor_Init(&pDscr[1], &dscrCfg);
+    }
+
+    return pFirst;
+}
+
+/**
+ * \name Cy_USB_I2CDmaStart
+ * \brief Start a DataWire driven I2C transfer on SCB0, always terminated by STOP.
+ * \details Write: the address byte is queued by the CPU and the DataWire channel keeps the TX FIFO
+ *          filled with the payload. STOP is requested once the FIFO runs empty after the last byte.
+ *          Read: the DataWire channel drains all but the last FIFO-depth bytes. The master ACKs while
+ *          the RX FIFO has room and NACKs the byte which fills it, which is exactly the last byte of
+ *          the transfer. The tail is then copied out of the FIFO by the CPU.
+ * \param base
+ * \param dev_addr
+ * \param data
+ * \param size
+ * \param readXfer
+ * \retval status Exit code of starting the transfer
+ */
+static cy_en_scb_i2c_status_t Cy_USB_I2CDmaStart(CySCB_Type *base, uint16_t dev_addr, uint8_t *data,
+                                                 uint16_t size, bool readXfer)
+{
+    cy_stc_dma_channel_config_t chanCfg;
+    cy_stc_dma_descriptor_t *pDscr;
+    uint32_t fifoSize = Cy_SCB_GetFifoSize(base);
+
+    if (CY_SCB_I2C_IDLE != I2C_context.state)
+    {
+        return CY_SCB_I2C_MASTER_NOT_READY;
+    }
+
+    memset((void *)&i2c_dma_xfer, 0, sizeof(i2c_dma_xfer));
+    i2c_dma_xfer.readXfer = readXfer;
+    i2c_dma_xfer.devAddr  = dev_addr;
+    i2c_dma_xfer.size     = size;
+    i2c_dma_xfer.pData    = data;
+    i2c_dma_xfer.i2cCtrl  = SCB_I2C_CTRL(base);
+
+    if (readXfer)
+    {
+        i2c_dma_xfer.pDwBase   = appCtxt.pCpuDw1Base;
+        i2c_dma_xfer.dwChannel = I2C_DMA_RX_CHANNEL;
+        i2c_dma_xfer.pTail     = &data[size - fifoSize];
+        i2c_dma_xfer.tailSize  = fifoSize;
+        pDscr = Cy_USB_I2CDmaSetupDscr(i2c_dma_rx_dscr, (void *)&SCB_RX_FIFO_RD(base), data,
+                                       size - fifoSize, false);
+    }
+    else
+    {
+        i2c_dma_xfer.pDwBase   = appCtxt.pCpuDw0Base;
+        i2c_dma_xfer.dwChannel = I2C_DMA_TX_CHANNEL;
+        pDscr = Cy_USB_I2CDmaSetupDscr(i2c_dma_tx_dscr, data, (void *)&SCB_TX_FIFO_WR(base),
+                                       size, true);
+    }
+
+    memset((void *)&chanCfg, 0, sizeof(chanCfg));
+    chanCfg.descriptor  = pDscr;
+    chanCfg.preemptable = false;
+    chanCfg.priority    = 1U;
+    chanCfg.enable      = false;
+    chanCfg.bufferable  = false;
+    Cy_DMA_Channel_Init(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel, &chanCfg);
+    Cy_DMA_Channel_ClearInterrupt(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel);
+
+    /* Clean-up hardware before transfer. */
+    Cy_SCB_ClearMasterInterrupt(base, CY_SCB_I2C_MASTER_INTR_ALL);
+    Cy_SCB_ClearTxFifo(base);
+    Cy_SCB_ClearRxFifo(base);
+    Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_EMPTY);
+    Cy_SCB_ClearRxInterrupt(base, CY_SCB_RX_INTR_FULL);
+
+    i2c_dma_xfer.active = true;
+    I2C_TRACE_ADD(I2C_TRACE_EVT_START, dev_addr, readXfer, 0, 0, NULL);
+
+    if (readXfer)
+    {
+        SCB_I2C_CTRL(base) |= (SCB_I2C_CTRL_M_READY_DATA_ACK_Msk | SCB_I2C_CTRL_M_NOT_READY_DATA_NACK_Msk);
+        Cy_SCB_SetRxFifoLevel(base, 0U);
+        Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_FULL);
+        Cy_SCB_SetTxInterruptMask(base, 0U);
+        Cy_DMA_Channel_Enable(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel);
+
+        SCB_I2C_M_CMD(base) = SCB_I2C_M_CMD_M_START_ON_IDLE_Msk;
+        Cy_SCB_WriteTxFifo(base, CY_SCB_I2C_READ_ADDR(dev_addr));
+    }
+    else
+    {
+        /* Queue the address before the channel starts filling the FIFO behind it. */
+        SCB_I2C_M_CMD(base) = SCB_I2C_M_CMD_M_START_ON_IDLE_Msk;
+        Cy_SCB_WriteTxFifo(base, CY_SCB_I2C_WRITE_ADDR(dev_addr));
+
+        Cy_SCB_SetTxFifoLevel(base, fifoSize - 1U);
+        Cy_SCB_SetRxInterruptMask(base, 0U);
+        Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_EMPTY);
+        Cy_DMA_Channel_Enable(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel);
+    }
+
+    /* The first ACK is the address one, it is only needed to tell address and data NACKs apart. */
+    Cy_SCB_SetMasterInterruptMask(base, (CY_SCB_MASTER_INTR_I2C_ARB_LOST | CY_SCB_MASTER_INTR_I2C_NACK |
+                                         CY_SCB_MASTER_INTR_I2C_ACK | CY_SCB_MASTER_INTR_I2C_BUS_ERROR |
+                                         CY_SCB_MASTER_INTR_I2C_STOP));
+
+    return CY_SCB_I2C_SUCCESS;
+}
+
+/**
+ * \name Cy_USB_I2CDmaComplete
+ * \brief Return SCB0 to the driver and report the end of the DataWire driven transfer
+ * \param base
+ * \param masterIntr Master interrupt causes seen at the end of the transfer
+ * \retval None
+ */
+static void Cy_USB_I2CDmaComplete(CySCB_Type *base, uint32_t masterIntr)
+{
+    Cy_DMA_Channel_Disable(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel);
+    Cy_DMA_Channel_ClearInterrupt(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel);
+
+    Cy_SCB_SetMasterInterruptMask(base, 0U);
+    Cy_SCB_SetTxInterruptMask(base, 0U);
+    Cy_SCB_SetRxInterruptMask(base, 0U);
+    Cy_SCB_ClearTxFifo(base);
+    Cy_SCB_ClearRxFifo(base);
+    SCB_I2C_CTRL(base) = i2c_dma_xfer.i2cCtrl;
+    i2c_dma_xfer.active = false;
+
+    I2C_TRACE_ADD(I2C_TRACE_EVT_DATA, i2c_dma_xfer.devAddr, i2c_dma_xfer.readXfer,
+                  ((masterIntr != 0UL) || (i2c_dma_xfer.failed)) ? 0U : i2c_dma_xfer.size,
+                  (0UL != (masterIntr & CY_SCB_MASTER_INTR_I2C_NACK)) ? CY_SCB_I2C_MASTER_MANUAL_ADDR_NAK :
+                  ((masterIntr != 0UL) || (i2c_dma_xfer.failed)) ? CY_SCB_I2C_MASTER_MANUAL_BUS_ERR : CY_SCB_I2C_SUCCESS,
+                  i2c_dma_xfer.pData);
+    I2C_TRACE_ADD(I2C_TRACE_EVT_STOP, i2c_dma_xfer.devAddr, i2c_dma_xfer.readXfer, 0, 0, NULL);
+
+    if (0UL != (masterIntr & CY_SCB_MASTER_INTR_I2C_ARB_LOST))
+    {
+        i2c_master_arbitration_lost_callback();
+    }
+    else if (0UL != (masterIntr & CY_SCB_MASTER_INTR_I2C_NACK))
+    {
+        /* The OPTIGA does not acknowledge its address while busy. */
+        i2c_master_nack_received_callback();
+    }
+    else if (i2c_dma_xfer.failed)
+    {
+        i2c_master_error_detected_callback();
+    }
+    else if (i2c_dma_xfer.readXfer)
+    {
+        i2c_master_end_of_receive_callback();
+    }
+    else
+    {
+        i2c_master_end_of_transmit_callback();
+    }
+}
+
+/**
+ * \name Cy_USB_I2CDmaInterrupt
+ * \brief SCB0 interrupt handling while a DataWire driven transfer owns the block
+ * \param base
+ * \retval None
+ */
+static void Cy_USB_I2CDmaInterrupt(CySCB_Type *base)
+{
+    uint32_t masterIntr = Cy_SCB_GetMasterInterruptStatusMasked(base);
+    bool dmaDone = (0UL != Cy_DMA_Channel_GetInterruptStatus(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel));
+    uint32_t idx;
+
+    Cy_SCB_ClearMasterInterrupt(base, masterIntr);
+
+    if (0UL != (masterIntr & (CY_SCB_MASTER_INTR_I2C_ARB_LOST | CY_SCB_MASTER_INTR_I2C_BUS_ERROR)))
+    {
+        /* The master has already released the bus. */
+        i2c_dma_xfer.failed = true;
+        Cy_USB_I2CDmaComplete(base, masterIntr);
+        return;
+    }
+
+    if (0UL != (masterIntr & CY_SCB_MASTER_INTR_I2C_ACK))
+    {
+        i2c_dma_xfer.addrAcked = true;
+        Cy_SCB_SetMasterInterruptMask(base, Cy_SCB_GetMasterInterruptMask(base) & ~CY_SCB_MASTER_INTR_I2C_ACK);
+    }
+
+    if (0UL != (masterIntr & CY_SCB_MASTER_INTR_I2C_NACK))
+    {
+        /* Address or data not acknowledged by the slave: stop feeding and release the bus. */
+        Cy_DMA_Channel_Disable(i2c_dma_xfer.pDwBase, i2c_dma_xfer.dwChannel);
+        Cy_SCB_SetTxInterruptMask(base, 0U);
+        Cy_SCB_ClearTxFifo(base);
+        i2c_dma_xfer.failed = true;
+        SCB_I2C_M_CMD(base) = SCB_I2C_M_CMD_M_STOP_Msk;
+        return;
+    }
+
+    if (0UL != (masterIntr & CY_SCB_MASTER_INTR_I2C_STOP))
+    {
+        /* Only an address NACK is reported as such, like the driver does, anything else is an error. */
+        Cy_USB_I2CDmaComplete(base, ((i2c_dma_xfer.failed) && (!i2c_dma_xfer.addrAcked))
+                                    ? CY_SCB_MASTER_INTR_I2C_NACK : 0UL);
+        return;
+    }
+
+    if (0UL != (Cy_SCB_GetTxInterruptStatusMasked(base) & CY_SCB_TX_INTR_EMPTY))
+    {
+        Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_EMPTY);
+
+        /* The FIFO may briefly run dry while the channel is still busy; wait for the real end. */
+        if (dmaDone)
+        {
+            Cy_SCB_SetTxInterruptMask(base, 0U);
+            SCB_I2C_M_CMD(base) = SCB_I2C_M_CMD_M_STOP_Msk;
+        }
+    }
+
+    if (0UL != (Cy_SCB_GetRxInterruptStatusMasked(base) & CY_SCB_RX_INTR_FULL))
+    {
+        Cy_SCB_SetRxInterruptMask(base, 0U);
+        Cy_SCB_ClearRxInterrupt(base, CY_SCB_RX_INTR_FULL);
+
+        /* A full FIFO before the channel finished means the master NACKed too early. */
+        i2c_dma_xfer.failed = !dmaDone;
+
+        for (idx = 0U; idx < i2c_dma_xfer.tailSize; idx++)
+        {
+            i2c_dma_xfer.pTail[idx] = (uint8_t)Cy_SCB_ReadRxFifo(base);
+        }
+        SCB_I2C_M_CMD(base) = SCB_I2C_M_CMD_M_STOP_Msk;
+    }
+}
+
+/**
+ * \name Cy_USB_I2CDmaInit
+ * \brief Route the SCB0 FIFO triggers to the DataWire channels used for I2C transfers
+ * \retval None
+ */
+static void Cy_USB_I2CDmaInit(void)
+{
+    if ((appCtxt.pCpuDw0Base == NULL) || (appCtxt.pCpuDw1Base == NULL))
+    {
+        DBG_APP_ERR("I2C DMA: DataWire base not set in appCtxt\r\n");
+        return;
+    }
+
+    Cy_TrigMux_Connect(I2C_DMA_TX_TRIG_IN, I2C_DMA_TX_TRIG_OUT, false, TRIGGER_TYPE_LEVEL);
+    Cy_TrigMux_Connect(I2C_DMA_RX_TRIG_IN, I2C_DMA_RX_TRIG_OUT, false, TRIGGER_TYPE_LEVEL);
+
+    Cy_DMA_Enable(appCtxt.pCpuDw0Base);
+    Cy_DMA_Enable(appCtxt.pCpuDw1Base);
+}
+#endif /* I2C_DMA_EN */
+
+#if I2C_INTR_MODE_EN
+/**
+ * \name cyi2c_master_read_async
+ * \brief Start an interrupt driven I2C read. Completion is reported through Scb0i2cMasterEvent.
+ * \param base
+ * \param dev_addr
+ * \param data Buffer which must stay valid until the transfer completes
+ * \param size
+ * \param send_stop
+ * \retval status Exit code of starting the transfer
+ */
+cy_en_scb_i2c_status_t cyi2c_master_read_async(CySCB_Type *base, uint16_t dev_addr, uint8_t *data,
+                        uint16_t size, bool send_stop)
+{
+#if I2C_DMA_EN
+    /* The DataWire path needs more bytes than the RX FIFO holds to end the read on its own. */
+    if ((send_stop) && (appCtxt.pCpuDw1Base != NULL) && (size > Cy_SCB_GetFifoSize(base)))
+    {
+        return Cy_USB_I2CDmaStart(base, dev_addr, data, size, true);
+    }
+#endif /* I2C_DMA_EN */
+
+    I2C_TRACE_ADD((I2C_context.state == CY_SCB_I2C_IDLE) ? I2C_TRACE_EVT_START : I2C_TRACE_EVT_RESTART,
+                  dev_addr, true, 0, 0, NULL);
+
+    /* The driver generates a START, or a ReSTART when the previous transfer left the bus pending. */
+    i2c_async_read              = true;
+    i2c_async_combined          = false;
+    i2c_async_xfer.slaveAddress = (uint8_t)dev_addr;
+    i2c_async_xfer.buffer       = data;
+    i2c_async_xfer.bufferSize   = size;
+    i2c_async_xfer.xferPending  = !send_stop;
+
+    return Cy_SCB_I2C_MasterRead(base, &i2c_async_xfer, &I2C_context);
+}
+
+/**
+ * \name cyi2c_master_write_async
+ * \brief Start an interrupt driven I2C write. Completion is reported through Scb0i2cMasterEvent.
+ * \param base
+ * \param dev_addr
+ * \param data Buffer which must stay valid until the transfer completes
+ * \param size
+ * \param send_stop
+ * \retval status Exit code of starting the transfer
+ */
+cy_en_scb_i2c_status_t cyi2c_master_write_async(CySCB_Type *base, uint16_t dev_addr, const uint8_t *data,
+                                            uint16_t size, bool send_stop)
+{
+#if I2C_DMA_EN
+    if ((send_stop) && (appCtxt.pCpuDw0Base != NULL) && (size >= I2C_DMA_MIN_XFER_SIZE))
+    {
+        return Cy_USB_I2CDmaStart(base, dev_addr, (uint8_t *)data, size, false);
+    }
+#endif /* I2C_DMA_EN */
+
+    I2C_TRACE_ADD((I2C_context.state == CY_SCB_I2C_IDLE) ? I2C_TRACE_EVT_START : I2C_TRACE_EVT_RESTART,
+                  dev_addr, false, 0, 0, NULL);
+
+    i2c_async_read              = false;
+    i2c_async_combined          = false;
+    i2c_async_xfer.slaveAddress = (uint8_t)dev_addr;
+    i2c_async_xfer.buffer       = (uint8_t *)data;
+    i2c_async_xfer.bufferSize   = size;
+    i2c_async_xfer.xferPending  = !send_stop;
+
+    return Cy_SCB_I2C_MasterWrite(base, &i2c_async_xfer, &I2C_context);
+}
+
+/**
+ * \name cyi2c_master_write_read_async
+ * \brief Start an interrupt driven write followed by a read joined by a ReSTART. Only the
+ *        completion of the read phase, or the failure of either phase, is reported through
+ *        Scb0i2cMasterEvent.
+ * \param base
+ * \param dev_addr
+ * \param wr_data Buffer which must stay valid until the transfer completes
+ * \param wr_size
+ * \param rd_data Buffer which must stay valid until the transfer completes
+ * \param rd_size
+ * \retval status Exit code of starting the write phase
+ */
+cy_en_scb_i2c_status_t cyi2c_master_write_read_async(CySCB_Type *base, uint16_t dev_addr, const uint8_t *wr_data,
+                        uint16_t wr_size, uint8_t *rd_data, uint16_t rd_size)
+{
+    cy_en_scb_i2c_status_t status;
+
+    /* The phases are short register accesses, the DataWire path is not worth setting up here. */
+    status = cyi2c_master_write_async(base, dev_addr, wr_data, wr_size, false);
+    if (status == CY_SCB_I2C_SUCCESS)
+    {
+        i2c_async_combined = true;
+        i2c_async_rd_data  = rd_data;
+        i2c_async_rd_size  = rd_size;
     }
 
     return status;
 }
+#endif /* I2C_INTR_MODE_EN */
 
 /**
  * \name I2CMaster_ISR
- * \details Does some init for running rtos based auto reload software timer
- *          which periodically enables ITP interrupt for LDM exchange mechanism
+ * \details SCB0 interrupt handler. Drives the interrupt based transfer state machine of the
+ *          driver, which reports completion through Scb0i2cMasterEvent
  * \retval None
  */
 void I2CMaster_ISR(void)
 {
+#if I2C_DMA_EN
+    if (i2c_dma_xfer.active)
+    {
+        Cy_USB_I2CDmaInterrupt(SCB0);
+        return;
+    }
+#endif /* I2C_DMA_EN */
     Cy_SCB_I2C_Interrupt(SCB0, &I2C_context);
 }
 
 /**
  * \name ConfigureSCB0Clock
  * \brief Configure the I2C clock for SCB0 with divider #3
- * \retval None
+ * \param scbIndex
+ * \param clkFreq Highest SCB clock frequency acceptable to the caller
+ * \retval Frequency of the SCB clock actually configured
  */
-void ConfigureSCB0Clock(uint8_t scbIndex)
+uint32_t ConfigureSCB0Clock(uint8_t scbIndex, uint32_t clkFreq)
 {
     /* Get the PERI clock frequency for the platform. */
     uint32_t hfClkFreq = Cy_SysClk_ClkPeriGetFrequency();
 
-    /* Configure PERI 16 bit clock divider#3 for 3 MHz operation and enable it. */
-    switch (hfClkFreq)
-    {
-        case 50000000UL:
-            /* Divide 50 MHz by 16 to get 3 MHz. */
-            Cy_SysClk_PeriphSetDivider(CY_SYSCLK_DIV_16_BIT, 3, 15);
-            break;
-
-        case 60000000UL:
-            /* Divide 60 MHz by 20 to get 3 MHz. */
-            Cy_SysClk_PeriphSetDivider(CY_SYSCLK_DIV_16_BIT, 3, 19);
-            break;
-
-        case 75000000UL:
-            /* Divide 75 MHz by 25 to get 3 MHz. */
-            Cy_SysClk_PeriphSetDivider(CY_SYSCLK_DIV_16_BIT, 3, 24);
-            break;
+    /* Smallest divider which keeps the SCB clock at or below the requested frequency. */
+    uint32_t divider = (hfClkFreq + clkFreq - 1UL) / clkFreq;
 
-        case 100000000UL:
-            /* Divide 100 MHz by 33 to get 3 MHz. */
-            Cy_SysClk_PeriphSetDivider(CY_SYSCLK_DIV_16_BIT, 3, 32);
-            break;
-
-        default:
-            break;
+    if (divider == 0UL)
+    {
+        divider = 1UL;
     }
 
-    DBG_APP_INFO("scbIndex: %d, hfClkFreq: %d \n\r", 3, hfClkFreq);
+    /* Configure PERI 16 bit clock divider#3 and enable it. */
+    Cy_SysClk_PeriphDisableDivider(CY_SYSCLK_DIV_16_BIT, 3);
+    Cy_SysClk_PeriphSetDivider(CY_SYSCLK_DIV_16_BIT, 3, divider - 1UL);
+
+    DBG_APP_INFO("scbIndex: %d, hfClkFreq: %d, divider: %d \n\r", 3, hfClkFreq, divider);
 
     Cy_SysClk_PeriphEnableDivider (CY_SYSCLK_DIV_16_BIT, 3);
     Cy_SysLib_DelayUs (10);
 
     /* Connect the PERI clock to the SCB input. */
     Cy_SysClk_PeriphAssignDivider((en_clk_dst_t)(PCLK_SCB0_CLOCK + scbIndex), CY_SYSCLK_DIV_16_BIT, 3);
+
+    return (hfClkFreq / divider);
+}
+
+/**
+ * \name Cy_USB_I2CSetPinSpeed
+ * \brief Match the slew rate of the SCB0 pins (P10.0 and P10.1) to the I2C mode of a data rate. The pins
+ *        stay open drain driving low, the only I2C drive mode. Fast-mode Plus needs the fast slew rate
+ *        and full drive strength to sink its 20 mA within the shorter fall time, Standard and Fast-mode
+ *        use the slow slew rate which limits ringing on the bus.
+ * \param dataRate Data rate in Hz
+ * \retval None
+ */
+static void Cy_USB_I2CSetPinSpeed(uint32_t dataRate)
+{
+    uint32_t slewRate = (dataRate > CY_SCB_I2C_FST_DATA_RATE) ? CY_GPIO_SLEW_FAST : CY_GPIO_SLEW_SLOW;
+
+    Cy_GPIO_SetDriveSel(P10_0_PORT, P10_0_PIN, CY_GPIO_DRIVE_FULL);
+    Cy_GPIO_SetDriveSel(P10_1_PORT, P10_1_PIN, CY_GPIO_DRIVE_FULL);
+    Cy_GPIO_SetSlewRate(P10_0_PORT, P10_0_PIN, slewRate);
+    Cy_GPIO_SetSlewRate(P10_1_PORT, P10_1_PIN, slewRate);
+}
+
+/**
+ * \name Cy_USB_I2CSetDataRate
+ * \brief Change the SCB0 I2C data rate, re-clocking the block for the matching I2C mode
+ * \param base
+ * \param dataRate Requested data rate in Hz, capped at Fast-mode Plus
+ * \retval Achieved data rate in Hz, 0 if the bus is busy or the rate is not reachable
+ */
+uint32_t Cy_USB_I2CSetDataRate(CySCB_Type *base, uint32_t dataRate)
+{
+    uint32_t hfClkFreq = Cy_SysClk_ClkPeriGetFrequency();
+    uint32_t clkMin;
+    uint32_t clkMax;
+    uint32_t scbClock;
+    uint32_t achieved;
+
+    /* The SCB clock must fall in the window specified for the I2C mode. */
+    if (dataRate <= CY_SCB_I2C_STD_DATA_RATE)
+    {
+        clkMin = CY_SCB_I2C_MASTER_STD_CLK_MIN;
+        clkMax = CY_SCB_I2C_MASTER_STD_CLK_MAX;
+    }
+    else if (dataRate <= CY_SCB_I2C_FST_DATA_RATE)
+    {
+        clkMin = CY_SCB_I2C_MASTER_FST_CLK_MIN;
+        clkMax = CY_SCB_I2C_MASTER_FST_CLK_MAX;
+    }
+    else
+    {
+        if (dataRate > CY_SCB_I2C_FSTP_DATA_RATE)
+        {
+            dataRate = CY_SCB_I2C_FSTP_DATA_RATE;
+        }
+        clkMin = CY_SCB_I2C_MASTER_FSTP_CLK_MIN;
+        clkMax = CY_SCB_I2C_MASTER_FSTP_CLK_MAX;
+    }
+
+    /* Check the clock which the divider will produce before touching the block. */
+    scbClock = hfClkFreq / ((hfClkFreq + clkMax - 1UL) / clkMax);
+    if ((dataRate == 0UL) || (scbClock < clkMin))
+    {
+        return 0UL;
+    }
+
+    /* The block is re-clocked, so no transfer may be in progress. */
+    if (CY_SCB_I2C_IDLE != I2C_context.state)
+    {
+        return 0UL;
+    }
+#if I2C_DMA_EN
+    if (i2c_dma_xfer.active)
+    {
+        return 0UL;
+    }
+#endif /* I2C_DMA_EN */
+
+    Cy_SCB_I2C_Disable(base, &I2C_context);
+    scbClock = ConfigureSCB0Clock(0, clkMax);
+    achieved = Cy_SCB_I2C_SetDataRate(base, dataRate, scbClock);
+    if (0UL != achieved)
+    {
+        Cy_USB_I2CSetPinSpeed(achieved);
+    }
+    Cy_SCB_I2C_Enable(base);
+
+    DBG_APP_INFO("I2C dataClock: %d dataRate: %d\r\n", scbClock, achieved);
+    return achieved;
 }
 
 /**
@@ -201,19 +774,73 @@ void ConfigureSCB0Clock(uint8_t scbIndex)
  */
 void Scb0i2cMasterEvent(uint32_t Events)
 {
-    switch (Events)
-    {
-    case CY_SCB_I2C_MASTER_WR_IN_FIFO_EVENT:
-        break;
-    case CY_SCB_I2C_MASTER_WR_CMPLT_EVENT:
-        break;
-    case CY_SCB_I2C_MASTER_RD_CMPLT_EVENT:
-        break;
-    case CY_SCB_I2C_MASTER_ERR_EVENT:
-        break;
-    default:
-        break;
+#if I2C_INTR_MODE_EN
+    uint32_t masterStatus;
+
+    if (0UL != (Events & (CY_SCB_I2C_MASTER_ERR_EVENT | CY_SCB_I2C_MASTER_WR_CMPLT_EVENT |
+                          CY_SCB_I2C_MASTER_RD_CMPLT_EVENT)))
+    {
+        I2C_TRACE_ADD(I2C_TRACE_EVT_DATA, i2c_async_xfer.slaveAddress, i2c_async_read,
+                      Cy_SCB_I2C_MasterGetTransferCount(SCB0, &I2C_context),
+                      Cy_SCB_I2C_MasterGetStatus(SCB0, &I2C_context) & CY_SCB_I2C_MASTER_ERR,
+                      i2c_async_xfer.buffer);
+        if ((!i2c_async_xfer.xferPending) || (0UL != (Events & CY_SCB_I2C_MASTER_ERR_EVENT)))
+        {
+            I2C_TRACE_ADD(I2C_TRACE_EVT_STOP, i2c_async_xfer.slaveAddress, i2c_async_read, 0, 0, NULL);
+        }
+    }
+
+    /* The error event is reported together with the completion event of the failed transfer. */
+    if (0UL != (Events & CY_SCB_I2C_MASTER_ERR_EVENT))
+    {
+        masterStatus = Cy_SCB_I2C_MasterGetStatus(SCB0, &I2C_context);
+
+        if (0UL != (masterStatus & CY_SCB_I2C_MASTER_ARB_LOST))
+        {
+            i2c_master_arbitration_lost_callback();
+        }
+        else if (0UL != (masterStatus & CY_SCB_I2C_MASTER_ADDR_NAK))
+        {
+            /* The OPTIGA does not acknowledge its address while busy. */
+            i2c_master_nack_received_callback();
+        }
+        else
+        {
+            i2c_master_error_detected_callback();
+        }
+    }
+    else if ((0UL != (Events & CY_SCB_I2C_MASTER_WR_CMPLT_EVENT)) && (i2c_async_combined))
+    {
+        /* Write phase done with the bus still held: the driver continues with a ReSTART. The
+         * DataWire path always issues a START, so the read phase stays on the FIFO interrupts. */
+        I2C_TRACE_ADD(I2C_TRACE_EVT_RESTART, i2c_async_xfer.slaveAddress, true, 0, 0, NULL);
+        i2c_async_read             = true;
+        i2c_async_combined         = false;
+        i2c_async_xfer.buffer      = i2c_async_rd_data;
+        i2c_async_xfer.bufferSize  = i2c_async_rd_size;
+        i2c_async_xfer.xferPending = false;
+
+        if (CY_SCB_I2C_SUCCESS != Cy_SCB_I2C_MasterRead(SCB0, &i2c_async_xfer, &I2C_context))
+        {
+            Cy_SCB_I2C_MasterSendStop(SCB0, 0, &I2C_context);
+            i2c_master_error_detected_callback();
+        }
     }
+    else if (0UL != (Events & CY_SCB_I2C_MASTER_WR_CMPLT_EVENT))
+    {
+        i2c_master_end_of_transmit_callback();
+    }
+    else if (0UL != (Events & CY_SCB_I2C_MASTER_RD_CMPLT_EVENT))
+    {
+        i2c_master_end_of_receive_callback();
+    }
+    else
+    {
+        /* CY_SCB_I2C_MASTER_WR_IN_FIFO_EVENT: nothing to do until the transfer completes. */
+    }
+#else
+    (void)Events;
+#endif /* I2C_INTR_MODE_EN */
 }
 
 void Cy_USB_AppInitIntr(cy_israddress userIsr)
@@ -221,12 +848,12 @@ void Cy_USB_AppInitIntr(cy_israddress userIsr)
     cy_stc_sysint_t intrCfg;
 #if (!CY_CPU_CORTEX_M4)
     intrCfg.intrSrc = NvicMux3_IRQn;
-    intrCfg.intrPriority = 1;
+    intrCfg.intrPriority = I2C_INTR_PRIORITY;
     intrCfg.cm0pSrc = scb_0_interrupt_IRQn;
     Cy_SysInt_Init(&intrCfg, I2CMaster_ISR);
 #else
     intrCfg.intrSrc = (IRQn_Type) scb_0_interrupt_IRQn;
-    intrCfg.intrPriority = 1u;
+    intrCfg.intrPriority = I2C_INTR_PRIORITY;
     Cy_SysInt_Init(&intrCfg, I2CMaster_ISR);
 #endif /* (!CY_CPU_CORTEX_M4) */
 
@@ -258,7 +885,7 @@ void Cy_USB_I2CInit (void)
 
     Cy_SCB_I2C_DeInit(SCB0);
     Cy_USB_AppInitIntr(NULL);
-    ConfigureSCB0Clock(0);
+    dataClock = ConfigureSCB0Clock(0, I2C_INCLK_TARGET_FREQ);
     memset ((void *)&pinCfg, 0, sizeof(pinCfg));
     memset ((void *)&i2cCfg, 0, sizeof(i2cCfg));
 
@@ -281,8 +908,8 @@ void Cy_USB_I2CInit (void)
 
     Cy_SCB_I2C_Init (SCB0, &i2cCfg, &I2C_context);
     
-    dataClock = Cy_SysClk_PeriphGetFrequency(CY_SYSCLK_DIV_16_BIT, 3);
-    dataRate = Cy_SCB_I2C_SetDataRate(SCB0, I2C_DATARATE, I2C_INCLK_TARGET_FREQ);
+    dataRate = Cy_SCB_I2C_SetDataRate(SCB0, I2C_DATARATE, dataClock);
+    Cy_USB_I2CSetPinSpeed(dataRate);
 
     /* Register interrupt handler for SCB-I2C. */
     DBG_APP_INFO("I2C dataClock: %d\r\n", dataClock);
@@ -299,10 +926,50 @@ void Cy_USB_I2CInit (void)
     Cy_SCB_I2C_RegisterEventCallback(SCB0,(cy_cb_scb_i2c_handle_events_t) Scb0i2cMasterEvent,
                                     &I2C_context);  
 
+#if I2C_DMA_EN
+    Cy_USB_I2CDmaInit();
+#endif /* I2C_DMA_EN */
+
     Cy_USB_AppInitIntr(I2CMaster_ISR);                              
 
     Cy_SCB_I2C_Enable (SCB0);
 
 }
 
+/* Transfer functions driving SCB0, used by the OPTIGA PAL unless replaced. */
+static const cy_stc_i2c_transport_t scb0I2cTransport =
+{
+    .read           = cyi2c_master_read,
+    .write          = cyi2c_master_write,
+    .writeRead      = cyi2c_master_write_read,
+#if I2C_INTR_MODE_EN
+    .readAsync      = cyi2c_master_read_async,
+    .writeAsync     = cyi2c_master_write_async,
+    .writeReadAsync = cyi2c_master_write_read_async,
+#endif /* I2C_INTR_MODE_EN */
+};
+
+static const cy_stc_i2c_transport_t *pI2cTransport = &scb0I2cTransport;
+
+/**
+ * \name Cy_USB_I2CSetTransport
+ * \brief Select the transfer functions used by the OPTIGA PAL. Only call while no transfer is in progress.
+ * \param pTransport Table of transfer functions, NULL for the SCB0 functions
+ * \retval None
+ */
+void Cy_USB_I2CSetTransport(const cy_stc_i2c_transport_t *pTransport)
+{
+    pI2cTransport = (pTransport != NULL) ? pTransport : &scb0I2cTransport;
+}
+
+/**
+ * \name Cy_USB_I2CGetTransport
+ * \brief Transfer functions currently used by the OPTIGA PAL
+ * \retval Table of transfer functions, never NULL
+ */
+const cy_stc_i2c_transport_t *Cy_USB_I2CGetTransport(void)
+{
+    return pI2cTransport;
+}
+
 /* End of File */
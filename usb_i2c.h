@@ -42,8 +42,49 @@
 #define FPGA_I2C_ADDRESS_WIDTH         (2)
 #define FPGA_I2C_DATA_WIDTH            (1)
 #define I2C_BUFF_SIZE                  (10)
+/* Data rate after init. The OPTIGA PAL raises it at runtime through Cy_USB_I2CSetDataRate. */
 #define I2C_DATARATE                   (100000)
 #define I2C_INCLK_TARGET_FREQ          (3200000)
+
+/*
+ * SCB0 interrupt priority. The interrupt driven transfer mode hands transfer completion to
+ * the RTOS from the SCB0 event callback, so the interrupt must not be more urgent than
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY in that mode.
+ */
+#if I2C_INTR_MODE_EN
+#define I2C_INTR_PRIORITY              (3u)
+#else
+#define I2C_INTR_PRIORITY              (1u)
+#endif /* I2C_INTR_MODE_EN */
+
+#if I2C_DMA_EN
+#if !I2C_INTR_MODE_EN
+#error "I2C_DMA_EN requires I2C_INTR_MODE_EN"
+#endif /* !I2C_INTR_MODE_EN */
+
+/*
+ * DataWire channels feeding the SCB0 FIFOs: TX on DW0 and RX on DW1. Channels 0 to 15 of both
+ * blocks are left to the USB endpoints.
+ */
+#define I2C_DMA_TX_CHANNEL             (16u)
+#define I2C_DMA_RX_CHANNEL             (16u)
+
+/* Transfers shorter than this are left to the interrupt driven FIFO path. */
+#define I2C_DMA_MIN_XFER_SIZE          (32u)
+
+/* Maximum number of elements moved by one DataWire X loop. */
+#define I2C_DMA_MAX_XLOOP_COUNT        (256u)
+
+/*
+ * Trigger routes from the SCB0 TX/RX FIFO requests to the DataWire channel trigger inputs.
+ * These depend on the trigger multiplexer of the part and must be taken from the device header.
+ */
+#if !defined(I2C_DMA_TX_TRIG_IN) || !defined(I2C_DMA_TX_TRIG_OUT) || \
+    !defined(I2C_DMA_RX_TRIG_IN) || !defined(I2C_DMA_RX_TRIG_OUT)
+#error "Define the SCB0 to DataWire trigger routes I2C_DMA_TX_TRIG_IN/OUT and I2C_DMA_RX_TRIG_IN/OUT"
+#endif
+#endif /* I2C_DMA_EN */
+
 /* Get the LS byte from a 16-bit number */
 #define CY_GET_LSB(w)                              ((uint8_t)((w) & UINT8_MAX))
 
@@ -80,6 +121,36 @@ struct cy_stc_usb_app_ctxt_
 typedef struct cy_stc_usb_app_ctxt_ cy_stc_usb_app_ctxt_t;
 
 extern cy_stc_scb_i2c_context_t I2C_context;
+extern cy_stc_usb_app_ctxt_t appCtxt;
+
+/*
+ * Transfer functions the OPTIGA PAL reaches the bus through. The default table drives SCB0 with the
+ * cyi2c_master_* functions below. Another table, such as a model of the OPTIGA timing, can take its
+ * place so that the PAL and the application run without the device. Asynchronous functions report
+ * completion through the i2c_master_*_callback hooks of the PAL (pal_custom.h).
+ */
+typedef struct
+{
+    cy_en_scb_i2c_status_t (*read)(CySCB_Type *base, uint16_t dev_addr, uint8_t *data, uint16_t size,
+                                   bool send_stop);
+    cy_en_scb_i2c_status_t (*write)(CySCB_Type *base, uint16_t dev_addr, const uint8_t *data, uint16_t size,
+                                    bool send_stop);
+    cy_en_scb_i2c_status_t (*writeRead)(CySCB_Type *base, uint16_t dev_addr, const uint8_t *wr_data,
+                                        uint16_t wr_size, uint8_t *rd_data, uint16_t rd_size);
+#if I2C_INTR_MODE_EN
+    cy_en_scb_i2c_status_t (*readAsync)(CySCB_Type *base, uint16_t dev_addr, uint8_t *data, uint16_t size,
+                                        bool send_stop);
+    cy_en_scb_i2c_status_t (*writeAsync)(CySCB_Type *base, uint16_t dev_addr, const uint8_t *data,
+                                         uint16_t size, bool send_stop);
+    cy_en_scb_i2c_status_t (*writeReadAsync)(CySCB_Type *base, uint16_t dev_addr, const uint8_t *wr_data,
+                                             uint16_t wr_size, uint8_t *rd_data, uint16_t rd_size);
+#endif /* I2C_INTR_MODE_EN */
+} cy_stc_i2c_transport_t;
+
+/*
+ * SCB0 may be shared by several clients (OPTIGA PAL, FPGA register access). Every client must own
+ * the bus through Cy_USB_I2CBusAcquire (i2c_bus_mgr.h) while it calls the transfer functions below.
+ */
 
 /* Function prototypes */
 /**
@@ -89,6 +160,15 @@ extern cy_stc_scb_i2c_context_t I2C_context;
  */
 void Cy_USB_I2CInit (void);
 
+/**
+ * \name Cy_USB_I2CSetDataRate
+ * \brief Change the SCB0 I2C data rate, re-clocking the block for the matching I2C mode
+ * \param base
+ * \param dataRate Requested data rate in Hz, capped at Fast-mode Plus
+ * \retval Achieved data rate in Hz, 0 if the bus is busy or the rate is not reachable
+ */
+uint32_t Cy_USB_I2CSetDataRate(CySCB_Type *base, uint32_t dataRate);
+
 /**
  * \name Scb0i2cMasterEvent
  * \brief i2c master event callback function, handling various i2c master event
@@ -122,4 +202,77 @@ cy_en_scb_i2c_status_t cyi2c_master_read(CySCB_Type *base, uint16_t dev_addr, ui
 cy_en_scb_i2c_status_t cyi2c_master_write(CySCB_Type *base, uint16_t dev_addr, const uint8_t *data, 
     uint16_t size, bool send_stop);
 
+/**
+ * \name cyi2c_master_write_read
+ * \brief Write to the slave and read back its response in one transaction, joined by a ReSTART
+ * \param base
+ * \param dev_addr
+ * \param wr_data
+ * \param wr_size
+ * \param rd_data
+ * \param rd_size
+ * \retval status Exit code of the failing phase, or of the read phase
+ */
+cy_en_scb_i2c_status_t cyi2c_master_write_read(CySCB_Type *base, uint16_t dev_addr, const uint8_t *wr_data,
+    uint16_t wr_size, uint8_t *rd_data, uint16_t rd_size);
+
+#if I2C_INTR_MODE_EN
+/**
+ * \name cyi2c_master_read_async
+ * \brief Start an interrupt driven I2C read. Completion is reported through Scb0i2cMasterEvent.
+ * \param base
+ * \param dev_addr
+ * \param data Buffer which must stay valid until the transfer completes
+ * \param size
+ * \param send_stop
+ * \retval status Exit code of starting the transfer
+ */
+cy_en_scb_i2c_status_t cyi2c_master_read_async(CySCB_Type *base, uint16_t dev_addr, uint8_t *data,
+    uint16_t size, bool send_stop);
+
+/**
+ * \name cyi2c_master_write_async
+ * \brief Start an interrupt driven I2C write. Completion is reported through Scb0i2cMasterEvent.
+ * \param base
+ * \param dev_addr
+ * \param data Buffer which must stay valid until the transfer completes
+ * \param size
+ * \param send_stop
+ * \retval status Exit code of starting the transfer
+ */
+cy_en_scb_i2c_status_t cyi2c_master_write_async(CySCB_Type *base, uint16_t dev_addr, const uint8_t *data,
+    uint16_t size, bool send_stop);
+
+/**
+ * \name cyi2c_master_write_read_async
+ * \brief Start an interrupt driven write followed by a read joined by a ReSTART. Only the
+ *        completion of the read phase, or the failure of either phase, is reported through
+ *        Scb0i2cMasterEvent.
+ * \param base
+ * \param dev_addr
+ * \param wr_data Buffer which must stay valid until the transfer completes
+ * \param wr_size
+ * \param rd_data Buffer which must stay valid until the transfer completes
+ * \param rd_size
+ * \retval status Exit code of starting the write phase
+ */
+cy_en_scb_i2c_status_t cyi2c_master_write_read_async(CySCB_Type *base, uint16_t dev_addr, const uint8_t *wr_data,
+    uint16_t wr_size, uint8_t *rd_data, uint16_t rd_size);
+#endif /* I2C_INTR_MODE_EN */
+
+/**
+ * \name Cy_USB_I2CSetTransport
+ * \brief Select the transfer functions used by the OPTIGA PAL. Only call while no transfer is in progress.
+ * \param pTransport Table of transfer functions, NULL for the SCB0 functions
+ * \retval None
+ */
+void Cy_USB_I2CSetTransport(const cy_stc_i2c_transport_t *pTransport);
+
+/**
+ * \name Cy_USB_I2CGetTransport
+ * \brief Transfer functions currently used by the OPTIGA PAL
+ * \retval Table of transfer functions, never NULL
+ */
+const cy_stc_i2c_transport_t *Cy_USB_I2CGetTransport(void);
+
 #endif //End _CY_USB_i2C_H_